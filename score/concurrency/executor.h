@@ -128,6 +128,9 @@ class Executor
      * \param arguments The types to use when executing the callable
      * \return A std::future of the Callables return value, which will be set
      * once the callable finished its execution.
+     *
+     * \note The shared state of the returned TaskResult is allocated from the memory resource of this executor, so
+     * the TaskResult must not outlive that resource.
      */
     template <class CallableType, class... ArgumentTypes, typename = EnableIfIsCallable<CallableType, ArgumentTypes...>>
     auto Submit(CallableType&& callable, ArgumentTypes&&... arguments)
@@ -18,6 +18,7 @@
 #include "score/concurrency/future/interruptible_state.h"
 
 #include "score/expected.hpp"
+#include "score/memory_resource.hpp"
 
 #include <memory>
 
@@ -43,6 +44,17 @@ class BaseInterruptiblePromise
      */
     BaseInterruptiblePromise() : state_{InterruptibleState<Value>::Make()}, future_retrieved_{false} {}
 
+    /**
+     * Constructs a BaseInterruptiblePromise with an associated shared state, which is allocated from the given memory
+     * resource. Together with a pooling memory resource, this avoids the heap allocation of the shared state.
+     *
+     * \param memory_resource The memory resource used to allocate the shared state
+     */
+    explicit BaseInterruptiblePromise(score::cpp::pmr::memory_resource* memory_resource)
+        : state_{InterruptibleState<Value>::Make(memory_resource)}, future_retrieved_{false}
+    {
+    }
+
     /**
      * Constructs a BaseInterruptiblePromise with the shared state of another BaseInterruptiblePromise.
      *
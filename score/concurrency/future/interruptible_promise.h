@@ -33,6 +33,8 @@ template <typename Value>
 class InterruptiblePromise final : public detail::BaseInterruptiblePromise<Value>
 {
   public:
+    using detail::BaseInterruptiblePromise<Value>::BaseInterruptiblePromise;
+
     /**
      * Stores the value in the shared state and makes the state ready.
      *
@@ -94,6 +96,8 @@ template <typename Value>
 class InterruptiblePromise<Value&> final : public detail::BaseInterruptiblePromise<Value&>
 {
   public:
+    using detail::BaseInterruptiblePromise<Value&>::BaseInterruptiblePromise;
+
     /**
      * Stores the value in the shared state and makes the state ready.
      *
@@ -123,6 +127,8 @@ template <>
 class InterruptiblePromise<void> final : public detail::BaseInterruptiblePromise<void>
 {
   public:
+    using detail::BaseInterruptiblePromise<void>::BaseInterruptiblePromise;
+
     /**
      * Stores the value in the shared state and makes the state ready.
      *
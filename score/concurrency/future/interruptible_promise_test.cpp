@@ -15,10 +15,13 @@
 #include "score/concurrency/future/test_types.h"
 
 #include "score/expected.hpp"
+#include "score/memory_resource.hpp"
 #include "score/stop_token.hpp"
 
 #include "gtest/gtest.h"
 
+#include <array>
+#include <cstddef>
 #include <future>
 
 namespace score
@@ -146,6 +149,32 @@ TYPED_TEST(InterruptiblePromiseTest, CanDefaultConstruct)
     EXPECT_NO_FATAL_FAILURE(InterruptiblePromise<TypeParam> promise{});
 }
 
+TYPED_TEST(InterruptiblePromiseTest, AllocatesSharedStateFromGivenMemoryResource)
+{
+    // Given a memory resource, which fails as soon as its buffer is exhausted
+    std::array<std::byte, 4096U> buffer{};
+    score::cpp::pmr::monotonic_buffer_resource memory_resource{
+        buffer.data(), buffer.size(), score::cpp::pmr::null_memory_resource()};
+
+    // When constructing a promise with it
+    InterruptiblePromise<TypeParam> promise{&memory_resource};
+    auto expected_future = promise.GetInterruptibleFuture();
+    ASSERT_TRUE(expected_future.has_value());
+
+    // Then the shared state works as usual
+    ASSERT_TRUE(InterruptiblePromiseTest<TypeParam>::SetPromise(promise).has_value());
+    score::cpp::stop_token stop_token{};
+    InterruptiblePromiseTest<TypeParam>::ExpectCorrectValue(expected_future.value().Get(stop_token));
+}
+
+TYPED_TEST(InterruptiblePromiseTest, ConstructionFailsIfMemoryResourceIsExhausted)
+{
+    // Given a memory resource without any memory
+    // When constructing a promise with it
+    // Then the allocation failure is propagated
+    EXPECT_THROW(InterruptiblePromise<TypeParam>{score::cpp::pmr::null_memory_resource()}, std::bad_alloc);
+}
+
 TYPED_TEST(InterruptiblePromiseTest, CanNotCopyConstruct)
 {
     EXPECT_FALSE(std::is_copy_constructible<InterruptiblePromise<TypeParam>>::value);
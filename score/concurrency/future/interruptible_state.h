@@ -23,6 +23,8 @@
 
 #include "score/callback.hpp"
 #include "score/expected.hpp"
+#include "score/memory.hpp"
+#include "score/memory_resource.hpp"
 
 #include <atomic>
 #include <mutex>
@@ -37,6 +39,9 @@ namespace detail
 using TypedBaseInterruptibleState =
     score::concurrency::detail::BaseInterruptibleState<std::mutex, score::concurrency::InterruptibleConditionalVariable>;
 
+// The scope lives in the same memory resource as the shared state which owns it.
+using StateScope = safecpp::Scope<score::cpp::pmr::polymorphic_allocator<safecpp::details::ScopeState>>;
+
 template <class>
 struct IsScoped : std::false_type
 {
@@ -67,6 +72,19 @@ class InterruptibleState final : public score::concurrency::detail::TypedBaseInt
         return std::make_shared<InterruptibleState>();
     }
 
+    static std::shared_ptr<InterruptibleState> Make(score::cpp::pmr::memory_resource* memory_resource)
+    {
+        return score::cpp::pmr::make_shared<InterruptibleState>(memory_resource, memory_resource);
+    }
+
+    InterruptibleState() : InterruptibleState{score::cpp::pmr::get_default_resource()} {}
+
+    explicit InterruptibleState(score::cpp::pmr::memory_resource* memory_resource)
+        : score::concurrency::detail::TypedBaseInterruptibleState{},
+          scope_{score::cpp::pmr::polymorphic_allocator<safecpp::details::ScopeState>{memory_resource}}
+    {
+    }
+
     template <
         typename V = Value,
         std::enable_if_t<std::is_move_constructible<V>::value && !std::is_lvalue_reference<V>::value, bool> = true>
@@ -146,7 +164,7 @@ class InterruptibleState final : public score::concurrency::detail::TypedBaseInt
         }
     }
 
-    const safecpp::Scope<>& GetScope() const noexcept
+    const detail::StateScope& GetScope() const noexcept
     {
         return scope_;
     }
@@ -175,7 +193,7 @@ class InterruptibleState final : public score::concurrency::detail::TypedBaseInt
     score::Result<Value> value_{MakeUnexpected(Error::kUnset)};
 
     std::mutex continuation_callback_mutex_{};
-    safecpp::Scope<> scope_{};
+    detail::StateScope scope_;
     // intentional usage; may generate more instantiations, but is harmless
     // coverity[autosar_cpp14_a5_1_7_violation]
     std::vector<ScopedContinuationCallback> continuation_callbacks_{};
@@ -194,6 +212,19 @@ class InterruptibleState<Value&> final : public score::concurrency::detail::Type
         return std::make_shared<InterruptibleState>();
     }
 
+    static std::shared_ptr<InterruptibleState> Make(score::cpp::pmr::memory_resource* memory_resource)
+    {
+        return score::cpp::pmr::make_shared<InterruptibleState>(memory_resource, memory_resource);
+    }
+
+    InterruptibleState() : InterruptibleState{score::cpp::pmr::get_default_resource()} {}
+
+    explicit InterruptibleState(score::cpp::pmr::memory_resource* memory_resource)
+        : score::concurrency::detail::TypedBaseInterruptibleState{},
+          scope_{score::cpp::pmr::polymorphic_allocator<safecpp::details::ScopeState>{memory_resource}}
+    {
+    }
+
     bool SetValue(Value& value)
     {
         if ((this->TestAndMarkValueAsSet()) == true)
@@ -246,7 +277,7 @@ class InterruptibleState<Value&> final : public score::concurrency::detail::Type
         }
     }
 
-    const safecpp::Scope<>& GetScope() const noexcept
+    const detail::StateScope& GetScope() const noexcept
     {
         return scope_;
     }
@@ -275,7 +306,7 @@ class InterruptibleState<Value&> final : public score::concurrency::detail::Type
     score::Result<std::reference_wrapper<Value>> value_{MakeUnexpected(Error::kUnset)};
 
     std::mutex continuation_callback_mutex_{};
-    safecpp::Scope<> scope_{};
+    detail::StateScope scope_;
     std::vector<ScopedContinuationCallback> continuation_callbacks_{};
     bool triggered_{false};
 };
@@ -291,6 +322,19 @@ class InterruptibleState<void> final : public score::concurrency::detail::TypedB
         return std::make_shared<InterruptibleState>();
     }
 
+    static std::shared_ptr<InterruptibleState> Make(score::cpp::pmr::memory_resource* memory_resource)
+    {
+        return score::cpp::pmr::make_shared<InterruptibleState>(memory_resource, memory_resource);
+    }
+
+    InterruptibleState() : InterruptibleState{score::cpp::pmr::get_default_resource()} {}
+
+    explicit InterruptibleState(score::cpp::pmr::memory_resource* memory_resource)
+        : score::concurrency::detail::TypedBaseInterruptibleState{},
+          scope_{score::cpp::pmr::polymorphic_allocator<safecpp::details::ScopeState>{memory_resource}}
+    {
+    }
+
     bool SetValue();
 
     bool SetError(score::result::Error error);
@@ -306,7 +350,7 @@ class InterruptibleState<void> final : public score::concurrency::detail::TypedB
     score::Result<void> value_{};
 
     std::mutex continuation_callback_mutex_{};
-    safecpp::Scope<> scope_{};
+    detail::StateScope scope_;
     // intentional usage; may generate more instantiations, but is harmless
     // coverity[autosar_cpp14_a5_1_7_violation]
     std::vector<ScopedContinuationCallback> continuation_callbacks_{};
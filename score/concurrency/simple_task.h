@@ -22,6 +22,8 @@
 #include <score/memory_resource.hpp>
 #include <score/stop_token.hpp>
 
+#include <cstddef>
+#include <memory>
 #include <utility>
 
 namespace score
@@ -42,13 +44,14 @@ class SimpleTaskBase : public Task
 
   public:
     /**
-     * \brief Constructs a SimpleTask from any Callable.
+     * \brief Constructs the base of a SimpleTask.
      *
-     * \param promise The promise which shall be set once the task is finished
-     * \param callable The callable itself
-     * \param arguments The arguments
+     * \param memory_resource The memory resource from which the stop state of the task is allocated
      */
-    explicit SimpleTaskBase(ConstructionGuard) noexcept : Task(), stop_source_{} {}
+    SimpleTaskBase(ConstructionGuard, score::cpp::pmr::memory_resource* memory_resource)
+        : Task(), stop_source_{std::allocator_arg, score::cpp::pmr::polymorphic_allocator<std::byte>{memory_resource}}
+    {
+    }
 
     ~SimpleTaskBase() override = default;
 
@@ -97,9 +100,10 @@ class SimpleTask final : public detail::SimpleTaskBase
 
     template <class LocalCallableType, class... ArgumentTypes>
     SimpleTask(typename detail::SimpleTaskBase::ConstructionGuard construction_guard,
+               score::cpp::pmr::memory_resource* memory_resource,
                concurrency::InterruptiblePromise<ResultType>&& promise,
                LocalCallableType&& callable)
-        : detail::SimpleTaskBase(construction_guard),
+        : detail::SimpleTaskBase(construction_guard, memory_resource),
           callable_{std::forward<decltype(callable)>(callable)},
           promise_{std::forward<decltype(promise)>(promise)}
     {
@@ -136,9 +140,10 @@ class SimpleTask<CallableType, void> final : public detail::SimpleTaskBase
 
     template <class LocalCallableType>
     SimpleTask(detail::SimpleTaskBase::ConstructionGuard construction_guard,
+               score::cpp::pmr::memory_resource* memory_resource,
                concurrency::InterruptiblePromise<void>&& promise,
                LocalCallableType&& callable)
-        : detail::SimpleTaskBase(construction_guard),
+        : detail::SimpleTaskBase(construction_guard, memory_resource),
           callable_{std::forward<decltype(callable)>(callable)},
           promise_{std::move(promise)}
     {
@@ -171,6 +176,9 @@ class SimpleTaskFactory final
      *
      * \tparam CallableType The Callable type that shall be used
      * \tparam ArgumentTypes The argument types of the callable
+     * \param memory_resource The memory resource from which the task, its stop state and the shared state of its
+     * promise are allocated. Pass a TaskNodePool to avoid heap allocations. The resource must outlive the task and any
+     * future obtained from its promise.
      * \param callable The callable itself
      * \param arguments The arguments with what the callable shall be invoked
      * \return A SimpleTask constructed from the provided Callable
@@ -178,7 +186,7 @@ class SimpleTaskFactory final
     template <class CallableType, class... ArgumentTypes>
     static auto Make(score::cpp::pmr::memory_resource* memory_resource, CallableType&& callable, ArgumentTypes&&... arguments)
     {
-        concurrency::InterruptiblePromise<result_type<CallableType, ArgumentTypes...>> promise{};
+        concurrency::InterruptiblePromise<result_type<CallableType, ArgumentTypes...>> promise{memory_resource};
 
         return InternalMake(memory_resource,
                             std::move(promise),
@@ -191,6 +199,9 @@ class SimpleTaskFactory final
      *
      * \tparam CallableType The Callable type that shall be used
      * \tparam ArgumentTypes The argument types of the callable
+     * \param memory_resource The memory resource from which the task, its stop state and the shared state of its
+     * promise are allocated. Pass a TaskNodePool to avoid heap allocations. The shared state is released by whichever
+     * of the task and the TaskResult is destroyed last, so the resource must outlive both of them.
      * \param callable The callable itself
      * \param arguments The arguments with what the callable shall be invoked
      * \return A tuple of TaskResult and SimpleTask constructed from the provided Callable
@@ -200,7 +211,7 @@ class SimpleTaskFactory final
                                    CallableType&& callable,
                                    ArgumentTypes&&... arguments)
     {
-        concurrency::InterruptiblePromise<result_type<CallableType, ArgumentTypes...>> promise{};
+        concurrency::InterruptiblePromise<result_type<CallableType, ArgumentTypes...>> promise{memory_resource};
         auto future = promise.GetInterruptibleFuture().value();
 
         auto task = InternalMake(memory_resource,
@@ -246,6 +257,7 @@ class SimpleTaskFactory final
         using simple_task_type = SimpleTask<decltype(wrapped_callable), result_type<CallableType, ArgumentTypes...>>;
         auto task = score::cpp::pmr::make_unique<simple_task_type>(memory_resource,
                                                             typename simple_task_type::ConstructionGuard{},
+                                                            memory_resource,
                                                             std::forward<decltype(promise)>(promise),
                                                             std::forward<decltype(wrapped_callable)>(wrapped_callable));
 
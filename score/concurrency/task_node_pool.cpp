@@ -0,0 +1,147 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/task_node_pool.h"
+
+#include <score/assert.hpp>
+
+#include <functional>
+#include <limits>
+
+namespace
+{
+
+constexpr std::uint32_t kEndOfList{std::numeric_limits<std::uint32_t>::max()};
+constexpr std::uint64_t kIndexMask{0xFFFFFFFFU};
+constexpr std::uint64_t kCounterShift{32U};
+
+std::size_t RoundUpToNodeAlignment(const std::size_t size) noexcept
+{
+    constexpr auto alignment = score::concurrency::TaskNodePool::kNodeAlignment;
+    return ((size + alignment) - 1U) / alignment * alignment;
+}
+
+std::uint64_t MakeHead(const std::uint64_t previous_head, const std::uint32_t node_index) noexcept
+{
+    const std::uint64_t counter{(previous_head >> kCounterShift) + 1U};
+    return (counter << kCounterShift) | static_cast<std::uint64_t>(node_index);
+}
+
+}  // namespace
+
+score::concurrency::TaskNodePool::TaskNodePool(const std::size_t number_of_nodes,
+                                               const std::size_t node_size,
+                                               score::cpp::pmr::memory_resource* upstream)
+    : score::cpp::pmr::memory_resource{},
+      upstream_{upstream},
+      node_size_{RoundUpToNodeAlignment(node_size)},
+      number_of_nodes_{number_of_nodes},
+      nodes_{nullptr},
+      next_free_node_{number_of_nodes, upstream},
+      free_list_head_{kEndOfList}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(upstream_ != nullptr);
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(node_size_ > 0U);
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(number_of_nodes_ < kEndOfList);
+    nodes_ = static_cast<std::byte*>(upstream_->allocate(node_size_ * number_of_nodes_, kNodeAlignment));
+
+    // Link all nodes in ascending order
+    for (std::size_t index{0U}; index < number_of_nodes_; ++index)
+    {
+        const auto next = index + 1U;
+        next_free_node_[index].store((next < number_of_nodes_) ? static_cast<std::uint32_t>(next) : kEndOfList,
+                                     std::memory_order_relaxed);
+    }
+    free_list_head_.store((number_of_nodes_ > 0U) ? 0U : kEndOfList, std::memory_order_release);
+}
+
+score::concurrency::TaskNodePool::~TaskNodePool() noexcept
+{
+    upstream_->deallocate(nodes_, node_size_ * number_of_nodes_, kNodeAlignment);
+}
+
+std::size_t score::concurrency::TaskNodePool::NodeSize() const noexcept
+{
+    return node_size_;
+}
+
+std::size_t score::concurrency::TaskNodePool::NumberOfNodes() const noexcept
+{
+    return number_of_nodes_;
+}
+
+void* score::concurrency::TaskNodePool::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    std::uint32_t node_index{kEndOfList};
+    if ((bytes <= node_size_) && (alignment <= kNodeAlignment) && PopFreeNode(node_index))
+    {
+        return nodes_ + (static_cast<std::size_t>(node_index) * node_size_);
+    }
+    return upstream_->allocate(bytes, alignment);
+}
+
+void score::concurrency::TaskNodePool::do_deallocate(void* const pointer,
+                                                     const std::size_t bytes,
+                                                     const std::size_t alignment)
+{
+    if (IsNode(pointer))
+    {
+        const auto offset = static_cast<std::size_t>(static_cast<std::byte*>(pointer) - nodes_);
+        PushFreeNode(static_cast<std::uint32_t>(offset / node_size_));
+    }
+    else
+    {
+        upstream_->deallocate(pointer, bytes, alignment);
+    }
+}
+
+bool score::concurrency::TaskNodePool::do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+bool score::concurrency::TaskNodePool::PopFreeNode(std::uint32_t& node_index) noexcept
+{
+    std::uint64_t head{free_list_head_.load(std::memory_order_acquire)};
+    while (static_cast<std::uint32_t>(head & kIndexMask) != kEndOfList)
+    {
+        const auto first = static_cast<std::uint32_t>(head & kIndexMask);
+        // If another thread pops `first` meanwhile, the value read here is outdated, but then the counter of the head
+        // changed as well and the exchange below fails.
+        const auto next = next_free_node_[first].load(std::memory_order_relaxed);
+        if (free_list_head_.compare_exchange_weak(
+                head, MakeHead(head, next), std::memory_order_acquire, std::memory_order_acquire))
+        {
+            node_index = first;
+            return true;
+        }
+    }
+    return false;
+}
+
+void score::concurrency::TaskNodePool::PushFreeNode(const std::uint32_t node_index) noexcept
+{
+    std::uint64_t head{free_list_head_.load(std::memory_order_relaxed)};
+    do
+    {
+        next_free_node_[node_index].store(static_cast<std::uint32_t>(head & kIndexMask), std::memory_order_relaxed);
+    } while (!free_list_head_.compare_exchange_weak(
+        head, MakeHead(head, node_index), std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool score::concurrency::TaskNodePool::IsNode(const void* const pointer) const noexcept
+{
+    const auto* const byte_pointer = static_cast<const std::byte*>(pointer);
+    const std::less_equal<const std::byte*> less_equal{};
+    const std::less<const std::byte*> less{};
+    return less_equal(nodes_, byte_pointer) && less(byte_pointer, nodes_ + (node_size_ * number_of_nodes_));
+}
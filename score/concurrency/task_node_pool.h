@@ -0,0 +1,96 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_TASK_NODE_POOL_H
+#define SCORE_LIB_CONCURRENCY_TASK_NODE_POOL_H
+
+#include <score/memory_resource.hpp>
+#include <score/vector.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace concurrency
+{
+
+/**
+ * \brief TaskNodePool is a thread-safe memory resource which hands out fixed-size nodes from a buffer that is
+ * allocated once upon construction.
+ *
+ * It is meant to be passed to an Executor (e.g. ThreadPool), so that posting and submitting tasks does not touch the
+ * heap in steady state: A SimpleTask stores its callable inline and is placed into one node, its stop state and the
+ * shared state of its promise occupy one node each, and so do the blocks of the task queue of the executor.
+ *
+ * Freed nodes are recycled through a lock-free free-list. Requests which are larger than a node, which need a
+ * stricter alignment or which arrive while all nodes are in use are forwarded to the upstream resource.
+ *
+ * The pool must be destroyed after the executor using it and after every TaskResult submitted to that executor, since
+ * a TaskResult releases the shared state of its task into the pool.
+ */
+class TaskNodePool final : public score::cpp::pmr::memory_resource
+{
+  public:
+    /// \brief Default size of a node, large enough for the queue blocks of the executors and typical tasks.
+    static constexpr std::size_t kDefaultNodeSize{512U};
+
+    /// \brief Alignment of each node.
+    static constexpr std::size_t kNodeAlignment{alignof(std::max_align_t)};
+
+    /**
+     * \brief Creates a pool and allocates all of its nodes from the upstream resource.
+     *
+     * \param number_of_nodes The number of nodes which are handed out without falling back to upstream
+     * \param node_size The size of each node, rounded up to a multiple of kNodeAlignment
+     * \param upstream The resource for the nodes and for all requests which can not be served by a node
+     */
+    explicit TaskNodePool(const std::size_t number_of_nodes,
+                          const std::size_t node_size = kDefaultNodeSize,
+                          score::cpp::pmr::memory_resource* upstream = score::cpp::pmr::get_default_resource());
+
+    ~TaskNodePool() noexcept override;
+
+    TaskNodePool(const TaskNodePool&) = delete;
+    TaskNodePool(TaskNodePool&&) noexcept = delete;
+    TaskNodePool& operator=(const TaskNodePool&) = delete;
+    TaskNodePool& operator=(TaskNodePool&&) noexcept = delete;
+
+    std::size_t NodeSize() const noexcept;
+    std::size_t NumberOfNodes() const noexcept;
+
+  private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+    void do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment) override;
+    bool do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept override;
+
+    bool PopFreeNode(std::uint32_t& node_index) noexcept;
+    void PushFreeNode(const std::uint32_t node_index) noexcept;
+    bool IsNode(const void* const pointer) const noexcept;
+
+    score::cpp::pmr::memory_resource* upstream_;
+    std::size_t node_size_;
+    std::size_t number_of_nodes_;
+    std::byte* nodes_;
+    // The free-list is kept apart from the nodes, so that popping a node never reads memory which another thread
+    // already got handed out.
+    score::cpp::pmr::vector<std::atomic<std::uint32_t>> next_free_node_;
+    // Index of the first free node in the lower half, a counter which is incremented on every change in the upper
+    // half. The counter prevents the ABA problem of the lock-free list.
+    std::atomic<std::uint64_t> free_list_head_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_TASK_NODE_POOL_H
@@ -0,0 +1,308 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/task_node_pool.h"
+#include "score/concurrency/notification.h"
+#include "score/concurrency/thread_pool.h"
+
+#include "score/memory_resource.hpp"
+#include "score/utility.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+// Counts the requests and forwards them to upstream, to tell how an executor or pool uses its resource.
+class CountingMemoryResource : public score::cpp::pmr::memory_resource
+{
+  public:
+    explicit CountingMemoryResource(
+        score::cpp::pmr::memory_resource* upstream = score::cpp::pmr::new_delete_resource()) noexcept
+        : upstream_{upstream}
+    {
+    }
+
+    std::atomic<std::size_t> number_of_allocations{0U};
+    std::atomic<std::size_t> number_of_deallocations{0U};
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        number_of_allocations++;
+        return upstream_->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        number_of_deallocations++;
+        upstream_->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    score::cpp::pmr::memory_resource* upstream_;
+};
+
+TEST(TaskNodePool, AllocatesAllNodesUponConstruction)
+{
+    // Given an upstream resource
+    CountingMemoryResource upstream{};
+
+    // When creating a pool with it
+    TaskNodePool unit{16U, 100U, &upstream};
+
+    // Then the nodes are allocated at once and the node size is rounded up to the node alignment
+    EXPECT_EQ(upstream.number_of_allocations, 2U);
+    EXPECT_EQ(unit.NumberOfNodes(), 16U);
+    EXPECT_EQ(unit.NodeSize() % TaskNodePool::kNodeAlignment, 0U);
+    EXPECT_GE(unit.NodeSize(), 100U);
+}
+
+TEST(TaskNodePool, ServesFittingRequestsWithoutUpstream)
+{
+    // Given a pool with two nodes
+    CountingMemoryResource upstream{};
+    TaskNodePool unit{2U, 64U, &upstream};
+    const std::size_t allocations_upon_construction{upstream.number_of_allocations};
+
+    // When allocating two fitting blocks
+    void* const first = unit.allocate(64U, alignof(std::max_align_t));
+    void* const second = unit.allocate(1U, 1U);
+
+    // Then both are distinct nodes of the pool
+    EXPECT_NE(first, second);
+    EXPECT_EQ(upstream.number_of_allocations, allocations_upon_construction);
+
+    unit.deallocate(first, 64U, alignof(std::max_align_t));
+    unit.deallocate(second, 1U, 1U);
+    EXPECT_EQ(upstream.number_of_deallocations, 0U);
+}
+
+TEST(TaskNodePool, RecyclesFreedNodes)
+{
+    // Given a pool with a single node, which got allocated and freed
+    TaskNodePool unit{1U, 64U};
+    void* const first = unit.allocate(32U, 8U);
+    unit.deallocate(first, 32U, 8U);
+
+    // When allocating again
+    void* const second = unit.allocate(48U, 8U);
+
+    // Then the same node is handed out
+    EXPECT_EQ(first, second);
+    unit.deallocate(second, 48U, 8U);
+}
+
+TEST(TaskNodePool, ForwardsRequestsWhichDoNotFitIntoNodeToUpstream)
+{
+    // Given a pool with 64 byte nodes
+    CountingMemoryResource upstream{};
+    TaskNodePool unit{4U, 64U, &upstream};
+    const std::size_t allocations_upon_construction{upstream.number_of_allocations};
+
+    // When allocating a larger block and an over-aligned one
+    void* const large = unit.allocate(65U, 8U);
+    void* const over_aligned = unit.allocate(8U, TaskNodePool::kNodeAlignment * 2U);
+
+    // Then both are served by upstream and also returned to it
+    EXPECT_EQ(upstream.number_of_allocations, allocations_upon_construction + 2U);
+    unit.deallocate(large, 65U, 8U);
+    unit.deallocate(over_aligned, 8U, TaskNodePool::kNodeAlignment * 2U);
+    EXPECT_EQ(upstream.number_of_deallocations, 2U);
+}
+
+TEST(TaskNodePool, FallsBackToUpstreamIfAllNodesAreInUse)
+{
+    // Given a pool whose only node is in use
+    CountingMemoryResource upstream{};
+    TaskNodePool unit{1U, 64U, &upstream};
+    const std::size_t allocations_upon_construction{upstream.number_of_allocations};
+    void* const node = unit.allocate(64U, 8U);
+
+    // When allocating another fitting block
+    void* const fallback = unit.allocate(64U, 8U);
+
+    // Then it is served by upstream, and each block is returned to where it came from
+    EXPECT_EQ(upstream.number_of_allocations, allocations_upon_construction + 1U);
+    unit.deallocate(fallback, 64U, 8U);
+    EXPECT_EQ(upstream.number_of_deallocations, 1U);
+    unit.deallocate(node, 64U, 8U);
+    EXPECT_EQ(upstream.number_of_deallocations, 1U);
+}
+
+TEST(TaskNodePool, IsOnlyEqualToItself)
+{
+    TaskNodePool unit{1U};
+    TaskNodePool other{1U};
+
+    EXPECT_TRUE(unit.is_equal(unit));
+    EXPECT_FALSE(unit.is_equal(other));
+}
+
+TEST(TaskNodePool, NeverHandsOutTheSameNodeConcurrently)
+{
+    // Given a pool with less nodes than the threads below request in total
+    constexpr std::size_t kNumberOfThreads{4U};
+    constexpr std::size_t kNodesPerThread{8U};
+    constexpr std::size_t kRounds{2000U};
+    TaskNodePool unit{kNumberOfThreads * kNodesPerThread / 2U, 64U};
+    std::atomic<bool> overlap_detected{false};
+
+    // When several threads allocate, fill and free nodes concurrently
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([&unit, &overlap_detected, thread_index]() {
+            std::vector<std::uintptr_t*> nodes(kNodesPerThread);
+            for (std::size_t round = 0U; round < kRounds; ++round)
+            {
+                for (auto& node : nodes)
+                {
+                    node = static_cast<std::uintptr_t*>(unit.allocate(64U, 8U));
+                    *node = thread_index;
+                }
+                std::this_thread::yield();
+                for (auto* const node : nodes)
+                {
+                    if (*node != thread_index)
+                    {
+                        overlap_detected = true;
+                    }
+                    unit.deallocate(node, 64U, 8U);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then no node was used by two threads at the same time
+    EXPECT_FALSE(overlap_detected);
+
+    // And all nodes are free again
+    std::set<void*> nodes{};
+    for (std::size_t index = 0U; index < unit.NumberOfNodes(); ++index)
+    {
+        nodes.insert(unit.allocate(64U, 8U));
+    }
+    EXPECT_EQ(nodes.size(), unit.NumberOfNodes());
+    for (auto* const node : nodes)
+    {
+        unit.deallocate(node, 64U, 8U);
+    }
+}
+
+class TaskNodePoolWithThreadPool : public ::testing::Test
+{
+  protected:
+    static constexpr std::size_t kNumberOfTasks{1000U};
+
+    // Blocks the worker threads while posting, so that the task queue reaches the same depth on every call
+    void PostAndWait(const std::size_t number_of_tasks)
+    {
+        Notification release_workers{};
+        for (std::size_t index = 0U; index < executor_.MaxConcurrencyLevel(); ++index)
+        {
+            executor_.Post([&release_workers](const score::cpp::stop_token& token) noexcept {
+                score::cpp::ignore = release_workers.waitWithAbort(token);
+            });
+        }
+        std::atomic<std::size_t> executed{0U};
+        Notification all_executed{};
+        for (std::size_t index = 0U; index < number_of_tasks; ++index)
+        {
+            executor_.Post([&executed, &all_executed, number_of_tasks](const score::cpp::stop_token&) noexcept {
+                if (++executed == number_of_tasks)
+                {
+                    all_executed.notify();
+                }
+            });
+        }
+        release_workers.notify();
+        ASSERT_TRUE(all_executed.waitWithAbort({}));
+    }
+
+    void WarmUp()
+    {
+        // Let the task queue of the executor grow well beyond the depth it needs below, so it never reallocates again
+        PostAndWait(4U * kNumberOfTasks);
+        for (std::size_t index = 0U; index < kNumberOfTasks; ++index)
+        {
+            auto result = executor_.Submit([](const score::cpp::stop_token&) noexcept {});
+            ASSERT_TRUE(result.Wait().has_value());
+        }
+    }
+
+    CountingMemoryResource upstream_{};
+    // Each queued task occupies four nodes: the task, its stop state, the shared state and the scope of the latter
+    TaskNodePool pool_{5U * kNumberOfTasks, TaskNodePool::kDefaultNodeSize, &upstream_};
+    // Sees every request of the executor, which proves that the executor allocates through its resource at all
+    CountingMemoryResource executor_resource_{&pool_};
+    ThreadPool executor_{2U, &executor_resource_};
+};
+
+TEST_F(TaskNodePoolWithThreadPool, PostDoesNotAllocateInSteadyState)
+{
+    // Given a ThreadPool which allocates from a TaskNodePool and which already executed some tasks
+    WarmUp();
+    const std::size_t executor_allocations{executor_resource_.number_of_allocations};
+    const std::size_t upstream_allocations{upstream_.number_of_allocations};
+
+    // When posting tasks
+    PostAndWait(kNumberOfTasks);
+
+    // Then each task is allocated from the resource of the executor, and all of them are served by the pool
+    EXPECT_GE(executor_resource_.number_of_allocations, executor_allocations + kNumberOfTasks);
+    EXPECT_EQ(upstream_.number_of_allocations, upstream_allocations);
+}
+
+TEST_F(TaskNodePoolWithThreadPool, SubmitDoesNotAllocateInSteadyState)
+{
+    // Given a ThreadPool which allocates from a TaskNodePool and which already executed some tasks
+    WarmUp();
+    const std::size_t executor_allocations{executor_resource_.number_of_allocations};
+    const std::size_t upstream_allocations{upstream_.number_of_allocations};
+
+    // When submitting tasks and waiting for their results
+    for (std::size_t index = 0U; index < kNumberOfTasks; ++index)
+    {
+        auto result = executor_.Submit([index](const score::cpp::stop_token&) noexcept {
+            return index;
+        });
+        const auto value = result.Get();
+        ASSERT_TRUE(value.has_value());
+        ASSERT_EQ(value.value(), index);
+    }
+
+    // Then the task and its shared state are allocated from the resource of the executor, and served by the pool
+    EXPECT_GE(executor_resource_.number_of_allocations, executor_allocations + (2U * kNumberOfTasks));
+    EXPECT_EQ(upstream_.number_of_allocations, upstream_allocations);
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
@@ -170,7 +170,8 @@ class TaskResult : public TaskResultBase
     // intentional usage; may generate more instantiations, but is harmless
     // coverity[autosar_cpp14_a5_1_7_violation]
     concurrency::InterruptibleFuture<T> future_;
-    score::cpp::stop_source dummy_stop_source_;
+    // Without stop state, so that waiting for the result never allocates.
+    score::cpp::stop_source dummy_stop_source_{score::cpp::nostopstate};
 };
 
 }  // namespace concurrency
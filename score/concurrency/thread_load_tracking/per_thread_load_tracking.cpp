@@ -0,0 +1,138 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking.h"
+
+#include "score/assert.hpp"
+
+#include <utility>
+
+namespace score
+{
+namespace concurrency
+{
+
+namespace
+{
+
+template <typename T>
+void AddByOwner(std::atomic<T>& counter, const T value) noexcept
+{
+    // There is only one writer, so there is no need for an atomic read-modify-write operation.
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+WorkLoad MakeWorkLoad(const PerThreadLoadTracking::TrackingResolution work_duration,
+                      const PerThreadLoadTracking::TrackingResolution wait_duration) noexcept
+{
+    // coverity[autosar_cpp14_m8_5_2_violation] kept for the sake of zero-initialization
+    WorkLoad result{};
+
+    const auto work_fp = work_duration.count();
+    const auto wait_fp = wait_duration.count();
+    const auto work_and_wait_duration = work_fp + wait_fp;
+
+    if (work_and_wait_duration != 0)
+    {
+        result.work_load_percent = 100.0 * static_cast<double>(work_fp) / static_cast<double>(work_and_wait_duration);
+    }
+
+    result.work_duration = work_duration;
+    result.wait_duration = wait_duration;
+    return result;
+}
+
+}  // namespace
+
+PerThreadLoadTracking::PerThreadLoadTracking(const std::size_t number_of_threads, GetTimePointFunction get_time_now)
+    : counters_(number_of_threads),
+      calculate_mutex_{},
+      snapshots_(number_of_threads),
+      get_time_now_{std::move(get_time_now)}
+{
+}
+
+PerThreadLoadTrackingToken PerThreadLoadTracking::StartWorking(const std::size_t thread_index) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(thread_index < counters_.size());
+    return {*this, thread_index, ThreadLoadTrackingState::kWorking};
+}
+
+PerThreadLoadTrackingToken PerThreadLoadTracking::StartWaiting(const std::size_t thread_index) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(thread_index < counters_.size());
+    return {*this, thread_index, ThreadLoadTrackingState::kWaiting};
+}
+
+std::size_t PerThreadLoadTracking::NumberOfThreads() const noexcept
+{
+    return counters_.size();
+}
+
+void PerThreadLoadTracking::OnTokenEnd(const std::size_t thread_index,
+                                       const TrackingResolution& duration,
+                                       const ThreadLoadTrackingState& state) noexcept
+{
+    auto& counters = counters_[thread_index];
+    if (state == ThreadLoadTrackingState::kWorking)
+    {
+        AddByOwner(counters.work_duration, duration.count());
+        const auto bucket_index = WorkDurationHistogram::BucketIndex(duration);
+        AddByOwner(counters.work_duration_histogram[bucket_index], std::uint64_t{1U});
+    }
+    else
+    {
+        AddByOwner(counters.wait_duration, duration.count());
+    }
+}
+
+PerThreadWorkLoad PerThreadLoadTracking::Calculate()
+{
+    std::lock_guard<std::mutex> lock{calculate_mutex_};
+
+    PerThreadWorkLoad result{};
+    result.threads.resize(counters_.size());
+    TrackingResolution total_work_duration{};
+    TrackingResolution total_wait_duration{};
+
+    for (std::size_t thread_index{0U}; thread_index < counters_.size(); ++thread_index)
+    {
+        const auto& counters = counters_[thread_index];
+        auto& snapshot = snapshots_[thread_index];
+        auto& thread_work_load = result.threads[thread_index];
+
+        const auto work_duration = counters.work_duration.load(std::memory_order_relaxed);
+        const auto wait_duration = counters.wait_duration.load(std::memory_order_relaxed);
+        const TrackingResolution work_duration_delta{work_duration - snapshot.work_duration};
+        const TrackingResolution wait_duration_delta{wait_duration - snapshot.wait_duration};
+        snapshot.work_duration = work_duration;
+        snapshot.wait_duration = wait_duration;
+
+        for (std::size_t bucket_index{0U}; bucket_index < WorkDurationHistogram::kNumberOfBuckets; ++bucket_index)
+        {
+            const auto count = counters.work_duration_histogram[bucket_index].load(std::memory_order_relaxed);
+            auto& snapshot_count = snapshot.work_duration_histogram.bucket_counts[bucket_index];
+            thread_work_load.work_duration_histogram.bucket_counts[bucket_index] = count - snapshot_count;
+            snapshot_count = count;
+        }
+
+        thread_work_load.work_load = MakeWorkLoad(work_duration_delta, wait_duration_delta);
+        total_work_duration += work_duration_delta;
+        total_wait_duration += wait_duration_delta;
+    }
+
+    result.total = MakeWorkLoad(total_work_duration, total_wait_duration);
+    return result;
+}
+
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,138 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_H
+#define SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_H
+
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking_token.h"
+#include "score/concurrency/thread_load_tracking/work_duration_histogram.h"
+#include "score/concurrency/thread_load_tracking/work_load.h"
+
+#include "score/callback.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+
+/// \brief The work load of one thread together with the distribution of its work durations.
+struct ThreadWorkLoad
+{
+    /// \brief Work and wait duration of the thread in the observed time frame.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    WorkLoad work_load{};
+
+    /// \brief Durations of the individual work tokens of the thread in the observed time frame.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    WorkDurationHistogram work_duration_histogram{};
+};
+
+/// \brief Result of PerThreadLoadTracking::Calculate().
+struct PerThreadWorkLoad
+{
+    /// \brief Work load aggregated over all threads, comparable to ThreadLoadTracking::Calculate().
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    WorkLoad total{};
+
+    /// \brief Work load of the individual threads, indexed by their thread index.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::vector<ThreadWorkLoad> threads{};
+};
+
+/// \brief Tracks the work load of a fixed set of threads, e.g. the workers of an executor, without any contention
+/// between them.
+/// \details In contrast to ThreadLoadTracking, ending a token does not take a lock. Every thread accumulates into its
+/// own cache line aligned counters, which are only read by Calculate(). Besides the work and wait duration, the
+/// duration of every work token is recorded in a histogram, which shows the tail latency of the individual threads.
+///
+/// Each thread identifies itself by its index in [0, number_of_threads). Tokens of one thread index must not end
+/// concurrently, i.e. an index shall be used by one thread at a time.
+/// \note Calculate() may be called concurrently to the tracking. The time point function gets called by all tracked
+/// threads and thus has to be thread safe.
+class PerThreadLoadTracking
+{
+    // Suppres "AUTOSAR C++14 A11-3-1" rule finding: "Friend declarations shall not be used.".
+    // Encapsultes the need to call "get_time_now_()" before creating and ending of "PerThreadLoadTrackingToken" to
+    // measure the processing duration.
+    // coverity[autosar_cpp14_a11_3_1_violation]
+    friend PerThreadLoadTrackingToken;
+
+  public:
+    using TrackingResolution = std::chrono::steady_clock::duration;
+
+    // Allow the injection of the now function for unit testing.
+    using GetTimePointFunction = score::cpp::callback<std::chrono::steady_clock::time_point(void)>;
+
+    explicit PerThreadLoadTracking(const std::size_t number_of_threads,
+                                   GetTimePointFunction get_time_now = &std::chrono::steady_clock::now);
+
+    ~PerThreadLoadTracking() = default;
+
+    // Class must not be moved or copied because the token stores a reference to the tracking instance.
+    PerThreadLoadTracking(const PerThreadLoadTracking&) = delete;
+    PerThreadLoadTracking(PerThreadLoadTracking&&) = delete;
+    PerThreadLoadTracking& operator=(const PerThreadLoadTracking&) = delete;
+    PerThreadLoadTracking& operator=(PerThreadLoadTracking&&) = delete;
+
+    /// \brief Returns a token to track working time of the thread with the given index.
+    PerThreadLoadTrackingToken StartWorking(const std::size_t thread_index) noexcept;
+
+    /// \brief Returns a token to track waiting time of the thread with the given index.
+    PerThreadLoadTrackingToken StartWaiting(const std::size_t thread_index) noexcept;
+
+    /// \brief Calculates the work load of every thread and in total since the last call.
+    PerThreadWorkLoad Calculate();
+
+    std::size_t NumberOfThreads() const noexcept;
+
+  private:
+    using Rep = TrackingResolution::rep;
+
+    // Only written by the tracked thread, thus a plain load and store is sufficient for every update.
+    struct alignas(64) Counters
+    {
+        std::atomic<Rep> work_duration{0};
+        std::atomic<Rep> wait_duration{0};
+        std::array<std::atomic<std::uint64_t>, WorkDurationHistogram::kNumberOfBuckets> work_duration_histogram{};
+    };
+
+    // The counters only ever grow, Calculate() reports the difference to the values it saw last time.
+    struct Snapshot
+    {
+        Rep work_duration{0};
+        Rep wait_duration{0};
+        WorkDurationHistogram work_duration_histogram{};
+    };
+
+    /// \brief Method to be called by PerThreadLoadTrackingToken.
+    void OnTokenEnd(const std::size_t thread_index,
+                    const TrackingResolution& duration,
+                    const ThreadLoadTrackingState& state) noexcept;
+
+    std::vector<Counters> counters_;
+    std::mutex calculate_mutex_;
+    std::vector<Snapshot> snapshots_;
+    GetTimePointFunction get_time_now_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_H
@@ -0,0 +1,225 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking.h"
+
+#include "score/utility.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+const std::chrono::steady_clock::time_point kStartingPoint = std::chrono::steady_clock::now();
+
+// Returns the given offsets to kStartingPoint one after another.
+PerThreadLoadTracking::GetTimePointFunction MakeNowFunctionMock(std::vector<std::chrono::nanoseconds> offsets)
+{
+    // The offsets are shared, since the callback can not store the vector inline.
+    return [offsets = std::make_shared<const std::vector<std::chrono::nanoseconds>>(std::move(offsets)),
+            i = std::size_t{0U}]() mutable noexcept {
+        const auto time_point = kStartingPoint + offsets->at(i);
+        i++;
+        return time_point;
+    };
+}
+
+TEST(TestPerThreadLoadTracking, NoWorkNoWaitShallReturnEmptyOptional)
+{
+    PerThreadLoadTracking tracking{2U};
+
+    const auto result = tracking.Calculate();
+
+    EXPECT_EQ(tracking.NumberOfThreads(), 2U);
+    EXPECT_FALSE(result.total.work_load_percent.has_value());
+    ASSERT_EQ(result.threads.size(), 2U);
+    for (const auto& thread : result.threads)
+    {
+        EXPECT_FALSE(thread.work_load.work_load_percent.has_value());
+        EXPECT_EQ(thread.work_duration_histogram.TotalCount(), 0U);
+    }
+}
+
+TEST(TestPerThreadLoadTracking, ReportsWorkLoadPerThreadAndInTotal)
+{
+    // Given thread 0 only works, thread 1 only waits and thread 2 works and waits equally long
+    using std::chrono::seconds;
+    PerThreadLoadTracking tracking{
+        3U, MakeNowFunctionMock({seconds{0}, seconds{2}, seconds{0}, seconds{2}, seconds{0}, seconds{1}, seconds{1},
+                                 seconds{2}})};
+    tracking.StartWorking(0U);
+    tracking.StartWaiting(1U);
+    tracking.StartWorking(2U);
+    tracking.StartWaiting(2U);
+
+    // When calculating the work load
+    const auto result = tracking.Calculate();
+
+    // Then it is reported per thread
+    ASSERT_EQ(result.threads.size(), 3U);
+    EXPECT_DOUBLE_EQ(result.threads[0].work_load.work_load_percent.value(), 100.0);
+    EXPECT_EQ(result.threads[0].work_load.work_duration, seconds{2});
+    EXPECT_DOUBLE_EQ(result.threads[1].work_load.work_load_percent.value(), 0.0);
+    EXPECT_EQ(result.threads[1].work_load.wait_duration, seconds{2});
+    EXPECT_DOUBLE_EQ(result.threads[2].work_load.work_load_percent.value(), 50.0);
+
+    // And in total
+    EXPECT_DOUBLE_EQ(result.total.work_load_percent.value(), 50.0);
+    EXPECT_EQ(result.total.work_duration, seconds{3});
+    EXPECT_EQ(result.total.wait_duration, seconds{3});
+}
+
+TEST(TestPerThreadLoadTracking, CalculateOnlyReportsTheTimeSinceTheLastCall)
+{
+    // Given a thread which worked and got evaluated already
+    using std::chrono::seconds;
+    PerThreadLoadTracking tracking{1U, MakeNowFunctionMock({seconds{0}, seconds{1}, seconds{1}, seconds{4}})};
+    tracking.StartWorking(0U);
+    score::cpp::ignore = tracking.Calculate();
+
+    // When it waits afterwards
+    tracking.StartWaiting(0U);
+    const auto result = tracking.Calculate();
+
+    // Then only the waiting is reported
+    EXPECT_EQ(result.threads[0].work_load.work_duration, seconds{0});
+    EXPECT_EQ(result.threads[0].work_load.wait_duration, seconds{3});
+    EXPECT_DOUBLE_EQ(result.total.work_load_percent.value(), 0.0);
+    EXPECT_EQ(result.threads[0].work_duration_histogram.TotalCount(), 0U);
+
+    // And nothing at all once nothing happened meanwhile
+    EXPECT_FALSE(tracking.Calculate().total.work_load_percent.has_value());
+}
+
+TEST(TestPerThreadLoadTracking, RecordsEveryWorkDurationInTheHistogramOfItsThread)
+{
+    // Given a thread which works three times with different durations and waits once
+    using std::chrono::microseconds;
+    PerThreadLoadTracking tracking{
+        2U, MakeNowFunctionMock({microseconds{0}, microseconds{10}, microseconds{10}, microseconds{20},
+                                 microseconds{20}, microseconds{1020}, microseconds{1020}, microseconds{5000}})};
+    tracking.StartWorking(1U);
+    tracking.StartWorking(1U);
+    tracking.StartWorking(1U);
+    tracking.StartWaiting(1U);
+
+    // When calculating the work load
+    const auto result = tracking.Calculate();
+
+    // Then only the work durations got recorded in the histogram of that thread
+    const auto& histogram = result.threads[1].work_duration_histogram;
+    EXPECT_EQ(histogram.TotalCount(), 3U);
+    EXPECT_EQ(histogram.bucket_counts[WorkDurationHistogram::BucketIndex(microseconds{10})], 2U);
+    EXPECT_EQ(histogram.bucket_counts[WorkDurationHistogram::BucketIndex(microseconds{1000})], 1U);
+    EXPECT_EQ(result.threads[0].work_duration_histogram.TotalCount(), 0U);
+}
+
+TEST(TestPerThreadLoadTracking, MovedTokenIsOnlyCountedOnce)
+{
+    // Given a working token which got moved twice
+    using std::chrono::seconds;
+    PerThreadLoadTracking tracking{1U, MakeNowFunctionMock({seconds{0}, seconds{1}, seconds{3}, seconds{4}})};
+    {
+        auto token = tracking.StartWorking(0U);
+        auto moved_token = std::move(token);
+        auto other_token = tracking.StartWaiting(0U);
+
+        // When move-assigning it, which ends the assigned-to token
+        other_token = std::move(moved_token);
+    }
+
+    // Then each token got counted exactly once
+    const auto result = tracking.Calculate();
+    EXPECT_EQ(result.threads[0].work_load.work_duration, seconds{4});
+    EXPECT_EQ(result.threads[0].work_load.wait_duration, seconds{2});
+    EXPECT_EQ(result.threads[0].work_duration_histogram.TotalCount(), 1U);
+}
+
+TEST(TestPerThreadLoadTracking, EndStopsTheTrackingEarly)
+{
+    using std::chrono::seconds;
+    PerThreadLoadTracking tracking{1U, MakeNowFunctionMock({seconds{0}, seconds{1}})};
+    {
+        auto token = tracking.StartWorking(0U);
+        token.End();
+        token.End();
+    }
+
+    const auto result = tracking.Calculate();
+    EXPECT_EQ(result.threads[0].work_load.work_duration, seconds{1});
+}
+
+TEST(TestPerThreadLoadTracking, CountsAllTokensOfConcurrentThreads)
+{
+    // Given several threads which track their work concurrently to repeated calculations
+    constexpr std::size_t kNumberOfThreads{4U};
+    constexpr std::size_t kTokensPerThread{10000U};
+    PerThreadLoadTracking tracking{kNumberOfThreads};
+    std::vector<std::uint64_t> counted_tokens(kNumberOfThreads, 0U);
+    const auto calculate = [&tracking, &counted_tokens]() {
+        const auto result = tracking.Calculate();
+        for (std::size_t thread_index{0U}; thread_index < result.threads.size(); ++thread_index)
+        {
+            counted_tokens[thread_index] += result.threads[thread_index].work_duration_histogram.TotalCount();
+        }
+    };
+    std::atomic<bool> done{false};
+    std::thread calculating_thread{[&calculate, &done]() {
+        while (!done)
+        {
+            calculate();
+        }
+    }};
+
+    // When each of them ends many tokens
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index{0U}; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([&tracking, thread_index]() {
+            for (std::size_t i{0U}; i < kTokensPerThread; ++i)
+            {
+                tracking.StartWaiting(thread_index);
+                tracking.StartWorking(thread_index);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    done = true;
+    calculating_thread.join();
+    calculate();
+
+    // Then every work token got reported exactly once
+    for (const auto count : counted_tokens)
+    {
+        EXPECT_EQ(count, kTokensPerThread);
+    }
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/work_duration_histogram.h"
+
+#include "score/bit.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace score
+{
+namespace concurrency
+{
+
+std::size_t WorkDurationHistogram::BucketIndex(const std::chrono::nanoseconds duration) noexcept
+{
+    if (duration.count() < static_cast<std::chrono::nanoseconds::rep>(kSubBucketsPerPowerOfTwo))
+    {
+        return static_cast<std::size_t>(std::max(duration.count(), std::chrono::nanoseconds::rep{0}));
+    }
+
+    const auto value = static_cast<std::uint64_t>(duration.count());
+    const auto exponent = static_cast<std::size_t>(score::cpp::bit_width(value)) - 1U;
+    if (exponent > kMaxExponent)
+    {
+        return kNumberOfBuckets - 1U;
+    }
+    const auto sub_bucket =
+        static_cast<std::size_t>(value >> (exponent - kSubBucketBits)) & (kSubBucketsPerPowerOfTwo - 1U);
+    return kSubBucketsPerPowerOfTwo + ((exponent - kSubBucketBits) * kSubBucketsPerPowerOfTwo) + sub_bucket;
+}
+
+std::chrono::nanoseconds WorkDurationHistogram::BucketLowerBound(const std::size_t bucket_index) noexcept
+{
+    if (bucket_index < kSubBucketsPerPowerOfTwo)
+    {
+        return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(bucket_index)};
+    }
+
+    const auto logarithmic_index = std::min(bucket_index, kNumberOfBuckets - 1U) - kSubBucketsPerPowerOfTwo;
+    const auto exponent = (logarithmic_index / kSubBucketsPerPowerOfTwo) + kSubBucketBits;
+    const auto sub_bucket = static_cast<std::uint64_t>(logarithmic_index % kSubBucketsPerPowerOfTwo);
+    const auto lower_bound = (std::uint64_t{1U} << exponent) + (sub_bucket << (exponent - kSubBucketBits));
+    return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(lower_bound)};
+}
+
+std::uint64_t WorkDurationHistogram::TotalCount() const noexcept
+{
+    std::uint64_t total_count{0U};
+    for (const auto count : bucket_counts)
+    {
+        total_count += count;
+    }
+    return total_count;
+}
+
+std::chrono::nanoseconds WorkDurationHistogram::ValueAtPercentile(const double percentile) const noexcept
+{
+    const auto total_count = TotalCount();
+    if (total_count == 0U)
+    {
+        return std::chrono::nanoseconds{0};
+    }
+
+    const auto clamped_percentile = std::min(std::max(percentile, 0.0), 100.0);
+    const auto rank = std::max(
+        std::uint64_t{1U},
+        static_cast<std::uint64_t>(std::ceil((clamped_percentile / 100.0) * static_cast<double>(total_count))));
+    std::uint64_t cumulative_count{0U};
+    for (std::size_t bucket_index{0U}; bucket_index < kNumberOfBuckets; ++bucket_index)
+    {
+        cumulative_count += bucket_counts[bucket_index];
+        if (cumulative_count >= rank)
+        {
+            return BucketLowerBound(bucket_index);
+        }
+    }
+    return BucketLowerBound(kNumberOfBuckets - 1U);
+}
+
+WorkDurationHistogram& WorkDurationHistogram::operator+=(const WorkDurationHistogram& other) noexcept
+{
+    for (std::size_t bucket_index{0U}; bucket_index < kNumberOfBuckets; ++bucket_index)
+    {
+        bucket_counts[bucket_index] += other.bucket_counts[bucket_index];
+    }
+    return *this;
+}
+
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,63 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_WORK_DURATION_HISTOGRAM_H
+#define SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_WORK_DURATION_HISTOGRAM_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace concurrency
+{
+
+/// \brief Histogram of work durations with logarithmic buckets.
+/// \details Like in an HDR histogram, every power of two is split into kSubBucketsPerPowerOfTwo linear sub-buckets.
+/// Thus the relative error of a bucket is bounded by 1 / kSubBucketsPerPowerOfTwo, independent of the magnitude of
+/// the durations. Durations below kSubBucketsPerPowerOfTwo nanoseconds are counted exactly, durations at or above
+/// 2^(kMaxExponent + 1) nanoseconds (about 18 minutes) all end up in the last bucket.
+struct WorkDurationHistogram
+{
+    static constexpr std::size_t kSubBucketBits{2U};
+    static constexpr std::size_t kSubBucketsPerPowerOfTwo{std::size_t{1U} << kSubBucketBits};
+    static constexpr std::size_t kMaxExponent{39U};
+    static constexpr std::size_t kNumberOfBuckets{kSubBucketsPerPowerOfTwo +
+                                                  ((kMaxExponent - kSubBucketBits) + 1U) * kSubBucketsPerPowerOfTwo};
+
+    /// \brief Returns the index of the bucket which counts the given duration.
+    static std::size_t BucketIndex(const std::chrono::nanoseconds duration) noexcept;
+
+    /// \brief Returns the smallest duration which is counted by the bucket with the given index.
+    static std::chrono::nanoseconds BucketLowerBound(const std::size_t bucket_index) noexcept;
+
+    /// \brief Returns the number of recorded durations.
+    std::uint64_t TotalCount() const noexcept;
+
+    /// \brief Returns the lower bound of the bucket that contains the given percentile, e.g. 99.0 for the duration
+    /// which 99 percent of the recorded durations do not exceed. Zero if the histogram is empty.
+    std::chrono::nanoseconds ValueAtPercentile(const double percentile) const noexcept;
+
+    /// \brief Adds the counts of another histogram to this one.
+    WorkDurationHistogram& operator+=(const WorkDurationHistogram& other) noexcept;
+
+    /// \brief Number of recorded durations per bucket.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::array<std::uint64_t, kNumberOfBuckets> bucket_counts{};
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_WORK_DURATION_HISTOGRAM_H
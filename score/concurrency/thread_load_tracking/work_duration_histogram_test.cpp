@@ -0,0 +1,115 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/work_duration_histogram.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstddef>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+using std::chrono::nanoseconds;
+
+TEST(TestWorkDurationHistogram, CountsSmallDurationsExactly)
+{
+    for (std::size_t value{0U}; value < WorkDurationHistogram::kSubBucketsPerPowerOfTwo; ++value)
+    {
+        const nanoseconds duration{static_cast<nanoseconds::rep>(value)};
+        EXPECT_EQ(WorkDurationHistogram::BucketIndex(duration), value);
+        EXPECT_EQ(WorkDurationHistogram::BucketLowerBound(value), duration);
+    }
+}
+
+TEST(TestWorkDurationHistogram, NegativeDurationsEndUpInTheFirstBucket)
+{
+    EXPECT_EQ(WorkDurationHistogram::BucketIndex(nanoseconds{-5}), 0U);
+}
+
+TEST(TestWorkDurationHistogram, EveryBucketContainsItsLowerBoundButNotTheNextOne)
+{
+    for (std::size_t index{0U}; index + 1U < WorkDurationHistogram::kNumberOfBuckets; ++index)
+    {
+        const auto lower_bound = WorkDurationHistogram::BucketLowerBound(index);
+        const auto next_lower_bound = WorkDurationHistogram::BucketLowerBound(index + 1U);
+        EXPECT_LT(lower_bound, next_lower_bound);
+        EXPECT_EQ(WorkDurationHistogram::BucketIndex(lower_bound), index);
+        EXPECT_EQ(WorkDurationHistogram::BucketIndex(next_lower_bound - nanoseconds{1}), index);
+    }
+}
+
+TEST(TestWorkDurationHistogram, RelativeErrorIsBoundedBySubBuckets)
+{
+    // Given a duration in the middle of the range
+    const nanoseconds duration{123456789};
+
+    // When looking up its bucket
+    const auto lower_bound = WorkDurationHistogram::BucketLowerBound(WorkDurationHistogram::BucketIndex(duration));
+
+    // Then the lower bound deviates less than the width of a sub-bucket
+    EXPECT_LE(lower_bound, duration);
+    EXPECT_LT((duration - lower_bound) * WorkDurationHistogram::kSubBucketsPerPowerOfTwo, duration);
+}
+
+TEST(TestWorkDurationHistogram, HugeDurationsEndUpInTheLastBucket)
+{
+    EXPECT_EQ(WorkDurationHistogram::BucketIndex(std::chrono::hours{24}), WorkDurationHistogram::kNumberOfBuckets - 1U);
+    EXPECT_EQ(WorkDurationHistogram::BucketIndex(nanoseconds::max()), WorkDurationHistogram::kNumberOfBuckets - 1U);
+}
+
+TEST(TestWorkDurationHistogram, EmptyHistogramReportsZeroForEveryPercentile)
+{
+    const WorkDurationHistogram unit{};
+
+    EXPECT_EQ(unit.TotalCount(), 0U);
+    EXPECT_EQ(unit.ValueAtPercentile(50.0), nanoseconds{0});
+}
+
+TEST(TestWorkDurationHistogram, ReportsPercentiles)
+{
+    // Given 99 short and one long duration
+    WorkDurationHistogram unit{};
+    unit.bucket_counts[WorkDurationHistogram::BucketIndex(std::chrono::microseconds{1})] = 99U;
+    unit.bucket_counts[WorkDurationHistogram::BucketIndex(std::chrono::milliseconds{1})] = 1U;
+
+    // Then the median and the 99th percentile are short, only the maximum is long
+    EXPECT_EQ(unit.TotalCount(), 100U);
+    EXPECT_EQ(unit.ValueAtPercentile(50.0), nanoseconds{896});
+    EXPECT_EQ(unit.ValueAtPercentile(99.0), nanoseconds{896});
+    EXPECT_EQ(unit.ValueAtPercentile(100.0), nanoseconds{917504});
+    EXPECT_EQ(unit.ValueAtPercentile(0.0), nanoseconds{896});
+}
+
+TEST(TestWorkDurationHistogram, AddsHistograms)
+{
+    WorkDurationHistogram unit{};
+    unit.bucket_counts[1U] = 1U;
+    WorkDurationHistogram other{};
+    other.bucket_counts[1U] = 2U;
+    other.bucket_counts[10U] = 3U;
+
+    unit += other;
+
+    EXPECT_EQ(unit.bucket_counts[1U], 3U);
+    EXPECT_EQ(unit.bucket_counts[10U], 3U);
+    EXPECT_EQ(unit.TotalCount(), 6U);
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
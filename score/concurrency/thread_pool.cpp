@@ -36,7 +36,7 @@ score::concurrency::ThreadPool::ThreadPool(const std::size_t number_of_threads,
 void score::concurrency::ThreadPool::InitializeThreads(const std::size_t number_of_threads, const std::string& name)
 {
     pool_.reserve(number_of_threads);
-    active_.resize(number_of_threads);
+    active_.resize(number_of_threads, score::cpp::stop_source{score::cpp::nostopstate});
 
     std::unique_ptr<score::os::Pthread> pthread;
     // coverity[autosar_cpp14_a16_0_1_violation] must have implementation selection
@@ -87,7 +87,7 @@ void score::concurrency::ThreadPool::Work(const std::size_t thread_number, const
             lock.unlock();
             Execute(std::move(task));
             lock.lock();
-            active_.at(thread_number) = score::cpp::stop_source{};
+            active_.at(thread_number) = score::cpp::stop_source{score::cpp::nostopstate};
         }
     }
 }
@@ -0,0 +1,176 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/task_node_pool.h"
+#include "score/concurrency/thread_pool.h"
+#include "score/concurrency/work_stealing_thread_pool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfWorkers{4U};
+constexpr std::int64_t kTasksPerBatch{256};
+
+// Shared by all benchmark threads. Created by the first thread before and destroyed after the measurement, both of
+// which are synchronized by the benchmark framework.
+template <typename Pool>
+std::unique_ptr<Pool>& SharedPool() noexcept
+{
+    static std::unique_ptr<Pool> pool{};
+    return pool;
+}
+
+void WaitUntil(const std::atomic<std::int64_t>& counter, const std::int64_t expected) noexcept
+{
+    while (counter.load(std::memory_order_acquire) != expected)
+    {
+        std::this_thread::yield();
+    }
+}
+
+/// Every benchmark thread posts batches of tiny tasks and waits until its batch was executed. Shows how the pool
+/// scales with the number of posters competing for its queues.
+template <typename Pool>
+void PostFineGrainedTasks(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        SharedPool<Pool>() = std::make_unique<Pool>(kNumberOfWorkers);
+    }
+
+    std::atomic<std::int64_t> executed{0};
+    for (auto _ : state)
+    {
+        executed.store(0, std::memory_order_relaxed);
+        for (std::int64_t i = 0; i < kTasksPerBatch; ++i)
+        {
+            SharedPool<Pool>()->Post([&executed](const score::cpp::stop_token&) noexcept {
+                executed.fetch_add(1, std::memory_order_release);
+            });
+        }
+        WaitUntil(executed, kTasksPerBatch);
+    }
+    state.SetItemsProcessed(state.iterations() * kTasksPerBatch);
+
+    if (state.thread_index() == 0)
+    {
+        SharedPool<Pool>().reset();
+    }
+}
+BENCHMARK_TEMPLATE(PostFineGrainedTasks, ThreadPool)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(PostFineGrainedTasks, WorkStealingThreadPool)->ThreadRange(1, 4)->UseRealTime();
+
+// Posts two children until the given depth is reached, like a recursive divide and conquer algorithm.
+template <typename Pool>
+void Spawn(Pool& pool, const std::uint32_t depth, std::atomic<std::int64_t>& executed) noexcept
+{
+    if (depth > 0U)
+    {
+        for (std::uint32_t child = 0U; child < 2U; ++child)
+        {
+            pool.Post([&pool, depth, &executed](const score::cpp::stop_token&) noexcept {
+                Spawn(pool, depth - 1U, executed);
+            });
+        }
+    }
+    executed.fetch_add(1, std::memory_order_release);
+}
+
+/// Tasks which post further tasks from within the pool. Shows the benefit of the per-worker queues.
+template <typename Pool>
+void SpawnTasksFromWithinTasks(benchmark::State& state)
+{
+    constexpr std::uint32_t kDepth{10U};
+    constexpr std::int64_t kNumberOfTasks{(std::int64_t{1} << (kDepth + 1U)) - 1};
+
+    Pool pool{kNumberOfWorkers};
+    std::atomic<std::int64_t> executed{0};
+    for (auto _ : state)
+    {
+        executed.store(0, std::memory_order_relaxed);
+        pool.Post([&pool, &executed](const score::cpp::stop_token&) noexcept {
+            Spawn(pool, kDepth, executed);
+        });
+        WaitUntil(executed, kNumberOfTasks);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumberOfTasks);
+}
+BENCHMARK_TEMPLATE(SpawnTasksFromWithinTasks, ThreadPool)->UseRealTime();
+BENCHMARK_TEMPLATE(SpawnTasksFromWithinTasks, WorkStealingThreadPool)->UseRealTime();
+
+score::cpp::pmr::memory_resource* SelectMemoryResource(const benchmark::State& state,
+                                                 TaskNodePool& task_node_pool) noexcept
+{
+    return (state.range(0) != 0) ? &task_node_pool : score::cpp::pmr::get_default_resource();
+}
+
+/// Latency of a single Submit() until its result is available, with the task, its stop state and its shared state
+/// either allocated from the heap or from a TaskNodePool.
+void SubmitAndGet(benchmark::State& state)
+{
+    TaskNodePool task_node_pool{64U};
+    ThreadPool pool{1U, SelectMemoryResource(state, task_node_pool)};
+    std::int64_t index{0};
+    for (auto _ : state)
+    {
+        auto result = pool.Submit([index](const score::cpp::stop_token&) noexcept {
+            return index;
+        });
+        benchmark::DoNotOptimize(result.Get());
+        ++index;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(SubmitAndGet)->ArgName("task_node_pool")->Arg(0)->Arg(1)->UseRealTime();
+
+/// Cost of a single fire-and-forget Post() on the calling thread, measured in batches which are drained in between.
+void Post(benchmark::State& state)
+{
+    TaskNodePool task_node_pool{4U * static_cast<std::size_t>(kTasksPerBatch) + 64U};
+    ThreadPool pool{1U, SelectMemoryResource(state, task_node_pool)};
+    std::atomic<std::int64_t> executed{0};
+    std::int64_t posted{0};
+    for (auto _ : state)
+    {
+        pool.Post([&executed](const score::cpp::stop_token&) noexcept {
+            executed.fetch_add(1, std::memory_order_release);
+        });
+        ++posted;
+        if ((posted % kTasksPerBatch) == 0)
+        {
+            state.PauseTiming();
+            WaitUntil(executed, posted);
+            state.ResumeTiming();
+        }
+    }
+    WaitUntil(executed, posted);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Post)->ArgName("task_node_pool")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
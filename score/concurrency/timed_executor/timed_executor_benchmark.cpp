@@ -0,0 +1,121 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/notification.h"
+#include "score/concurrency/thread_pool.h"
+#include "score/concurrency/timed_executor/concurrent_timed_executor.h"
+#include "score/concurrency/timed_executor/timer_wheel_timed_executor.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/memory.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace score::concurrency
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using namespace std::chrono_literals;
+
+constexpr std::size_t kNumberOfThreads{2U};
+constexpr std::size_t kNumberOfPeriodicTasks{10000U};
+constexpr std::size_t kExecutionsPerTask{10U};
+constexpr Clock::duration kPeriod{20ms};
+
+template <typename TimedExecutorType>
+score::cpp::pmr::unique_ptr<TimedExecutorType> CreateExecutor()
+{
+    return score::cpp::pmr::make_unique<TimedExecutorType>(
+        score::cpp::pmr::get_default_resource(),
+        score::cpp::pmr::get_default_resource(),
+        score::cpp::pmr::make_unique<ThreadPool>(score::cpp::pmr::get_default_resource(), kNumberOfThreads));
+}
+
+/// 10k periodic tasks, whose first executions are spread over one period, run for ten periods. The wall time is
+/// dominated by the schedule itself, the interesting figures are the CPU time and how late tasks are executed.
+template <typename TimedExecutorType>
+void RunPeriodicTasks(benchmark::State& state)
+{
+    std::int64_t total_lateness_in_us{0};
+    for (auto _ : state)
+    {
+        auto executor = CreateExecutor<TimedExecutorType>();
+        std::atomic<std::size_t> number_of_finished_tasks{0U};
+        std::atomic<std::int64_t> lateness_in_us{0};
+        Notification all_finished{};
+
+        const auto start = Clock::now() + 10ms;
+        for (std::size_t index = 0U; index < kNumberOfPeriodicTasks; ++index)
+        {
+            auto task = [&, executions = std::size_t{0U}](const score::cpp::stop_token&,
+                                                          const Clock::time_point intended_execution) mutable {
+                const auto lateness = Clock::now() - intended_execution;
+                lateness_in_us += std::chrono::duration_cast<std::chrono::microseconds>(lateness).count();
+                if (++executions < kExecutionsPerTask)
+                {
+                    return true;
+                }
+                if (++number_of_finished_tasks == kNumberOfPeriodicTasks)
+                {
+                    all_finished.notify();
+                }
+                return false;
+            };
+            executor->Post(start + ((kPeriod * index) / kNumberOfPeriodicTasks), kPeriod, std::move(task));
+        }
+        score::cpp::ignore = all_finished.waitWithAbort({});
+        total_lateness_in_us += lateness_in_us;
+    }
+    const auto number_of_executions =
+        state.iterations() * static_cast<std::int64_t>(kNumberOfPeriodicTasks * kExecutionsPerTask);
+    state.SetItemsProcessed(number_of_executions);
+    state.counters["mean_lateness_us"] =
+        static_cast<double>(total_lateness_in_us) / static_cast<double>(number_of_executions);
+}
+BENCHMARK_TEMPLATE(RunPeriodicTasks, ConcurrentTimedExecutor<Clock>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(RunPeriodicTasks, TimerWheelTimedExecutor<Clock>)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/// Cost of scheduling a task while 10k periodic tasks are already waiting.
+template <typename TimedExecutorType>
+void PostWithManyWaitingTasks(benchmark::State& state)
+{
+    auto executor = CreateExecutor<TimedExecutorType>();
+    const auto far_future = Clock::now() + 1h;
+    const auto post_waiting_task = [&executor, far_future](const std::size_t index) {
+        executor->Post(far_future + std::chrono::milliseconds{index}, kPeriod, [](auto, auto) noexcept {});
+    };
+    for (std::size_t index = 0U; index < kNumberOfPeriodicTasks; ++index)
+    {
+        post_waiting_task(index);
+    }
+
+    std::size_t index{kNumberOfPeriodicTasks};
+    for (auto _ : state)
+    {
+        post_waiting_task(index % kNumberOfPeriodicTasks);
+        ++index;
+    }
+    state.SetItemsProcessed(state.iterations());
+    executor->Shutdown();
+}
+BENCHMARK_TEMPLATE(PostWithManyWaitingTasks, ConcurrentTimedExecutor<Clock>)->Iterations(20000);
+BENCHMARK_TEMPLATE(PostWithManyWaitingTasks, TimerWheelTimedExecutor<Clock>)->Iterations(20000);
+
+}  // namespace
+}  // namespace score::concurrency
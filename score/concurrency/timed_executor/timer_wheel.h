@@ -0,0 +1,403 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_H
+#define SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_H
+
+#include "score/concurrency/timed_executor/timed_task.h"
+
+#include <score/assert.hpp>
+#include <score/bit.hpp>
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace score::concurrency
+{
+
+/// @brief Hierarchical hashed timer wheel, which sorts TimedTasks by their next execution point.
+///
+/// @details Time is divided into ticks of a configurable resolution. The wheel consists of kLevels levels with
+/// kSlotsPerLevel slots each. A slot of level 0 holds the tasks of one tick, a slot of level n the tasks of
+/// kSlotsPerLevel^n ticks. A task is placed on the lowest level whose slots still distinguish its tick from the current
+/// one. Whenever the current tick enters a slot of a higher level, the tasks of that slot are cascaded down. Tasks that
+/// are further away than the highest level reaches are kept in an overflow list, which is only revisited every
+/// kSlotsPerLevel^kLevels ticks.
+///
+/// Inserting a task and advancing time by one tick are O(1). Tasks of one tick are moved to the expired list in one
+/// step. Empty ticks are skipped by means of a bitmap per level, so advancing over a long idle period is O(1) as well.
+///
+/// Tasks are never removed from the wheel before they expire. A task is cancelled by requesting a stop on its stop
+/// source. It is then handed out at its next execution point, so it can finish (e.g. set its promise), and is not
+/// inserted again afterwards.
+///
+/// The nodes which hold the tasks are recycled, so no memory is allocated while a periodic task is rescheduled.
+///
+/// The class is not thread-safe.
+/// @tparam Clock Any clock following the named requirements of `TrivialClock` (e.g. steady_clock)
+template <class Clock>
+class TimerWheel final
+{
+  public:
+    using TimePoint = typename Clock::time_point;
+    using Duration = typename Clock::duration;
+    using TaskPointer = score::cpp::pmr::unique_ptr<TimedTask<Clock>>;
+
+    static constexpr std::size_t kSlotBits{6U};
+    static constexpr std::size_t kSlotsPerLevel{std::size_t{1U} << kSlotBits};
+    static constexpr std::size_t kLevels{4U};
+
+    /// @param resolution Duration of one tick. Tasks expire at the first tick which is not before their execution
+    /// point.
+    /// @param start Time point of tick zero
+    /// @param memory_resource Used to allocate the nodes holding the tasks
+    TimerWheel(const Duration resolution, const TimePoint start, score::cpp::pmr::memory_resource* memory_resource)
+        : resolution_{resolution},
+          start_{start},
+          allocator_{memory_resource},
+          slots_{},
+          occupied_{},
+          overflow_{},
+          expired_{},
+          free_nodes_{},
+          current_tick_{0U},
+          size_{0U}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(resolution > Duration::zero(), "Resolution must be positive");
+    }
+
+    ~TimerWheel() noexcept
+    {
+        for (auto& level : slots_)
+        {
+            for (auto& slot : level)
+            {
+                Destroy(slot);
+            }
+        }
+        Destroy(overflow_);
+        Destroy(expired_);
+        Destroy(free_nodes_);
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) noexcept = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel& operator=(TimerWheel&&) noexcept = delete;
+
+    /// @brief Schedules a task at its next execution point.
+    /// @pre The task has a next execution point.
+    void Insert(TaskPointer task)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(task != nullptr,
+                                                          "Contract violation, nullptr as task provided");
+        const auto execution_point = task->GetNextExecutionPoint();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(execution_point.has_value(),
+                                                          "Contract violation, no next execution point given.");
+
+        Node* node = free_nodes_.PopFront();
+        if (node == nullptr)
+        {
+            node = allocator_.allocate(1U);
+            allocator_.construct(node);
+        }
+        node->task = std::move(task);
+        node->tick = TickNotBefore(execution_point.value());
+        Place(*node);
+        ++size_;
+    }
+
+    /// @brief Moves all tasks whose execution point is not after the given time point to the expired list.
+    void Advance(const TimePoint now) noexcept
+    {
+        const auto now_tick = TickAt(now);
+        for (auto next_tick = NextOccupiedTick(); next_tick.has_value() && (next_tick.value() <= now_tick);
+             next_tick = NextOccupiedTick())
+        {
+            ProcessTick(next_tick.value());
+        }
+        // All remaining tasks are due after now_tick, so the ticks in between are empty and can be skipped.
+        if (now_tick > current_tick_)
+        {
+            current_tick_ = now_tick;
+        }
+    }
+
+    /// @brief Removes the earliest expired task.
+    /// @return The task or nullptr, if no task has expired.
+    TaskPointer PopExpired() noexcept
+    {
+        Node* const node = expired_.PopFront();
+        if (node == nullptr)
+        {
+            return nullptr;
+        }
+        auto task = std::move(node->task);
+        free_nodes_.PushBack(*node);
+        --size_;
+        return task;
+    }
+
+    [[nodiscard]] bool HasExpired() const noexcept
+    {
+        return !expired_.Empty();
+    }
+
+    /// @brief The time point at which Advance() has to be called next.
+    /// @details At that time point, tasks either expire or are cascaded to a lower level. So after at most kLevels + 1
+    /// calls (one for the overflow list), the next expiry is met exactly. Advancing the wheel before that time point
+    /// does not change anything.
+    /// @return No value if the wheel is empty, a time point not after the last call to Advance() if a task has already
+    /// expired.
+    [[nodiscard]] std::optional<TimePoint> NextAdvance() const noexcept
+    {
+        if (HasExpired())
+        {
+            return TimePointOf(current_tick_);
+        }
+        const auto next_tick = NextOccupiedTick();
+        if (!next_tick.has_value())
+        {
+            return {};
+        }
+        return TimePointOf(next_tick.value());
+    }
+
+    /// @brief Number of tasks in the wheel, including the expired ones.
+    [[nodiscard]] std::size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+  private:
+    struct Node
+    {
+        TaskPointer task{};
+        std::uint64_t tick{0U};
+        Node* next{nullptr};
+    };
+
+    /// @brief Intrusive singly linked FIFO list, so that whole slots can be moved in O(1).
+    class List
+    {
+      public:
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return head_ == nullptr;
+        }
+
+        void PushBack(Node& node) noexcept
+        {
+            node.next = nullptr;
+            if (tail_ == nullptr)
+            {
+                head_ = &node;
+            }
+            else
+            {
+                tail_->next = &node;
+            }
+            tail_ = &node;
+        }
+
+        Node* PopFront() noexcept
+        {
+            Node* const node = head_;
+            if (node != nullptr)
+            {
+                head_ = node->next;
+                if (head_ == nullptr)
+                {
+                    tail_ = nullptr;
+                }
+                node->next = nullptr;
+            }
+            return node;
+        }
+
+        /// @brief Moves all nodes of other to the end of this list.
+        void Splice(List& other) noexcept
+        {
+            if (other.Empty())
+            {
+                return;
+            }
+            if (tail_ == nullptr)
+            {
+                head_ = other.head_;
+            }
+            else
+            {
+                tail_->next = other.head_;
+            }
+            tail_ = other.tail_;
+            other.head_ = nullptr;
+            other.tail_ = nullptr;
+        }
+
+        List Take() noexcept
+        {
+            List taken{};
+            taken.Splice(*this);
+            return taken;
+        }
+
+      private:
+        Node* head_{nullptr};
+        Node* tail_{nullptr};
+    };
+
+    static constexpr std::uint64_t kSlotMask{kSlotsPerLevel - 1U};
+    static constexpr std::size_t kWheelBits{kSlotBits * kLevels};
+
+    static constexpr std::size_t LevelShift(const std::size_t level) noexcept
+    {
+        return kSlotBits * level;
+    }
+
+    static constexpr std::uint64_t SlotIndex(const std::uint64_t tick, const std::size_t level) noexcept
+    {
+        return (tick >> LevelShift(level)) & kSlotMask;
+    }
+
+    std::uint64_t TickAt(const TimePoint time_point) const noexcept
+    {
+        if (time_point <= start_)
+        {
+            return 0U;
+        }
+        return static_cast<std::uint64_t>((time_point - start_) / resolution_);
+    }
+
+    std::uint64_t TickNotBefore(const TimePoint time_point) const noexcept
+    {
+        const auto tick = TickAt(time_point);
+        return (TimePointOf(tick) < time_point) ? (tick + 1U) : tick;
+    }
+
+    TimePoint TimePointOf(const std::uint64_t tick) const noexcept
+    {
+        return start_ + (resolution_ * static_cast<typename Duration::rep>(tick));
+    }
+
+    void Place(Node& node) noexcept
+    {
+        if (node.tick <= current_tick_)
+        {
+            expired_.PushBack(node);
+            return;
+        }
+        for (std::size_t level = 0U; level < kLevels; ++level)
+        {
+            // The lowest level on which the tick and the current tick only differ within one rotation.
+            const auto shift = LevelShift(level + 1U);
+            if ((node.tick >> shift) == (current_tick_ >> shift))
+            {
+                const auto slot = SlotIndex(node.tick, level);
+                slots_.at(level).at(slot).PushBack(node);
+                occupied_.at(level) |= std::uint64_t{1U} << slot;
+                return;
+            }
+        }
+        overflow_.PushBack(node);
+    }
+
+    void PlaceAll(List list) noexcept
+    {
+        for (Node* node = list.PopFront(); node != nullptr; node = list.PopFront())
+        {
+            Place(*node);
+        }
+    }
+
+    List TakeSlot(const std::size_t level, const std::uint64_t slot) noexcept
+    {
+        occupied_.at(level) &= ~(std::uint64_t{1U} << slot);
+        return slots_.at(level).at(slot).Take();
+    }
+
+    /// @brief The next tick after the current one at which a slot has to be cascaded or expires.
+    std::optional<std::uint64_t> NextOccupiedTick() const noexcept
+    {
+        std::optional<std::uint64_t> next_tick{};
+        for (std::size_t level = 0U; level < kLevels; ++level)
+        {
+            const auto current_slot = SlotIndex(current_tick_, level);
+            // All tasks on a level are in slots after the current one. For the last slot, the shift yields zero.
+            const auto later_slots = occupied_.at(level) & ~((std::uint64_t{2U} << current_slot) - 1U);
+            if (later_slots != 0U)
+            {
+                const auto slot = static_cast<std::uint64_t>(score::cpp::countr_zero(later_slots));
+                const auto rotation_start = (current_tick_ >> LevelShift(level + 1U)) << LevelShift(level + 1U);
+                const auto tick = rotation_start + (slot << LevelShift(level));
+                if ((!next_tick.has_value()) || (tick < next_tick.value()))
+                {
+                    next_tick = tick;
+                }
+            }
+        }
+        if ((!next_tick.has_value()) && (!overflow_.Empty()))
+        {
+            next_tick = ((current_tick_ >> kWheelBits) + 1U) << kWheelBits;
+        }
+        return next_tick;
+    }
+
+    void ProcessTick(const std::uint64_t tick) noexcept
+    {
+        current_tick_ = tick;
+        if ((tick & ((std::uint64_t{1U} << kWheelBits) - 1U)) == 0U)
+        {
+            PlaceAll(overflow_.Take());
+        }
+        // Cascade from the top, so that tasks can move down several levels at once.
+        for (std::size_t level = kLevels - 1U; level > 0U; --level)
+        {
+            if ((tick & ((std::uint64_t{1U} << LevelShift(level)) - 1U)) == 0U)
+            {
+                PlaceAll(TakeSlot(level, SlotIndex(tick, level)));
+            }
+        }
+        auto due = TakeSlot(0U, SlotIndex(tick, 0U));
+        expired_.Splice(due);
+    }
+
+    void Destroy(List& list) noexcept
+    {
+        for (Node* node = list.PopFront(); node != nullptr; node = list.PopFront())
+        {
+            node->~Node();
+            allocator_.deallocate(node, 1U);
+        }
+    }
+
+    Duration resolution_;
+    TimePoint start_;
+    score::cpp::pmr::polymorphic_allocator<Node> allocator_;
+    std::array<std::array<List, kSlotsPerLevel>, kLevels> slots_;
+    std::array<std::uint64_t, kLevels> occupied_;
+    List overflow_;
+    List expired_;
+    List free_nodes_;
+    std::uint64_t current_tick_;
+    std::size_t size_;
+};
+
+}  // namespace score::concurrency
+
+#endif  // SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_H
@@ -0,0 +1,237 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/timed_executor/timer_wheel.h"
+
+#include "score/concurrency/clock.h"
+#include "score/concurrency/timed_executor/delayed_task.h"
+#include "score/concurrency/timed_executor/periodic_task.h"
+
+#include "gtest/gtest.h"
+
+#include <score/assert_support.hpp>
+#include <score/memory_resource.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace score::concurrency
+{
+namespace
+{
+
+using Clock = testing::SteadyClock;
+using namespace std::chrono_literals;
+
+class CountingMemoryResource : public score::cpp::pmr::memory_resource
+{
+  public:
+    std::size_t number_of_allocations_{0U};
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++number_of_allocations_;
+        return score::cpp::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        score::cpp::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+class TimerWheelTest : public ::testing::Test
+{
+  protected:
+    TimerWheel<Clock>::TaskPointer CreateDelayedTask(const Clock::time_point execution_point)
+    {
+        return DelayedTaskFactory::Make<Clock>(
+            score::cpp::pmr::get_default_resource(), execution_point, [](auto, auto) noexcept {});
+    }
+
+    Clock::time_point start_{Clock::now()};
+    TimerWheel<Clock> unit_{1ms, start_, score::cpp::pmr::get_default_resource()};
+};
+
+TEST_F(TimerWheelTest, EmptyWheelHasNoExpiry)
+{
+    // Given an empty wheel
+    // When asking for the next expiry
+    // Then there is none
+    EXPECT_FALSE(unit_.NextAdvance().has_value());
+    EXPECT_FALSE(unit_.HasExpired());
+    EXPECT_EQ(unit_.Size(), 0U);
+    EXPECT_EQ(unit_.PopExpired(), nullptr);
+}
+
+TEST_F(TimerWheelTest, TaskInThePastExpiresImmediately)
+{
+    // When inserting a task whose execution point is already reached
+    unit_.Insert(CreateDelayedTask(start_));
+
+    // Then it has expired without advancing the wheel
+    EXPECT_TRUE(unit_.HasExpired());
+    EXPECT_EQ(unit_.NextAdvance(), start_);
+    EXPECT_NE(unit_.PopExpired(), nullptr);
+    EXPECT_EQ(unit_.Size(), 0U);
+}
+
+TEST_F(TimerWheelTest, ExecutionPointsAreRoundedUpToTheResolution)
+{
+    // Given a task in between two ticks
+    unit_.Insert(CreateDelayedTask(start_ + 1500us));
+
+    // Then it expires at the later tick
+    EXPECT_EQ(unit_.NextAdvance(), start_ + 2ms);
+    unit_.Advance(start_ + 1999us);
+    EXPECT_FALSE(unit_.HasExpired());
+    unit_.Advance(start_ + 2ms);
+    EXPECT_TRUE(unit_.HasExpired());
+}
+
+TEST_F(TimerWheelTest, TasksExpireInOrderOfTheirExecutionPoints)
+{
+    // Given tasks on different levels of the wheel, inserted in reverse order
+    const std::vector<Clock::duration> delays{10h, 5min, 3s, 70ms, 5ms};
+    for (const auto delay : delays)
+    {
+        unit_.Insert(CreateDelayedTask(start_ + delay));
+    }
+    EXPECT_EQ(unit_.Size(), delays.size());
+
+    // When advancing the wheel whenever it requires so
+    // Then the tasks expire one after another exactly at their execution points
+    for (auto delay = delays.rbegin(); delay != delays.rend(); ++delay)
+    {
+        std::size_t number_of_advances{0U};
+        auto now = start_;
+        while (!unit_.HasExpired())
+        {
+            const auto next_advance = unit_.NextAdvance();
+            ASSERT_TRUE(next_advance.has_value());
+            ASSERT_GT(next_advance.value(), now);
+            now = next_advance.value();
+            unit_.Advance(now);
+            ++number_of_advances;
+        }
+        // At most one advance per level and one for the overflow list, since tasks are cascaded down at each of them
+        EXPECT_LE(number_of_advances, TimerWheel<Clock>::kLevels + 1U);
+        EXPECT_EQ(now, start_ + *delay);
+        auto task = unit_.PopExpired();
+        ASSERT_NE(task, nullptr);
+        EXPECT_EQ(task->GetNextExecutionPoint(), start_ + *delay);
+        EXPECT_FALSE(unit_.HasExpired());
+    }
+    EXPECT_FALSE(unit_.NextAdvance().has_value());
+}
+
+TEST_F(TimerWheelTest, EveryTaskExpiresAtTheFirstAdvanceNotBeforeItsExecutionPoint)
+{
+    // Given many tasks with random execution points, including ones beyond the range of the highest level
+    constexpr std::int64_t kMaximumDelayInTicks{std::int64_t{1} << 26};
+    std::mt19937_64 random_engine{42U};
+    std::uniform_int_distribution<std::int64_t> delay_distribution{0, kMaximumDelayInTicks};
+    constexpr std::size_t kNumberOfTasks{2000U};
+    for (std::size_t i = 0U; i < kNumberOfTasks; ++i)
+    {
+        unit_.Insert(CreateDelayedTask(start_ + std::chrono::milliseconds{delay_distribution(random_engine)}));
+    }
+
+    // When advancing the wheel in random steps
+    std::uniform_int_distribution<std::int64_t> step_distribution{1, kMaximumDelayInTicks / 500};
+    auto previous_now = start_ - 1ms;
+    auto now = start_;
+    std::size_t number_of_expired_tasks{0U};
+    while (number_of_expired_tasks < kNumberOfTasks)
+    {
+        unit_.Advance(now);
+
+        // Then every expired task is due now, but was not due at the previous advance
+        for (auto task = unit_.PopExpired(); task != nullptr; task = unit_.PopExpired())
+        {
+            const auto execution_point = task->GetNextExecutionPoint().value();
+            ASSERT_LE(execution_point, now);
+            ASSERT_GT(execution_point, previous_now);
+            ++number_of_expired_tasks;
+        }
+        // And no task which is still in the wheel is due
+        const auto next_advance = unit_.NextAdvance();
+        ASSERT_TRUE((!next_advance.has_value()) || (next_advance.value() > now));
+
+        previous_now = now;
+        now += std::chrono::milliseconds{step_distribution(random_engine)};
+    }
+    EXPECT_EQ(unit_.Size(), 0U);
+}
+
+TEST_F(TimerWheelTest, ReschedulingAPeriodicTaskDoesNotAllocate)
+{
+    // Given a wheel with a periodic task, that was executed once
+    CountingMemoryResource memory_resource{};
+    TimerWheel<Clock> unit{1ms, start_, &memory_resource};
+    std::size_t number_of_executions{0U};
+    unit.Insert(PeriodicTaskFactory::Make<Clock>(
+        score::cpp::pmr::get_default_resource(), start_, 10ms, [&number_of_executions](auto, auto) noexcept {
+            ++number_of_executions;
+        }));
+    const auto number_of_allocations = memory_resource.number_of_allocations_;
+
+    // When expiring, executing and rescheduling the task repeatedly
+    for (std::size_t period = 0U; period < 100U; ++period)
+    {
+        unit.Advance(start_ + (period * 10ms));
+        auto task = unit.PopExpired();
+        ASSERT_NE(task, nullptr);
+        (*task)(task->GetStopSource().get_token());
+        unit.Insert(std::move(task));
+    }
+
+    // Then the task was executed at every period without any further allocation
+    EXPECT_EQ(number_of_executions, 100U);
+    EXPECT_EQ(memory_resource.number_of_allocations_, number_of_allocations);
+    EXPECT_EQ(unit.NextAdvance(), start_ + 1000ms);
+}
+
+TEST_F(TimerWheelTest, CancelledTaskIsHandedOutAtItsExecutionPointWithoutNextExecutionPoint)
+{
+    // Given a periodic task in the wheel, which gets cancelled
+    auto task = PeriodicTaskFactory::Make<Clock>(
+        score::cpp::pmr::get_default_resource(), start_ + 10ms, 10ms, [](auto, auto) noexcept {});
+    auto stop_source = task->GetStopSource();
+    unit_.Insert(std::move(task));
+    score::cpp::ignore = stop_source.request_stop();
+
+    // When its execution point is reached
+    unit_.Advance(start_ + 10ms);
+
+    // Then it is handed out, but shall not be rescheduled
+    auto expired_task = unit_.PopExpired();
+    ASSERT_NE(expired_task, nullptr);
+    EXPECT_FALSE(expired_task->GetNextExecutionPoint().has_value());
+}
+
+TEST_F(TimerWheelTest, ResolutionMustBePositive)
+{
+    // When constructing a wheel without a positive resolution
+    // Then the program terminates
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        TimerWheel<Clock>(Clock::duration::zero(), start_, score::cpp::pmr::get_default_resource()));
+}
+
+}  // namespace
+}  // namespace score::concurrency
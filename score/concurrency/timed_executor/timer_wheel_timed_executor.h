@@ -0,0 +1,224 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_TIMED_EXECUTOR_H
+#define SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_TIMED_EXECUTOR_H
+
+#include "score/concurrency/condition_variable.h"
+#include "score/concurrency/executor.h"
+#include "score/concurrency/timed_executor/timed_executor.h"
+#include "score/concurrency/timed_executor/timed_task.h"
+#include "score/concurrency/timed_executor/timer_wheel.h"
+
+#include <score/assert.hpp>
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+#include <score/stop_token.hpp>
+#include <score/utility.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace score::concurrency
+{
+
+/// @brief TimedExecutor which keeps its tasks in a TimerWheel, so that scheduling and rescheduling a task is O(1),
+/// independent of the number of tasks.
+///
+/// @details In contrast to ConcurrentTimedExecutor, there is no sorted queue and no bookkeeping of the waiting threads.
+/// One of the threads of the underlying executor acts as ticker: It sleeps until the next execution point of the
+/// wheel and then expires all due tasks at once. If more than one task is due, all idle threads are woken up to execute
+/// them. The ticker executes tasks as well, another idle thread takes over the ticker role meanwhile.
+///
+/// Execution points are rounded up to the tick resolution. A coarser resolution means fewer wake-ups, since tasks with
+/// close execution points are executed as one batch.
+///
+/// A task is cancelled by requesting a stop on its stop source, see TimerWheel.
+/// @note Running tasks will _not_ get interrupted. If the concurrency level is to low, tasks will not get executed
+/// according to their schedule.
+template <class Clock>
+class TimerWheelTimedExecutor final : public TimedExecutor<Clock>
+{
+  public:
+    using TimePoint = typename Clock::time_point;
+    using Duration = typename Clock::duration;
+
+    /// @param memory_resource The resource for the tasks and the nodes of the timer wheel
+    /// @param executor The executor whose threads execute the tasks. All of them are occupied by this executor.
+    /// @param tick_resolution The duration of one tick of the timer wheel
+    TimerWheelTimedExecutor(score::cpp::pmr::memory_resource* memory_resource,
+                            score::cpp::pmr::unique_ptr<Executor> executor,
+                            const Duration tick_resolution = std::chrono::milliseconds{1})
+        : TimedExecutor<Clock>{memory_resource},
+          mutex_{},
+          wheel_{tick_resolution, Clock::now(), memory_resource},
+          ticker_active_{false},
+          ticker_wake_up_point_{TimePoint::max()},
+          ticker_interrupted_{false},
+          ticker_condition_{},
+          idle_condition_{},
+          executor_{std::move(executor)}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(executor_ != nullptr);
+        for (std::size_t counter{0U}; counter < executor_->MaxConcurrencyLevel(); counter++)
+        {
+            // capturing `this` is fine, since executor_ will be destroyed upon destruction of `this`
+            executor_->Post([this](const score::cpp::stop_token token) {
+                Work(token);
+            });
+        }
+    }
+
+    TimerWheelTimedExecutor(const TimerWheelTimedExecutor&) = delete;
+    TimerWheelTimedExecutor(TimerWheelTimedExecutor&&) noexcept = delete;
+    TimerWheelTimedExecutor& operator=(const TimerWheelTimedExecutor&) = delete;
+    TimerWheelTimedExecutor& operator=(TimerWheelTimedExecutor&&) noexcept = delete;
+
+    ~TimerWheelTimedExecutor() noexcept override
+    {
+        executor_.reset();
+    }
+
+    [[nodiscard]] std::size_t MaxConcurrencyLevel() const noexcept override
+    {
+        return executor_->MaxConcurrencyLevel();
+    }
+
+    [[nodiscard]] bool ShutdownRequested() const noexcept override
+    {
+        return executor_->ShutdownRequested();
+    }
+
+    void Shutdown() noexcept override
+    {
+        executor_->Shutdown();
+    }
+
+  protected:
+    void Enqueue(score::cpp::pmr::unique_ptr<TimedTask<Clock>> task) override
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        Schedule(std::move(task));
+    }
+
+  private:
+    // false-positive: used as executors task main body
+    // coverity[autosar_cpp14_a0_1_3_violation]
+    void Work(const score::cpp::stop_token& token)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        // GCOV_EXCL_START: false-positive, covered by TimerWheelTimedExecutorTest
+        while (not token.stop_requested())
+        // GCOV_EXCL_STOP
+        {
+            auto task = wheel_.PopExpired();
+            if (task != nullptr)
+            {
+                lock.unlock();
+                Execute(*task, token);
+                if (not task->GetNextExecutionPoint().has_value())
+                {
+                    // Destroy finished tasks outside of the lock
+                    task.reset();
+                }
+                lock.lock();
+                if (task != nullptr)
+                {
+                    Schedule(std::move(task));
+                }
+            }
+            else if (not ticker_active_)
+            {
+                Tick(lock, token);
+            }
+            else
+            {
+                score::cpp::ignore = idle_condition_.wait(lock, token, [this]() noexcept {
+                    return wheel_.HasExpired() || (not ticker_active_);
+                });
+            }
+        }
+    }
+
+    /// @brief Sleeps until the next execution point of the wheel or until an earlier task was scheduled and expires
+    /// all due tasks.
+    void Tick(std::unique_lock<std::mutex>& lock, const score::cpp::stop_token& token)
+    {
+        ticker_active_ = true;
+        ticker_interrupted_ = false;
+        const auto next_advance = wheel_.NextAdvance();
+        ticker_wake_up_point_ = next_advance.value_or(TimePoint::max());
+        if (next_advance.has_value())
+        {
+            score::cpp::ignore = ticker_condition_.wait_until(lock, token, ticker_wake_up_point_, [this]() noexcept {
+                return ticker_interrupted_;
+            });
+        }
+        else
+        {
+            score::cpp::ignore = ticker_condition_.wait(lock, token, [this]() noexcept {
+                return ticker_interrupted_;
+            });
+        }
+
+        wheel_.Advance(Clock::now());
+        ticker_active_ = false;
+        ticker_wake_up_point_ = TimePoint::max();
+        // The ticker executes one of the expired tasks itself, the others shall be picked up by idle threads. One of
+        // them will also take over the ticker role.
+        if (wheel_.HasExpired())
+        {
+            idle_condition_.notify_all();
+        }
+    }
+
+    void Schedule(score::cpp::pmr::unique_ptr<TimedTask<Clock>> task)
+    {
+        wheel_.Insert(std::move(task));
+        const auto next_advance = wheel_.NextAdvance();
+        if (wheel_.HasExpired())
+        {
+            idle_condition_.notify_one();
+        }
+        if (ticker_active_ && next_advance.has_value() && (next_advance.value() < ticker_wake_up_point_))
+        {
+            ticker_interrupted_ = true;
+            ticker_condition_.notify_one();
+        }
+    }
+
+    static void Execute(TimedTask<Clock>& task, const score::cpp::stop_token& token)
+    {
+        // coverity[autosar_cpp14_m0_1_9_violation] false-positive: callback is stored into the token
+        [[maybe_unused]] score::cpp::stop_callback cb{token, [&task]() noexcept {
+                                                          score::cpp::ignore = task.GetStopSource().request_stop();
+                                                      }};
+        std::invoke(task, task.GetStopSource().get_token());
+    }
+
+    std::mutex mutex_;
+    TimerWheel<Clock> wheel_;
+    bool ticker_active_;
+    TimePoint ticker_wake_up_point_;
+    bool ticker_interrupted_;
+    InterruptibleConditionalVariable ticker_condition_;
+    InterruptibleConditionalVariable idle_condition_;
+
+    // This is intentionally last, since on destruction the worker threads need to be stopped before anything else.
+    score::cpp::pmr::unique_ptr<Executor> executor_;
+};
+
+}  // namespace score::concurrency
+
+#endif  // SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_TIMED_EXECUTOR_H
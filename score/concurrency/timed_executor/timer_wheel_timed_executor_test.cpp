@@ -0,0 +1,219 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/timed_executor/timer_wheel_timed_executor.h"
+
+#include "score/concurrency/notification.h"
+#include "score/concurrency/thread_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <score/memory.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace score::concurrency
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using namespace std::chrono_literals;
+
+TimerWheelTimedExecutor<Clock> CreateUnit(const std::size_t number_of_threads,
+                                          const Clock::duration tick_resolution = 1ms)
+{
+    return TimerWheelTimedExecutor<Clock>{
+        score::cpp::pmr::get_default_resource(),
+        score::cpp::pmr::make_unique<ThreadPool>(score::cpp::pmr::get_default_resource(), number_of_threads),
+        tick_resolution};
+}
+
+TEST(TimerWheelTimedExecutorTest, HoldsConcurrencyLevelOfUnderlyingExecutor)
+{
+    // Given a TimerWheelTimedExecutor on top of two threads
+    auto unit = CreateUnit(2U);
+
+    // When asking for the maximum concurrency level
+    // Then that should be two
+    EXPECT_EQ(unit.MaxConcurrencyLevel(), 2U);
+}
+
+TEST(TimerWheelTimedExecutorTest, RequestingShutdownChangesState)
+{
+    // Given a TimerWheelTimedExecutor
+    auto unit = CreateUnit(1U);
+    EXPECT_FALSE(unit.ShutdownRequested());
+
+    // When shutting down
+    unit.Shutdown();
+
+    // Then it should be seen, that the shutdown was requested
+    EXPECT_TRUE(unit.ShutdownRequested());
+}
+
+TEST(TimerWheelTimedExecutorTest, ExecutesDelayedTaskNotBeforeItsExecutionPoint)
+{
+    // Given a TimerWheelTimedExecutor
+    auto unit = CreateUnit(2U);
+    concurrency::Notification executed{};
+
+    // When posting a delayed task
+    const auto execution_point = Clock::now() + 20ms;
+    Clock::time_point executed_at{};
+    unit.Post(execution_point, [&executed, &executed_at](auto, auto) noexcept {
+        executed_at = Clock::now();
+        executed.notify();
+    });
+
+    // Then it gets executed, but not before its execution point
+    executed.waitWithAbort({});
+    EXPECT_GE(executed_at, execution_point);
+}
+
+TEST(TimerWheelTimedExecutorTest, ExecutesPeriodicTaskUntilItReturnsFalse)
+{
+    // Given a TimerWheelTimedExecutor
+    auto unit = CreateUnit(1U);
+    concurrency::Notification finished{};
+    std::atomic<std::size_t> number_of_executions{0U};
+
+    // When posting a periodic task which stops itself after the fifth execution
+    unit.Post(2ms, [&finished, &number_of_executions](auto, auto) noexcept {
+        if (++number_of_executions == 5U)
+        {
+            finished.notify();
+            return false;
+        }
+        return true;
+    });
+
+    // Then it gets executed exactly five times
+    finished.waitWithAbort({});
+    std::this_thread::sleep_for(10ms);
+    EXPECT_EQ(number_of_executions, 5U);
+}
+
+TEST(TimerWheelTimedExecutorTest, ExecutesTasksInOrderOfTheirExecutionPoints)
+{
+    // Given a TimerWheelTimedExecutor with one thread
+    auto unit = CreateUnit(1U);
+    std::mutex order_mutex{};
+    std::vector<std::size_t> order{};
+    concurrency::Notification finished{};
+
+    // When posting tasks in reverse order of their execution points
+    const auto now = Clock::now();
+    for (std::size_t index = 3U; index > 0U; --index)
+    {
+        unit.Post(now + (index * 10ms), [&, index](auto, auto) noexcept {
+            std::lock_guard<std::mutex> lock{order_mutex};
+            order.push_back(index);
+            if (index == 3U)
+            {
+                finished.notify();
+            }
+        });
+    }
+
+    // Then they are executed in order of their execution points
+    finished.waitWithAbort({});
+    std::lock_guard<std::mutex> lock{order_mutex};
+    EXPECT_EQ(order, (std::vector<std::size_t>{1U, 2U, 3U}));
+}
+
+TEST(TimerWheelTimedExecutorTest, TaskScheduledWhileTickerSleepsForALaterTaskIsExecutedInTime)
+{
+    // Given a TimerWheelTimedExecutor whose ticker sleeps until a task far in the future
+    auto unit = CreateUnit(2U);
+    unit.Post(Clock::now() + 1h, [](auto, auto) noexcept {});
+    std::this_thread::sleep_for(10ms);
+
+    // When posting a task which is due much earlier
+    concurrency::Notification executed{};
+    unit.Post(Clock::now() + 5ms, [&executed](auto, auto) noexcept {
+        executed.notify();
+    });
+
+    // Then it gets executed without waiting for the later task
+    EXPECT_TRUE(executed.waitForWithAbort(5s, {}));
+}
+
+TEST(TimerWheelTimedExecutorTest, CancelledPeriodicTaskIsNotExecutedAnymore)
+{
+    // Given a TimerWheelTimedExecutor with a periodic task, which was executed at least once
+    auto unit = CreateUnit(1U);
+    std::atomic<std::size_t> number_of_executions{0U};
+    auto [task_result, task] =
+        PeriodicTaskFactory::MakeWithTaskResult<Clock>(unit.GetMemoryResource(),
+                                                       Clock::now(),
+                                                       2ms,
+                                                       [&number_of_executions](auto, auto) noexcept {
+                                                           ++number_of_executions;
+                                                       });
+    unit.Post(std::move(task));
+    while (number_of_executions == 0U)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    // When cancelling the task
+    task_result.Abort();
+
+    // Then it finishes and is not executed anymore
+    score::cpp::ignore = task_result.Wait();
+    const std::size_t executions_after_abort = number_of_executions;
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(number_of_executions, executions_after_abort);
+}
+
+TEST(TimerWheelTimedExecutorTest, ManyPeriodicTasksAreAllExecuted)
+{
+    // Given a TimerWheelTimedExecutor with a coarse resolution
+    auto unit = CreateUnit(2U, 5ms);
+    constexpr std::size_t kNumberOfTasks{1000U};
+    constexpr std::size_t kExecutionsPerTask{3U};
+    std::vector<std::atomic<std::size_t>> number_of_executions(kNumberOfTasks);
+    std::atomic<std::size_t> number_of_finished_tasks{0U};
+    concurrency::Notification all_finished{};
+
+    // When posting many periodic tasks with different periods
+    for (std::size_t index = 0U; index < kNumberOfTasks; ++index)
+    {
+        const auto period = std::chrono::milliseconds{1U + (index % 10U)};
+        unit.Post(period, [&, index](auto, auto) noexcept {
+            if (++number_of_executions.at(index) < kExecutionsPerTask)
+            {
+                return true;
+            }
+            if (++number_of_finished_tasks == kNumberOfTasks)
+            {
+                all_finished.notify();
+            }
+            return false;
+        });
+    }
+
+    // Then every task is executed the expected number of times
+    EXPECT_TRUE(all_finished.waitForWithAbort(10s, {}));
+    for (const auto& executions : number_of_executions)
+    {
+        EXPECT_EQ(executions, kExecutionsPerTask);
+    }
+}
+
+}  // namespace
+}  // namespace score::concurrency
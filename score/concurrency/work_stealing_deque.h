@@ -0,0 +1,195 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_WORK_STEALING_DEQUE_H
+#define SCORE_LIB_CONCURRENCY_WORK_STEALING_DEQUE_H
+
+#include <score/assert.hpp>
+#include <score/memory_resource.hpp>
+#include <score/vector.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace score
+{
+namespace concurrency
+{
+namespace detail
+{
+
+/**
+ * \brief Bounded work-stealing deque after Chase and Lev.
+ *
+ * Exactly one thread (the owner) may call Push() and Pop(). They work on the bottom end of the deque in LIFO order,
+ * so the owner continues with the task it created last, whose data is most likely still in its cache. Any number of
+ * other threads (the thieves) may call Steal(), which takes the oldest element from the top end.
+ *
+ * The owner only synchronizes with thieves when the deque is about to run empty. Thieves compete with a single
+ * compare-and-swap on the top index.
+ *
+ * In contrast to the original algorithm the deque does not grow, so no memory is allocated after construction.
+ * Since elements are moved out of a slot only after a thief won the race for it, every slot carries a flag which
+ * tells the owner whether the slot can be reused.
+ */
+template <typename T>
+class WorkStealingDeque final
+{
+  public:
+    /**
+     * \brief Constructs an empty deque.
+     *
+     * \param capacity Maximum number of elements. Must be a power of two.
+     * \param memory_resource The resource for the slots, which are all allocated upfront.
+     */
+    WorkStealingDeque(const std::size_t capacity, score::cpp::pmr::memory_resource* memory_resource)
+        : top_{0}, bottom_{0}, slots_(capacity, memory_resource), index_mask_{static_cast<std::int64_t>(capacity) - 1}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE((capacity > 0U) && ((capacity & (capacity - 1U)) == 0U),
+                                                          "Capacity must be a power of two");
+    }
+
+    ~WorkStealingDeque() noexcept = default;
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) noexcept = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) noexcept = delete;
+
+    /**
+     * \brief Appends an element at the bottom. May only be called by the owner.
+     *
+     * \return true if the element was moved into the deque, false if the deque was full. Then value is left untouched.
+     */
+    bool Push(T& value) noexcept
+    {
+        const auto bottom = bottom_.load(std::memory_order_relaxed);
+        const auto top = top_.load(std::memory_order_acquire);
+        if ((bottom - top) > index_mask_)
+        {
+            return false;
+        }
+
+        auto& slot = SlotAt(bottom);
+        // A thief which won the slot in the previous round might still be moving the element out of it.
+        if (slot.occupied.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        slot.value = std::move(value);
+        slot.occupied.store(true, std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * \brief Removes the newest element from the bottom. May only be called by the owner.
+     */
+    std::optional<T> Pop() noexcept
+    {
+        const auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        // Sequentially consistent, so that either a concurrent thief sees the reservation or the owner sees the
+        // thief's increment of top_.
+        bottom_.store(bottom, std::memory_order_seq_cst);
+        auto top = top_.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            bottom_.store(bottom + 1, std::memory_order_release);
+            return {};
+        }
+
+        if ((top == bottom) &&
+            (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)))
+        {
+            // A thief took the last element.
+            bottom_.store(bottom + 1, std::memory_order_release);
+            return {};
+        }
+
+        auto& slot = SlotAt(bottom);
+        std::optional<T> value{std::move(slot.value)};
+        slot.occupied.store(false, std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            bottom_.store(bottom + 1, std::memory_order_release);
+        }
+        return value;
+    }
+
+    /**
+     * \brief Removes the oldest element from the top. May be called by any thread.
+     *
+     * \return The element or an empty optional if the deque was empty or another thread won the race for the element.
+     */
+    std::optional<T> Steal() noexcept
+    {
+        auto top = top_.load(std::memory_order_seq_cst);
+        const auto bottom = bottom_.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+        {
+            return {};
+        }
+
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return {};
+        }
+
+        auto& slot = SlotAt(top);
+        std::optional<T> value{std::move(slot.value)};
+        slot.occupied.store(false, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * \brief Returns whether the deque looked empty at the time of the call. May be called by any thread.
+     */
+    bool Empty() const noexcept
+    {
+        const auto top = top_.load(std::memory_order_seq_cst);
+        const auto bottom = bottom_.load(std::memory_order_seq_cst);
+        return top >= bottom;
+    }
+
+    std::size_t Capacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+  private:
+    struct Slot
+    {
+        T value{};
+        std::atomic<bool> occupied{false};
+    };
+
+    Slot& SlotAt(const std::int64_t index) noexcept
+    {
+        return slots_[static_cast<std::size_t>(index & index_mask_)];
+    }
+
+    // Signed, since Pop() temporarily decrements bottom_ below top_ on an empty deque.
+    alignas(64) std::atomic<std::int64_t> top_;
+    alignas(64) std::atomic<std::int64_t> bottom_;
+    score::cpp::pmr::vector<Slot> slots_;
+    std::int64_t index_mask_;
+};
+
+}  // namespace detail
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_WORK_STEALING_DEQUE_H
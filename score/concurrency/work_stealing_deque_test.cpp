@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/work_stealing_deque.h"
+
+#include <score/assert_support.hpp>
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace detail
+{
+namespace
+{
+
+using Deque = WorkStealingDeque<std::unique_ptr<std::uint32_t>>;
+
+TEST(WorkStealingDeque, OwnerPopsInLifoOrderAndThievesStealInFifoOrder)
+{
+    // Given a deque with three elements
+    Deque unit{4U, score::cpp::pmr::get_default_resource()};
+    for (std::uint32_t value = 1U; value <= 3U; ++value)
+    {
+        auto element = std::make_unique<std::uint32_t>(value);
+        ASSERT_TRUE(unit.Push(element));
+    }
+
+    // When popping and stealing
+    // Then the owner gets the newest and the thief the oldest element
+    EXPECT_EQ(*unit.Pop().value(), 3U);
+    EXPECT_EQ(*unit.Steal().value(), 1U);
+    EXPECT_EQ(*unit.Pop().value(), 2U);
+    EXPECT_FALSE(unit.Pop().has_value());
+    EXPECT_FALSE(unit.Steal().has_value());
+    EXPECT_TRUE(unit.Empty());
+}
+
+TEST(WorkStealingDeque, PushFailsWhenFullAndLeavesTheElementUntouched)
+{
+    // Given a full deque
+    Deque unit{2U, score::cpp::pmr::get_default_resource()};
+    auto first = std::make_unique<std::uint32_t>(1U);
+    auto second = std::make_unique<std::uint32_t>(2U);
+    ASSERT_TRUE(unit.Push(first));
+    ASSERT_TRUE(unit.Push(second));
+
+    // When pushing another element
+    auto third = std::make_unique<std::uint32_t>(3U);
+
+    // Then it is rejected and still owned by the caller
+    EXPECT_FALSE(unit.Push(third));
+    ASSERT_NE(third, nullptr);
+    EXPECT_EQ(*third, 3U);
+
+    // And can be pushed once an element was stolen
+    EXPECT_EQ(*unit.Steal().value(), 1U);
+    EXPECT_TRUE(unit.Push(third));
+}
+
+TEST(WorkStealingDeque, CapacityMustBeAPowerOfTwo)
+{
+    // When constructing a deque with a capacity that is not a power of two
+    // Then the program terminates
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(Deque(3U, score::cpp::pmr::get_default_resource()));
+}
+
+TEST(WorkStealingDeque, OwnerAndThievesTakeEveryElementExactlyOnce)
+{
+    constexpr std::uint32_t kNumberOfElements{50000U};
+    constexpr std::size_t kNumberOfThieves{2U};
+
+    // Given an owner which pushes elements and pops some of them
+    Deque unit{16U, score::cpp::pmr::get_default_resource()};
+    std::vector<std::atomic<std::uint32_t>> times_taken(kNumberOfElements);
+    std::atomic<std::uint32_t> number_taken{0U};
+    const auto take = [&times_taken, &number_taken](const std::unique_ptr<std::uint32_t>& element) {
+        times_taken.at(*element)++;
+        number_taken++;
+    };
+
+    // When thieves steal concurrently
+    std::array<std::thread, kNumberOfThieves> thieves{};
+    for (auto& thief : thieves)
+    {
+        thief = std::thread{[&unit, &number_taken, &take]() {
+            while (number_taken < kNumberOfElements)
+            {
+                auto element = unit.Steal();
+                if (element.has_value())
+                {
+                    take(element.value());
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+    }
+    for (std::uint32_t value = 0U; value < kNumberOfElements; ++value)
+    {
+        auto element = std::make_unique<std::uint32_t>(value);
+        while (!unit.Push(element))
+        {
+            std::this_thread::yield();
+        }
+        if ((value % 3U) == 0U)
+        {
+            auto popped = unit.Pop();
+            if (popped.has_value())
+            {
+                take(popped.value());
+            }
+        }
+    }
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    // Then every element was taken exactly once
+    for (const auto& taken : times_taken)
+    {
+        ASSERT_EQ(taken, 1U);
+    }
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,371 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/work_stealing_thread_pool.h"
+#include "score/os/pthread.h"
+#if defined(__QNX__)
+#include "score/os/qnx_pthread.h"
+#elif defined(__linux__)
+#include "score/os/linux_pthread.h"
+#endif  // __QNX__
+
+#include "score/utility.hpp"
+
+#include <functional>
+#include <thread>
+
+namespace
+{
+
+// Number of unsuccessful searches for a task, after which an idle worker stops spinning and parks.
+constexpr std::uint32_t kSpinRoundsBeforeParking{64U};
+
+// Suppress "AUTOSAR C++14 A3-3-2" rule finding. This rule states: "Static and thread-local objects shall be
+// constant-initialized.".
+// Both objects are constant-initialized, the finding is a false positive.
+// The pool and worker index of the calling thread, if it is a worker thread. Used to enqueue tasks which are posted
+// from within a task into the local queue of the executing worker.
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local const score::concurrency::WorkStealingThreadPool* current_pool{nullptr};
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local std::size_t current_worker{0U};
+
+// xorshift32, sufficient to spread the victims of concurrent thieves.
+std::uint32_t NextRandom(std::uint32_t& state) noexcept
+{
+    state ^= state << 13U;
+    state ^= state >> 17U;
+    state ^= state << 5U;
+    return state;
+}
+
+}  // namespace
+
+score::concurrency::WorkStealingThreadPool::Worker::Worker(score::cpp::pmr::memory_resource* memory_resource)
+    : local_queue{kLocalQueueCapacity, memory_resource}, inbox{memory_resource}, active{score::cpp::nostopstate}
+{
+}
+
+score::concurrency::WorkStealingThreadPool::WorkStealingThreadPool(const std::size_t number_of_threads,
+                                                                 const std::string& name)
+    : WorkStealingThreadPool(number_of_threads, score::cpp::pmr::get_default_resource(), name)
+{
+}
+
+score::concurrency::WorkStealingThreadPool::WorkStealingThreadPool(const std::size_t number_of_threads,
+                                                                 score::cpp::pmr::memory_resource* memory_resource,
+                                                                 const std::string& name)
+    : Executor(memory_resource)
+{
+    InitializeThreads(number_of_threads, name);
+}
+
+void score::concurrency::WorkStealingThreadPool::InitializeThreads(const std::size_t number_of_threads,
+                                                                 const std::string& name)
+{
+    // All workers have to exist before the first thread starts to steal from them.
+    workers_.reserve(number_of_threads);
+    for (std::size_t thread_number = 0u; thread_number < number_of_threads; thread_number++)
+    {
+        workers_.push_back(score::cpp::pmr::make_unique<Worker>(this->GetMemoryResource(), this->GetMemoryResource()));
+    }
+    pool_.reserve(number_of_threads);
+
+    std::unique_ptr<score::os::Pthread> pthread;
+    // coverity[autosar_cpp14_a16_0_1_violation] must have implementation selection
+#if defined(__QNX__)
+    pthread = std::make_unique<score::os::QnxPthread>();
+    // coverity[autosar_cpp14_a16_0_1_violation] must have implementation selection
+#elif defined(__linux__)
+    pthread = std::make_unique<score::os::LinuxPthread>();
+    // coverity[autosar_cpp14_a16_0_1_violation] must have implementation selection
+#endif  // __QNX__
+
+    for (std::size_t thread_number = 0u; thread_number < number_of_threads; thread_number++)
+    {
+        score::cpp::jthread worker_thread{[this, thread_number](score::cpp::stop_token stop_token) {
+            Work(thread_number, std::move(stop_token));
+        }};
+
+        score::cpp::ignore =
+            pthread->setname_np(worker_thread.native_handle(), (name + "_" + std::to_string(thread_number)).c_str());
+        pool_.push_back(std::move(worker_thread));
+    }
+}
+
+void score::concurrency::WorkStealingThreadPool::Work(const std::size_t thread_number,
+                                                    const score::cpp::stop_token stop_token)
+{
+    current_pool = this;
+    current_worker = thread_number;
+    auto& worker = *workers_.at(thread_number);
+    std::uint32_t random_state{static_cast<std::uint32_t>(thread_number) + 1U};
+    std::uint32_t idle_rounds{0U};
+
+    for (;;)
+    {
+        // The stop has to be observed before searching for tasks. Otherwise, a task which was enqueued right before
+        // the stop was requested could be missed.
+        const bool stop_requested = stop_token.stop_requested();
+        auto task = FindTask(thread_number, random_state);
+        if (task != nullptr)
+        {
+            idle_rounds = 0U;
+            Run(worker, std::move(task));
+        }
+        else if (stop_requested)
+        {
+            // Every worker drains its own queues before it exits, so nothing is left behind.
+            break;
+        }
+        else if (idle_rounds < kSpinRoundsBeforeParking)
+        {
+            ++idle_rounds;
+            std::this_thread::yield();
+        }
+        else
+        {
+            Park(stop_token);
+            idle_rounds = 0U;
+        }
+    }
+    current_pool = nullptr;
+}
+
+score::concurrency::WorkStealingThreadPool::TaskPtr score::concurrency::WorkStealingThreadPool::FindTask(
+    const std::size_t thread_number,
+    std::uint32_t& random_state) noexcept
+{
+    auto& worker = *workers_[thread_number];
+    auto task = worker.local_queue.Pop();
+    if (task.has_value())
+    {
+        return std::move(task.value());
+    }
+
+    if (worker.inbox_size.load(std::memory_order_relaxed) > 0U)
+    {
+        auto task_from_inbox = TakeFromOwnInbox(worker);
+        if (task_from_inbox != nullptr)
+        {
+            return task_from_inbox;
+        }
+    }
+
+    const auto number_of_workers = workers_.size();
+    const auto first_victim = static_cast<std::size_t>(NextRandom(random_state)) % number_of_workers;
+    for (std::size_t offset = 0U; offset < number_of_workers; ++offset)
+    {
+        const auto victim_number = (first_victim + offset) % number_of_workers;
+        if (victim_number == thread_number)
+        {
+            continue;
+        }
+        auto& victim = *workers_[victim_number];
+        auto stolen_task = victim.local_queue.Steal();
+        if (stolen_task.has_value())
+        {
+            return std::move(stolen_task.value());
+        }
+        if (victim.inbox_size.load(std::memory_order_relaxed) > 0U)
+        {
+            auto task_from_inbox = StealFromInbox(victim);
+            if (task_from_inbox != nullptr)
+            {
+                return task_from_inbox;
+            }
+        }
+    }
+    return nullptr;
+}
+
+score::concurrency::WorkStealingThreadPool::TaskPtr score::concurrency::WorkStealingThreadPool::TakeFromOwnInbox(
+    Worker& worker) noexcept
+{
+    std::lock_guard<std::mutex> lock{worker.inbox_mutex};
+    if (worker.inbox.empty())
+    {
+        return nullptr;
+    }
+    auto task = std::move(worker.inbox.front());
+    worker.inbox.pop_front();
+
+    // Move the remaining tasks to the local queue in one go, so they can be executed and stolen without the lock.
+    while ((!worker.inbox.empty()) && worker.local_queue.Push(worker.inbox.front()))
+    {
+        worker.inbox.pop_front();
+    }
+    worker.inbox_size.store(worker.inbox.size());
+    return task;
+}
+
+score::concurrency::WorkStealingThreadPool::TaskPtr score::concurrency::WorkStealingThreadPool::StealFromInbox(
+    Worker& victim) noexcept
+{
+    // Never wait for a lock while searching, the owner or a poster will make progress with it anyway.
+    std::unique_lock<std::mutex> lock{victim.inbox_mutex, std::try_to_lock};
+    if ((!lock.owns_lock()) || victim.inbox.empty())
+    {
+        return nullptr;
+    }
+    auto task = std::move(victim.inbox.front());
+    victim.inbox.pop_front();
+    victim.inbox_size.store(victim.inbox.size());
+    return task;
+}
+
+bool score::concurrency::WorkStealingThreadPool::WorkAvailable() const noexcept
+{
+    for (const auto& worker : workers_)
+    {
+        if ((worker->inbox_size.load() > 0U) || (!worker->local_queue.Empty()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void score::concurrency::WorkStealingThreadPool::Park(const score::cpp::stop_token& stop_token)
+{
+    std::unique_lock<std::mutex> lock{park_mutex_};
+    const auto wake_up_count = wake_up_count_;
+    // Pairs with the load in Enqueue(): Either the poster sees the parked worker and wakes it up or the worker sees
+    // the task of the poster. Both accesses are sequentially consistent.
+    score::cpp::ignore = number_of_parked_workers_.fetch_add(1U);
+    if (!WorkAvailable())
+    {
+        score::cpp::ignore = park_condition_.wait(lock, stop_token, [this, wake_up_count]() noexcept -> bool {
+            return wake_up_count_ != wake_up_count;
+        });
+    }
+    score::cpp::ignore = number_of_parked_workers_.fetch_sub(1U);
+}
+
+void score::concurrency::WorkStealingThreadPool::WakeUpOne() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{park_mutex_};
+        ++wake_up_count_;
+    }
+    park_condition_.notify_one();
+}
+
+std::size_t score::concurrency::WorkStealingThreadPool::MaxConcurrencyLevel() const noexcept
+{
+    return pool_.size();
+}
+
+void score::concurrency::WorkStealingThreadPool::Shutdown() noexcept
+{
+    InternalShutdown();
+}
+
+void score::concurrency::WorkStealingThreadPool::InternalShutdown() noexcept
+{
+    // we set this flag as first step so that no new tasks will get added to any queue
+    shutdown_requested_.store(true);
+
+    // Enqueue() checks the flag under the inbox lock. Once every lock was taken, all tasks which were added before
+    // are visible to the workers, which will drain them before they exit.
+    for (auto& worker : workers_)
+    {
+        std::lock_guard<std::mutex> lock{worker->inbox_mutex};
+    }
+    for (auto& worker : workers_)
+    {
+        std::lock_guard<std::mutex> lock{worker->active_mutex};
+        score::cpp::ignore = worker->active.request_stop();
+    }
+    for (auto& worker_thread : pool_)
+    {
+        score::cpp::ignore = worker_thread.request_stop();
+    }
+}
+
+bool score::concurrency::WorkStealingThreadPool::ShutdownRequested() const noexcept
+{
+    return shutdown_requested_.load();
+}
+
+void score::concurrency::WorkStealingThreadPool::Enqueue(score::cpp::pmr::unique_ptr<Task> task)
+{
+    if (ShutdownRequested() || workers_.empty())
+    {
+        Execute(std::move(task));
+        return;
+    }
+
+    const bool is_worker_of_this_pool = current_pool == this;
+    if (is_worker_of_this_pool)
+    {
+        // The worker drains its local queue before it exits, so there is no race with a concurrent shutdown.
+        if (workers_[current_worker]->local_queue.Push(task))
+        {
+            // Only best effort, since the local queue is not sequentially consistent. This is fine, since the
+            // executing worker will pick up the task anyway.
+            if (number_of_parked_workers_.load(std::memory_order_relaxed) > 0U)
+            {
+                WakeUpOne();
+            }
+            return;
+        }
+    }
+
+    const auto worker_number = is_worker_of_this_pool
+                                   ? current_worker
+                                   : (next_inbox_.fetch_add(1U, std::memory_order_relaxed) % workers_.size());
+    auto& worker = *workers_[worker_number];
+    {
+        // NOTE: The flag has to be checked under the lock, see InternalShutdown().
+        std::unique_lock<std::mutex> lock{worker.inbox_mutex};
+        if (ShutdownRequested())
+        {
+            lock.unlock();
+            Execute(std::move(task));
+            return;
+        }
+        score::cpp::ignore = worker.inbox.emplace_back(std::move(task));
+        worker.inbox_size.store(worker.inbox.size());
+    }
+    if (number_of_parked_workers_.load() > 0U)
+    {
+        WakeUpOne();
+    }
+}
+
+void score::concurrency::WorkStealingThreadPool::Run(Worker& worker, TaskPtr task)
+{
+    {
+        std::lock_guard<std::mutex> lock{worker.active_mutex};
+        worker.active = task->GetStopSource();
+    }
+    Execute(std::move(task));
+    {
+        std::lock_guard<std::mutex> lock{worker.active_mutex};
+        worker.active = score::cpp::stop_source{score::cpp::nostopstate};
+    }
+}
+
+void score::concurrency::WorkStealingThreadPool::Execute(TaskPtr task)
+{
+    if (ShutdownRequested())
+    {
+        score::cpp::ignore = task->GetStopSource().request_stop();
+    }
+    std::invoke(*task, task->GetStopSource().get_token());
+}
+
+score::concurrency::WorkStealingThreadPool::~WorkStealingThreadPool() noexcept
+{
+    InternalShutdown();
+}
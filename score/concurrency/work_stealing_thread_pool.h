@@ -0,0 +1,143 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_WORK_STEALING_THREAD_POOL_H
+#define SCORE_LIB_CONCURRENCY_WORK_STEALING_THREAD_POOL_H
+
+#include "score/concurrency/condition_variable.h"
+#include "score/concurrency/executor.h"
+#include "score/concurrency/task.h"
+#include "score/concurrency/work_stealing_deque.h"
+
+#include <score/deque.hpp>
+#include <score/jthread.hpp>
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+#include <score/stop_token.hpp>
+#include <score/vector.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace score
+{
+namespace concurrency
+{
+
+/**
+ * \brief WorkStealingThreadPool is an execution policy for the Executor interface with the same semantics as
+ * ThreadPool, but which scales to many short tasks and many threads posting them.
+ *
+ * The ThreadPool serializes every Post() and every task start on one mutex. Here every worker owns a
+ * WorkStealingDeque. Tasks which are posted from within a task go to the deque of the executing worker without any
+ * lock. Tasks which are posted from other threads are distributed round-robin to small per-worker inboxes, so posters
+ * only contend with each other if they hit the same worker. A worker which runs out of tasks steals from the other
+ * workers, starting at a random victim. If there is nothing to steal, it spins for a few rounds and then parks on a
+ * condition variable. Posters only notify if a worker is parked.
+ *
+ * Shutdown behaves like for ThreadPool: Already queued tasks are still executed, but with a stop requested on their
+ * token. Tasks which are enqueued after Shutdown() are executed synchronously in the calling thread. The same applies
+ * to a pool without any threads.
+ *
+ * Apart from the inboxes, all memory is allocated upon construction. In order to be used in safety systems, a
+ * memory_resource can be injected which will be used for the dynamic allocation.
+ */
+class WorkStealingThreadPool final : public Executor
+{
+  public:
+    /**
+     * \brief Creates a thread pool with a fixed size number of threads.
+     * It will use HEAP Memory allocation for queueing any enqueued tasks.
+     *
+     * \param number_of_threads The number of threads that will be started
+     * \param name The name assigned to this pool. Threads will inherit this name with a counter attached to it.
+     */
+    explicit WorkStealingThreadPool(const std::size_t number_of_threads,
+                                    const std::string& name = "workstealingpool");
+
+    /**
+     * \brief Creates a thread pool with a fixed size number of threads.
+     *
+     * \param number_of_threads The number of threads that will be started
+     * \param memory_resource The resource to acquire memory for the workers and for enqueuing tasks
+     * \param name The name assigned to this pool. Threads will inherit this name with a counter attached to it.
+     */
+    explicit WorkStealingThreadPool(const std::size_t number_of_threads,
+                                    score::cpp::pmr::memory_resource* memory_resource,
+                                    const std::string& name = "workstealingpool");
+
+    ~WorkStealingThreadPool() noexcept override;
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool(WorkStealingThreadPool&&) noexcept = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(WorkStealingThreadPool&&) noexcept = delete;
+
+    std::size_t MaxConcurrencyLevel() const noexcept override;
+    bool ShutdownRequested() const noexcept override;
+    void Shutdown() noexcept override;
+    void Enqueue(score::cpp::pmr::unique_ptr<Task> task) override;
+
+    /// \brief Number of tasks each worker can hold in its lock-free deque.
+    static constexpr std::size_t kLocalQueueCapacity{256U};
+
+  private:
+    using TaskPtr = score::cpp::pmr::unique_ptr<Task>;
+
+    struct alignas(64) Worker
+    {
+        explicit Worker(score::cpp::pmr::memory_resource* memory_resource);
+
+        detail::WorkStealingDeque<TaskPtr> local_queue;
+        std::mutex inbox_mutex{};
+        score::cpp::pmr::deque<TaskPtr> inbox;
+        // Mirrors inbox.size() so that idle workers can check it without taking the lock.
+        std::atomic<std::size_t> inbox_size{0U};
+        std::mutex active_mutex{};
+        score::cpp::stop_source active;
+    };
+
+    void InitializeThreads(const std::size_t number_of_threads, const std::string& name);
+    void Work(const std::size_t thread_number, const score::cpp::stop_token stop_token);
+    TaskPtr FindTask(const std::size_t thread_number, std::uint32_t& random_state) noexcept;
+    TaskPtr TakeFromOwnInbox(Worker& worker) noexcept;
+    TaskPtr StealFromInbox(Worker& victim) noexcept;
+    bool WorkAvailable() const noexcept;
+    void Park(const score::cpp::stop_token& stop_token);
+    void WakeUpOne() noexcept;
+    void Run(Worker& worker, TaskPtr task);
+    void Execute(TaskPtr task);
+    // Required since the pool needs to call shutdown within its destructor but that method is virtual.
+    // See also MISRA.DTOR.DYNAMIC
+    void InternalShutdown() noexcept;
+
+    std::atomic_bool shutdown_requested_{false};
+    std::atomic<std::size_t> next_inbox_{0U};
+    score::cpp::pmr::vector<score::cpp::pmr::unique_ptr<Worker>> workers_{this->GetMemoryResource()};
+
+    std::mutex park_mutex_{};
+    InterruptibleConditionalVariable park_condition_{};
+    std::atomic<std::size_t> number_of_parked_workers_{0U};
+    std::uint64_t wake_up_count_{0U};
+
+    // This is intentionally last, since this will ensure that on destruction we first wait for all threads to stop
+    // before we destruct anything else.
+    score::cpp::pmr::vector<score::cpp::jthread> pool_{this->GetMemoryResource()};
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_WORK_STEALING_THREAD_POOL_H
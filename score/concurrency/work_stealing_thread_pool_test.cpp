@@ -0,0 +1,620 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/work_stealing_thread_pool.h"
+#include "score/concurrency/notification.h"
+
+#include "score/memory_resource.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+TEST(WorkStealingThreadPool, ConstructionAndDestructionOnStack)
+{
+    WorkStealingThreadPool thread_pool{1U};
+}
+
+TEST(WorkStealingThreadPool, ConstructionAndDestructionOnHeap)
+{
+    auto unique_thread_pool = std::make_unique<WorkStealingThreadPool>(1U);
+    unique_thread_pool.reset();
+}
+
+TEST(WorkStealingThreadPool, ConstructionAndDestructionOnHeapWithBasePointer)
+{
+    std::unique_ptr<WorkStealingThreadPool> unique_thread_pool = std::make_unique<WorkStealingThreadPool>(1U);
+    unique_thread_pool.reset();
+}
+
+TEST(WorkStealingThreadPool, executesSubmittedCallables)
+{
+    // Given a WorkStealingThreadPool with two threads
+    WorkStealingThreadPool unit{2U};
+
+    // When submitting two tasks
+    std::atomic<std::size_t> counter{0};
+    auto f = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        counter++;
+    });
+    auto f2 = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        counter++;
+    });
+
+    // That both tasks are executed
+    EXPECT_TRUE(f.Get());
+    EXPECT_TRUE(f2.Get());
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, correctMaxConcurrencyLevel)
+{
+    // Given a WorkStealingThreadPool with 5 threads
+    WorkStealingThreadPool unit{5U};
+
+    // When querying the maximum concurrency level
+    // That 5 is returned
+    ASSERT_EQ(unit.MaxConcurrencyLevel(), 5U);
+}
+
+TEST(WorkStealingThreadPool, stopRequestFunctional)
+{
+    // Given a WorkStealingThreadPool with two threads, that includes two long running tasks
+    WorkStealingThreadPool unit{2U};
+
+    std::atomic<std::size_t> counter{0};
+    unit.Post([&counter](const score::cpp::stop_token& token) noexcept {
+        counter++;
+        while (!token.stop_requested())
+        {
+            std::this_thread::yield();
+        }
+    });
+    unit.Post([&counter](const score::cpp::stop_token& token) noexcept {
+        counter++;
+        while (!token.stop_requested())
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    // Ensuring that both tasks have started
+    while (counter != 2)
+    {
+        std::this_thread::yield();
+    }
+
+    // When calling the WorkStealingThreadPool to shutdown
+    ASSERT_FALSE(unit.ShutdownRequested());
+    unit.Shutdown();
+
+    // That the shutdown request is executed respectively
+    ASSERT_TRUE(unit.ShutdownRequested());
+}
+
+TEST(WorkStealingThreadPool, DestructionStopsAndJoinsThreads)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool with two threads
+    std::optional<WorkStealingThreadPool> unit{2U};
+
+    // When posting two long running tasks
+    unit->Post([&counter](const score::cpp::stop_token& token) noexcept {
+        while (!token.stop_requested())
+        {
+            std::this_thread::yield();
+        }
+        ++counter;
+    });
+    unit->Post([&counter](const score::cpp::stop_token& token) noexcept {
+        while (!token.stop_requested())
+        {
+            std::this_thread::yield();
+        }
+        ++counter;
+    });
+
+    // And immediately destroying the WorkStealingThreadPool afterwards
+    unit.reset();
+
+    // Then it must shutdown its worker threads
+    // And still guarantee the execution of all queued tasks
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, CanAbortThread)
+{
+    // Given a WorkStealingThreadPool with two threads, that includes one long running tasks
+    WorkStealingThreadPool unit{2U};
+
+    std::atomic<bool> abort_token_set{false};
+    auto result = unit.Submit([&abort_token_set](const score::cpp::stop_token& token) noexcept {
+        while (!token.stop_requested())
+        {
+            std::this_thread::yield();
+        }
+        abort_token_set = true;
+    });
+
+    // When the user is aborting the long running task
+    result.Abort();
+
+    // That it is requested to shutdown
+    while (!abort_token_set)
+    {
+        std::this_thread::yield();
+    };
+}
+
+TEST(WorkStealingThreadPool, PostTaskFromWithinAnotherTask)
+{
+    std::atomic<std::size_t> counter{0};
+    concurrency::Notification first_done{};
+    concurrency::Notification second_done{};
+
+    // Given a WorkStealingThreadPool with two threads
+    WorkStealingThreadPool unit{2U};
+
+    // When posting a task which itself posts another task
+    unit.Post([&](const score::cpp::stop_token&) {
+        unit.Post([&](const score::cpp::stop_token&) {
+            ++counter;
+            second_done.notify();
+        });
+        ++counter;
+        first_done.notify();
+    });
+
+    second_done.waitWithAbort({});
+    first_done.waitWithAbort({});
+
+    // Then both tasks must have gotten executed asynchronously
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, SubmitTaskFromWithinAnotherTask)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool with two threads
+    WorkStealingThreadPool unit{2U};
+
+    // When submitting a task which itself submits another task
+    unit.Submit([&](const score::cpp::stop_token&) noexcept {
+            unit.Submit([&](const score::cpp::stop_token&) noexcept {
+                    ++counter;
+                })
+                .Wait();
+            ++counter;
+        })
+        .Wait();
+
+    // Then both tasks must have gotten executed asynchronously
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, PostTaskFromWithinAnotherTaskAfterShutdown)
+{
+    std::atomic<std::size_t> counter{0};
+    concurrency::Notification first_done{};
+    concurrency::Notification second_done{};
+
+    // Given a WorkStealingThreadPool without any thread which got already shutdown
+    WorkStealingThreadPool unit{0U};
+    unit.Shutdown();
+
+    ASSERT_TRUE(unit.ShutdownRequested());
+
+    // When posting a task which itself posts another task
+    unit.Post([&](const score::cpp::stop_token&) {
+        unit.Submit([&](const score::cpp::stop_token&) {
+            ++counter;
+            second_done.notify();
+        });
+        ++counter;
+        first_done.notify();
+    });
+
+    second_done.waitWithAbort({});
+    first_done.waitWithAbort({});
+
+    // Then both tasks must have gotten executed synchronously
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, SubmitTaskFromWithinAnotherTaskAfterShutdown)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool without any thread which got already shutdown
+    WorkStealingThreadPool unit{0U};
+    unit.Shutdown();
+
+    ASSERT_TRUE(unit.ShutdownRequested());
+
+    // When submitting a task which itself submits another task
+    unit.Submit([&unit, &counter](const score::cpp::stop_token&) noexcept {
+        unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+            ++counter;
+        });
+        ++counter;
+    });
+
+    // Then both tasks must have gotten executed synchronously
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, SubmitTaskWhileWorkStealingThreadPoolWasAlreadyRequestedToShutDown)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool without any thread which got already shutdown
+    WorkStealingThreadPool unit{0U};
+    unit.Shutdown();
+
+    // When submitting one task
+    ASSERT_TRUE(unit.ShutdownRequested());
+    auto f = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        ++counter;
+    });
+
+    // Then the task must have gotten executed nonetheless
+    ASSERT_EQ(counter, 1U);
+}
+
+TEST(WorkStealingThreadPool, PostTaskWhileWorkStealingThreadPoolWasAlreadyRequestedToShutDown)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool without any thread which got already shutdown
+    WorkStealingThreadPool unit{0U};
+    unit.Shutdown();
+
+    // When posting one task
+    ASSERT_TRUE(unit.ShutdownRequested());
+    unit.Post([&counter](const score::cpp::stop_token&) noexcept {
+        ++counter;
+    });
+
+    // Then the task must have gotten executed nonetheless
+    ASSERT_EQ(counter, 1U);
+}
+
+TEST(WorkStealingThreadPool, SubmitTaskAndDestroyWorkStealingThreadPoolDirectlyAfterwards)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool with one thread
+    std::optional<WorkStealingThreadPool> unit{1U};
+
+    // When submitting one task prior to destroying the WorkStealingThreadPool
+    auto f = unit->Submit([&counter](const score::cpp::stop_token&) noexcept {
+        ++counter;
+    });
+
+    // And destroying the WorkStealingThreadPool directly afterwards
+    unit.reset();
+
+    // Then the task must have gotten executed nonetheless
+    f.Wait();
+    ASSERT_EQ(counter, 1U);
+}
+
+TEST(WorkStealingThreadPool, PostTaskAndDestroyWorkStealingThreadPoolDirectlyAfterwards)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool with one thread
+    std::optional<WorkStealingThreadPool> unit{1U};
+
+    // When posting one task prior to destroying the WorkStealingThreadPool
+    unit->Post([&counter](const score::cpp::stop_token&) noexcept {
+        ++counter;
+    });
+
+    // And destroying the WorkStealingThreadPool directly afterwards
+    unit.reset();
+
+    // Then the task must have gotten executed nonetheless
+    ASSERT_EQ(counter, 1U);
+}
+
+TEST(WorkStealingThreadPool, SubmitTasksWhileWorkStealingThreadPoolGetsShutDown)
+{
+    constexpr std::size_t kMaxNumRuns{1000};
+    constexpr std::size_t kNumSubmits{10};
+    std::atomic<std::size_t> counter{0};
+
+    for (std::size_t num_run{1}; num_run <= kMaxNumRuns; ++num_run)
+    {
+        concurrency::Notification producer_is_running{};
+
+        // Given a WorkStealingThreadPool with one thread
+        WorkStealingThreadPool unit{1U};
+
+        // When repeatedly submitting tasks
+        auto producer_finished = std::async(std::launch::async, [&] {
+            producer_is_running.notify();
+            for (std::size_t num_submit{0}; num_submit < kNumSubmits; ++num_submit)
+            {
+                auto task_future = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+                    ++counter;
+                });
+                task_future.Wait();
+            }
+        });
+
+        // At the same time while the WorkStealingThreadPool gets requested to shut down
+        auto thread_pool_got_shutdown = std::async([&] {
+            producer_is_running.waitWithAbort({});
+            unit.Shutdown();
+            ASSERT_TRUE(unit.ShutdownRequested());
+        });
+
+        // Then all submitted tasks must have gotten executed
+        thread_pool_got_shutdown.wait();
+        producer_finished.wait();
+        ASSERT_EQ(counter, num_run * kNumSubmits);
+    };
+}
+
+TEST(WorkStealingThreadPool, PostTasksWhileWorkStealingThreadPoolGetsShutDown)
+{
+    constexpr std::size_t kMaxNumRuns{1000};
+    constexpr std::size_t kNumSubmits{10};
+    std::atomic<std::size_t> counter{0};
+
+    for (std::size_t num_run{1}; num_run <= kMaxNumRuns; ++num_run)
+    {
+        concurrency::Notification producer_is_running{};
+
+        // Given a WorkStealingThreadPool with one thread
+        WorkStealingThreadPool unit{1U};
+
+        // When repeatedly posting tasks
+        auto producer_finished = std::async(std::launch::async, [&] {
+            producer_is_running.notify();
+            for (std::size_t num_submit{0}; num_submit < kNumSubmits; ++num_submit)
+            {
+                unit.Post([&counter](const score::cpp::stop_token&) noexcept {
+                    ++counter;
+                });
+            }
+            const auto start = std::chrono::steady_clock::now();
+            constexpr std::chrono::seconds kMaxWait{10};
+            while (counter != (num_run * kNumSubmits))
+            {
+                if (std::chrono::steady_clock::now() > (start + kMaxWait))
+                {
+                    ASSERT_EQ(counter, num_run * kNumSubmits);
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        });
+
+        // While at the same time shutting down the WorkStealingThreadPool
+        auto thread_pool_got_shutdown = std::async([&] {
+            producer_is_running.waitWithAbort({});
+            unit.Shutdown();
+            ASSERT_TRUE(unit.ShutdownRequested());
+        });
+
+        // Then all posted tasks must have gotten executed
+        thread_pool_got_shutdown.wait();
+        producer_finished.wait();
+        ASSERT_EQ(counter, num_run * kNumSubmits);
+    };
+}
+
+class TaskMemoryResource : public score::cpp::pmr::memory_resource
+{
+  private:
+    // The workers are over-aligned, so the alignment must be respected.
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocated_memory_ += bytes;
+        return ::operator new(bytes, std::align_val_t{alignment});
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        allocated_memory_ -= bytes;
+        ::operator delete(p, std::align_val_t{alignment});
+    }
+    bool do_is_equal(const memory_resource&) const noexcept override
+    {
+        return false;
+    };
+
+  public:
+    std::atomic<std::size_t> allocated_memory_{};
+};
+
+TEST(WorkStealingThreadPool, UsingCustomMemoryResource)
+{
+    // Given a WorkStealingThreadPool that uses a custom memory resource
+    TaskMemoryResource memory_resource{};
+    std::atomic<std::size_t> counter{0};
+    WorkStealingThreadPool unit{2U, &memory_resource};
+
+    // When submitting tasks
+    auto f = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        counter++;
+    });
+    auto f2 = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        counter++;
+    });
+
+    // That these tasks are allocated on the custom memory resource
+    ASSERT_GT(memory_resource.allocated_memory_, 0);
+    EXPECT_TRUE(f.Get());
+    EXPECT_TRUE(f2.Get());
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(WorkStealingThreadPool, AllocatesWorkersOnCustomMemoryResource)
+{
+    // Given a custom memory resource
+    TaskMemoryResource memory_resource{};
+
+    // When creating a WorkStealingThreadPool without enqueuing any task
+    std::optional<WorkStealingThreadPool> unit{};
+    unit.emplace(2U, &memory_resource);
+
+    // Then the workers and their queues are allocated on the custom memory resource
+    ASSERT_GT(memory_resource.allocated_memory_, 0);
+
+    // And everything is given back on destruction
+    unit.reset();
+    ASSERT_EQ(memory_resource.allocated_memory_, 0);
+}
+
+TEST(WorkStealingThreadPool, TasksPostedFromWithinATaskAreStolenByOtherWorkers)
+{
+    constexpr std::size_t kNumberOfChildTasks{WorkStealingThreadPool::kLocalQueueCapacity / 2U};
+    std::mutex thread_ids_mutex{};
+    std::set<std::thread::id> thread_ids{};
+    std::atomic<std::size_t> counter{0};
+    concurrency::Notification all_posted{};
+    concurrency::Notification all_done{};
+
+    // Given a WorkStealingThreadPool with two threads
+    WorkStealingThreadPool unit{2U};
+
+    // When a task posts many child tasks into the local queue of its worker and keeps that worker busy afterwards
+    unit.Post([&](const score::cpp::stop_token&) {
+        for (std::size_t i = 0U; i < kNumberOfChildTasks; ++i)
+        {
+            unit.Post([&](const score::cpp::stop_token&) {
+                {
+                    std::lock_guard<std::mutex> lock{thread_ids_mutex};
+                    score::cpp::ignore = thread_ids.insert(std::this_thread::get_id());
+                }
+                if (++counter == kNumberOfChildTasks)
+                {
+                    all_done.notify();
+                }
+            });
+        }
+        all_posted.notify();
+        all_done.waitWithAbort({});
+    });
+
+    // Then the other worker steals and executes all child tasks
+    all_posted.waitWithAbort({});
+    all_done.waitWithAbort({});
+    ASSERT_EQ(counter, kNumberOfChildTasks);
+    ASSERT_EQ(thread_ids.size(), 1U);
+}
+
+TEST(WorkStealingThreadPool, OverflowOfTheLocalQueueIsExecutedNonetheless)
+{
+    constexpr std::size_t kNumberOfChildTasks{WorkStealingThreadPool::kLocalQueueCapacity * 4U};
+    std::atomic<std::size_t> counter{0};
+
+    // Given a WorkStealingThreadPool with one thread
+    std::optional<WorkStealingThreadPool> unit{1U};
+
+    // When a task posts more child tasks than fit into the local queue of its worker
+    auto f = unit->Submit([&](const score::cpp::stop_token&) noexcept {
+        for (std::size_t i = 0U; i < kNumberOfChildTasks; ++i)
+        {
+            unit->Post([&counter](const score::cpp::stop_token&) {
+                ++counter;
+            });
+        }
+    });
+    f.Wait();
+
+    // And destroying the WorkStealingThreadPool afterwards
+    unit.reset();
+
+    // Then all child tasks must have gotten executed
+    ASSERT_EQ(counter, kNumberOfChildTasks);
+}
+
+TEST(WorkStealingThreadPool, ManyPostersAndWorkersExecuteEveryTaskExactlyOnce)
+{
+    constexpr std::size_t kNumberOfPosters{4U};
+    constexpr std::size_t kTasksPerPoster{5000U};
+    std::vector<std::atomic<std::uint32_t>> times_executed(kNumberOfPosters * kTasksPerPoster);
+
+    // Given a WorkStealingThreadPool with three threads
+    std::optional<WorkStealingThreadPool> unit{3U};
+
+    // When several threads post tasks concurrently
+    std::vector<std::future<void>> posters{};
+    for (std::size_t poster = 0U; poster < kNumberOfPosters; ++poster)
+    {
+        posters.push_back(std::async(std::launch::async, [&unit, &times_executed, poster]() {
+            for (std::size_t i = 0U; i < kTasksPerPoster; ++i)
+            {
+                unit->Post([&times_executed, index = (poster * kTasksPerPoster) + i](const score::cpp::stop_token&) {
+                    times_executed.at(index)++;
+                });
+            }
+        }));
+    }
+    for (auto& poster : posters)
+    {
+        poster.wait();
+    }
+    unit.reset();
+
+    // Then every task got executed exactly once
+    for (const auto& executed : times_executed)
+    {
+        ASSERT_EQ(executed, 1U);
+    }
+}
+
+TEST(WorkStealingThreadPool, ParkedWorkersAreWokenUpByPostedTasks)
+{
+    // Given a WorkStealingThreadPool with two threads which had enough time to park
+    WorkStealingThreadPool unit{2U};
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+    // When repeatedly submitting tasks with pauses in between
+    for (std::size_t i = 0U; i < 10U; ++i)
+    {
+        std::atomic<bool> executed{false};
+        auto f = unit.Submit([&executed](const score::cpp::stop_token&) noexcept {
+            executed = true;
+        });
+
+        // Then every task gets executed
+        f.Wait();
+        ASSERT_TRUE(executed);
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
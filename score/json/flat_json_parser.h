@@ -0,0 +1,57 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_FLAT_JSON_PARSER_H
+#define SCORE_LIB_JSON_FLAT_JSON_PARSER_H
+
+#include "score/json/internal/model/error.h"
+#include "score/json/internal/model/flat_document.h"
+#include "score/result/result.h"
+
+#include <score/memory_resource.hpp>
+
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+
+/// \brief Parses JSON into a FlatDocument instead of a tree of Any
+///
+/// \details The flat representation is meant for large documents which are only read after parsing, e.g.
+/// configuration files loaded at startup. All nodes and strings of a document are placed in one arena, which is
+/// allocated from the given upstream resource in a few large blocks.
+class FlatJsonParser
+{
+  public:
+    /// \brief Parses the underlying file and creates a flat JSON document
+    /// \param file_path The path to the file that shall be parsed
+    /// \param upstream The resource the arena of the document allocates from
+    /// \return the document, error on error
+    score::Result<FlatDocument> FromFile(
+        const std::string_view file_path,
+        score::cpp::pmr::memory_resource* const upstream = score::cpp::pmr::get_default_resource()) const noexcept;
+
+    /// \brief Parses the underlying buffer and creates a flat JSON document
+    /// \param buffer The string_view that shall be parsed, which does not need to outlive the document
+    /// \param upstream The resource the arena of the document allocates from
+    /// \return the document, error on error
+    score::Result<FlatDocument> FromBuffer(
+        const std::string_view buffer,
+        score::cpp::pmr::memory_resource* const upstream = score::cpp::pmr::get_default_resource()) const noexcept;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_FLAT_JSON_PARSER_H
@@ -0,0 +1,205 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/model/flat_document.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+// Objects with at most this number of members are sorted by insertion sort, which is stable without allocating.
+constexpr std::size_t kInsertionSortThreshold{16U};
+
+bool IsKeyLess(const FlatMember& lhs, const FlatMember& rhs) noexcept
+{
+    return lhs.key < rhs.key;
+}
+
+// Sorts the members by key and removes all but the first occurrence of a key, returns the end of the unique range.
+std::vector<FlatMember>::iterator SortAndRemoveDuplicates(const std::vector<FlatMember>::iterator first,
+                                                          const std::vector<FlatMember>::iterator last) noexcept
+{
+    if (static_cast<std::size_t>(std::distance(first, last)) <= kInsertionSortThreshold)
+    {
+        for (auto current = first; current != last; ++current)
+        {
+            std::rotate(std::upper_bound(first, current, *current, IsKeyLess), current, std::next(current));
+        }
+    }
+    else
+    {
+        std::stable_sort(first, last, IsKeyLess);
+    }
+    return std::unique(first, last, [](const FlatMember& lhs, const FlatMember& rhs) noexcept {
+        return lhs.key == rhs.key;
+    });
+}
+
+template <typename T>
+T* AllocateArray(score::cpp::pmr::memory_resource& arena, const std::size_t size)
+{
+    static_assert(std::is_trivially_destructible_v<T>, "The arena never destroys its content");
+    return static_cast<T*>(arena.allocate(size * sizeof(T), alignof(T)));
+}
+
+}  // namespace
+
+FlatObject::const_iterator FlatObject::find(const std::string_view key) const noexcept
+{
+    const auto iterator = std::lower_bound(begin(), end(), key, [](const FlatMember& member, std::string_view value) {
+        return member.key < value;
+    });
+    if ((iterator != end()) && (iterator->key == key))
+    {
+        return iterator;
+    }
+    return end();
+}
+
+score::Result<std::reference_wrapper<const FlatValue>> FlatObject::At(const std::string_view key) const noexcept
+{
+    const auto iterator = find(key);
+    if (iterator == end())
+    {
+        return score::MakeUnexpected(score::json::Error::kKeyNotFound, "Key was not found on the object");
+    }
+    return std::cref(iterator->value);
+}
+
+FlatDocumentBuilder::FlatDocumentBuilder(const std::size_t initial_arena_size,
+                                         score::cpp::pmr::memory_resource* const upstream)
+    : arena_{std::make_unique<score::cpp::pmr::monotonic_buffer_resource>(std::max(initial_arena_size, std::size_t{1U}),
+                                                                          upstream)},
+      pending_values_{},
+      open_containers_{},
+      pending_key_{}
+{
+}
+
+void FlatDocumentBuilder::AddNull() noexcept
+{
+    Add(FlatValue{});
+}
+
+void FlatDocumentBuilder::AddBool(const bool value) noexcept
+{
+    Add(FlatValue{value});
+}
+
+void FlatDocumentBuilder::AddNumber(const Number value) noexcept
+{
+    Add(FlatValue{value});
+}
+
+void FlatDocumentBuilder::AddString(const std::string_view value) noexcept
+{
+    Add(FlatValue{CopyToArena(value)});
+}
+
+void FlatDocumentBuilder::AddKey(const std::string_view key) noexcept
+{
+    pending_key_ = CopyToArena(key);
+}
+
+void FlatDocumentBuilder::StartList() noexcept
+{
+    open_containers_.push_back(OpenContainer{pending_values_.size(), pending_key_});
+    pending_key_ = {};
+}
+
+void FlatDocumentBuilder::EndList() noexcept
+{
+    const auto container = CloseContainer();
+    const auto first = std::next(pending_values_.begin(), static_cast<std::ptrdiff_t>(container.first_child));
+    const auto size = static_cast<std::size_t>(std::distance(first, pending_values_.end()));
+
+    auto* const elements = AllocateArray<FlatValue>(*arena_, size);
+    for (std::size_t index{0U}; index < size; ++index)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) elements points to an array of size
+        score::cpp::ignore = new (&elements[index]) FlatValue{first[static_cast<std::ptrdiff_t>(index)].value};
+    }
+    pending_values_.erase(first, pending_values_.end());
+
+    pending_key_ = container.key;
+    Add(FlatValue{FlatList{elements, size}});
+}
+
+void FlatDocumentBuilder::StartObject() noexcept
+{
+    open_containers_.push_back(OpenContainer{pending_values_.size(), pending_key_});
+    pending_key_ = {};
+}
+
+void FlatDocumentBuilder::EndObject() noexcept
+{
+    const auto container = CloseContainer();
+    const auto first = std::next(pending_values_.begin(), static_cast<std::ptrdiff_t>(container.first_child));
+    const auto last = SortAndRemoveDuplicates(first, pending_values_.end());
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+
+    auto* const members = AllocateArray<FlatMember>(*arena_, size);
+    score::cpp::ignore = std::uninitialized_copy(first, last, members);
+    pending_values_.erase(first, pending_values_.end());
+
+    pending_key_ = container.key;
+    Add(FlatValue{FlatObject{members, size}});
+}
+
+score::Result<FlatDocument> FlatDocumentBuilder::Build() && noexcept
+{
+    if ((!open_containers_.empty()) || (pending_values_.size() != 1U))
+    {
+        return score::MakeUnexpected(score::json::Error::kParsingError, "Document is not complete");
+    }
+    return FlatDocument{std::move(arena_), pending_values_.front().value};
+}
+
+void FlatDocumentBuilder::Add(const FlatValue value) noexcept
+{
+    pending_values_.push_back(FlatMember{pending_key_, value});
+    pending_key_ = {};
+}
+
+std::string_view FlatDocumentBuilder::CopyToArena(const std::string_view value) noexcept
+{
+    if (value.empty())
+    {
+        return {};
+    }
+    auto* const characters = AllocateArray<char>(*arena_, value.size());
+    score::cpp::ignore = std::memcpy(characters, value.data(), value.size());
+    return std::string_view{characters, value.size()};
+}
+
+FlatDocumentBuilder::OpenContainer FlatDocumentBuilder::CloseContainer() noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(!open_containers_.empty());
+    const auto container = open_containers_.back();
+    open_containers_.pop_back();
+    return container;
+}
+
+}  // namespace json
+}  // namespace score
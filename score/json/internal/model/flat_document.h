@@ -0,0 +1,277 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_INTERNAL_MODEL_FLAT_DOCUMENT_H
+#define SCORE_LIB_JSON_INTERNAL_MODEL_FLAT_DOCUMENT_H
+
+#include "score/json/internal/model/error.h"
+#include "score/json/internal/model/null.h"
+#include "score/json/internal/model/number.h"
+#include "score/result/result.h"
+
+#include <score/memory_resource.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace score
+{
+namespace json
+{
+
+class FlatValue;
+struct FlatMember;
+
+/// \brief Read-only view of the elements of a JSON array within a FlatDocument
+class FlatList
+{
+  public:
+    using const_iterator = const FlatValue*;
+
+    FlatList() noexcept = default;
+    FlatList(const FlatValue* const elements, const std::size_t size) noexcept : elements_{elements}, size_{size} {}
+
+    const_iterator begin() const noexcept
+    {
+        return elements_;
+    }
+    const_iterator end() const noexcept;
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+    bool empty() const noexcept
+    {
+        return size_ == 0U;
+    }
+
+    /// \brief Returns the element at the given index, which must be less than size()
+    const FlatValue& operator[](const std::size_t index) const noexcept;
+
+  private:
+    const FlatValue* elements_{nullptr};
+    std::size_t size_{0U};
+};
+
+/// \brief Read-only view of the members of a JSON object within a FlatDocument
+///
+/// \details The members are stored contiguously and sorted by key, thus lookups are binary searches. Like for Object,
+/// only the first occurrence of a duplicated key is kept.
+class FlatObject
+{
+  public:
+    using const_iterator = const FlatMember*;
+
+    FlatObject() noexcept = default;
+    FlatObject(const FlatMember* const members, const std::size_t size) noexcept : members_{members}, size_{size} {}
+
+    const_iterator begin() const noexcept
+    {
+        return members_;
+    }
+    const_iterator end() const noexcept;
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+    bool empty() const noexcept
+    {
+        return size_ == 0U;
+    }
+
+    /// \brief Returns the member with the given key, end() if there is none
+    const_iterator find(const std::string_view key) const noexcept;
+
+    /// \brief Returns the value of the member with the given key, kKeyNotFound if there is none
+    score::Result<std::reference_wrapper<const FlatValue>> At(const std::string_view key) const noexcept;
+
+  private:
+    const FlatMember* members_{nullptr};
+    std::size_t size_{0U};
+};
+
+/// \brief Represents a JSON value within a FlatDocument
+///
+/// \details In contrast to Any, a FlatValue does not own anything. Strings, lists and objects are views into the
+/// arena of the FlatDocument the value belongs to, thus a FlatValue is small and trivially copyable, but only valid as
+/// long as its document exists.
+class FlatValue
+{
+  public:
+    /// \brief Constructs a null value
+    FlatValue() noexcept : value_{Null{}} {}
+
+    /// \brief Constructs a value of one of the types bool, Number, std::string_view, FlatList or FlatObject
+    template <typename T,
+              typename std::enable_if_t<std::is_same_v<T, bool> || std::is_same_v<T, Number> ||
+                                            std::is_same_v<T, std::string_view> || std::is_same_v<T, FlatList> ||
+                                            std::is_same_v<T, FlatObject> || std::is_same_v<T, Null>,
+                                        bool> = true>
+    explicit FlatValue(const T value) noexcept : value_{value}
+    {
+    }
+
+    /// \brief Interpret value as type T
+    /// \tparam T One of Null, Number, std::string_view, FlatList or FlatObject
+    /// \return A result containing the value if the value holds it, an kWrongType Error otherwise
+    template <typename T, typename std::enable_if_t<!std::is_arithmetic<T>::value, bool> = true>
+    score::Result<T> As() const noexcept
+    {
+        const auto* const value = std::get_if<T>(&value_);
+        if (value != nullptr)
+        {
+            return *value;
+        }
+        return score::MakeUnexpected(score::json::Error::kWrongType);
+    }
+
+    /// \brief Convenience method to directly convert a JSON number or boolean into arithmetic type.
+    template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+    score::Result<T> As() const noexcept
+    {
+        const auto* const value = std::get_if<Number>(&value_);
+        if (value != nullptr)
+        {
+            return value->As<T>();
+        }
+
+        // Fallback iff the element contains a bool.
+        const auto* const boolean = std::get_if<bool>(&value_);
+        if (boolean != nullptr)
+        {
+            // The cast from a bool to every arithmetic type is well-defined.
+            return static_cast<T>(*boolean);
+        }
+
+        return score::MakeUnexpected(score::json::Error::kWrongType);
+    }
+
+  private:
+    std::variant<Null, bool, Number, std::string_view, FlatList, FlatObject> value_;
+};
+
+/// \brief A member of a FlatObject
+struct FlatMember
+{
+    std::string_view key;
+    FlatValue value;
+};
+
+inline FlatList::const_iterator FlatList::end() const noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) elements_ points to an array of size_
+    return elements_ + size_;
+}
+
+inline FlatObject::const_iterator FlatObject::end() const noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) members_ points to an array of size_
+    return members_ + size_;
+}
+
+inline const FlatValue& FlatList::operator[](const std::size_t index) const noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is less than size_ by precondition
+    return elements_[index];
+}
+
+/// \brief A JSON document whose values are stored in a single arena
+///
+/// \details The document is the handle for the lifetime of all FlatValues, FlatLists, FlatObjects and string views
+/// obtained from it. The arena is a monotonic buffer resource, so building a document performs a few large
+/// allocations instead of one per node, and destroying it releases them at once. Moving the document does not move
+/// the arena, thus views stay valid.
+class FlatDocument
+{
+  public:
+    FlatDocument(FlatDocument&&) noexcept = default;
+    FlatDocument& operator=(FlatDocument&&) noexcept = default;
+    FlatDocument(const FlatDocument&) = delete;
+    FlatDocument& operator=(const FlatDocument&) = delete;
+    ~FlatDocument() = default;
+
+    /// \brief Returns the root value of the document
+    const FlatValue& GetRoot() const noexcept
+    {
+        return root_;
+    }
+
+  private:
+    friend class FlatDocumentBuilder;
+
+    FlatDocument(std::unique_ptr<score::cpp::pmr::monotonic_buffer_resource> arena, const FlatValue root) noexcept
+        : arena_{std::move(arena)}, root_{root}
+    {
+    }
+
+    std::unique_ptr<score::cpp::pmr::monotonic_buffer_resource> arena_;
+    FlatValue root_;
+};
+
+/// \brief Builds a FlatDocument from a sequence of parser events
+///
+/// \details Values are collected on a scratch stack until the container they belong to is closed. Only then the
+/// container is copied into the arena, with exactly the number of elements it has. Keys and strings are copied into
+/// the arena when they are added, so the source of the events does not need to outlive the document.
+class FlatDocumentBuilder
+{
+  public:
+    /// \brief Creates a builder
+    /// \param initial_arena_size Size of the first block of the arena, e.g. the size of the source document
+    /// \param upstream The resource the arena allocates its blocks from
+    explicit FlatDocumentBuilder(
+        const std::size_t initial_arena_size,
+        score::cpp::pmr::memory_resource* const upstream = score::cpp::pmr::get_default_resource());
+
+    void AddNull() noexcept;
+    void AddBool(const bool value) noexcept;
+    void AddNumber(const Number value) noexcept;
+    void AddString(const std::string_view value) noexcept;
+
+    /// \brief Sets the key of the next value, which must be added to an object
+    void AddKey(const std::string_view key) noexcept;
+
+    void StartList() noexcept;
+    void EndList() noexcept;
+    void StartObject() noexcept;
+    void EndObject() noexcept;
+
+    /// \brief Finishes the document
+    /// \return The document, kParsingError if the events did not describe exactly one complete root value
+    score::Result<FlatDocument> Build() && noexcept;
+
+  private:
+    struct OpenContainer
+    {
+        std::size_t first_child;
+        std::string_view key;
+    };
+
+    void Add(const FlatValue value) noexcept;
+    std::string_view CopyToArena(const std::string_view value) noexcept;
+    OpenContainer CloseContainer() noexcept;
+
+    std::unique_ptr<score::cpp::pmr::monotonic_buffer_resource> arena_;
+    std::vector<FlatMember> pending_values_;
+    std::vector<OpenContainer> open_containers_;
+    std::string_view pending_key_;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_MODEL_FLAT_DOCUMENT_H
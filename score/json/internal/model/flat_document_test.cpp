@@ -0,0 +1,251 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/model/flat_document.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+static_assert(std::is_trivially_copyable_v<FlatValue>, "FlatValues are copied around like views");
+
+class CountingMemoryResource : public score::cpp::pmr::memory_resource
+{
+  public:
+    std::size_t number_of_allocations{0U};
+    std::size_t number_of_deallocations{0U};
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        number_of_allocations++;
+        return score::cpp::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        number_of_deallocations++;
+        score::cpp::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST(FlatDocumentBuilderTest, BuildsScalarRoot)
+{
+    FlatDocumentBuilder builder{64U};
+    builder.AddNumber(Number{std::uint8_t{42U}});
+
+    const auto document = std::move(builder).Build();
+
+    ASSERT_TRUE(document.has_value());
+    EXPECT_EQ(document->GetRoot().As<std::uint8_t>().value(), 42U);
+    EXPECT_EQ(document->GetRoot().As<std::int64_t>().value(), 42);
+    EXPECT_EQ(document->GetRoot().As<std::string_view>().error(), Error::kWrongType);
+}
+
+TEST(FlatDocumentBuilderTest, ConvertsBoolToArithmeticTypes)
+{
+    FlatDocumentBuilder builder{64U};
+    builder.AddBool(true);
+
+    const auto document = std::move(builder).Build();
+
+    ASSERT_TRUE(document.has_value());
+    EXPECT_TRUE(document->GetRoot().As<bool>().value());
+    EXPECT_EQ(document->GetRoot().As<std::uint32_t>().value(), 1U);
+}
+
+TEST(FlatDocumentBuilderTest, BuildsNestedContainers)
+{
+    FlatDocumentBuilder builder{64U};
+    builder.StartObject();
+    builder.AddKey("list");
+    builder.StartList();
+    builder.AddNull();
+    builder.AddString("two");
+    builder.StartObject();
+    builder.AddKey("inner");
+    builder.AddBool(false);
+    builder.EndObject();
+    builder.EndList();
+    builder.AddKey("after");
+    builder.AddNumber(Number{3.5});
+    builder.EndObject();
+
+    const auto document = std::move(builder).Build();
+
+    ASSERT_TRUE(document.has_value());
+    const auto root = document->GetRoot().As<FlatObject>();
+    ASSERT_TRUE(root.has_value());
+    ASSERT_EQ(root->size(), 2U);
+
+    const auto list = root->At("list").value().get().As<FlatList>();
+    ASSERT_TRUE(list.has_value());
+    ASSERT_EQ(list->size(), 3U);
+    EXPECT_TRUE((*list)[0U].As<Null>().has_value());
+    EXPECT_EQ((*list)[1U].As<std::string_view>().value(), "two");
+    const auto inner = (*list)[2U].As<FlatObject>();
+    ASSERT_TRUE(inner.has_value());
+    EXPECT_FALSE(inner->At("inner").value().get().As<bool>().value());
+
+    EXPECT_DOUBLE_EQ(root->At("after").value().get().As<double>().value(), 3.5);
+}
+
+TEST(FlatDocumentBuilderTest, BuildsEmptyContainers)
+{
+    FlatDocumentBuilder builder{64U};
+    builder.StartList();
+    builder.StartObject();
+    builder.EndObject();
+    builder.StartList();
+    builder.EndList();
+    builder.EndList();
+
+    const auto document = std::move(builder).Build();
+
+    ASSERT_TRUE(document.has_value());
+    const auto root = document->GetRoot().As<FlatList>().value();
+    ASSERT_EQ(root.size(), 2U);
+    EXPECT_TRUE(root[0U].As<FlatObject>().value().empty());
+    EXPECT_TRUE(root[1U].As<FlatList>().value().empty());
+}
+
+TEST(FlatDocumentBuilderTest, SortsMembersByKey)
+{
+    FlatDocumentBuilder builder{64U};
+    builder.StartObject();
+    for (const auto* const key : {"delta", "alpha", "charlie", "bravo"})
+    {
+        builder.AddKey(key);
+        builder.AddString(key);
+    }
+    builder.EndObject();
+
+    const auto document = std::move(builder).Build();
+
+    ASSERT_TRUE(document.has_value());
+    const auto object = document->GetRoot().As<FlatObject>().value();
+    std::vector<std::string_view> keys{};
+    for (const auto& member : object)
+    {
+        keys.push_back(member.key);
+        EXPECT_EQ(member.value.As<std::string_view>().value(), member.key);
+    }
+    EXPECT_EQ(keys, (std::vector<std::string_view>{"alpha", "bravo", "charlie", "delta"}));
+    EXPECT_EQ(object.find("echo"), object.end());
+    EXPECT_EQ(object.At("echo").error(), Error::kKeyNotFound);
+}
+
+TEST(FlatDocumentBuilderTest, KeepsFirstOccurrenceOfDuplicatedKey)
+{
+    // Large enough to be sorted by std::stable_sort as well
+    for (const std::size_t number_of_other_keys : {std::size_t{2U}, std::size_t{40U}})
+    {
+        FlatDocumentBuilder builder{64U};
+        builder.StartObject();
+        builder.AddKey("key");
+        builder.AddNumber(Number{std::uint8_t{1U}});
+        for (std::size_t index{0U}; index < number_of_other_keys; ++index)
+        {
+            builder.AddKey("other" + std::to_string(index));
+            builder.AddNull();
+        }
+        builder.AddKey("key");
+        builder.AddNumber(Number{std::uint8_t{2U}});
+        builder.EndObject();
+
+        const auto document = std::move(builder).Build();
+
+        ASSERT_TRUE(document.has_value());
+        const auto object = document->GetRoot().As<FlatObject>().value();
+        EXPECT_EQ(object.size(), number_of_other_keys + 1U);
+        EXPECT_EQ(object.At("key").value().get().As<std::uint8_t>().value(), 1U);
+        EXPECT_EQ(object.At("other1").value().get().As<Null>().has_value(), true);
+    }
+}
+
+TEST(FlatDocumentBuilderTest, CopiesStringsIntoTheDocument)
+{
+    std::string key{"key"};
+    std::string value{"value"};
+    FlatDocumentBuilder builder{64U};
+    builder.StartObject();
+    builder.AddKey(key);
+    builder.AddString(value);
+    builder.EndObject();
+    key.assign("xxx");
+    value.assign("xxxxx");
+
+    const auto document = std::move(builder).Build();
+
+    ASSERT_TRUE(document.has_value());
+    EXPECT_EQ(document->GetRoot().As<FlatObject>().value().At("key").value().get().As<std::string_view>().value(),
+              "value");
+}
+
+TEST(FlatDocumentBuilderTest, FailsForIncompleteDocument)
+{
+    FlatDocumentBuilder empty_builder{64U};
+    EXPECT_EQ(std::move(empty_builder).Build().error(), Error::kParsingError);
+
+    FlatDocumentBuilder unclosed_builder{64U};
+    unclosed_builder.StartList();
+    unclosed_builder.AddNull();
+    EXPECT_EQ(std::move(unclosed_builder).Build().error(), Error::kParsingError);
+
+    FlatDocumentBuilder two_roots_builder{64U};
+    two_roots_builder.AddNull();
+    two_roots_builder.AddNull();
+    EXPECT_EQ(std::move(two_roots_builder).Build().error(), Error::kParsingError);
+}
+
+TEST(FlatDocumentTest, AllocatesFromUpstreamInFewBlocks)
+{
+    CountingMemoryResource upstream{};
+    {
+        FlatDocumentBuilder builder{4096U, &upstream};
+        builder.StartList();
+        for (std::size_t index{0U}; index < 100U; ++index)
+        {
+            builder.StartObject();
+            builder.AddKey("name");
+            builder.AddString("a string which does not fit into small string optimization");
+            builder.EndObject();
+        }
+        builder.EndList();
+
+        auto document = std::move(builder).Build();
+        ASSERT_TRUE(document.has_value());
+
+        // Moving the document keeps the arena in place, thus the values are still valid
+        const FlatDocument moved_document{std::move(document).value()};
+        EXPECT_EQ(moved_document.GetRoot().As<FlatList>().value().size(), 100U);
+        EXPECT_LE(upstream.number_of_allocations, 3U);
+        EXPECT_EQ(upstream.number_of_deallocations, 0U);
+    }
+    EXPECT_EQ(upstream.number_of_deallocations, upstream.number_of_allocations);
+}
+
+}  // namespace
+}  // namespace json
+}  // namespace score
@@ -17,6 +17,7 @@
 #include "score/json/internal/model/error.h"
 #include "score/result/result.h"
 
+#include <utility>
 #include <variant>
 
 namespace score
@@ -55,6 +56,13 @@ class Number
     template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value, bool>>
     score::Result<T> As() const noexcept;
 
+    /// \brief Calls visitor with the value in the arithmetic type it is stored as, without any conversion.
+    template <typename Visitor>
+    decltype(auto) Visit(Visitor&& visitor) const
+    {
+        return std::visit(std::forward<Visitor>(visitor), value_);
+    }
+
     friend bool operator==(const Number& lhs, const Number& rhs) noexcept;
 
   private:
@@ -714,6 +714,26 @@ TEST(Number, CheckEqualOperator)
     }
 }
 
+TEST(Number, VisitPassesStoredType)
+{
+    RecordProperty("Verifies", "::score::json::Number::Visit");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Tests that the visitor receives the value in the type it was stored as.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+    RecordProperty("Priority", "3");
+
+    const auto is_float = [](const auto value) noexcept {
+        return std::is_same<decltype(value), const float>::value;
+    };
+    EXPECT_TRUE(Number{1.5F}.Visit(is_float));
+    EXPECT_FALSE(Number{1.5}.Visit(is_float));
+    const auto doubled = Number{std::int16_t{-3}}.Visit([](const auto value) noexcept {
+        return static_cast<std::int64_t>(value) * 2;
+    });
+    EXPECT_EQ(doubled, -6);
+}
+
 }  // namespace
 }  // namespace json
 }  // namespace score
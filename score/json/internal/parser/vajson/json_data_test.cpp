@@ -0,0 +1,326 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_impl/reader.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/scanner.h"
+
+#include "gtest/gtest.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace
+{
+
+// Records every event as text, so that the results of both reader backends can be compared.
+class RecordingParser final : public v2::Parser
+{
+  public:
+    using v2::Parser::Parser;
+
+    std::string events_{};
+
+  private:
+    auto OnNull() noexcept -> ParserResult override
+    {
+        return Record("null");
+    }
+    auto OnBool(bool value) noexcept -> ParserResult override
+    {
+        return Record(value ? "true" : "false");
+    }
+    auto OnNumber(JsonNumber value) noexcept -> ParserResult override
+    {
+        const auto number = value.As<double>();
+        return Record("number:" + (number.has_value() ? std::to_string(number.value()) : std::string{"invalid"}));
+    }
+    auto OnString(StringView value) noexcept -> ParserResult override
+    {
+        return Record("string:" + std::string{value});
+    }
+    auto OnKey(StringView key) noexcept -> ParserResult override
+    {
+        return Record("key:" + std::string{key});
+    }
+    auto OnStartObject() noexcept -> ParserResult override
+    {
+        return Record("{");
+    }
+    auto OnEndObject(std::size_t count) noexcept -> ParserResult override
+    {
+        return Record("}" + std::to_string(count));
+    }
+    auto OnStartArray() noexcept -> ParserResult override
+    {
+        return Record("[");
+    }
+    auto OnEndArray(std::size_t count) noexcept -> ParserResult override
+    {
+        return Record("]" + std::to_string(count));
+    }
+
+    auto Record(const std::string& event) -> ParserResult
+    {
+        events_ += event + ' ';
+        return ParserState::kRunning;
+    }
+};
+
+// Returns the recorded events, followed by "ok" or "error".
+std::string Parse(JsonData& data)
+{
+    RecordingParser parser{data};
+    const auto result = parser.Parse();
+    return parser.events_ + (result.has_value() ? "ok" : "error");
+}
+
+std::string ParseFromStream(const std::string& json)
+{
+    JsonData data{std::make_unique<std::istringstream>(json)};
+    return Parse(data);
+}
+
+std::string ParseInPlace(const std::string& json)
+{
+    auto data = JsonData::FromView(json);
+    return Parse(data.value());
+}
+
+TEST(JsonData, ContiguousBufferYieldsSameEventsAsStream)
+{
+    const std::vector<std::string> documents{
+        R"({"key": "value", "list": [1, -2.5, 3e2, true, false, null], "nested": {"a": {}}})",
+        "\xEF\xBB\xBF[1]",
+        R"(["a string that is considerably longer than a single sixteen byte block of the scanner"])",
+        R"(["escapes \" \\ \/ \b \f \n \r \t in between", "\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"])",
+        "{\n\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\"indented\"   \r\n   :\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n 1}",
+        "12345678901234567890",
+        "\"unterminated string which runs until the end of the buffer",
+        R"(["unicode escapes are not supported A"])",
+        "[tru",
+        "[nul]",
+        "",
+        "    ",
+        "{}",
+    };
+
+    for (const auto& document : documents)
+    {
+        EXPECT_EQ(ParseInPlace(document), ParseFromStream(document)) << document;
+    }
+}
+
+TEST(JsonData, FromBufferDoesNotDependOnTheLifetimeOfTheBuffer)
+{
+    // Given a JSON data object created from a buffer which got destroyed afterwards
+    auto json = std::make_unique<std::string>(R"({"key": ["value"]})");
+    auto data = JsonData::FromBuffer(StringView{*json});
+    json.reset();
+
+    // When moving and parsing it
+    JsonData moved{std::move(data.value())};
+
+    // Then it still parses the copy
+    EXPECT_EQ(Parse(moved), "{ key:key [ string:value ]1 }1 ok");
+}
+
+TEST(JsonData, RestoresSnapshotOfContiguousBuffer)
+{
+    // Given a contiguous buffer which got partially read after a snapshot
+    const std::string json{"[1, 2]"};
+    auto data = JsonData::FromView(json);
+    internal::JsonOps ops{data.value()};
+    EXPECT_EQ(ops.Take(), '[');
+    ASSERT_TRUE(data.value().Snap().has_value());
+    EXPECT_EQ(ops.Take(), '1');
+
+    // When restoring the snapshot
+    ASSERT_TRUE(data.value().Restore().has_value());
+
+    // Then reading continues at the position of the snapshot
+    EXPECT_EQ(ops.Tell().value(), 1U);
+    EXPECT_EQ(ops.Take(), '1');
+    EXPECT_FALSE(data.value().Restore().has_value());
+}
+
+// Unique directory for the files of a test, which is removed again once they were removed.
+class TemporaryDirectory final
+{
+  public:
+    TemporaryDirectory() : path_{::testing::TempDir() + "/json_data_XXXXXX"}
+    {
+        if (::mkdtemp(path_.data()) == nullptr)
+        {
+            ADD_FAILURE() << "Failed to create a temporary directory";
+        }
+    }
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    TemporaryDirectory(TemporaryDirectory&&) = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+    TemporaryDirectory& operator=(TemporaryDirectory&&) = delete;
+    ~TemporaryDirectory()
+    {
+        std::ignore = ::rmdir(path_.c_str());
+    }
+
+    std::string GetFilePath() const
+    {
+        return path_ + "/file.json";
+    }
+
+  private:
+    std::string path_;
+};
+
+// Writes the content into a new file in directory and returns its path.
+std::string WriteTemporaryFile(const TemporaryDirectory& directory, const std::string& content)
+{
+    const auto file_path = directory.GetFilePath();
+    std::ofstream file(file_path);
+    file << content;
+    return file_path;
+}
+
+TEST(JsonData, ParsesRegularFileInPlace)
+{
+    // Given a regular file
+    const std::string json{R"({"key": "value", "list": [1, -2.5, 3e2, true, false, null]})"};
+    const TemporaryDirectory directory{};
+    const auto file_path = WriteTemporaryFile(directory, json);
+
+    // When creating and moving a JSON data object from it
+    auto data = JsonData::FromFile(file_path);
+    ASSERT_TRUE(data.has_value());
+    JsonData moved{std::move(data.value())};
+
+    // Then it yields the same events as a stream
+    EXPECT_EQ(Parse(moved), ParseFromStream(json));
+    EXPECT_EQ(std::remove(file_path.c_str()), 0);
+}
+
+TEST(JsonData, ReadsEmptyFile)
+{
+    // Given an empty file, which can not be mapped
+    const TemporaryDirectory directory{};
+    const auto file_path = WriteTemporaryFile(directory, "");
+
+    // When creating a JSON data object from it
+    auto data = JsonData::FromFile(file_path);
+
+    // Then it is read like an empty stream
+    ASSERT_TRUE(data.has_value());
+    EXPECT_EQ(Parse(data.value()), ParseFromStream(""));
+    EXPECT_EQ(std::remove(file_path.c_str()), 0);
+}
+
+TEST(JsonData, ReadsFifoWhichCanNotBeMapped)
+{
+    // Given a FIFO which gets written by another thread
+    const std::string json{R"([1, "two", {"three": 3}])"};
+    const TemporaryDirectory directory{};
+    const auto file_path = directory.GetFilePath();
+    ASSERT_EQ(::mkfifo(file_path.c_str(), 0600), 0);
+    std::thread writer{[&file_path, &json]() {
+        std::ofstream file(file_path);
+        file << json;
+    }};
+
+    // When creating a JSON data object from it
+    auto data = JsonData::FromFile(file_path);
+    if (!data.has_value())
+    {
+        // The writer waits in open() for a reader, which is provided here so that the test fails instead of hanging
+        const auto reader = ::open(file_path.c_str(), O_RDONLY | O_NONBLOCK);
+        writer.join();
+        std::ignore = ::close(reader);
+    }
+    else
+    {
+        writer.join();
+    }
+
+    // Then its content is parsed
+    EXPECT_EQ(std::remove(file_path.c_str()), 0);
+    ASSERT_TRUE(data.has_value());
+    EXPECT_EQ(Parse(data.value()), ParseFromStream(json));
+}
+
+TEST(JsonData, FailsForMissingFile)
+{
+    const TemporaryDirectory directory{};
+
+    EXPECT_FALSE(JsonData::FromFile(directory.GetFilePath()).has_value());
+}
+
+// Compares the scanner with the scalar search of the standard library for all positions of the match, including those
+// in the remainder which is shorter than a block.
+TEST(Scanner, FindsSameCharacterAsScalarSearch)
+{
+    const StringView set{"\"\\"};
+    for (std::size_t size{0U}; size < 4U * internal::scanner::kBlockSize; ++size)
+    {
+        for (std::size_t match{0U}; match <= size; ++match)
+        {
+            // Also use characters which are special to the SSE4.2 string instructions and the NEON comparison
+            std::string text(size, '\0');
+            for (std::size_t index{0U}; index < size; ++index)
+            {
+                text[index] = static_cast<char>((index % 2U == 0U) ? '\0' : '\xFF');
+            }
+            if (match < size)
+            {
+                text[match] = '\\';
+            }
+
+            const auto expected = StringView{text}.find_first_of(set);
+            EXPECT_EQ(internal::scanner::FindFirstOf(text, set), (expected == StringView::npos) ? size : expected);
+
+            std::string whitespace(size, ' ');
+            if (match < size)
+            {
+                whitespace[match] = '"';
+            }
+            EXPECT_EQ(internal::scanner::FindFirstNotOf(whitespace, " \n\r\t"), match);
+        }
+    }
+}
+
+TEST(Scanner, FallsBackToScalarSearchForLargeSets)
+{
+    const std::string set{"abcdefghijklmnopqrstuvwxyz"};
+    const std::string text(40U, 'z');
+
+    EXPECT_EQ(internal::scanner::FindFirstOf(text + "!", "!" + set), 0U);
+    EXPECT_EQ(internal::scanner::FindFirstNotOf(text + "!", set), text.size());
+}
+
+}  // namespace
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
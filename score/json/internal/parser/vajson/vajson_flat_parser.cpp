@@ -0,0 +1,135 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_flat_parser.h"
+
+#include "score/json/flat_json_parser.h"
+
+#include <utility>
+
+namespace
+{
+
+// The size of a file is not known before it is read, thus its arena starts with a block of this size and grows.
+constexpr std::size_t kInitialArenaSizeForFiles{4096U};
+
+}  // namespace
+
+auto score::json::VajsonFlatParser::FromFile(const std::string_view file_path,
+                                             score::cpp::pmr::memory_resource* const upstream)
+    -> score::Result<score::json::FlatDocument>
+{
+    VajsonFlatParser parser{kInitialArenaSizeForFiles, upstream};
+    // NOLINTNEXTLINE(score-banned-function) Tolerated because JsonParser::FromFile is also on the banned function list
+    const auto parse_result = JsonSaxParser{}.FromFile(file_path, parser);
+    return parser.GetDocument(parse_result);
+}
+
+auto score::json::VajsonFlatParser::FromBuffer(const std::string_view buffer,
+                                               score::cpp::pmr::memory_resource* const upstream)
+    -> score::Result<score::json::FlatDocument>
+{
+    // The buffer size is only a first guess: each value takes a whole FlatValue or FlatMember in the arena, which is
+    // larger than a short number or literal in the source. So documents with many short values grow the arena by
+    // further blocks.
+    VajsonFlatParser parser{buffer.size(), upstream};
+    // Strings are copied into the arena of the document, thus the buffer only needs to outlive the parsing.
+    const auto parse_result = JsonSaxParser{}.FromBuffer(buffer, parser);
+    return parser.GetDocument(parse_result);
+}
+
+score::json::VajsonFlatParser::VajsonFlatParser(const std::size_t initial_arena_size,
+                                                score::cpp::pmr::memory_resource* const upstream) noexcept
+    : JsonSaxHandler(), builder_{initial_arena_size, upstream}
+{
+}
+
+auto score::json::VajsonFlatParser::GetDocument(const score::ResultBlank parse_result) noexcept
+    -> score::Result<score::json::FlatDocument>
+{
+    if (!parse_result.has_value())
+    {
+        return MakeUnexpected(Error::kParsingError);
+    }
+    return std::move(builder_).Build();
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnNull() noexcept
+{
+    builder_.AddNull();
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnBool(const bool value) noexcept
+{
+    builder_.AddBool(value);
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnNumber(const Number& value) noexcept
+{
+    builder_.AddNumber(value);
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnString(const std::string_view value) noexcept
+{
+    builder_.AddString(value);
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnKey(const std::string_view key) noexcept
+{
+    builder_.AddKey(key);
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnStartObject() noexcept
+{
+    builder_.StartObject();
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnEndObject() noexcept
+{
+    builder_.EndObject();
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnStartList() noexcept
+{
+    builder_.StartList();
+    return {};
+}
+
+score::ResultBlank score::json::VajsonFlatParser::OnEndList() noexcept
+{
+    builder_.EndList();
+    return {};
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings: "The std::terminate() function shall not be called implicitly".
+// Calling std::terminate() if any exceptions are thrown is expected as per safety requirements
+// coverity[autosar_cpp14_a15_5_3_violation]
+auto score::json::FlatJsonParser::FromFile(const std::string_view file_path,
+                                           score::cpp::pmr::memory_resource* const upstream) const noexcept
+    -> score::Result<score::json::FlatDocument>
+{
+    return score::json::VajsonFlatParser::FromFile(file_path, upstream);
+}
+
+auto score::json::FlatJsonParser::FromBuffer(const std::string_view buffer,
+                                             score::cpp::pmr::memory_resource* const upstream) const noexcept
+    -> score::Result<score::json::FlatDocument>
+{
+    return score::json::VajsonFlatParser::FromBuffer(buffer, upstream);
+}
@@ -0,0 +1,79 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_FLAT_PARSER_H
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_FLAT_PARSER_H
+
+#include "score/json/internal/model/flat_document.h"
+#include "score/json/json_sax_parser.h"
+#include "score/result/result.h"
+
+#include <score/memory_resource.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+
+/// \brief JSON parser that returns a FlatDocument instead of a tree of Any.
+///
+/// \details The tokens are read by a JsonSaxParser, which uses vaJSON, and each event is added to a
+/// FlatDocumentBuilder. Thus numbers have the same types as in the tree of Any.
+class VajsonFlatParser final : public JsonSaxHandler
+{
+  public:
+    /// \brief Constructs a flat document from a JSON file
+    /// \param file_path The JSON file to read
+    /// \param upstream The resource the arena of the document allocates from
+    /// \return The document, error on error
+    static auto FromFile(const std::string_view file_path, score::cpp::pmr::memory_resource* const upstream)
+        -> score::Result<FlatDocument>;
+
+    /// \brief Constructs a flat document from a string containing JSON
+    /// \param buffer The string_view containing JSON
+    /// \param upstream The resource the arena of the document allocates from
+    /// \return The document, error on error
+    static auto FromBuffer(const std::string_view buffer, score::cpp::pmr::memory_resource* const upstream)
+        -> score::Result<FlatDocument>;
+
+    VajsonFlatParser(const VajsonFlatParser&) = delete;
+    VajsonFlatParser(VajsonFlatParser&&) noexcept = delete;
+    VajsonFlatParser& operator=(const VajsonFlatParser&) = delete;
+    VajsonFlatParser& operator=(VajsonFlatParser&&) noexcept = delete;
+    ~VajsonFlatParser() override = default;
+
+    score::ResultBlank OnNull() noexcept override;
+    score::ResultBlank OnBool(const bool value) noexcept override;
+    score::ResultBlank OnNumber(const Number& value) noexcept override;
+    score::ResultBlank OnString(const std::string_view value) noexcept override;
+    score::ResultBlank OnKey(const std::string_view key) noexcept override;
+    score::ResultBlank OnStartObject() noexcept override;
+    score::ResultBlank OnEndObject() noexcept override;
+    score::ResultBlank OnStartList() noexcept override;
+    score::ResultBlank OnEndList() noexcept override;
+
+  private:
+    VajsonFlatParser(const std::size_t initial_arena_size, score::cpp::pmr::memory_resource* const upstream) noexcept;
+
+    /// \brief Finishes the document after the parser reported all tokens of the source
+    auto GetDocument(const score::ResultBlank parse_result) noexcept -> score::Result<FlatDocument>;
+
+    FlatDocumentBuilder builder_;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_FLAT_PARSER_H
@@ -0,0 +1,156 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/flat_json_parser.h"
+#include "score/json/internal/parser/vajson/vajson_parser.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+constexpr auto kDocument = R"(
+    {
+      "boolean": true,
+      "color": "gold",
+      "escaped": "a\"b\\cä",
+      "null": null,
+      "number": 123,
+      "number_u64": 18446744073709551615,
+      "number_i": -123,
+      "number_i64": -922337203685477580,
+      "double": 1.79769e+308,
+      "object": {
+        "z": "last",
+        "a": "first",
+        "a": "duplicate"
+      },
+      "list": [
+        "first",
+        2,
+        [],
+        {}
+      ]
+    }
+)";
+
+// Checks that the flat value contains the same content as the value parsed by VajsonParser
+void ExpectEqual(const Any& expected, const FlatValue& actual)
+{
+    if (expected.As<Null>().has_value())
+    {
+        EXPECT_TRUE(actual.As<Null>().has_value());
+    }
+    else if (expected.As<bool>().has_value() && !actual.As<Number>().has_value())
+    {
+        EXPECT_EQ(actual.As<bool>().value(), expected.As<bool>().value());
+    }
+    else if (expected.As<Number>().has_value())
+    {
+        ASSERT_TRUE(actual.As<Number>().has_value());
+        EXPECT_TRUE(actual.As<Number>().value() == expected.As<Number>().value().get());
+    }
+    else if (expected.As<std::string_view>().has_value())
+    {
+        EXPECT_EQ(actual.As<std::string_view>().value(), expected.As<std::string_view>().value());
+    }
+    else if (expected.As<List>().has_value())
+    {
+        const List& list = expected.As<List>().value();
+        const auto flat_list = actual.As<FlatList>();
+        ASSERT_TRUE(flat_list.has_value());
+        ASSERT_EQ(flat_list->size(), list.size());
+        for (std::size_t index{0U}; index < list.size(); ++index)
+        {
+            ExpectEqual(list[index], (*flat_list)[index]);
+        }
+    }
+    else
+    {
+        const Object& object = expected.As<Object>().value();
+        const auto flat_object = actual.As<FlatObject>();
+        ASSERT_TRUE(flat_object.has_value());
+        ASSERT_EQ(flat_object->size(), object.size());
+        for (const auto& member : object)
+        {
+            const auto flat_member = flat_object->At(member.first.GetAsStringView());
+            ASSERT_TRUE(flat_member.has_value()) << member.first.GetAsStringView();
+            ExpectEqual(member.second, flat_member.value());
+        }
+    }
+}
+
+TEST(VajsonFlatParser, ParsesSameContentAsVajsonParser)
+{
+    const auto expected = VajsonParser::FromBuffer(kDocument);
+    ASSERT_TRUE(expected.has_value());
+
+    const auto document = FlatJsonParser{}.FromBuffer(kDocument);
+
+    ASSERT_TRUE(document.has_value());
+    ExpectEqual(expected.value(), document->GetRoot());
+}
+
+TEST(VajsonFlatParser, KeepsFirstOccurrenceOfDuplicatedKey)
+{
+    const auto document = FlatJsonParser{}.FromBuffer(kDocument);
+
+    ASSERT_TRUE(document.has_value());
+    const auto object = document->GetRoot().As<FlatObject>().value().At("object").value().get().As<FlatObject>();
+    ASSERT_TRUE(object.has_value());
+    EXPECT_EQ(object->At("a").value().get().As<std::string_view>().value(), "first");
+}
+
+TEST(VajsonFlatParser, DocumentDoesNotDependOnTheLifetimeOfTheBuffer)
+{
+    auto buffer = std::make_unique<std::string>(R"({"key": ["value"]})");
+    const auto document = FlatJsonParser{}.FromBuffer(*buffer);
+    buffer.reset();
+
+    ASSERT_TRUE(document.has_value());
+    const auto list = document->GetRoot().As<FlatObject>().value().At("key").value().get().As<FlatList>().value();
+    EXPECT_EQ(list[0U].As<std::string_view>().value(), "value");
+}
+
+TEST(VajsonFlatParser, ParsesFile)
+{
+    const std::string file_path = std::tmpnam(nullptr);
+    std::ofstream{file_path} << kDocument;
+
+    const auto expected = VajsonParser::FromBuffer(kDocument);
+    const auto document = FlatJsonParser{}.FromFile(file_path);
+    std::remove(file_path.c_str());
+
+    ASSERT_TRUE(expected.has_value());
+    ASSERT_TRUE(document.has_value());
+    ExpectEqual(expected.value(), document->GetRoot());
+}
+
+TEST(VajsonFlatParser, FailsForInvalidJson)
+{
+    EXPECT_EQ(FlatJsonParser{}.FromBuffer(R"({"key": [1, 2})").error(), Error::kParsingError);
+    EXPECT_EQ(FlatJsonParser{}.FromBuffer("").error(), Error::kParsingError);
+    EXPECT_EQ(FlatJsonParser{}.FromFile("/this/file/does/not/exist.json").error(), Error::kParsingError);
+}
+
+}  // namespace
+}  // namespace json
+}  // namespace score
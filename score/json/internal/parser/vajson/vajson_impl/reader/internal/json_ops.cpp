@@ -25,6 +25,7 @@
 #include <utility>
 #include <vector>
 
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/scanner.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader/json_data.h"
 namespace score
 {
@@ -55,6 +56,9 @@ inline auto SplitStringView(std::string_view const view, std::size_t const pivot
     return {view.substr(0, pivot), view.substr(pivot)};
 }
 
+/// \brief           The valid JSON whitespace characters
+constexpr StringView kWhitespaceChars{" \n\r\t"sv};
+
 }  // namespace
 
 JsonOps::JsonOps(JsonData& json_data) noexcept : data_(json_data) {}
@@ -66,6 +70,11 @@ auto JsonOps::Take() noexcept -> char
 
 auto JsonOps::TryTake() noexcept -> Result<char>
 {
+    if (this->GetJsonDocument().IsContiguous())
+    {
+        return this->TryTakeContiguous();
+    }
+
     std::istream& stream = this->GetStream();
     std::int64_t c = stream.get();
     Result<char> result{MakeErrorResult<char>(JsonErrc::kStreamFailure, "JsonOps::TryTake: EOF.")};
@@ -80,6 +89,17 @@ auto JsonOps::TryTake() noexcept -> Result<char>
 
 auto JsonOps::Move() noexcept -> bool
 {
+    JsonData& data{this->GetJsonDocument()};
+    if (data.IsContiguous())
+    {
+        const bool has_next{!data.GetRemainingBuffer().empty()};
+        if (has_next)
+        {
+            data.Consume(1U);
+        }
+        return has_next;
+    }
+
     std::istream& stream = this->GetStream();
     stream.seekg(1, std::ios::cur);
     return !stream.fail();
@@ -87,6 +107,11 @@ auto JsonOps::Move() noexcept -> bool
 
 auto JsonOps::Tell() const noexcept -> Result<std::uint64_t>
 {
+    if (this->GetJsonDocument().IsContiguous())
+    {
+        return Result<std::uint64_t>{this->GetJsonDocument().position_};
+    }
+
     std::istream& stream = const_cast<std::istream&>(this->GetStream());
     std::streampos pos = stream.tellg();
     Result<std::uint64_t> result{static_cast<std::uint64_t>(pos)};
@@ -110,6 +135,18 @@ auto JsonOps::Tell() const noexcept -> Result<std::uint64_t>
  */
 auto JsonOps::Skip(const char character) noexcept -> bool
 {
+    JsonData& data{this->GetJsonDocument()};
+    if (data.IsContiguous())
+    {
+        const StringView remaining{data.GetRemainingBuffer()};
+        const bool found{(!remaining.empty()) && (remaining.front() == character)};
+        if (found)
+        {
+            data.Consume(1U);
+        }
+        return found;
+    }
+
     std::istream& stream = this->GetStream();
     std::int64_t peek_val = stream.peek();
     bool result{false};
@@ -155,6 +192,18 @@ auto JsonOps::ReadString(std::string_view const string) noexcept -> Result<bool>
 {
     AssertCondition(!string.empty(), "JsonOps::ReadString: Cannot check for empty string");
 
+    JsonData& data{this->GetJsonDocument()};
+    if (data.IsContiguous())
+    {
+        // Compare in place, there is nothing to rewind if the string does not match.
+        const bool is_same{data.GetRemainingBuffer().substr(0U, string.size()) == string};
+        if (is_same)
+        {
+            data.Consume(string.size());
+        }
+        return Result<bool>{is_same};
+    }
+
     std::size_t const total_size{string.size()};
     bool is_same{true};
     std::string_view to_be_read{string};
@@ -208,7 +257,20 @@ auto JsonOps::RewindIf(const bool condition, std::size_t const num) noexcept ->
  */
 auto JsonOps::SkipWhitespace() noexcept -> bool
 {
-    constexpr static StringView kWhitespaceChars{" \n\r\t"sv};
+    JsonData& data{this->GetJsonDocument()};
+    if (data.IsContiguous())
+    {
+        const StringView remaining{data.GetRemainingBuffer()};
+        std::size_t skipped{0U};
+        // Most tokens directly follow each other, so only start a vectorized scan if there is whitespace at all.
+        if ((!remaining.empty()) && (kWhitespaceChars.find(remaining.front()) != StringView::npos))
+        {
+            skipped = scanner::FindFirstNotOf(remaining, kWhitespaceChars);
+            data.Consume(skipped);
+        }
+        return skipped < remaining.size();
+    }
+
     std::istream& stream = this->GetStream();
     bool done{false};
     bool result{false};
@@ -258,6 +320,18 @@ auto JsonOps::Read(std::uint64_t const num_to_read,
                    const score::cpp::move_only_function<void(std::string_view), 40>& callback) noexcept
     -> Result<std::uint64_t>
 {
+    JsonData& data{this->GetJsonDocument()};
+    if (data.IsContiguous())
+    {
+        const StringView view{data.GetRemainingBuffer().substr(0U, static_cast<std::size_t>(num_to_read))};
+        if (!view.empty())
+        {
+            callback(view);
+        }
+        data.Consume(view.size());
+        return Result<std::uint64_t>{static_cast<std::uint64_t>(view.size())};
+    }
+
     std::istream& stream = this->GetStream();
     std::vector<char> buffer(num_to_read);
 
@@ -288,6 +362,23 @@ auto JsonOps::ReadExactly(std::uint64_t const num_to_read,
                           const score::cpp::move_only_function<void(std::string_view)>& callback) noexcept
     -> Result<void>
 {
+    JsonData& data{this->GetJsonDocument()};
+    if (data.IsContiguous())
+    {
+        const StringView remaining{data.GetRemainingBuffer()};
+        Result<void> result{MakeErrorResult<void>(JsonErrc::kInvalidJson, "JsonOps::ReadExactly: Unexpected EOF.")};
+        if (remaining.size() >= num_to_read)
+        {
+            callback(remaining.substr(0U, static_cast<std::size_t>(num_to_read)));
+            data.Consume(static_cast<std::size_t>(num_to_read));
+            result.emplace();
+        }
+        else
+        {
+            data.Consume(remaining.size());
+        }
+        return result;
+    }
 
     String& buffer{this->GetJsonDocument().GetClearedStringBuffer()};
 
@@ -334,6 +425,11 @@ auto JsonOps::ReadUntil(std::string_view const delimiter,
                         const score::cpp::move_only_function<void(std::string_view)>& callback) noexcept
     -> Result<OptChar>
 {
+    if (this->GetJsonDocument().IsContiguous())
+    {
+        return this->ReadUntilContiguous(delimiter, callback);
+    }
+
     std::istream& stream = this->GetStream();
     std::string buffer;
     bool done{false};
@@ -384,6 +480,59 @@ auto JsonOps::ReadUntil(std::string_view const delimiter,
     return result;
 }
 
+/*!
+ * \internal
+ * - If there is a character left in the buffer:
+ *   - Consume and return it.
+ * - Otherwise:
+ *   - Return an error.
+ * \endinternal
+ */
+auto JsonOps::TryTakeContiguous() noexcept -> Result<char>
+{
+    JsonData& data{this->GetJsonDocument()};
+    const StringView remaining{data.GetRemainingBuffer()};
+    Result<char> result{MakeErrorResult<char>(JsonErrc::kStreamFailure, "JsonOps::TryTake: EOF.")};
+
+    if (!remaining.empty())
+    {
+        result = Result<char>{remaining.front()};
+        data.Consume(1U);
+    }
+
+    return result;
+}
+
+/*!
+ * \internal
+ * - Search the first delimiter in the remaining buffer with the vectorized scanner.
+ * - Trigger the given action once on all characters before it, if there are any, and consume them.
+ * - Return the delimiter without consuming it, or EOF if there is none.
+ * \endinternal
+ */
+auto JsonOps::ReadUntilContiguous(std::string_view const delimiter,
+                                  const score::cpp::move_only_function<void(std::string_view)>& callback) noexcept
+    -> Result<OptChar>
+{
+    JsonData& data{this->GetJsonDocument()};
+    const StringView remaining{data.GetRemainingBuffer()};
+    const std::size_t length{scanner::FindFirstOf(remaining, delimiter)};
+
+    if (length > 0U)
+    {
+        callback(remaining.substr(0U, length));
+        data.Consume(length);
+    }
+
+    Result<OptChar> result{OptChar{-1}};
+    if (length < remaining.size())
+    {
+        result = Result<OptChar>{OptChar{std::char_traits<char>::to_int_type(remaining[length])}};
+    }
+
+    return result;
+}
+
 auto JsonOps::GetJsonDocument() & noexcept -> JsonData&
 {
 
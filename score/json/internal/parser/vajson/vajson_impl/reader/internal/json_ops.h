@@ -13,7 +13,7 @@
 /*!        \file
  *        \brief  Collection of all operations on a JsonData object.
  *
- *      \details  Provides operations for stream based input data.
+ *      \details  Provides operations for stream based and contiguous input data.
  *
  *********************************************************************************************************************/
 
@@ -274,6 +274,30 @@ class JsonOps final
     auto GetJsonDocument() const& noexcept -> const JsonData&;
 
   private:
+    /// \brief           Takes the character at the current position of a contiguous buffer
+    /// \return          The character if inside buffer bounds, or the error.
+    /// \error           score::json::vajson::JsonErrc::kStreamFailure,
+    ///                  if the buffer has ended
+    /// \context         ANY
+    /// \pre             The document is read from a contiguous buffer.
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    auto TryTakeContiguous() noexcept -> Result<char>;
+
+    /// \brief           Scans a contiguous buffer for the delimiter and executes the action once for the span before it
+    /// \param[in]       delimiter
+    ///                  The characters to stop at.
+    /// \param[in]       callback
+    ///                  Callback to call with the characters before the delimiter.
+    /// \return          Either EOF or the delimiter that was found.
+    /// \context         ANY
+    /// \pre             The document is read from a contiguous buffer. callback does not throw exceptions.
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    auto ReadUntilContiguous(std::string_view delimiter,
+                             const score::cpp::move_only_function<void(std::string_view)>& callback) noexcept
+        -> Result<OptChar>;
+
     /// \brief           Rewind the position of the document if a condition is fulfilled
     /// \param[in]       condition
     ///                  The condition to check before seeking.
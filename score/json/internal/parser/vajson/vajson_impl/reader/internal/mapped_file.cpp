@@ -0,0 +1,152 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  mapped file
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/mapped_file.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+#include "score/utility.hpp"
+
+#include <sys/stat.h>
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+namespace
+{
+
+/// \brief           Returns if the status describes a regular file
+/// \param[in]       status
+///                  The status of the file.
+/// \return          True for a regular file.
+/// \context         ANY
+/// \pre             -
+/// \threadsafe      TRUE
+/// \reentrant       TRUE
+auto IsRegularFile(const score::os::StatBuffer& status) noexcept -> bool
+{
+    // NOLINTNEXTLINE(hicpp-signed-bitwise): macro does not affect the sign of the result.
+    return (status.st_mode & static_cast<std::uint32_t>(S_IFMT)) == static_cast<std::uint32_t>(S_IFREG);
+}
+
+}  // namespace
+
+/*!
+ * \internal
+ * - Check that the path refers to a regular file which is not empty.
+ * - Open the file and map it read-only. The size is taken from the opened file, because the path may refer to
+ *   another file by now.
+ * - Advise the kernel that the mapping is read sequentially, which is only an optimization.
+ * - Close the file, the mapping stays valid without it.
+ * \endinternal
+ */
+auto MappedFile::Open(std::string_view const path) noexcept -> Result<MappedFile>
+{
+    auto result = MakeErrorResult<MappedFile>(JsonErrc::kStreamFailure, "Could not map file");
+    const std::string file_path{path};
+
+    // The type is checked before opening the file, since opening a FIFO blocks until a writer connects.
+    score::os::StatBuffer status{};
+    const bool is_regular_file{score::os::Stat::instance().stat(file_path.c_str(), status, true).has_value() &&
+                               IsRegularFile(status)};
+    if (is_regular_file)
+    {
+        using Open = score::os::Fcntl::Open;
+        const auto file = score::os::Fcntl::instance().open(file_path.c_str(), Open::kReadOnly | Open::kCloseOnExec);
+        if (file.has_value())
+        {
+            if (score::os::Stat::instance().fstat(file.value(), status).has_value() && IsRegularFile(status) &&
+                (status.st_size > 0))
+            {
+                const auto length = static_cast<std::size_t>(status.st_size);
+                const auto address = score::os::Mman::instance().mmap(nullptr,
+                                                                     length,
+                                                                     score::os::Mman::Protection::kRead,
+                                                                     score::os::Mman::Map::kPrivate,
+                                                                     file.value(),
+                                                                     0);
+                if (address.has_value())
+                {
+                    score::cpp::ignore = score::os::Mman::instance().madvise(
+                        address.value(), length, score::os::Mman::Advice::kSequential);
+                    result.emplace(MappedFile{address.value(), length});
+                }
+            }
+            score::cpp::ignore = score::os::Unistd::instance().close(file.value());
+        }
+    }
+
+    return result;
+}
+
+MappedFile::MappedFile(void* const address, std::size_t const length) noexcept : address_{address}, length_{length}
+{
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : address_{std::exchange(other.address_, nullptr)}, length_{std::exchange(other.length_, 0U)}
+{
+}
+
+auto MappedFile::operator=(MappedFile&& other) & noexcept -> MappedFile&
+{
+    if (this != &other)
+    {
+        this->Unmap();
+        this->address_ = std::exchange(other.address_, nullptr);
+        this->length_ = std::exchange(other.length_, 0U);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    this->Unmap();
+}
+
+auto MappedFile::GetView() const noexcept -> StringView
+{
+    return StringView{static_cast<const char*>(this->address_), this->length_};
+}
+
+void MappedFile::Unmap() noexcept
+{
+    if (this->address_ != nullptr)
+    {
+        score::cpp::ignore = score::os::Mman::instance().munmap(this->address_, this->length_);
+        this->address_ = nullptr;
+        this->length_ = 0U;
+    }
+}
+
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,135 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  Read-only memory mapping of a JSON file.
+ *
+ *      \details  Allows the contiguous reader backend to scan a file in place, without reading it into a buffer.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_MAPPED_FILE_H_
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_MAPPED_FILE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_impl/util/json_error_domain.h"
+#include "score/json/internal/parser/vajson/vajson_impl/util/types.h"
+#include <cstddef>
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+
+/// \brief           A read-only, private memory mapping of a whole regular file
+/// \details         The mapping does not depend on the file descriptor, which is closed right after mapping. Moving
+///                  the object keeps the address of the mapping, thus views into it stay valid. The file must not be
+///                  truncated while it is mapped, since accessing pages beyond its end raises SIGBUS.
+class MappedFile final
+{
+    /// \brief           Start of the mapping, null if nothing is mapped
+    void* address_{nullptr};
+    /// \brief           Length of the mapping
+    std::size_t length_{0U};
+
+  public:
+    /// \brief           Maps a regular file for sequential reading
+    /// \param[in]       path
+    ///                  The path to the file.
+    /// \return          The mapped file.
+    /// \error           score::json::vajson::JsonErrc::kStreamFailure
+    ///                  if the file could not be opened, is no regular file, is empty or could not be mapped.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE
+    /// \reentrant       TRUE
+    static auto Open(std::string_view path) noexcept -> Result<MappedFile>;
+
+    /// \brief           Constructs an object which does not own a mapping
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    MappedFile() noexcept = default;
+
+    /// \brief           Move constructor
+    /// \param[in]       other
+    ///                  The moved from object, which does not own a mapping afterwards.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    MappedFile(MappedFile&& other) noexcept;
+
+    /// \brief           Move assignment, which unmaps the previously owned mapping
+    /// \param[in]       other
+    ///                  The moved from object, which does not own a mapping afterwards.
+    /// \return          A reference to the moved into object.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    auto operator=(MappedFile&& other) & noexcept -> MappedFile&;
+
+    /// \brief           Deleted copy constructor
+    MappedFile(const MappedFile&) = delete;
+
+    /// \brief           Deleted copy assignment
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    /// \brief           Unmaps the file
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    ~MappedFile() noexcept;
+
+    /// \brief           Returns the content of the file
+    /// \return          A view of the mapping, valid as long as this object or the one it is moved into exists.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE
+    auto GetView() const noexcept -> StringView;
+
+  private:
+    /// \brief           Takes ownership of a mapping
+    /// \param[in]       address
+    ///                  Start of the mapping.
+    /// \param[in]       length
+    ///                  Length of the mapping.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    MappedFile(void* address, std::size_t length) noexcept;
+
+    /// \brief           Unmaps the owned mapping, if any
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    void Unmap() noexcept;
+};
+
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_MAPPED_FILE_H_
@@ -0,0 +1,203 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  Vectorized scanning of contiguous JSON text.
+ *
+ *      \details  Provides the character class searches the contiguous reader backend is built on. Uses the SSE4.2
+ *                string instructions respectively NEON byte comparisons, selected by the same conditions as the
+ *                backends of score/simd.hpp, and falls back to a scalar search on all other targets.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_SCANNER_H_
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_SCANNER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_impl/util/types.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE4_2__) && (defined(__linux__) || defined(__QNX__))
+#define SCORE_LIB_JSON_VAJSON_SCANNER_SSE42
+#include <nmmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__linux__) || defined(__QNX__))
+#define SCORE_LIB_JSON_VAJSON_SCANNER_NEON
+#include "score/bit.hpp"
+#include <arm_neon.h>
+#endif
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+namespace scanner
+{
+
+/// \brief           Number of characters which are compared at once
+constexpr std::size_t kBlockSize{16U};
+
+namespace detail
+{
+
+#if defined(SCORE_LIB_JSON_VAJSON_SCANNER_SSE42)
+
+/// \brief           Returns the index of the first character of view which is (not) contained in set
+/// \tparam          kMode
+///                  The _mm_cmpestri mode which selects between "any of" and "none of".
+/// \param[in]       view
+///                  The characters to search.
+/// \param[in]       set
+///                  The characters to search for, at most kBlockSize.
+/// \param[in]       negate
+///                  Must match kMode, used for the remainder which is shorter than a block.
+/// \return          The index or view.size() if there is no such character.
+template <int kMode>
+inline auto Find(const StringView view, const StringView set, const bool negate) noexcept -> std::size_t
+{
+    alignas(kBlockSize) char needles[kBlockSize]{};
+    static_cast<void>(std::memcpy(&needles[0], set.data(), set.size()));
+    const __m128i set_block{_mm_load_si128(reinterpret_cast<const __m128i*>(&needles[0]))};
+    const int set_size{static_cast<int>(set.size())};
+
+    std::size_t index{0U};
+    for (; (index + kBlockSize) <= view.size(); index += kBlockSize)
+    {
+        const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(view.data() + index))};
+        const int match{_mm_cmpestri(set_block, set_size, block, static_cast<int>(kBlockSize), kMode)};
+        if (match < static_cast<int>(kBlockSize))
+        {
+            return index + static_cast<std::size_t>(match);
+        }
+    }
+
+    const std::size_t tail{negate ? view.find_first_not_of(set, index) : view.find_first_of(set, index)};
+    return (tail == StringView::npos) ? view.size() : tail;
+}
+
+constexpr int kFindAnyOf{_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT};
+constexpr int kFindNoneOf{_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_MASKED_NEGATIVE_POLARITY |
+                          _SIDD_LEAST_SIGNIFICANT};
+
+#elif defined(SCORE_LIB_JSON_VAJSON_SCANNER_NEON)
+
+/// \brief           Returns the index of the first character of view which is (not) contained in set
+/// \param[in]       view
+///                  The characters to search.
+/// \param[in]       set
+///                  The characters to search for, at most kBlockSize.
+/// \param[in]       negate
+///                  Search for the first character which is not contained in set.
+/// \return          The index or view.size() if there is no such character.
+inline auto Find(const StringView view, const StringView set, const bool negate) noexcept -> std::size_t
+{
+    std::size_t index{0U};
+    for (; (index + kBlockSize) <= view.size(); index += kBlockSize)
+    {
+        const uint8x16_t block{vld1q_u8(reinterpret_cast<const std::uint8_t*>(view.data() + index))};
+        uint8x16_t matches{vdupq_n_u8(0U)};
+        for (const char character : set)
+        {
+            matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8(static_cast<std::uint8_t>(character))));
+        }
+        if (negate)
+        {
+            matches = vmvnq_u8(matches);
+        }
+        // Narrow every byte of the comparison result to four bits, so that the result fits into one 64 bit lane.
+        const uint8x8_t nibbles{vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)};
+        const std::uint64_t bits{vget_lane_u64(vreinterpret_u64_u8(nibbles), 0)};
+        if (bits != 0U)
+        {
+            return index + (static_cast<std::size_t>(score::cpp::countr_zero(bits)) / 4U);
+        }
+    }
+
+    const std::size_t tail{negate ? view.find_first_not_of(set, index) : view.find_first_of(set, index)};
+    return (tail == StringView::npos) ? view.size() : tail;
+}
+
+#endif
+
+}  // namespace detail
+
+/// \brief           Returns the index of the first character of view which is contained in set
+/// \param[in]       view
+///                  The characters to search.
+/// \param[in]       set
+///                  The characters to search for.
+/// \return          The index or view.size() if there is no such character.
+/// \context         ANY
+/// \pre             -
+/// \threadsafe      TRUE
+/// \reentrant       TRUE
+inline auto FindFirstOf(const StringView view, const StringView set) noexcept -> std::size_t
+{
+#if defined(SCORE_LIB_JSON_VAJSON_SCANNER_SSE42)
+    if (set.size() <= kBlockSize)
+    {
+        return detail::Find<detail::kFindAnyOf>(view, set, false);
+    }
+#elif defined(SCORE_LIB_JSON_VAJSON_SCANNER_NEON)
+    if (set.size() <= kBlockSize)
+    {
+        return detail::Find(view, set, false);
+    }
+#endif
+    const std::size_t index{view.find_first_of(set)};
+    return (index == StringView::npos) ? view.size() : index;
+}
+
+/// \brief           Returns the index of the first character of view which is not contained in set
+/// \param[in]       view
+///                  The characters to search.
+/// \param[in]       set
+///                  The characters to skip.
+/// \return          The index or view.size() if there is no such character.
+/// \context         ANY
+/// \pre             -
+/// \threadsafe      TRUE
+/// \reentrant       TRUE
+inline auto FindFirstNotOf(const StringView view, const StringView set) noexcept -> std::size_t
+{
+#if defined(SCORE_LIB_JSON_VAJSON_SCANNER_SSE42)
+    if (set.size() <= kBlockSize)
+    {
+        return detail::Find<detail::kFindNoneOf>(view, set, true);
+    }
+#elif defined(SCORE_LIB_JSON_VAJSON_SCANNER_NEON)
+    if (set.size() <= kBlockSize)
+    {
+        return detail::Find(view, set, true);
+    }
+#endif
+    const std::size_t index{view.find_first_not_of(set)};
+    return (index == StringView::npos) ? view.size() : index;
+}
+
+}  // namespace scanner
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
+
+#undef SCORE_LIB_JSON_VAJSON_SCANNER_SSE42
+#undef SCORE_LIB_JSON_VAJSON_SCANNER_NEON
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_SCANNER_H_
@@ -21,10 +21,11 @@
 #include "score/json/internal/parser/vajson/vajson_impl/reader/json_data.h"
 #include <array>
 #include <fstream>
+#include <iterator>
 #include <limits>
 #include <memory>
-#include <sstream>
 #include <utility>
+#include <vector>
 
 #include "score/filesystem/filestream/file_factory.h"
 #include "score/filesystem/filestream/file_stream.h"
@@ -44,7 +45,7 @@ namespace vajson
  * - Parse the BOM.
  * \endinternal
  */
-JsonData::JsonData(std::istream& input_stream) noexcept : stream_{input_stream}
+JsonData::JsonData(std::istream& input_stream) noexcept : stream_{&input_stream}
 {
 
     this->current_key_.reserve(internal::config::kKeyBufferSize);
@@ -68,23 +69,59 @@ JsonData::JsonData(std::unique_ptr<std::istream> input_stream) noexcept : JsonDa
 
 /*!
  * \internal
- * - Create the input stream from the file.
- * - If the file has been opened successfully.
- *   - Then create & return the JsonData object.
+ * - Reference the given buffer instead of a stream.
+ * - Set the capacity for the key and string buffer to the values defined in the static configuration.
+ * - Parse the BOM.
+ * \endinternal
+ */
+JsonData::JsonData(StringView const buffer) noexcept : buffer_{buffer}
+{
+
+    this->current_key_.reserve(internal::config::kKeyBufferSize);
+
+    this->current_buffer_.reserve(internal::config::kStringBufferSize);
+    this->ParseBom();
+}
+
+/*!
+ * \internal
+ * - Try to map the file.
+ * - If the file has been mapped successfully.
+ *   - Then create & return the JsonData object which reads from the mapping in place.
+ * - Else create the input stream from the file.
+ * - If the file has been opened and read successfully.
+ *   - Then create & return the JsonData object which reads from a copy of its content.
  * - Else return a JsonErrc containing the original error message.
  * \endinternal
  */
 auto JsonData::FromFile(std::string_view const path) noexcept -> Result<JsonData>
 {
-    // Open file using score filesystem
-    score::filesystem::FileFactory factory{};
-    score::filesystem::Path file_path{std::string(path.data(), path.size())};
-
-    auto file_result = factory.Open(file_path, std::ios::in);
     auto result = MakeErrorResult<JsonData>(JsonErrc::kStreamFailure, "Could not open file");
-    if (file_result.has_value())
+    auto mapped_file = internal::MappedFile::Open(path);
+    if (mapped_file.has_value())
+    {
+        // Moving the mapping keeps its address, thus the view stays valid.
+        JsonData data{mapped_file.value().GetView()};
+        data.mapped_file_ = std::move(mapped_file.value());
+        result.emplace(std::move(data));
+    }
+    else
     {
-        result.emplace(JsonData{std::move(file_result.value())});
+        // Open file using score filesystem
+        score::filesystem::FileFactory factory{};
+        score::filesystem::Path file_path{std::string(path.data(), path.size())};
+
+        auto file_result = factory.Open(file_path, std::ios::in);
+        if (file_result.has_value())
+        {
+            // Files which can not be mapped, like FIFOs, can neither be repositioned. Thus they are read as a whole.
+            std::istream& stream{*file_result.value()};
+            std::vector<char> content{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+            if (!stream.bad())
+            {
+                result = JsonData::FromOwnedBuffer(std::move(content));
+            }
+        }
     }
 
     return result;
@@ -114,33 +151,56 @@ auto JsonData::FromBuffer(score::safecpp::zstring_view const buffer) noexcept ->
 
 /*!
  * \internal
- * - Create the input stream from a buffer.
- * - Create & return the JsonData object.
+ * - Copy the buffer, so that the JsonData object does not depend on its lifetime.
+ * - Create & return the JsonData object which reads from the copy.
  * \endinternal
  */
 auto JsonData::FromBuffer(const score::cpp::span<const char> buffer) noexcept -> Result<JsonData>
 {
-    // Create istringstream from the buffer
-    std::unique_ptr<std::istream> iss{std::make_unique<std::istringstream>(std::string(buffer.data(), buffer.size()))};
-    return Result<JsonData>{JsonData{std::move(iss)}};
+    return JsonData::FromOwnedBuffer(std::vector<char>(buffer.begin(), buffer.end()));
+}
+
+/*!
+ * \internal
+ * - Create the JsonData object which reads from the buffer.
+ * - Take ownership of the buffer.
+ * - Return the JsonData object.
+ * \endinternal
+ */
+auto JsonData::FromOwnedBuffer(std::vector<char> buffer) noexcept -> Result<JsonData>
+{
+    // Moving the vector keeps its storage, thus the view stays valid when the JsonData object is moved.
+    JsonData data{StringView{buffer.data(), buffer.size()}};
+    data.owned_buffer_ = std::move(buffer);
+    return Result<JsonData>{std::move(data)};
 }
 
 /*!
  * \internal
- * - Get the current position from the stream.
+ * - Create & return the JsonData object which reads from the buffer in place.
+ * \endinternal
+ */
+auto JsonData::FromView(StringView const buffer) noexcept -> Result<JsonData>
+{
+    return Result<JsonData>{JsonData{buffer}};
+}
+
+/*!
+ * \internal
+ * - Get the current position from the stream respectively the contiguous buffer.
  * - Store the DepthCounter and the current position internally.
  * - Return the Result of the operation.
  * \endinternal
  */
 auto JsonData::Snap() noexcept -> Result<void>
 {
-    std::streampos pos = this->GetStream().tellg();
+    const Result<std::uint64_t> pos{internal::JsonOps{*this}.Tell()};
     auto result = MakeErrorResult<void>(JsonErrc::kStreamFailure, "JsonData::Snap: Could not get stream position.");
-    if (!this->GetStream().fail())
+    if (pos.has_value())
     {
         result.emplace();
         this->depth_counter_backup_ = this->depth_counter_;
-        this->pos_backup_ = static_cast<std::uint64_t>(pos);
+        this->pos_backup_ = pos.value();
         this->has_backup_ = true;
     }
 
@@ -150,6 +210,7 @@ auto JsonData::Snap() noexcept -> Result<void>
 /*!
  * \internal
  * - Check that a snapshot is available.
+ * - For a contiguous buffer, reset the position and restore the internal DepthCounter from the snapshot.
  * - Check that the stream position contained in the snapshot is small enough to be passed to seekg().
  * - Seek to the stream position.
  * - Check that the current position matches the requested seek position.
@@ -161,7 +222,14 @@ auto JsonData::Restore() noexcept -> Result<void>
 {
     Result<void> result{MakeErrorResult<void>(JsonErrc::kStreamFailure, "JsonData::Restore: No snapshot available.")};
 
-    if (this->has_backup_)
+    if (this->has_backup_ && this->IsContiguous())
+    {
+        this->position_ = this->pos_backup_;
+        this->depth_counter_ = std::move(this->depth_counter_backup_);
+        this->has_backup_ = false;
+        result = Result<void>{};
+    }
+    else if (this->has_backup_)
     {
         std::uint64_t const pos{this->pos_backup_};
 
@@ -173,16 +241,16 @@ auto JsonData::Restore() noexcept -> Result<void>
         else
         {
             // Seek to position
-            this->stream_.get().seekg(static_cast<std::streampos>(pos), std::ios::beg);
+            this->GetStream().seekg(static_cast<std::streampos>(pos), std::ios::beg);
 
-            if (this->stream_.get().fail())
+            if (this->GetStream().fail())
             {
                 result = MakeErrorResult<void>(JsonErrc::kStreamFailure, "Unable to restore original position.");
             }
             else
             {
                 // Verify position
-                std::uint64_t const curr{static_cast<std::uint64_t>(this->stream_.get().tellg())};
+                std::uint64_t const curr{static_cast<std::uint64_t>(this->GetStream().tellg())};
                 if (curr != this->pos_backup_)
                 {
                     result = MakeErrorResult<void>(JsonErrc::kStreamFailure, "Unable to restore original position.");
@@ -226,11 +294,11 @@ void JsonData::ParseBom() noexcept
             encoding_ = EncodingType::kUtf8;
         }
     }
-    else
+    else if (!this->IsContiguous())
     {
         // ReadString failed (e.g., stream shorter than BOM).
         // Ensure stream is in a usable state for subsequent parsing.
-        auto& stream = this->stream_.get();
+        auto& stream = this->GetStream();
         stream.clear(stream.rdstate() & ~(std::ios::failbit | std::ios::eofbit));
         stream.seekg(0, std::ios::beg);
     }
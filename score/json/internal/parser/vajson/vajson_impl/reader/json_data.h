@@ -25,12 +25,14 @@
  *********************************************************************************************************************/
 #include "score/json/internal/parser/vajson/vajson_impl/reader/internal/config/json_reader_cfg.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader/internal/depth_counter.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/mapped_file.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader/parser_state.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader_fwd.h"
 #include "score/json/internal/parser/vajson/vajson_impl/util/types.h"
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace score
 {
@@ -41,13 +43,23 @@ namespace vajson
 
 /// \brief           A JSON data representation
 /// \details         Handles the state of the data, such as the current position in the file and nesting of JSON tree.
+///                  The data is either read from a stream or, if it is available as a whole, scanned directly within
+///                  a contiguous buffer.
 /// \trace           DSGN-JSON-Reader-Deserialization
 class JsonData final
 {
-    /// \brief           Stream buffer
-    std::reference_wrapper<std::istream> stream_;
+    /// \brief           Stream buffer, null if the data is read from a contiguous buffer
+    std::istream* stream_{nullptr};
     /// \brief           The potentially owned stream
     std::unique_ptr<std::istream> owned_stream_{nullptr};
+    /// \brief           Contiguous buffer, only used if there is no stream
+    StringView buffer_{};
+    /// \brief           The potentially owned contiguous buffer
+    std::vector<char> owned_buffer_{};
+    /// \brief           The potentially owned mapping of a file, which is used as contiguous buffer
+    internal::MappedFile mapped_file_{};
+    /// \brief           Current position within the contiguous buffer
+    std::uint64_t position_{0U};
     /// \brief           JSON structure state
     internal::DepthCounter depth_counter_{};
     /// \brief           Current key
@@ -86,6 +98,8 @@ class JsonData final
     explicit JsonData(std::unique_ptr<std::istream> input_stream) noexcept;
 
     /// \brief           Initializes a JSON data object from a file
+    /// \details         A regular file is memory mapped and scanned in place, without copying it. All other files,
+    ///                  e.g. FIFOs, and files which can not be mapped are read into a buffer as a whole.
     /// \param[in]       path
     ///                  The path to the JSON file.
     /// \return          A constructed JSON data object.
@@ -131,6 +145,19 @@ class JsonData final
     /// \synchronous     -
     static auto FromBuffer(score::cpp::span<const char> buffer) noexcept -> Result<JsonData>;
 
+    /// \brief           Initializes a JSON data object which reads from a buffer without copying it
+    /// \details         The buffer is scanned in place, which avoids both the copy and the per character overhead of a
+    ///                  stream.
+    /// \param[in]       buffer
+    ///                  The buffer containing the JSON value.
+    /// \return          A constructed JSON data object.
+    /// \context         ANY
+    /// \pre             The buffer must outlive the returned object.
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    /// \synchronous     -
+    static auto FromView(StringView buffer) noexcept -> Result<JsonData>;
+
     /// \brief           Move constructor
     /// \param[in]       other
     ///                  The moved from object.
@@ -254,24 +281,74 @@ class JsonData final
     auto Restore() noexcept -> Result<void>;
 
   private:
+    /// \brief           Initializes a JSON data object which reads from a contiguous buffer
+    /// \param[in]       buffer
+    ///                  to operate on.
+    /// \context         ANY
+    /// \pre             The buffer must outlive the object.
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    explicit JsonData(StringView buffer) noexcept;
+
+    /// \brief           Initializes a JSON data object which reads from and owns a contiguous buffer
+    /// \param[in]       buffer
+    ///                  to operate on.
+    /// \return          A constructed JSON data object.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    static auto FromOwnedBuffer(std::vector<char> buffer) noexcept -> Result<JsonData>;
+
     /// \brief           Returns the stream
     /// \return          The stream.
     /// \context         ANY
-    /// \pre             -
+    /// \pre             The data is not read from a contiguous buffer.
     /// \threadsafe      TRUE, for different this pointer
     auto GetStream() noexcept -> std::istream&
     {
-        return this->stream_.get();
+        return *this->stream_;
     }
 
     /// \brief           Returns the stream
     /// \return          The stream.
     /// \context         ANY
-    /// \pre             -
+    /// \pre             The data is not read from a contiguous buffer.
     /// \threadsafe      TRUE, for different this pointer
     auto GetStream() const noexcept -> const std::istream&
     {
-        return this->stream_.get();
+        return *this->stream_;
+    }
+
+    /// \brief           Returns if the data is read from a contiguous buffer instead of a stream
+    /// \return          True for a contiguous buffer.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE, for different this pointer
+    auto IsContiguous() const noexcept -> bool
+    {
+        return this->stream_ == nullptr;
+    }
+
+    /// \brief           Returns the not yet consumed part of the contiguous buffer
+    /// \return          The remaining characters.
+    /// \context         ANY
+    /// \pre             The data is read from a contiguous buffer.
+    /// \threadsafe      TRUE, for different this pointer
+    auto GetRemainingBuffer() const noexcept -> StringView
+    {
+        return this->buffer_.substr(static_cast<std::size_t>(this->position_));
+    }
+
+    /// \brief           Consumes characters of the contiguous buffer
+    /// \param[in]       count
+    ///                  The number of characters to consume.
+    /// \context         ANY
+    /// \pre             The data is read from a contiguous buffer and count does not exceed the remaining characters.
+    /// \threadsafe      TRUE, for different this pointer
+    void Consume(std::size_t const count) noexcept
+    {
+        this->position_ += count;
     }
 
     /// \brief           Inspects the document's BOM
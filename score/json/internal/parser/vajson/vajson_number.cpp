@@ -0,0 +1,57 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_number.h"
+
+#include <score/utility.hpp>
+
+#include <cstdint>
+
+namespace
+{
+
+template <typename... NumberType>
+auto ToFirstLosslessNumber(score::json::vajson::JsonNumber& value) noexcept -> std::optional<score::json::Number>
+{
+    std::optional<score::json::Number> number{};
+    auto TryConvert = [&number](auto result) noexcept -> bool {
+        if (result.has_value())
+        {
+            number.emplace(result.value());
+        }
+        return result.has_value();
+    };
+
+    // Coverity warning: The operands of a logical && or || shall be parenthesized if the operands contain binary
+    // operators. Fold expression automatically sets parenthesis when expression is unfolded. In this case we are
+    // using Unary right fold '(E op ...) becomes (E1 op (... op (En-1 op En)))'. That means for
+    // ToFirstLosslessNumber<int, float, double>(value) fold expression will be: ( (TryConvert(value.As<int>())) || (
+    // (TryConvert(value.As<float>())) || (TryConvert(value.As<double>())) ) )
+    // coverity[autosar_cpp14_a5_2_6_violation]
+    score::cpp::ignore = ((TryConvert(value.As<NumberType>())) || ...);
+    return number;
+}
+
+}  // namespace
+
+auto score::json::ToSmallestNumber(score::json::vajson::JsonNumber& value) noexcept -> std::optional<Number>
+{
+    return ToFirstLosslessNumber<std::uint8_t,
+                                 std::uint16_t,
+                                 std::uint32_t,
+                                 std::uint64_t,
+                                 std::int8_t,
+                                 std::int16_t,
+                                 std::int32_t,
+                                 std::int64_t,
+                                 double>(value);
+}
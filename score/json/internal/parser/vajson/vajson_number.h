@@ -0,0 +1,40 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_NUMBER_H
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_NUMBER_H
+
+#include "score/json/internal/model/number.h"
+
+#include "score/json/internal/parser/vajson/vajson_impl/reader.h"
+
+#include <optional>
+
+namespace score
+{
+namespace json
+{
+
+/// \brief Converts a number of vaJSON into the smallest type which represents it without loss
+///
+/// \details The unsigned types are tried first from smallest to largest, then the signed types from smallest to
+/// largest and finally double. All parsers based on vaJSON use this conversion, so the tree of Any, a FlatDocument
+/// and the events of a JsonSaxHandler hold a number as the same type.
+///
+/// \param value The number as reported by vaJSON
+/// \return The converted number, empty if none of the types can represent it
+auto ToSmallestNumber(score::json::vajson::JsonNumber& value) noexcept -> std::optional<Number>;
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_NUMBER_H
@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/json/internal/parser/vajson/vajson_parser.h"
+#include "score/json/internal/parser/vajson/vajson_number.h"
 
 #include "score/json/json_parser.h"
 
@@ -33,10 +34,11 @@ auto score::json::VajsonParser::FromFile(const std::string_view file_path) -> sc
 auto score::json::VajsonParser::FromBuffer(const std::string_view buffer) -> score::Result<score::json::Any>
 {
     score::Result<score::json::Any> result = MakeUnexpected(Error::kParsingError);
-    auto json_data = score::json::vajson::JsonData::FromBuffer(std::string_view{buffer.data(), buffer.size()});
+    // The buffer outlives the parsing, thus it is scanned in place instead of being copied.
+    auto json_data = score::json::vajson::JsonData::FromView(std::string_view{buffer.data(), buffer.size()});
     if (json_data.has_value())  // LCOV_EXCL_BR_LINE (Decision Coverage: Not reachable. Branch excluded from coverage
                                 // report.)
-    // (else branch can't be hit due to internal implementation of JsonData::FromBuffer function that accepts all kind
+    // (else branch can't be hit due to internal implementation of JsonData::FromView function that accepts all kind
     // of strings.)
     {
         auto json_object = VajsonParser{json_data.value()}.GetData();
@@ -94,12 +96,15 @@ auto score::json::VajsonParser::OnBool(bool value) noexcept -> score::json::vajs
 auto score::json::VajsonParser::OnNumber(score::json::vajson::JsonNumber value) noexcept
     -> score::json::vajson::ParserResult
 {
-    // The parser shall try first the unsigned types from smallest to largest.
-    // Then it shall try the signed types from smallest to largest.
-    // Finally it will try double.
-    // This way the model can assume that the number type is the "smallest possible type" except from floating-point
-    // numbers, they shall be always presented as a 'double'
-    return OnNumber<uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, double>(value);
+    // The model can assume that the number type is the "smallest possible type" except from floating-point numbers,
+    // they shall be always presented as a 'double'
+    const auto number = ToSmallestNumber(value);
+    if ((!number.has_value()) || (!Store(number.value()).has_value()))
+    {
+        return score::json::vajson::MakeErrorResult<score::json::vajson::ParserState>(
+            score::json::vajson::JsonErrc::kInvalidJson);
+    }
+    return score::json::vajson::ParserState::kRunning;
 }
 
 auto score::json::VajsonParser::OnString(std::string_view value) noexcept -> score::json::vajson::ParserResult
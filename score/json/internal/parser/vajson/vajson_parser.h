@@ -116,25 +116,6 @@ class VajsonParser final : private score::json::vajson::v2::Parser
     auto OnEndArray(std::size_t) noexcept -> score::json::vajson::ParserResult override;
     auto OnUnexpectedEvent() noexcept -> score::json::vajson::ParserResult override;
 
-    template <typename... NumberType>
-    auto OnNumber(score::json::vajson::JsonNumber& value) noexcept -> score::json::vajson::ParserResult
-    {
-        auto TryStoreResult = [this](auto result) -> bool {
-            return (result.has_value() && Store(score::json::Number{result.value()}).has_value());
-        };
-
-        // Coverity warning: The operands of a logical && or || shall be parenthesized if the operands contain binary
-        // operators. Fold expression automatically sets parenthesis when expression is unfolded. In this case we are
-        // using Unary right fold '(E op ...) becomes (E1 op (... op (En-1 op En)))'. That means for OnNumber<int,
-        // float, double>(value) fold expression will be: ( (TryStoreResult(value.As<int>())) || (
-        // (TryStoreResult(value.As<float>())) || (TryStoreResult(value.As<double>())) ) )
-        // coverity[autosar_cpp14_a5_2_6_violation]
-        return ((TryStoreResult(value.As<NumberType>())) || ...)
-                   ? score::json::vajson::ParserState::kRunning
-                   : score::json::vajson::MakeErrorResult<score::json::vajson::ParserState>(
-                         score::json::vajson::JsonErrc::kInvalidJson);
-    }
-
     std::string last_key_{};
     std::stack<Any*> hierarchy_{};
     Any root_{};
@@ -0,0 +1,270 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/flat_json_parser.h"
+#include "score/json/internal/model/error.h"
+#include "score/json/internal/parser/nlohmann/json_builder.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader.h"
+#include "score/json/internal/parser/vajson/vajson_parser.h"
+
+#include "score/utility.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+
+std::atomic<std::uint64_t> number_of_heap_allocations{0U};
+std::atomic<std::uint64_t> number_of_heap_bytes{0U};
+
+}  // namespace
+
+// Counts the heap allocations of the whole binary, so that the memory cost of the data-trees can be reported.
+void* operator new(std::size_t size)
+{
+    number_of_heap_allocations.fetch_add(1U, std::memory_order_relaxed);
+    number_of_heap_bytes.fetch_add(size, std::memory_order_relaxed);
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc) replacement of the global operator new
+    void* const pointer = std::malloc((size == 0U) ? 1U : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc) replacement of the global operator delete
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc) replacement of the global operator delete
+    std::free(pointer);
+}
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfEntries{20000UL};
+
+/// Generates a configuration-like document of a few megabytes with indentation, nested objects, strings and numbers.
+const std::string& GetDocument()
+{
+    static const std::string document = []() {
+        std::string result{"{\n    \"entries\": [\n"};
+        for (std::size_t index{0UL}; index < kNumberOfEntries; ++index)
+        {
+            const auto number = std::to_string(index);
+            result += "        {\n";
+            result += "            \"name\": \"configuration_entry_" + number + "\",\n";
+            result += "            \"description\": \"A longer string value which describes entry " + number +
+                      " in \\\"detail\\\"\",\n";
+            result += "            \"id\": " + number + ",\n";
+            result += "            \"factor\": -" + number + ".125e-3,\n";
+            result += "            \"enabled\": true,\n";
+            result += "            \"fallback\": null,\n";
+            result += "            \"limits\": [0, 1, 2, 4, 8, 16, 32, 64]\n";
+            result += (index + 1UL < kNumberOfEntries) ? "        },\n" : "        }\n";
+        }
+        result += "    ]\n}\n";
+        return result;
+    }();
+    return document;
+}
+
+/// Counts the events, so that only the reader is measured and not the construction of a data-tree.
+class CountingParser final : public vajson::v2::Parser
+{
+  public:
+    using vajson::v2::Parser::Parser;
+
+    std::uint64_t number_of_events_{0U};
+
+  private:
+    auto OnNull() noexcept -> vajson::ParserResult override
+    {
+        return Count();
+    }
+    auto OnBool(bool) noexcept -> vajson::ParserResult override
+    {
+        return Count();
+    }
+    auto OnNumber(vajson::JsonNumber value) noexcept -> vajson::ParserResult override
+    {
+        benchmark::DoNotOptimize(value.As<double>());
+        return Count();
+    }
+    auto OnString(vajson::StringView value) noexcept -> vajson::ParserResult override
+    {
+        benchmark::DoNotOptimize(value.data());
+        return Count();
+    }
+    auto OnKey(vajson::StringView key) noexcept -> vajson::ParserResult override
+    {
+        benchmark::DoNotOptimize(key.data());
+        return Count();
+    }
+    auto OnStartObject() noexcept -> vajson::ParserResult override
+    {
+        return Count();
+    }
+    auto OnEndObject(std::size_t) noexcept -> vajson::ParserResult override
+    {
+        return Count();
+    }
+    auto OnStartArray() noexcept -> vajson::ParserResult override
+    {
+        return Count();
+    }
+    auto OnEndArray(std::size_t) noexcept -> vajson::ParserResult override
+    {
+        return Count();
+    }
+
+    auto Count() noexcept -> vajson::ParserResult
+    {
+        ++number_of_events_;
+        return vajson::ParserState::kRunning;
+    }
+};
+
+void Tokenize(benchmark::State& state, vajson::JsonData& data)
+{
+    CountingParser parser{data};
+    const auto result = parser.Parse();
+    if (!result.has_value())
+    {
+        state.SkipWithError("Failed to parse document");
+    }
+    benchmark::DoNotOptimize(parser.number_of_events_);
+}
+
+void TokenizeFromStream(benchmark::State& state)
+{
+    const auto& document = GetDocument();
+    for (auto _ : state)
+    {
+        vajson::JsonData data{std::make_unique<std::istringstream>(document)};
+        Tokenize(state, data);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+void TokenizeInPlace(benchmark::State& state)
+{
+    const auto& document = GetDocument();
+    for (auto _ : state)
+    {
+        auto data = vajson::JsonData::FromView(document);
+        Tokenize(state, data.value());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+void TokenizeFile(benchmark::State& state)
+{
+    const auto& document = GetDocument();
+    const std::string file_path = std::tmpnam(nullptr);
+    std::ofstream{file_path} << document;
+    for (auto _ : state)
+    {
+        auto data = vajson::JsonData::FromFile(file_path);
+        Tokenize(state, data.value());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+    score::cpp::ignore = std::remove(file_path.c_str());
+}
+
+/// Builds the data-tree the same way as the nlohmann backend of score::json::JsonParser, which can not be linked
+/// together with the vajson backend.
+struct NlohmannBackend
+{
+    static auto FromBuffer(const std::string_view buffer) -> score::Result<Any>
+    {
+        JsonBuilder json_builder{};
+        auto callback = [&json_builder](int, nlohmann::json::parse_event_t event, nlohmann::json& parsed) -> bool {
+            return json_builder.HandleEvent(event, parsed);
+        };
+        if (nlohmann::json::parse(buffer, callback, false).is_discarded())
+        {
+            return MakeUnexpected(Error::kParsingError);
+        }
+        return json_builder.GetData();
+    }
+};
+
+/// Parses into a FlatDocument through the same interface as the data-tree backends.
+struct FlatBackend
+{
+    static auto FromBuffer(const std::string_view buffer) -> score::Result<FlatDocument>
+    {
+        return FlatJsonParser{}.FromBuffer(buffer);
+    }
+};
+
+/// Parses the document and reports the heap allocations and allocated bytes per parsed document, including the
+/// destruction of the result.
+template <typename Backend>
+void ParseIntoDataTree(benchmark::State& state)
+{
+    const auto& document = GetDocument();
+    const auto allocations_before = number_of_heap_allocations.load(std::memory_order_relaxed);
+    const auto bytes_before = number_of_heap_bytes.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        auto result = Backend::FromBuffer(document);
+        if (!result.has_value())
+        {
+            state.SkipWithError("Failed to parse document");
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    const auto allocations = number_of_heap_allocations.load(std::memory_order_relaxed) - allocations_before;
+    const auto bytes = number_of_heap_bytes.load(std::memory_order_relaxed) - bytes_before;
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    state.counters["allocated_bytes"] =
+        benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kAvgIterations);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+BENCHMARK(TokenizeFromStream)->Unit(benchmark::kMillisecond);
+BENCHMARK(TokenizeInPlace)->Unit(benchmark::kMillisecond);
+BENCHMARK(TokenizeFile)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ParseIntoDataTree, VajsonParser)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ParseIntoDataTree, NlohmannBackend)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ParseIntoDataTree, FlatBackend)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,146 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_sax_parser.h"
+#include "score/json/internal/parser/vajson/vajson_number.h"
+
+#include <score/utility.hpp>
+
+auto score::json::VajsonSaxParser::FromFile(const std::string_view file_path, JsonSaxHandler& handler)
+    -> score::ResultBlank
+{
+    // NOLINTNEXTLINE(score-banned-function) Tolerated because JsonParser::FromFile is also on the banned function list
+    auto json_data = score::json::vajson::JsonData::FromFile(file_path);
+    if (!json_data.has_value())
+    {
+        return MakeUnexpected(Error::kParsingError);
+    }
+    return VajsonSaxParser{json_data.value(), handler}.Run();
+}
+
+auto score::json::VajsonSaxParser::FromBuffer(const std::string_view buffer, JsonSaxHandler& handler)
+    -> score::ResultBlank
+{
+    // The buffer outlives the parsing, thus it is scanned in place instead of being copied.
+    auto json_data = score::json::vajson::JsonData::FromView(std::string_view{buffer.data(), buffer.size()});
+    if (!json_data.has_value())  // LCOV_EXCL_BR_LINE (Decision Coverage: Not reachable, see VajsonParser::FromBuffer)
+    {
+        return MakeUnexpected(Error::kParsingError);  // LCOV_EXCL_LINE
+    }
+    return VajsonSaxParser{json_data.value(), handler}.Run();
+}
+
+score::json::VajsonSaxParser::VajsonSaxParser(score::json::vajson::JsonData& json_data,
+                                              JsonSaxHandler& handler) noexcept
+    : score::json::vajson::v2::Parser{json_data}, handler_{handler}, handler_error_{}
+{
+}
+
+auto score::json::VajsonSaxParser::Run() noexcept -> score::ResultBlank
+{
+    const auto parse_result = Parse();
+    if (handler_error_.has_value())
+    {
+        return MakeUnexpected<score::Blank>(handler_error_.value());
+    }
+    if (!parse_result.has_value())
+    {
+        return MakeUnexpected(Error::kParsingError);
+    }
+    return {};
+}
+
+auto score::json::VajsonSaxParser::Forward(score::ResultBlank handler_result) noexcept
+    -> score::json::vajson::ParserResult
+{
+    if (!handler_result.has_value())
+    {
+        score::cpp::ignore = handler_error_.emplace(handler_result.error());
+        return score::json::vajson::MakeErrorResult<score::json::vajson::ParserState>(
+            score::json::vajson::JsonErrc::kUserValidationFailed);
+    }
+    return score::json::vajson::ParserState::kRunning;
+}
+
+auto score::json::VajsonSaxParser::OnNull() noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnNull());
+}
+
+auto score::json::VajsonSaxParser::OnBool(bool value) noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnBool(value));
+}
+
+auto score::json::VajsonSaxParser::OnNumber(score::json::vajson::JsonNumber value) noexcept
+    -> score::json::vajson::ParserResult
+{
+    const auto number = ToSmallestNumber(value);
+    if (!number.has_value())
+    {
+        return score::json::vajson::MakeErrorResult<score::json::vajson::ParserState>(
+            score::json::vajson::JsonErrc::kInvalidJson);
+    }
+    return Forward(handler_.OnNumber(number.value()));
+}
+
+auto score::json::VajsonSaxParser::OnString(std::string_view value) noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnString(value));
+}
+
+auto score::json::VajsonSaxParser::OnKey(std::string_view key) noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnKey(key));
+}
+
+auto score::json::VajsonSaxParser::OnStartObject() noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnStartObject());
+}
+
+auto score::json::VajsonSaxParser::OnEndObject(std::size_t) noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnEndObject());
+}
+
+auto score::json::VajsonSaxParser::OnStartArray() noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnStartList());
+}
+
+auto score::json::VajsonSaxParser::OnEndArray(std::size_t) noexcept -> score::json::vajson::ParserResult
+{
+    return Forward(handler_.OnEndList());
+}
+
+auto score::json::VajsonSaxParser::OnUnexpectedEvent() noexcept -> score::json::vajson::ParserResult
+{
+    // See VajsonParser::OnUnexpectedEvent, a missing callback means the type is not supported.
+    return score::json::vajson::MakeErrorResult<score::json::vajson::ParserState>(
+        score::json::vajson::JsonErrc::kUserValidationFailed);
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings: "The std::terminate() function shall not be called implicitly".
+// Calling std::terminate() if any exceptions are thrown is expected as per safety requirements
+// coverity[autosar_cpp14_a15_5_3_violation]
+auto score::json::JsonSaxParser::FromFile(const std::string_view file_path, JsonSaxHandler& handler) const noexcept
+    -> score::ResultBlank
+{
+    return score::json::VajsonSaxParser::FromFile(file_path, handler);
+}
+
+auto score::json::JsonSaxParser::FromBuffer(const std::string_view buffer, JsonSaxHandler& handler) const noexcept
+    -> score::ResultBlank
+{
+    return score::json::VajsonSaxParser::FromBuffer(buffer, handler);
+}
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_SAX_PARSER_H
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_SAX_PARSER_H
+
+#include "score/json/json_sax_parser.h"
+#include "score/result/result.h"
+
+#include "score/json/internal/parser/vajson/vajson_impl/reader.h"
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+
+/// \brief JSON parser that uses vaJSON from Vector and forwards its events to a JsonSaxHandler
+class VajsonSaxParser final : private score::json::vajson::v2::Parser
+{
+  public:
+    /// \brief Reports the tokens of a JSON file to the handler
+    /// \param file_path The JSON file to read
+    /// \param handler The handler receiving the events
+    /// \return Blank, the error of the handler if it stopped the parsing, kParsingError on invalid JSON
+    static auto FromFile(const std::string_view file_path, JsonSaxHandler& handler) -> score::ResultBlank;
+
+    /// \brief Reports the tokens of a string containing JSON to the handler
+    /// \param buffer The string_view containing JSON
+    /// \param handler The handler receiving the events
+    /// \return Blank, the error of the handler if it stopped the parsing, kParsingError on invalid JSON
+    static auto FromBuffer(const std::string_view buffer, JsonSaxHandler& handler) -> score::ResultBlank;
+
+  private:
+    VajsonSaxParser(score::json::vajson::JsonData& json_data, JsonSaxHandler& handler) noexcept;
+
+    auto Run() noexcept -> score::ResultBlank;
+
+    /// \brief Stops the parsing if the handler returned an error, which is kept to be returned by Run()
+    auto Forward(score::ResultBlank handler_result) noexcept -> score::json::vajson::ParserResult;
+
+    auto OnNull() noexcept -> score::json::vajson::ParserResult override;
+    auto OnBool(bool value) noexcept -> score::json::vajson::ParserResult override;
+    auto OnNumber(score::json::vajson::JsonNumber value) noexcept -> score::json::vajson::ParserResult override;
+    auto OnString(std::string_view value) noexcept -> score::json::vajson::ParserResult override;
+    auto OnKey(std::string_view key) noexcept -> score::json::vajson::ParserResult override;
+    auto OnStartObject() noexcept -> score::json::vajson::ParserResult override;
+    auto OnEndObject(std::size_t) noexcept -> score::json::vajson::ParserResult override;
+    auto OnStartArray() noexcept -> score::json::vajson::ParserResult override;
+    auto OnEndArray(std::size_t) noexcept -> score::json::vajson::ParserResult override;
+    auto OnUnexpectedEvent() noexcept -> score::json::vajson::ParserResult override;
+
+    JsonSaxHandler& handler_;
+    std::optional<score::result::Error> handler_error_;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_VAJSON_SAX_PARSER_H
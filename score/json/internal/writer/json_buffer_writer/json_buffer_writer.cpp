@@ -0,0 +1,360 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/json/internal/writer/json_buffer_writer/json_buffer_writer.h"
+
+#include "score/json/internal/model/null.h"
+
+#include <score/bit.hpp>
+#include <score/utility.hpp>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#define SCORE_LIB_JSON_BUFFER_WRITER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__linux__) || defined(__QNX__))
+#define SCORE_LIB_JSON_BUFFER_WRITER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+constexpr std::size_t kIndentWidth{4U};
+constexpr std::size_t kBlockSize{16U};
+
+// The decimal digits of 00 to 99, so that integers are formatted two digits per division.
+constexpr std::array<char, 201U> kDigitPairs{
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899"};
+
+template <typename T>
+void AppendInteger(std::string& buffer, const T value)
+{
+    using U = std::make_unsigned_t<T>;
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "integral only");
+
+    // One character more than the maximal number of digits for the sign.
+    std::array<char, static_cast<std::size_t>(std::numeric_limits<U>::digits10) + 2U> characters{};
+    const bool is_negative{value < static_cast<T>(0)};
+    // The magnitude of the minimum of a signed type is only representable as its unsigned counterpart.
+    U magnitude{is_negative ? static_cast<U>(static_cast<U>(0U) - static_cast<U>(value)) : static_cast<U>(value)};
+
+    std::size_t position{characters.size()};
+    while (magnitude >= 100U)
+    {
+        const auto pair = static_cast<std::size_t>(magnitude % 100U) * 2U;
+        magnitude = static_cast<U>(magnitude / 100U);
+        characters[--position] = kDigitPairs[pair + 1U];
+        characters[--position] = kDigitPairs[pair];
+    }
+    if (magnitude >= 10U)
+    {
+        const auto pair = static_cast<std::size_t>(magnitude) * 2U;
+        characters[--position] = kDigitPairs[pair + 1U];
+        characters[--position] = kDigitPairs[pair];
+    }
+    else
+    {
+        characters[--position] = static_cast<char>('0' + static_cast<char>(magnitude));
+    }
+    if (is_negative)
+    {
+        characters[--position] = '-';
+    }
+    score::cpp::ignore = buffer.append(&characters[position], characters.size() - position);
+}
+
+/// Appends the shortest representation which parses back to the same value of type T.
+template <typename T>
+void AppendFloatingPoint(std::string& buffer, const T value)
+{
+    if (!std::isfinite(value))
+    {
+        score::cpp::ignore = buffer.append("null");
+        return;
+    }
+    std::array<char, 32U> characters{};
+#if defined(__cpp_lib_to_chars)
+    const auto result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    score::cpp::ignore = buffer.append(characters.data(), result.ptr);
+#else
+    // Toolchains without floating point std::to_chars: increase the precision until the value round-trips.
+    std::int32_t length{0};
+    for (std::int32_t precision{std::numeric_limits<T>::digits10}; precision <= std::numeric_limits<T>::max_digits10;
+         ++precision)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) fixed format string, arguments match
+        length = std::snprintf(characters.data(), characters.size(), "%.*g", precision, static_cast<double>(value));
+        if (std::equal_to<T>{}(static_cast<T>(std::strtod(characters.data(), nullptr)), value))
+        {
+            break;
+        }
+    }
+    score::cpp::ignore = buffer.append(characters.data(), static_cast<std::size_t>(length));
+#endif
+}
+
+/// Returns whether the character has to be escaped within a JSON string, cf. RFC-8259 section 7.
+constexpr bool NeedsEscaping(const char character) noexcept
+{
+    return (static_cast<unsigned char>(character) < 0x20U) || (character == '"') || (character == '\\');
+}
+
+/// Returns the index of the first character at or after index which has to be escaped, or the size of string.
+std::size_t FindFirstToEscape(const std::string_view string, std::size_t index) noexcept
+{
+#if defined(SCORE_LIB_JSON_BUFFER_WRITER_SSE2)
+    const __m128i quote{_mm_set1_epi8('"')};
+    const __m128i backslash{_mm_set1_epi8('\\')};
+    const __m128i last_control_character{_mm_set1_epi8(0x1F)};
+    for (; (index + kBlockSize) <= string.size(); index += kBlockSize)
+    {
+        const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + index))};
+        // Unsigned compare: a byte is a control character iff max(byte, 0x1F) == 0x1F.
+        const __m128i is_control{_mm_cmpeq_epi8(_mm_max_epu8(block, last_control_character), last_control_character)};
+        const __m128i matches{
+            _mm_or_si128(is_control, _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)))};
+        const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+        if (mask != 0U)
+        {
+            return index + static_cast<std::size_t>(score::cpp::countr_zero(mask));
+        }
+    }
+#elif defined(SCORE_LIB_JSON_BUFFER_WRITER_NEON)
+    const uint8x16_t quote{vdupq_n_u8(static_cast<std::uint8_t>('"'))};
+    const uint8x16_t backslash{vdupq_n_u8(static_cast<std::uint8_t>('\\'))};
+    const uint8x16_t first_printable_character{vdupq_n_u8(0x20U)};
+    for (; (index + kBlockSize) <= string.size(); index += kBlockSize)
+    {
+        const uint8x16_t block{vld1q_u8(reinterpret_cast<const std::uint8_t*>(string.data() + index))};
+        const uint8x16_t matches{vorrq_u8(vcltq_u8(block, first_printable_character),
+                                          vorrq_u8(vceqq_u8(block, quote), vceqq_u8(block, backslash)))};
+        // Narrow every byte of the comparison result to four bits, so that the result fits into one 64 bit lane.
+        const uint8x8_t nibbles{vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)};
+        const std::uint64_t bits{vget_lane_u64(vreinterpret_u64_u8(nibbles), 0)};
+        if (bits != 0U)
+        {
+            return index + (static_cast<std::size_t>(score::cpp::countr_zero(bits)) / 4U);
+        }
+    }
+#endif
+    while ((index < string.size()) && !NeedsEscaping(string[index]))
+    {
+        ++index;
+    }
+    return index;
+}
+
+void AppendEscaped(std::string& buffer, const char character)
+{
+    switch (character)
+    {
+        case '"':
+            score::cpp::ignore = buffer.append("\\\"");
+            break;
+        case '\\':
+            score::cpp::ignore = buffer.append("\\\\");
+            break;
+        case '\b':
+            score::cpp::ignore = buffer.append("\\b");
+            break;
+        case '\f':
+            score::cpp::ignore = buffer.append("\\f");
+            break;
+        case '\n':
+            score::cpp::ignore = buffer.append("\\n");
+            break;
+        case '\r':
+            score::cpp::ignore = buffer.append("\\r");
+            break;
+        case '\t':
+            score::cpp::ignore = buffer.append("\\t");
+            break;
+        default:
+        {
+            constexpr std::array<char, 17U> kHexDigits{"0123456789abcdef"};
+            const auto byte = static_cast<std::size_t>(static_cast<unsigned char>(character));
+            const std::array<char, 6U> escaped{'\\', 'u', '0', '0', kHexDigits[byte / 16U], kHexDigits[byte % 16U]};
+            score::cpp::ignore = buffer.append(escaped.data(), escaped.size());
+            break;
+        }
+    }
+}
+
+}  // namespace
+
+JsonBufferWriter::JsonBufferWriter(std::string& buffer, const JsonFormat format) noexcept
+    : buffer_{buffer}, format_{format}
+{
+}
+
+void JsonBufferWriter::Write(const Any& json_data)
+{
+    WriteValue(json_data, 0U);
+}
+
+void JsonBufferWriter::Write(const Object& json_data)
+{
+    WriteObject(json_data, 0U);
+}
+
+void JsonBufferWriter::Write(const List& json_data)
+{
+    WriteList(json_data, 0U);
+}
+
+// Justification: broken_link_c/issue/15410189
+// NOLINTNEXTLINE(misc-no-recursion) recursion justified for json serialization
+void JsonBufferWriter::WriteValue(const Any& value, const std::size_t depth)
+{
+    const auto number = value.As<Number>();
+    if (number.has_value())
+    {
+        WriteNumber(number.value().get());
+        return;
+    }
+    const auto string = value.As<std::string>();
+    if (string.has_value())
+    {
+        WriteString(string.value().get());
+        return;
+    }
+    // Numbers are handled above, so only an actual bool is left for the arithmetic accessor.
+    const auto boolean = value.As<bool>();
+    if (boolean.has_value())
+    {
+        score::cpp::ignore = buffer_.append(boolean.value() ? "true" : "false");
+        return;
+    }
+    const auto object = value.As<Object>();
+    if (object.has_value())
+    {
+        WriteObject(object.value().get(), depth);
+        return;
+    }
+    const auto list = value.As<List>();
+    if (list.has_value())
+    {
+        WriteList(list.value().get(), depth);
+        return;
+    }
+    // Null is the only remaining alternative of Any.
+    score::cpp::ignore = buffer_.append("null");
+}
+
+// Justification: broken_link_c/issue/15410189
+// NOLINTNEXTLINE(misc-no-recursion) recursion justified for json serialization
+void JsonBufferWriter::WriteObject(const Object& json_data, const std::size_t depth)
+{
+    buffer_.push_back('{');
+    const char* const key_separator{(format_ == JsonFormat::kPretty) ? ": " : ":"};
+    bool is_first{true};
+    for (const auto& pair : json_data)
+    {
+        if (!is_first)
+        {
+            buffer_.push_back(',');
+        }
+        is_first = false;
+        WriteLineBreak(depth + 1U);
+        WriteString(pair.first.GetAsStringView());
+        score::cpp::ignore = buffer_.append(key_separator);
+        WriteValue(pair.second, depth + 1U);
+    }
+    // Like JsonSerialize, the pretty layout also breaks the line within empty objects.
+    WriteLineBreak(depth);
+    buffer_.push_back('}');
+}
+
+// Justification: broken_link_c/issue/15410189
+// NOLINTNEXTLINE(misc-no-recursion) recursion justified for json serialization
+void JsonBufferWriter::WriteList(const List& json_data, const std::size_t depth)
+{
+    buffer_.push_back('[');
+    bool is_first{true};
+    for (const Any& value : json_data)
+    {
+        if (!is_first)
+        {
+            buffer_.push_back(',');
+        }
+        is_first = false;
+        WriteLineBreak(depth + 1U);
+        WriteValue(value, depth + 1U);
+    }
+    WriteLineBreak(depth);
+    buffer_.push_back(']');
+}
+
+/// Numbers are written in the type they are stored as, so that floats get the shortest representation of a float.
+void JsonBufferWriter::WriteNumber(const Number& number)
+{
+    number.Visit([this](const auto value) {
+        // Coverity doesn't know constexpr if statements
+        // coverity[autosar_cpp14_a7_1_8_violation]
+        if constexpr (std::is_floating_point<decltype(value)>::value)
+        {
+            AppendFloatingPoint(buffer_, value);
+        }
+        else
+        {
+            AppendInteger(buffer_, value);
+        }
+    });
+}
+
+void JsonBufferWriter::WriteString(const std::string_view string)
+{
+    buffer_.push_back('"');
+    std::size_t begin{0U};
+    while (begin < string.size())
+    {
+        const std::size_t end{FindFirstToEscape(string, begin)};
+        score::cpp::ignore = buffer_.append(string.data() + begin, end - begin);
+        if (end == string.size())
+        {
+            break;
+        }
+        AppendEscaped(buffer_, string[end]);
+        begin = end + 1U;
+    }
+    buffer_.push_back('"');
+}
+
+void JsonBufferWriter::WriteLineBreak(const std::size_t depth)
+{
+    if (format_ == JsonFormat::kPretty)
+    {
+        buffer_.push_back('\n');
+        score::cpp::ignore = buffer_.append(depth * kIndentWidth, ' ');
+    }
+}
+
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,70 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_LIB_JSON_INTERNAL_WRITER_JSON_BUFFER_WRITER_JSON_BUFFER_WRITER_H
+#define SCORE_LIB_JSON_INTERNAL_WRITER_JSON_BUFFER_WRITER_JSON_BUFFER_WRITER_H
+
+#include "score/json/internal/model/any.h"
+#include "score/json/internal/model/number.h"
+#include "score/json/json_format.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+
+/// @brief Serializes JSON data by appending it to a contiguous buffer in a single pass.
+///
+/// @details In contrast to JsonSerialize, no std::ostream is involved: integers are formatted with a digit-pair table,
+/// floating point numbers with the shortest representation which parses back to the same value, and strings are
+/// scanned for characters which need escaping 16 bytes at a time (SSE2 respectively NEON, scalar otherwise) so that
+/// unescaped runs are copied at once. Non-finite floating point numbers, which JSON can not represent, are written
+/// as null.
+///
+/// The buffer is only appended to, so clearing and reusing it for further documents avoids reallocations.
+class JsonBufferWriter final
+{
+  public:
+    explicit JsonBufferWriter(std::string& buffer, const JsonFormat format = JsonFormat::kPretty) noexcept;
+    ~JsonBufferWriter() = default;
+
+    JsonBufferWriter(const JsonBufferWriter& other) = delete;
+    JsonBufferWriter(JsonBufferWriter&& other) noexcept = default;
+    JsonBufferWriter& operator=(const JsonBufferWriter& other) = delete;
+    JsonBufferWriter& operator=(JsonBufferWriter&& other) = delete;
+
+    void Write(const score::json::Any& json_data);
+    void Write(const score::json::Object& json_data);
+    void Write(const score::json::List& json_data);
+
+  private:
+    void WriteValue(const score::json::Any& value, const std::size_t depth);
+    void WriteObject(const score::json::Object& json_data, const std::size_t depth);
+    void WriteList(const score::json::List& json_data, const std::size_t depth);
+    void WriteNumber(const score::json::Number& number);
+    void WriteString(const std::string_view string);
+    void WriteLineBreak(const std::size_t depth);
+
+    std::string& buffer_;
+    JsonFormat format_;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_WRITER_JSON_BUFFER_WRITER_JSON_BUFFER_WRITER_H
@@ -0,0 +1,180 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/writer/json_buffer_writer/json_buffer_writer.h"
+#include "score/json/internal/writer/json_serialize/json_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+template <typename T>
+std::string Write(const T& json, const JsonFormat format = JsonFormat::kPretty)
+{
+    std::string buffer{};
+    JsonBufferWriter writer{buffer, format};
+    writer.Write(json);
+    return buffer;
+}
+
+Object CreateNestedObject()
+{
+    Object nested{};
+    nested["empty_object"] = Object{};
+    nested["empty_list"] = List{};
+    List list{};
+    list.emplace_back(std::uint64_t{1U});
+    list.emplace_back(std::int64_t{-2});
+    list.emplace_back(std::string{"three"});
+    list.emplace_back(Null{});
+    Object json{};
+    json["list"] = std::move(list);
+    json["nested"] = std::move(nested);
+    json["string"] = std::string{R"(String with "special" characters like \)"};
+    return json;
+}
+
+TEST(JsonBufferWriterTest, PrettyFormatMatchesJsonSerialize)
+{
+    RecordProperty("Verifies", "SCR-5310867");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "serializing nested json into a buffer, cf. RFC-8259 section 4, 5 and 9");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    const Object json = CreateNestedObject();
+    std::ostringstream stream{};
+    JsonSerialize serializer{stream};
+    ASSERT_TRUE((serializer << json).has_value());
+
+    EXPECT_EQ(Write(json), stream.str());
+    EXPECT_EQ(Write(json), R"({
+    "list": [
+        1,
+        -2,
+        "three",
+        null
+    ],
+    "nested": {
+        "empty_list": [
+        ],
+        "empty_object": {
+        }
+    },
+    "string": "String with \"special\" characters like \\"
+})");
+}
+
+TEST(JsonBufferWriterTest, CompactFormatContainsNoWhitespace)
+{
+    const Object json = CreateNestedObject();
+
+    EXPECT_EQ(Write(json, JsonFormat::kCompact),
+              R"({"list":[1,-2,"three",null],"nested":{"empty_list":[],"empty_object":{}},)"
+              R"("string":"String with \"special\" characters like \\"})");
+    EXPECT_EQ(Write(List{}, JsonFormat::kCompact), "[]");
+    EXPECT_EQ(Write(Any{std::string{"any"}}, JsonFormat::kCompact), R"("any")");
+}
+
+TEST(JsonBufferWriterTest, AppendsToBuffer)
+{
+    std::string buffer{"prefix "};
+    JsonBufferWriter writer{buffer, JsonFormat::kCompact};
+
+    writer.Write(Any{std::uint64_t{1U}});
+    writer.Write(Any{true});
+
+    EXPECT_EQ(buffer, "prefix 1true");
+}
+
+TEST(JsonBufferWriterTest, WritesBooleans)
+{
+    List json{};
+    json.emplace_back(true);
+    json.emplace_back(false);
+
+    EXPECT_EQ(Write(json, JsonFormat::kCompact), "[true,false]");
+}
+
+TEST(JsonBufferWriterTest, WritesIntegerBoundaries)
+{
+    List json{};
+    json.emplace_back(std::numeric_limits<std::uint64_t>::max());
+    json.emplace_back(std::numeric_limits<std::int64_t>::min());
+    json.emplace_back(std::int64_t{-9});
+    json.emplace_back(std::int64_t{-10});
+    json.emplace_back(std::uint64_t{0U});
+    json.emplace_back(std::uint64_t{99U});
+    json.emplace_back(std::uint64_t{100U});
+    json.emplace_back(std::int8_t{-128});
+    json.emplace_back(std::uint8_t{255U});
+
+    EXPECT_EQ(Write(json, JsonFormat::kCompact),
+              "[18446744073709551615,-9223372036854775808,-9,-10,0,99,100,-128,255]");
+}
+
+TEST(JsonBufferWriterTest, WritesShortestRoundTripFloatingPointNumbers)
+{
+    List json{};
+    json.emplace_back(0.1);
+    json.emplace_back(0.123456789012345);
+    json.emplace_back(-1.5e-300);
+    json.emplace_back(2.0);
+    json.emplace_back(std::numeric_limits<double>::max());
+    json.emplace_back(0.1F);
+
+    EXPECT_EQ(Write(json, JsonFormat::kCompact), "[0.1,0.123456789012345,-1.5e-300,2,1.7976931348623157e+308,0.1]");
+}
+
+TEST(JsonBufferWriterTest, WritesNonFiniteNumbersAsNull)
+{
+    List json{};
+    json.emplace_back(std::numeric_limits<double>::infinity());
+    json.emplace_back(std::numeric_limits<float>::quiet_NaN());
+
+    EXPECT_EQ(Write(json, JsonFormat::kCompact), "[null,null]");
+}
+
+TEST(JsonBufferWriterTest, EscapesStringsAndKeys)
+{
+    RecordProperty("Verifies", "SCR-5310867");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "serializing strings with characters which must be escaped, cf. RFC-8259 section 7");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Long enough to cover both the vectorized blocks and the remainder.
+    const std::string value{std::string{"quote\" backslash\\ newline\n tab\t"} + '\x01' + " unicode \xC3\xA4 " +
+                            std::string(20U, 'x') + '\x1F' + "/end"};
+    Object json{};
+    json["key\"with\nescapes"] = value;
+
+    EXPECT_EQ(Write(json, JsonFormat::kCompact),
+              R"({"key\"with\nescapes":"quote\" backslash\\ newline\n tab\t\u0001 unicode )"
+              "\xC3\xA4 "
+              R"(xxxxxxxxxxxxxxxxxxxx\u001f/end"})");
+    EXPECT_EQ(Write(Any{std::string{"\b\f\r"}}), R"("\b\f\r")");
+}
+
+}  // namespace
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,312 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/json_decoder.h"
+
+#include <score/utility.hpp>
+
+#include <utility>
+
+namespace score::json::detail::decoder
+{
+namespace
+{
+
+score::Unexpected MakeWrongTypeError() noexcept
+{
+    return MakeUnexpected(Error::kWrongType, "JSON value not of expected type");
+}
+
+// The element of a std::vector<bool>, which is given as target the vector itself.
+class BoolElementSink final : public ValueSink
+{
+  public:
+    ResultBlank OnBool(void* const list, const bool boolean) const noexcept override
+    {
+        static_cast<std::vector<bool>*>(list)->push_back(boolean);
+        return {};
+    }
+
+    ResultBlank OnNumber(void* const list, const Number& number) const noexcept override
+    {
+        bool element{};
+        const auto result = GetSink<bool>().OnNumber(&element, number);
+        if (result.has_value())
+        {
+            static_cast<std::vector<bool>*>(list)->push_back(element);
+        }
+        return result;
+    }
+};
+
+}  // namespace
+
+ValueSink::~ValueSink() = default;
+
+ResultBlank ValueSink::OnNull(void* const) const noexcept
+{
+    return MakeWrongTypeError();
+}
+
+ResultBlank ValueSink::OnBool(void* const, const bool) const noexcept
+{
+    return MakeWrongTypeError();
+}
+
+ResultBlank ValueSink::OnNumber(void* const, const Number&) const noexcept
+{
+    return MakeWrongTypeError();
+}
+
+ResultBlank ValueSink::OnString(void* const, const std::string_view) const noexcept
+{
+    return MakeWrongTypeError();
+}
+
+Result<Target> ValueSink::OnStartObject(void* const) const noexcept
+{
+    return MakeWrongTypeError();
+}
+
+Result<Target> ValueSink::OnStartList(void* const) const noexcept
+{
+    return MakeWrongTypeError();
+}
+
+// Only called for sinks which returned themselves from OnStartObject() or OnStartList(), which override these.
+Target ValueSink::OnKey(void* const, const std::string_view, std::uint64_t&) const noexcept
+{
+    return Target{nullptr, nullptr};  // LCOV_EXCL_LINE (not reachable, see above)
+}
+
+Target ValueSink::OnElement(void* const) const noexcept
+{
+    return Target{nullptr, nullptr};  // LCOV_EXCL_LINE (not reachable, see above)
+}
+
+ResultBlank ValueSink::OnEndObject(void* const, const std::uint64_t) const noexcept
+{
+    return {};
+}
+
+ResultBlank Sink<bool>::OnBool(void* const value, const bool boolean) const noexcept
+{
+    *static_cast<bool*>(value) = boolean;
+    return {};
+}
+
+ResultBlank Sink<bool>::OnNumber(void* const value, const Number& number) const noexcept
+{
+    const auto converted = number.As<bool>();
+    if (!converted.has_value())
+    {
+        return MakeUnexpected(Error::kWrongType, "Expected a bool");
+    }
+    *static_cast<bool*>(value) = converted.value();
+    return {};
+}
+
+Result<Target> Sink<std::vector<bool>>::OnStartList(void* const value) const noexcept
+{
+    static_cast<std::vector<bool>*>(value)->clear();
+    return Target{value, this};
+}
+
+Target Sink<std::vector<bool>>::OnElement(void* const list) const noexcept
+{
+    static const BoolElementSink element_sink{};
+    return Target{list, &element_sink};
+}
+
+ResultBlank Sink<std::string>::OnString(void* const value, const std::string_view string) const noexcept
+{
+    score::cpp::ignore = static_cast<std::string*>(value)->assign(string.data(), string.size());
+    return {};
+}
+
+ResultBlank Sink<Any>::OnNull(void* const value) const noexcept
+{
+    *static_cast<Any*>(value) = Any{};
+    return {};
+}
+
+ResultBlank Sink<Any>::OnBool(void* const value, const bool boolean) const noexcept
+{
+    *static_cast<Any*>(value) = Any{boolean};
+    return {};
+}
+
+ResultBlank Sink<Any>::OnNumber(void* const value, const Number& number) const noexcept
+{
+    *static_cast<Any*>(value) = Any{number};
+    return {};
+}
+
+ResultBlank Sink<Any>::OnString(void* const value, const std::string_view string) const noexcept
+{
+    *static_cast<Any*>(value) = Any{std::string{string}};
+    return {};
+}
+
+Result<Target> Sink<Any>::OnStartObject(void* const value) const noexcept
+{
+    auto& any = *static_cast<Any*>(value);
+    any = Object{};
+    return MakeTarget(any.As<Object>().value().get());
+}
+
+Result<Target> Sink<Any>::OnStartList(void* const value) const noexcept
+{
+    auto& any = *static_cast<Any*>(value);
+    any = List{};
+    return MakeTarget(any.As<List>().value().get());
+}
+
+Target Sink<Object>::OnKey(void* const object, const std::string_view key, std::uint64_t&) const noexcept
+{
+    // Like for VajsonParser, the first occurrence of a duplicated key is kept.
+    const auto insertion_result = static_cast<Object*>(object)->emplace(std::string{key}, Any{});
+    if (!insertion_result.second)
+    {
+        return Target{nullptr, nullptr};
+    }
+    return MakeTarget(insertion_result.first->second);
+}
+
+StreamingDecoder::StreamingDecoder(const Target root) noexcept
+    : JsonSaxHandler{}, frames_{}, root_{root}, skipped_depth_{0U}
+{
+}
+
+ResultBlank StreamingDecoder::OnNull() noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        return {};
+    }
+    const auto target = NextTarget();
+    return (target.sink != nullptr) ? target.sink->OnNull(target.value) : ResultBlank{};
+}
+
+ResultBlank StreamingDecoder::OnBool(const bool value) noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        return {};
+    }
+    const auto target = NextTarget();
+    return (target.sink != nullptr) ? target.sink->OnBool(target.value, value) : ResultBlank{};
+}
+
+ResultBlank StreamingDecoder::OnNumber(const Number& value) noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        return {};
+    }
+    const auto target = NextTarget();
+    return (target.sink != nullptr) ? target.sink->OnNumber(target.value, value) : ResultBlank{};
+}
+
+ResultBlank StreamingDecoder::OnString(const std::string_view value) noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        return {};
+    }
+    const auto target = NextTarget();
+    return (target.sink != nullptr) ? target.sink->OnString(target.value, value) : ResultBlank{};
+}
+
+ResultBlank StreamingDecoder::OnKey(const std::string_view key) noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        return {};
+    }
+    auto& frame = frames_.back();
+    frame.member = frame.container.sink->OnKey(frame.container.value, key, frame.decoded_fields);
+    return {};
+}
+
+ResultBlank StreamingDecoder::OnStartObject() noexcept
+{
+    return StartContainer(false);
+}
+
+ResultBlank StreamingDecoder::OnEndObject() noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        --skipped_depth_;
+        return {};
+    }
+    const auto frame = frames_.back();
+    frames_.pop_back();
+    return frame.container.sink->OnEndObject(frame.container.value, frame.decoded_fields);
+}
+
+ResultBlank StreamingDecoder::OnStartList() noexcept
+{
+    return StartContainer(true);
+}
+
+ResultBlank StreamingDecoder::OnEndList() noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        --skipped_depth_;
+        return {};
+    }
+    frames_.pop_back();
+    return {};
+}
+
+/// The next value is the root, the next element of a list or the value of the member whose key was seen last.
+Target StreamingDecoder::NextTarget() noexcept
+{
+    if (frames_.empty())
+    {
+        return std::exchange(root_, Target{nullptr, nullptr});
+    }
+    auto& frame = frames_.back();
+    if (frame.is_list)
+    {
+        return frame.container.sink->OnElement(frame.container.value);
+    }
+    return std::exchange(frame.member, Target{nullptr, nullptr});
+}
+
+/// Containers without target are skipped as a whole, by counting the depth until they are closed again.
+ResultBlank StreamingDecoder::StartContainer(const bool is_list) noexcept
+{
+    if (skipped_depth_ > 0U)
+    {
+        ++skipped_depth_;
+        return {};
+    }
+    const auto target = NextTarget();
+    if (target.sink == nullptr)
+    {
+        skipped_depth_ = 1U;
+        return {};
+    }
+    const auto container = is_list ? target.sink->OnStartList(target.value) : target.sink->OnStartObject(target.value);
+    if (!container.has_value())
+    {
+        return MakeUnexpected<Blank>(container.error());
+    }
+    frames_.push_back(Frame{container.value(), is_list, 0U, Target{nullptr, nullptr}});
+    return {};
+}
+
+}  // namespace score::json::detail::decoder
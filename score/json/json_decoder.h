@@ -0,0 +1,422 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_JSON_DECODER_H
+#define SCORE_LIB_JSON_JSON_DECODER_H
+
+#include "score/json/json_sax_parser.h"
+#include "score/json/json_serializer.h"
+
+#include "score/result/result.h"
+
+#include <static_reflection_with_serialization/visitor/visit.h>
+#include <static_reflection_with_serialization/visitor/visit_as_struct.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace score::json
+{
+
+namespace detail::decoder
+{
+
+class ValueSink;
+
+/// The value the decoder fills with the next token. A target without sink skips the value, e.g. an unknown member.
+struct Target
+{
+    // This structure only groups a pointer and the operations on it, converting it to a class would not contribute to
+    // readability.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    void* value;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    const ValueSink* sink;
+};
+
+/// Type-erased operations which decode the tokens of one C++ type into a value of it.
+///
+/// There is one instance per type, see GetSink(). The default implementations reject a token with kWrongType. Sinks of
+/// containers return the container itself as target when it is started, which then receives its keys or elements.
+class ValueSink
+{
+  public:
+    ValueSink() noexcept = default;
+    ValueSink(const ValueSink&) = delete;
+    ValueSink(ValueSink&&) noexcept = delete;
+    ValueSink& operator=(const ValueSink&) = delete;
+    ValueSink& operator=(ValueSink&&) noexcept = delete;
+    virtual ~ValueSink();
+
+    virtual ResultBlank OnNull(void* const value) const noexcept;
+    virtual ResultBlank OnBool(void* const value, const bool boolean) const noexcept;
+    virtual ResultBlank OnNumber(void* const value, const Number& number) const noexcept;
+    virtual ResultBlank OnString(void* const value, const std::string_view string) const noexcept;
+    virtual Result<Target> OnStartObject(void* const value) const noexcept;
+    virtual Result<Target> OnStartList(void* const value) const noexcept;
+
+    /// Returns the target of the member with the given key. Decoded fields is a bitmask of the members decoded so far.
+    virtual Target OnKey(void* const object, const std::string_view key, std::uint64_t& decoded_fields) const noexcept;
+    /// Appends an element to the list and returns it as target
+    virtual Target OnElement(void* const list) const noexcept;
+    /// Checks that the object is complete
+    virtual ResultBlank OnEndObject(void* const object, const std::uint64_t decoded_fields) const noexcept;
+};
+
+template <typename T, typename = void>
+class Sink;
+
+template <typename T>
+const ValueSink& GetSink() noexcept
+{
+    static const Sink<T> sink{};
+    return sink;
+}
+
+template <typename T>
+Target MakeTarget(T& value) noexcept
+{
+    return Target{&value, &GetSink<T>()};
+}
+
+/// SAX handler which decodes the token stream into the root target, holding one frame per open container.
+class StreamingDecoder final : public JsonSaxHandler
+{
+  public:
+    explicit StreamingDecoder(const Target root) noexcept;
+
+    ResultBlank OnNull() noexcept override;
+    ResultBlank OnBool(const bool value) noexcept override;
+    ResultBlank OnNumber(const Number& value) noexcept override;
+    ResultBlank OnString(const std::string_view value) noexcept override;
+    ResultBlank OnKey(const std::string_view key) noexcept override;
+    ResultBlank OnStartObject() noexcept override;
+    ResultBlank OnEndObject() noexcept override;
+    ResultBlank OnStartList() noexcept override;
+    ResultBlank OnEndList() noexcept override;
+
+  private:
+    struct Frame
+    {
+        Target container;
+        bool is_list;
+        std::uint64_t decoded_fields;
+        Target member;
+    };
+
+    Target NextTarget() noexcept;
+    ResultBlank StartContainer(const bool is_list) noexcept;
+
+    std::vector<Frame> frames_;
+    Target root_;
+    std::size_t skipped_depth_;
+};
+
+/// Collects the target of the field with the given index of a visitable struct.
+struct FieldSelector
+{
+    // coverity[autosar_cpp14_m11_0_1_violation] see Target
+    std::size_t index;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Target target;
+};
+
+template <std::size_t>
+// coverity[autosar_cpp14_a2_10_4_violation]
+inline void SelectField(FieldSelector&)
+{
+}
+
+template <std::size_t FieldIndex, typename Field, typename... Fields>
+// coverity[autosar_cpp14_a2_10_4_violation]
+inline void SelectField(FieldSelector& selector, Field& field, Fields&... fields)
+{
+    if (selector.index == FieldIndex)
+    {
+        selector.target = MakeTarget<score::cpp::remove_cvref_t<Field>>(field);
+    }
+    else
+    {
+        SelectField<FieldIndex + 1U>(selector, fields...);
+    }
+}
+
+template <typename T, typename... Fields>
+inline void visit_as_struct(FieldSelector& selector, T&&, Fields&... fields)
+{
+    SelectField<0U>(selector, fields...);
+}
+
+/// Checks whether a mandatory field of a visitable struct was not decoded.
+struct MissingFieldFinder
+{
+    // coverity[autosar_cpp14_m11_0_1_violation] see Target
+    std::uint64_t decoded_fields;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    bool missing;
+};
+
+template <std::size_t>
+// coverity[autosar_cpp14_a2_10_4_violation]
+inline void FindMissingField(MissingFieldFinder&)
+{
+}
+
+template <std::size_t FieldIndex, typename Field, typename... Fields>
+// coverity[autosar_cpp14_a2_10_4_violation]
+inline void FindMissingField(MissingFieldFinder& finder, Field&, Fields&... fields)
+{
+    const bool is_decoded = (finder.decoded_fields & (std::uint64_t{1U} << FieldIndex)) != 0U;
+    if ((!is_decoded) && (!IsOptional<score::cpp::remove_cvref_t<Field>>::value))
+    {
+        finder.missing = true;
+    }
+    FindMissingField<FieldIndex + 1U>(finder, fields...);
+}
+
+template <typename T, typename... Fields>
+inline void visit_as_struct(MissingFieldFinder& finder, T&&, Fields&... fields)
+{
+    FindMissingField<0U>(finder, fields...);
+}
+
+/// Decodes a visitable struct from a JSON object. Unknown members are skipped and, like for the tree of Any, only the
+/// first occurrence of a duplicated member is decoded.
+template <typename T>
+class Sink<T,
+           std::enable_if_t<IsVisitableImpl<T>(common::visitor::struct_visitable<T>::fields) &&
+                            !(serializer::HasToAny<T>::value || deserializer::HasFromAny<T>::value)>>
+    final : public ValueSink
+{
+  public:
+    Result<Target> OnStartObject(void* const value) const noexcept override
+    {
+        return Target{value, this};
+    }
+
+    Target OnKey(void* const object, const std::string_view key, std::uint64_t& decoded_fields) const noexcept override
+    {
+        const auto index = FindField(key);
+        if ((index == kNumberOfFields) || ((decoded_fields & (std::uint64_t{1U} << index)) != 0U))
+        {
+            return Target{nullptr, nullptr};
+        }
+        decoded_fields |= std::uint64_t{1U} << index;
+        FieldSelector selector{index, Target{nullptr, nullptr}};
+        common::visitor::visit(selector, *static_cast<T*>(object));
+        return selector.target;
+    }
+
+    ResultBlank OnEndObject(void* const object, const std::uint64_t decoded_fields) const noexcept override
+    {
+        MissingFieldFinder finder{decoded_fields, false};
+        common::visitor::visit(finder, *static_cast<T*>(object));
+        if (finder.missing)
+        {
+            return MakeUnexpected(Error::kKeyNotFound, "Missing mandatory field in JSON object");
+        }
+        return {};
+    }
+
+  private:
+    static constexpr std::size_t kNumberOfFields{common::visitor::struct_visitable<T>::fields};
+    static_assert(kNumberOfFields <= 64U, "The decoded fields are tracked in a 64 bit mask");
+
+    template <std::size_t... Indices>
+    static constexpr std::array<std::string_view, kNumberOfFields> MakeFieldNames(std::index_sequence<Indices...>)
+    {
+        return {std::string_view{common::visitor::struct_visitable<T>::field_name(Indices)}...};
+    }
+
+    static std::size_t FindField(const std::string_view key) noexcept
+    {
+        static constexpr auto kFieldNames = MakeFieldNames(std::make_index_sequence<kNumberOfFields>{});
+        std::size_t index{0U};
+        while ((index < kNumberOfFields) && (kFieldNames.at(index) != key))
+        {
+            ++index;
+        }
+        return index;
+    }
+};
+
+// Decodes all number types (integer as well as floats)
+template <typename N>
+class Sink<N, std::enable_if_t<std::is_arithmetic_v<N> && !std::is_same_v<N, bool>>> final : public ValueSink
+{
+  public:
+    ResultBlank OnNumber(void* const value, const Number& number) const noexcept override
+    {
+        const auto converted = number.As<N>();
+        if (!converted.has_value())
+        {
+            return MakeUnexpected(Error::kWrongType, "Number not convertible to expected arithmetic type");
+        }
+        *static_cast<N*>(value) = converted.value();
+        return {};
+    }
+};
+
+// Decodes a bool, which can also be given as number like for Any::As<bool>()
+template <>
+class Sink<bool> final : public ValueSink
+{
+  public:
+    ResultBlank OnBool(void* const value, const bool boolean) const noexcept override;
+    ResultBlank OnNumber(void* const value, const Number& number) const noexcept override;
+};
+
+template <>
+class Sink<std::string> final : public ValueSink
+{
+  public:
+    ResultBlank OnString(void* const value, const std::string_view string) const noexcept override;
+};
+
+// Decodes a std::vector, the enclosed type also needs to be decodable.
+template <typename T>
+class Sink<std::vector<T>> final : public ValueSink
+{
+  public:
+    Result<Target> OnStartList(void* const value) const noexcept override
+    {
+        static_cast<std::vector<T>*>(value)->clear();
+        return Target{value, this};
+    }
+
+    Target OnElement(void* const list) const noexcept override
+    {
+        // The previous element is complete at this point, thus it does not matter that its address may change.
+        return MakeTarget(static_cast<std::vector<T>*>(list)->emplace_back());
+    }
+};
+
+// Decodes a std::vector<bool>, whose elements can not be referenced. Each element is decoded into a local bool by the
+// element sink and then appended.
+template <>
+class Sink<std::vector<bool>> final : public ValueSink
+{
+  public:
+    Result<Target> OnStartList(void* const value) const noexcept override;
+    Target OnElement(void* const list) const noexcept override;
+};
+
+// Decodes the enclosed type into the optional. An optional field that is missing stays empty.
+template <typename T>
+class Sink<std::optional<T>> final : public ValueSink
+{
+  public:
+    ResultBlank OnNull(void* const value) const noexcept override
+    {
+        return GetSink<T>().OnNull(&Emplace(value));
+    }
+    ResultBlank OnBool(void* const value, const bool boolean) const noexcept override
+    {
+        return GetSink<T>().OnBool(&Emplace(value), boolean);
+    }
+    ResultBlank OnNumber(void* const value, const Number& number) const noexcept override
+    {
+        return GetSink<T>().OnNumber(&Emplace(value), number);
+    }
+    ResultBlank OnString(void* const value, const std::string_view string) const noexcept override
+    {
+        return GetSink<T>().OnString(&Emplace(value), string);
+    }
+    Result<Target> OnStartObject(void* const value) const noexcept override
+    {
+        return GetSink<T>().OnStartObject(&Emplace(value));
+    }
+    Result<Target> OnStartList(void* const value) const noexcept override
+    {
+        return GetSink<T>().OnStartList(&Emplace(value));
+    }
+
+  private:
+    static T& Emplace(void* const value) noexcept
+    {
+        return static_cast<std::optional<T>*>(value)->emplace();
+    }
+};
+
+// Decodes arbitrary JSON into an Any, so that a user can also put Any into a struct or a vector if desired.
+template <>
+class Sink<Any> final : public ValueSink
+{
+  public:
+    ResultBlank OnNull(void* const value) const noexcept override;
+    ResultBlank OnBool(void* const value, const bool boolean) const noexcept override;
+    ResultBlank OnNumber(void* const value, const Number& number) const noexcept override;
+    ResultBlank OnString(void* const value, const std::string_view string) const noexcept override;
+    Result<Target> OnStartObject(void* const value) const noexcept override;
+    Result<Target> OnStartList(void* const value) const noexcept override;
+};
+
+// The members of an Object within an Any
+template <>
+class Sink<Object> final : public ValueSink
+{
+  public:
+    Target OnKey(void* const object, const std::string_view key, std::uint64_t& decoded_fields) const noexcept override;
+};
+
+}  // namespace detail::decoder
+
+/// Decodes JSON directly into a type that can be deserialized from JSON, without building a tree of Any first.
+///
+/// This supports the same types as FromJsonAny(), except for types which provide their own FromAny method or
+/// specialization of JsonSerializer, since those need the tree of Any. Errors are reported as soon as a token does not
+/// fit to the given type, with the same error codes as FromJsonAny() for the innermost value.
+///
+/// \tparam T The type to deserialize. The type needs to be default-constructible.
+/// \param buffer The JSON to deserialize.
+/// \return A result containing the deserialized object, or an error if parsing or deserialization failed.
+template <typename T>
+[[nodiscard]] inline Result<T> FromJsonBuffer(const std::string_view buffer)
+{
+    T result{};
+    detail::decoder::StreamingDecoder decoder{detail::decoder::MakeTarget(result)};
+    const auto decode_result = JsonSaxParser{}.FromBuffer(buffer, decoder);
+    if (!decode_result.has_value())
+    {
+        return MakeUnexpected<T>(decode_result.error());
+    }
+    return result;
+}
+
+/// Decodes a JSON file directly into a type that can be deserialized from JSON, see FromJsonBuffer().
+///
+/// \tparam T The type to deserialize. The type needs to be default-constructible.
+/// \param file_path The path to the JSON file to deserialize.
+/// \return A result containing the deserialized object, or an error if parsing or deserialization failed.
+template <typename T>
+[[nodiscard]] inline Result<T> FromJsonFile(const std::string_view file_path)
+{
+    T result{};
+    detail::decoder::StreamingDecoder decoder{detail::decoder::MakeTarget(result)};
+    // NOLINTNEXTLINE(score-banned-function) Tolerated because JsonParser::FromFile is also on the banned function list
+    const auto decode_result = JsonSaxParser{}.FromFile(file_path, decoder);
+    if (!decode_result.has_value())
+    {
+        return MakeUnexpected<T>(decode_result.error());
+    }
+    return result;
+}
+
+}  // namespace score::json
+
+#endif  // SCORE_LIB_JSON_JSON_DECODER_H
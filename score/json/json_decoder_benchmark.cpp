@@ -0,0 +1,114 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/json_decoder.h"
+#include "score/json/json_parser.h"
+#include "score/json/json_serializer.h"
+
+#include <static_reflection_with_serialization/visitor/visit.h>
+#include <static_reflection_with_serialization/visitor/visit_as_struct.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace score::json
+{
+namespace
+{
+
+struct Limits
+{
+    std::int32_t lower{};
+    std::int32_t upper{};
+};
+
+STRUCT_VISITABLE(Limits, lower, upper)
+
+struct Record
+{
+    std::string name{};
+    std::uint32_t id{};
+    double factor{};
+    bool enabled{};
+    std::optional<std::string> comment{};
+    Limits limits{};
+    std::vector<std::uint16_t> values{};
+};
+
+STRUCT_VISITABLE(Record, name, id, factor, enabled, comment, limits, values)
+
+struct Records
+{
+    std::vector<Record> records{};
+};
+
+STRUCT_VISITABLE(Records, records)
+
+/// Generates a large array of records, which also contains a member that is not part of Record.
+const std::string& GetDocument(const std::size_t number_of_records)
+{
+    static std::string document{};
+    document = "{\"records\": [\n";
+    for (std::size_t index{0UL}; index < number_of_records; ++index)
+    {
+        const auto number = std::to_string(index);
+        document += "    {\"name\": \"record_" + number + "\", \"id\": " + number + ", \"factor\": " + number +
+                    ".5, \"enabled\": true, \"unknown\": {\"a\": [1, 2]}, \"limits\": {\"lower\": -" + number +
+                    ", \"upper\": " + number + "}, \"values\": [1, 2, 3, 4, 5, 6, 7, 8]}";
+        document += (index + 1UL < number_of_records) ? ",\n" : "\n";
+    }
+    document += "]}\n";
+    return document;
+}
+
+void DecodeViaAny(benchmark::State& state)
+{
+    const auto& document = GetDocument(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        auto any = JsonParser{}.FromBuffer(document);
+        auto result = any.has_value() ? FromJsonAny<Records>(std::move(any).value())
+                                      : MakeUnexpected<Records>(any.error());
+        if (!result.has_value())
+        {
+            state.SkipWithError("Failed to decode document");
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+void DecodeDirectly(benchmark::State& state)
+{
+    const auto& document = GetDocument(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        auto result = FromJsonBuffer<Records>(document);
+        if (!result.has_value())
+        {
+            state.SkipWithError("Failed to decode document");
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+BENCHMARK(DecodeViaAny)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(DecodeDirectly)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace score::json
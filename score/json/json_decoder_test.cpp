@@ -0,0 +1,274 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/json_decoder.h"
+
+#include <static_reflection_with_serialization/visitor/visit.h>
+#include <static_reflection_with_serialization/visitor/visit_as_struct.h>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace score::json::test
+{
+namespace
+{
+
+struct NestedType
+{
+    std::uint8_t nested_int{};
+    bool nested_bool{};
+    std::vector<std::uint8_t> nested_array{};
+};
+
+STRUCT_VISITABLE(NestedType, nested_int, nested_bool, nested_array)
+
+struct TypeToDecode
+{
+    std::uint32_t integer_val{};
+    std::string string_val{};
+    NestedType nested_val{};
+    std::optional<double> optional_val{};
+    std::vector<NestedType> nested_list{};
+};
+
+STRUCT_VISITABLE(TypeToDecode, integer_val, string_val, nested_val, optional_val, nested_list)
+
+struct TypeWithAny
+{
+    std::int32_t id{};
+    Any payload{};
+};
+
+STRUCT_VISITABLE(TypeWithAny, id, payload)
+
+/// Records the events as text and stops the parsing after the given number of events
+class RecordingHandler final : public JsonSaxHandler
+{
+  public:
+    std::string events{};
+    std::size_t stop_after{100U};
+
+    ResultBlank OnNull() noexcept override
+    {
+        return Record("null");
+    }
+    ResultBlank OnBool(const bool value) noexcept override
+    {
+        return Record(value ? "true" : "false");
+    }
+    ResultBlank OnNumber(const Number& value) noexcept override
+    {
+        return Record(std::to_string(value.As<double>().value()));
+    }
+    ResultBlank OnString(const std::string_view value) noexcept override
+    {
+        return Record("\"" + std::string{value} + "\"");
+    }
+    ResultBlank OnKey(const std::string_view key) noexcept override
+    {
+        return Record(std::string{key} + ":");
+    }
+    ResultBlank OnStartObject() noexcept override
+    {
+        return Record("{");
+    }
+    ResultBlank OnEndObject() noexcept override
+    {
+        return Record("}");
+    }
+    ResultBlank OnStartList() noexcept override
+    {
+        return Record("[");
+    }
+    ResultBlank OnEndList() noexcept override
+    {
+        return Record("]");
+    }
+
+  private:
+    ResultBlank Record(const std::string& event)
+    {
+        if (stop_after == 0U)
+        {
+            return MakeUnexpected(Error::kInvalidFilePath, "Stopped by handler");
+        }
+        --stop_after;
+        events += event + " ";
+        return {};
+    }
+};
+
+TEST(JsonSaxParserTest, ReportsEventsInDocumentOrder)
+{
+    RecordingHandler handler{};
+
+    const auto result = JsonSaxParser{}.FromBuffer(R"({"a": [1, "two", null, true], "b": {}})", handler);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(handler.events, "{ a: [ 1.000000 \"two\" null true ] b: { } } ");
+}
+
+TEST(JsonSaxParserTest, ReturnsErrorOfHandler)
+{
+    RecordingHandler handler{};
+    handler.stop_after = 3U;
+
+    const auto result = JsonSaxParser{}.FromBuffer(R"({"a": [1, "two", null, true], "b": {}})", handler);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::kInvalidFilePath);
+    EXPECT_EQ(handler.events, "{ a: [ ");
+}
+
+TEST(JsonSaxParserTest, ReturnsParsingErrorForInvalidJson)
+{
+    RecordingHandler handler{};
+
+    EXPECT_EQ(JsonSaxParser{}.FromBuffer(R"({"a": [1, })", handler).error(), Error::kParsingError);
+    EXPECT_EQ(JsonSaxParser{}.FromFile("/this/file/does/not/exist.json", handler).error(), Error::kParsingError);
+}
+
+constexpr auto kDocument = R"(
+{
+    "integer_val": 42,
+    "unknown_object": {"nested_int": 1, "deeper": [{"integer_val": 7}, []]},
+    "string_val": "Blubb",
+    "nested_val": {
+        "nested_int": 43,
+        "nested_bool": true,
+        "nested_array": [44, 45]
+    },
+    "unknown_list": [[1], {"a": null}],
+    "nested_list": [
+        {"nested_int": 1, "nested_bool": false, "nested_array": []},
+        {"nested_int": 2, "nested_bool": 1, "nested_array": [3]}
+    ],
+    "integer_val": 43
+}
+)";
+
+TEST(JsonDecoderTest, DecodesSameValuesAsFromJsonAny)
+{
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::json::FromJsonBuffer");
+    RecordProperty("Description", "Decodes a visitable structure and compares it with the result of FromJsonAny");
+    RecordProperty("ASIL", "QM");
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a JSON with unknown members and a duplicated key
+    auto any = JsonParser{}.FromBuffer(kDocument);
+    ASSERT_TRUE(any.has_value());
+    const auto expected = FromJsonAny<TypeToDecode>(std::move(any).value());
+    ASSERT_TRUE(expected.has_value());
+
+    // When decoding it directly
+    const auto unit = FromJsonBuffer<TypeToDecode>(kDocument);
+
+    // Then the result is the same as for the tree of Any
+    ASSERT_TRUE(unit.has_value());
+    EXPECT_EQ(unit->integer_val, expected->integer_val);
+    EXPECT_EQ(unit->integer_val, 42U);
+    EXPECT_EQ(unit->string_val, "Blubb");
+    EXPECT_EQ(unit->nested_val.nested_int, 43U);
+    EXPECT_TRUE(unit->nested_val.nested_bool);
+    EXPECT_THAT(unit->nested_val.nested_array, ::testing::ElementsAre(44, 45));
+    EXPECT_FALSE(unit->optional_val.has_value());
+    ASSERT_EQ(unit->nested_list.size(), expected->nested_list.size());
+    for (std::size_t index{0U}; index < unit->nested_list.size(); ++index)
+    {
+        EXPECT_EQ(unit->nested_list[index].nested_int, expected->nested_list[index].nested_int);
+        EXPECT_EQ(unit->nested_list[index].nested_bool, expected->nested_list[index].nested_bool);
+        EXPECT_EQ(unit->nested_list[index].nested_array, expected->nested_list[index].nested_array);
+    }
+    EXPECT_TRUE(unit->nested_list[1U].nested_bool);
+}
+
+TEST(JsonDecoderTest, DecodesOptionalAndRootList)
+{
+    const auto unit = FromJsonBuffer<std::vector<std::optional<double>>>("[1.5, 2]");
+
+    ASSERT_TRUE(unit.has_value());
+    EXPECT_THAT(unit.value(), ::testing::ElementsAre(1.5, 2.0));
+}
+
+TEST(JsonDecoderTest, DecodesVectorOfBool)
+{
+    constexpr auto kPayload = "[true, false, 1, 0]";
+
+    const auto unit = FromJsonBuffer<std::vector<bool>>(kPayload);
+
+    ASSERT_TRUE(unit.has_value());
+    EXPECT_EQ(unit.value(), FromJsonAny<std::vector<bool>>(JsonParser{}.FromBuffer(kPayload).value()).value());
+    EXPECT_THAT(unit.value(), ::testing::ElementsAre(true, false, true, false));
+    EXPECT_EQ(FromJsonBuffer<std::vector<bool>>("[true, 2]").error(), Error::kWrongType);
+    EXPECT_EQ(FromJsonBuffer<std::vector<bool>>("[true, null]").error(), Error::kWrongType);
+}
+
+TEST(JsonDecoderTest, DecodesArbitraryJsonIntoAny)
+{
+    constexpr auto kPayload = R"({"id": -3, "payload": {"list": [1, "two", null, {"x": false}], "x": 1, "x": 2}})";
+
+    const auto unit = FromJsonBuffer<TypeWithAny>(kPayload);
+
+    ASSERT_TRUE(unit.has_value());
+    EXPECT_EQ(unit->id, -3);
+    auto expected = JsonParser{}.FromBuffer(kPayload).value().As<Object>().value().get().at("payload").CloneByValue();
+    EXPECT_TRUE(unit->payload == expected);
+}
+
+TEST(JsonDecoderTest, FailsForMissingMandatoryField)
+{
+    const auto unit = FromJsonBuffer<NestedType>(R"({"nested_int": 1, "nested_bool": true})");
+
+    ASSERT_FALSE(unit.has_value());
+    EXPECT_EQ(unit.error(), Error::kKeyNotFound);
+}
+
+TEST(JsonDecoderTest, FailsForWrongType)
+{
+    EXPECT_EQ(FromJsonBuffer<NestedType>(R"({"nested_int": 256})").error(), Error::kWrongType);
+    EXPECT_EQ(FromJsonBuffer<NestedType>(R"({"nested_int": "1"})").error(), Error::kWrongType);
+    EXPECT_EQ(FromJsonBuffer<NestedType>(R"({"nested_array": {}})").error(), Error::kWrongType);
+    EXPECT_EQ(FromJsonBuffer<NestedType>(R"([])").error(), Error::kWrongType);
+    EXPECT_EQ(FromJsonBuffer<TypeToDecode>(R"({"optional_val": null})").error(), Error::kWrongType);
+    EXPECT_EQ(FromJsonBuffer<std::vector<std::string>>(R"(["a", 1])").error(), Error::kWrongType);
+}
+
+TEST(JsonDecoderTest, FailsForInvalidJson)
+{
+    EXPECT_EQ(FromJsonBuffer<NestedType>(R"({"nested_int": 1,)").error(), Error::kParsingError);
+}
+
+TEST(JsonDecoderTest, DecodesFile)
+{
+    const std::string file_path = std::tmpnam(nullptr);
+    std::ofstream{file_path} << kDocument;
+
+    const auto unit = FromJsonFile<TypeToDecode>(file_path);
+    score::cpp::ignore = std::remove(file_path.c_str());
+
+    ASSERT_TRUE(unit.has_value());
+    EXPECT_EQ(unit->string_val, "Blubb");
+    EXPECT_EQ(unit->nested_list.size(), 2U);
+}
+
+}  // namespace
+}  // namespace score::json::test
@@ -0,0 +1,35 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_JSON_FORMAT_H
+#define SCORE_LIB_JSON_JSON_FORMAT_H
+
+#include <cstdint>
+
+namespace score
+{
+namespace json
+{
+
+/// @brief Layout of the serialized JSON.
+enum class JsonFormat : std::uint8_t
+{
+    /// One member or element per line, indented by four spaces per level (the layout of JsonSerialize).
+    kPretty,
+    /// No whitespace at all.
+    kCompact,
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_JSON_FORMAT_H
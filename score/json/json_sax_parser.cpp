@@ -0,0 +1,23 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/json_sax_parser.h"
+
+namespace score
+{
+namespace json
+{
+
+JsonSaxHandler::~JsonSaxHandler() = default;
+
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,75 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_JSON_SAX_PARSER_H
+#define SCORE_LIB_JSON_JSON_SAX_PARSER_H
+
+#include "score/json/internal/model/error.h"
+#include "score/json/internal/model/number.h"
+#include "score/result/result.h"
+
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+
+/// \brief Receives the events of a JsonSaxParser in document order
+///
+/// \details Every callback may return an error, which stops the parsing. The parser then returns this error. Strings
+/// and keys are only valid for the duration of the callback.
+class JsonSaxHandler
+{
+  public:
+    JsonSaxHandler() noexcept = default;
+    JsonSaxHandler(const JsonSaxHandler&) = delete;
+    JsonSaxHandler(JsonSaxHandler&&) noexcept = delete;
+    JsonSaxHandler& operator=(const JsonSaxHandler&) = delete;
+    JsonSaxHandler& operator=(JsonSaxHandler&&) noexcept = delete;
+    virtual ~JsonSaxHandler();
+
+    virtual score::ResultBlank OnNull() noexcept = 0;
+    virtual score::ResultBlank OnBool(const bool value) noexcept = 0;
+    /// \brief Called for a number, which holds the smallest type that represents it, like in the tree of Any
+    virtual score::ResultBlank OnNumber(const Number& value) noexcept = 0;
+    virtual score::ResultBlank OnString(const std::string_view value) noexcept = 0;
+
+    /// \brief Called for the key of an object member, before the events of its value
+    virtual score::ResultBlank OnKey(const std::string_view key) noexcept = 0;
+    virtual score::ResultBlank OnStartObject() noexcept = 0;
+    virtual score::ResultBlank OnEndObject() noexcept = 0;
+    virtual score::ResultBlank OnStartList() noexcept = 0;
+    virtual score::ResultBlank OnEndList() noexcept = 0;
+};
+
+/// \brief Parses JSON without building a tree of data, but by reporting every token to a JsonSaxHandler
+class JsonSaxParser
+{
+  public:
+    /// \brief Parses the underlying file and reports its tokens to the handler
+    /// \param file_path The path to the file that shall be parsed
+    /// \param handler The handler receiving the events
+    /// \return Blank, the error of the handler if it stopped the parsing, kParsingError on invalid JSON
+    score::ResultBlank FromFile(const std::string_view file_path, JsonSaxHandler& handler) const noexcept;
+
+    /// \brief Parses the underlying buffer and reports its tokens to the handler
+    /// \param buffer The string_view that shall be parsed
+    /// \param handler The handler receiving the events
+    /// \return Blank, the error of the handler if it stopped the parsing, kParsingError on invalid JSON
+    score::ResultBlank FromBuffer(const std::string_view buffer, JsonSaxHandler& handler) const noexcept;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_JSON_SAX_PARSER_H
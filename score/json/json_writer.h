@@ -16,7 +16,9 @@
 
 #include "score/filesystem/filestream/file_factory.h"
 #include "score/json/i_json_writer.h"
+#include "score/json/json_format.h"
 
+#include <string>
 #include <string_view>
 
 namespace score
@@ -57,13 +59,18 @@ class JsonWriter final : public IJsonWriter
      *
      *  The `ownership` parameter is ignored when kUnsynced mode is used.
      *
+     *  In both modes, the document is serialized into a buffer first and then written with a single write call.
+     *  The buffer is local to each call, so no state is shared between calls and its memory is released afterwards.
+     *
      *  @param file_sync_mode: Determines the synchronization mode (see above).
      *  @param ownership: When using kSynced mode, determines how to adjust the ownership
      *                    of the temporary file created.
+     *  @param format: Determines whether the output is indented (kPretty) or without any whitespace (kCompact).
      */
     explicit JsonWriter(FileSyncMode file_sync_mode = FileSyncMode::kUnsynced,
                         const score::filesystem::AtomicUpdateOwnershipFlags ownership =
-                            score::filesystem::kUseTargetFileUID | score::filesystem::kUseTargetFileGID) noexcept;
+                            score::filesystem::kUseTargetFileUID | score::filesystem::kUseTargetFileGID,
+                        const JsonFormat format = JsonFormat::kPretty) noexcept;
     JsonWriter(const JsonWriter&) = delete;
     JsonWriter(JsonWriter&&) noexcept = delete;
     JsonWriter& operator=(const JsonWriter&) = delete;
@@ -88,6 +95,7 @@ class JsonWriter final : public IJsonWriter
   private:
     FileSyncMode file_sync_mode_;
     const score::filesystem::AtomicUpdateOwnershipFlags atomic_ownership_;
+    const JsonFormat format_;
 };
 
 }  // namespace json
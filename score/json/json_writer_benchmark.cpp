@@ -0,0 +1,116 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/writer/json_buffer_writer/json_buffer_writer.h"
+#include "score/json/internal/writer/json_serialize/json_serialize.h"
+#include "score/json/json_writer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace score::json
+{
+namespace
+{
+
+/// Generates a configuration-like document with nested objects, strings, integers, floating point numbers and bools.
+const Object& GetDocument(const std::size_t number_of_entries)
+{
+    static Object document{};
+    document = Object{};
+    List entries{};
+    for (std::size_t index{0UL}; index < number_of_entries; ++index)
+    {
+        const auto number = std::to_string(index);
+        Object entry{};
+        entry["name"] = "configuration_entry_" + number;
+        entry["description"] = "A longer string value which describes entry " + number + " in \"detail\"";
+        entry["id"] = static_cast<std::uint64_t>(index);
+        entry["offset"] = -static_cast<std::int64_t>(index);
+        entry["factor"] = static_cast<double>(index) * 0.125e-3;
+        entry["enabled"] = (index % 2U) == 0U;
+        List limits{};
+        for (std::uint32_t limit{1U}; limit <= 128U; limit *= 2U)
+        {
+            limits.emplace_back(limit);
+        }
+        entry["limits"] = std::move(limits);
+        entries.emplace_back(std::move(entry));
+    }
+    document["entries"] = std::move(entries);
+    return document;
+}
+
+void SerializeToStream(benchmark::State& state)
+{
+    const auto& document = GetDocument(static_cast<std::size_t>(state.range(0)));
+    std::size_t size{0U};
+    for (auto _ : state)
+    {
+        std::ostringstream stream{};
+        JsonSerialize serializer{stream};
+        if (!(serializer << document).has_value())
+        {
+            state.SkipWithError("Failed to serialize document");
+        }
+        const auto output = stream.str();
+        size = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void JsonWriterToBuffer(benchmark::State& state)
+{
+    const auto& document = GetDocument(static_cast<std::size_t>(state.range(0)));
+    JsonWriter writer{};
+    std::size_t size{0U};
+    for (auto _ : state)
+    {
+        const auto output = writer.ToBuffer(document);
+        if (!output.has_value())
+        {
+            state.SkipWithError("Failed to serialize document");
+        }
+        size = output->size();
+        benchmark::DoNotOptimize(output->data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+/// Serializes into the same buffer in every iteration, which JsonWriter does not do as its buffers are local to a call.
+template <JsonFormat kFormat>
+void WriteToReusedBuffer(benchmark::State& state)
+{
+    const auto& document = GetDocument(static_cast<std::size_t>(state.range(0)));
+    std::string buffer{};
+    for (auto _ : state)
+    {
+        buffer.clear();
+        JsonBufferWriter writer{buffer, kFormat};
+        writer.Write(document);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+BENCHMARK(SerializeToStream)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(JsonWriterToBuffer)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(WriteToReusedBuffer, JsonFormat::kPretty)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(WriteToReusedBuffer, JsonFormat::kCompact)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace score::json
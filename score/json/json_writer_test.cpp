@@ -223,6 +223,32 @@ TYPED_TEST(JsonWriterWriteToFileTest, ToSyncedFileResultsInError)
     EXPECT_EQ(result.error(), score::json::Error::kInvalidFilePath);
 }
 
+TEST(JsonWriterTest, WritesCompactFormat)
+{
+    RecordProperty("Verifies", "::score::json::JsonWriter::ToFile");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "writing json without whitespace to file and buffer, cf. RFC-8259 section 2");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+    RecordProperty("Priority", "3");
+
+    score::filesystem::SimpleStringStreamCollection stream{};
+    auto file_factory_fake = std::make_shared<score::filesystem::FileFactoryFake>(stream);
+    score::json::JsonWriter writer{FileSyncMode::kUnsynced,
+                                   score::filesystem::kUseTargetFileUID | score::filesystem::kUseTargetFileGID,
+                                   JsonFormat::kCompact};
+    TestJsonList json{};
+    json.emplace_back(true);
+    constexpr auto expected = R"([1234,"string",{"key":"value"},true])";
+
+    // Writing twice leaves no state behind from the first call
+    ASSERT_TRUE(writer.ToFile(json, "/foo/bar.json", file_factory_fake).has_value());
+    ASSERT_TRUE(writer.ToFile(json, "/foo/foo.json", file_factory_fake).has_value());
+
+    EXPECT_EQ(file_factory_fake->Get("/foo/foo.json").str(), expected);
+    EXPECT_EQ(writer.ToBuffer(json).value(), expected);
+}
+
 template <typename T>
 class JsonWriterIntegerTest : public ::testing::Test
 {
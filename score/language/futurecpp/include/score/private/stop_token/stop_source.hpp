@@ -53,6 +53,20 @@ public:
     /// \post stop_possible() is true and stop_requested() is false
     stop_source() : state_{std::make_shared<detail::stop_state>()} { state_->increment_associated_sources(); }
 
+    /// \brief Constructs a stop_source with new stop-state which is allocated by the given allocator.
+    ///
+    /// \details Extension to the standard. Allows to create stop-state without touching the heap, e.g. by passing a
+    /// score::cpp::pmr::polymorphic_allocator.
+    ///
+    /// \param allocator The allocator used to allocate the stop-state
+    /// \post stop_possible() is true and stop_requested() is false
+    template <typename Allocator>
+    stop_source(std::allocator_arg_t, const Allocator& allocator)
+        : state_{std::allocate_shared<detail::stop_state>(allocator)}
+    {
+        state_->increment_associated_sources();
+    }
+
     /// \brief Constructs an empty stop_source with no associated stop-state.
     ///
     /// \post stop_possible() and stop_requested() are both false
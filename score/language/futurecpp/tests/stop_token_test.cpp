@@ -20,8 +20,11 @@
 #include <score/stop_token.hpp> // check include guard
 
 #include <score/jthread.hpp>
+#include <score/memory_resource.hpp>
 
+#include <array>
 #include <condition_variable>
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -53,6 +56,31 @@ TEST(stop_source, nostopstate_t_constructor)
     EXPECT_FALSE(unit.stop_requested());
 }
 
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#9462148
+TEST(stop_source, allocator_constructor)
+{
+    std::array<std::byte, 1024U> buffer{};
+    score::cpp::pmr::monotonic_buffer_resource resource{
+        buffer.data(), buffer.size(), score::cpp::pmr::null_memory_resource()};
+
+    score::cpp::stop_source unit{std::allocator_arg, score::cpp::pmr::polymorphic_allocator<std::byte>{&resource}};
+
+    EXPECT_TRUE(unit.stop_possible());
+    EXPECT_FALSE(unit.stop_requested());
+    EXPECT_TRUE(unit.request_stop());
+    EXPECT_TRUE(unit.get_token().stop_requested());
+}
+
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#9462148
+TEST(stop_source, allocator_constructor_propagates_allocation_failure)
+{
+    const score::cpp::pmr::polymorphic_allocator<std::byte> allocator{score::cpp::pmr::null_memory_resource()};
+
+    EXPECT_THROW((score::cpp::stop_source{std::allocator_arg, allocator}), std::bad_alloc);
+}
+
 /// \Test [stopsource.constr].5, [stopsource.cmp].1, [stopsource.cmp].2
 /// @testmethods TM_REQUIREMENT
 /// @requirement CB-#9462148
@@ -54,6 +54,11 @@ class MyBoundedSharedMemoryResource final : public ISharedMemoryResource
         return false;
     }
 
+    MappingOptions GetMappingOptions() const noexcept override
+    {
+        return {};
+    }
+
     MemoryResourceProxy* getMemoryResourceProxy() noexcept override
     {
         return resource_.getMemoryResourceProxy();
@@ -32,6 +32,8 @@ class ISharedMemoryFactory
     using UserPermissionsMap = ISharedMemoryResource::UserPermissionsMap;
     using UserPermissions = ISharedMemoryResource::UserPermissions;
     using AccessControl = ISharedMemoryResource::AccessControl;
+    using AllocationStrategy = ISharedMemoryResource::AllocationStrategy;
+    using MappingOptions = ISharedMemoryResource::MappingOptions;
 
     virtual std::shared_ptr<ISharedMemoryResource> Open(const std::string&,
                                                         const bool,
@@ -41,19 +43,25 @@ class ISharedMemoryFactory
                                                           InitializeCallback,
                                                           const std::size_t,
                                                           const UserPermissions&,
-                                                          const bool) noexcept = 0;
+                                                          const bool,
+                                                          const AllocationStrategy,
+                                                          const MappingOptions&) noexcept = 0;
 
     virtual std::shared_ptr<ISharedMemoryResource> CreateAnonymous(std::uint64_t,
                                                                    InitializeCallback,
                                                                    const std::size_t,
                                                                    const UserPermissions&,
-                                                                   const bool) noexcept = 0;
+                                                                   const bool,
+                                                                   const AllocationStrategy,
+                                                          const MappingOptions&) noexcept = 0;
 
     virtual std::shared_ptr<ISharedMemoryResource> CreateOrOpen(std::string,
                                                                 InitializeCallback,
                                                                 const std::size_t,
                                                                 const ISharedMemoryFactory::AccessControl,
-                                                                const bool) noexcept = 0;
+                                                                const bool,
+                                                                const AllocationStrategy,
+                                                          const MappingOptions&) noexcept = 0;
 
     virtual void Remove(const std::string&) noexcept = 0;
 
@@ -24,6 +24,7 @@
 #include <sys/types.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -53,6 +54,52 @@ class ISharedMemoryResource : public ManagedMemoryResource
 
     using AccessControlListFactory = score::cpp::callback<std::unique_ptr<score::os::IAccessControlList>(FileDescriptor)>;
 
+    /// \brief How allocations within the shared-memory region are synchronized.
+    /// \details The strategy is chosen by the creator of the region and stored in its control block, so every process
+    /// that opens the region allocates in the same way.
+    enum class AllocationStrategy : std::uint8_t
+    {
+        /// \brief Monotonic allocation serialized by an interprocess mutex. Allocations are laid out deterministically.
+        kMonotonicLocked = 0U,
+        /// \brief Monotonic allocation that reserves space with a compare-and-swap on the allocation offset.
+        kMonotonicLockFree = 1U,
+        /// \brief Like kMonotonicLockFree, but each thread reserves chunks and serves small allocations from them, so
+        /// threads allocating concurrently do not contend on the allocation offset. Reserved chunks count as allocated
+        /// bytes, even if they are not used up yet.
+        kMonotonicThreadLocalChunks = 2U,
+        /// \brief Segregated-fit allocation with coalescing serialized by an interprocess mutex. Deallocated memory is
+        /// reused, and freed memory at the end of the region is given back.
+        kSegregatedFit = 3U,
+    };
+
+    /// \brief Options for mapping the shared-memory region into the calling process.
+    /// \details The options only apply to the mapping of the calling process, they are not stored in the region. An
+    /// option that can not be applied, e.g. because the platform or the system configuration does not support it, is
+    /// logged and skipped. GetMappingOptions() reports which options have been applied.
+    class MappingOptions
+    {
+      public:
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+        // be private.".
+        // Rationale: There are no class invariants to maintain which could be violated by directly accessing these
+        // member variables.
+        /// \brief Back the region with transparent huge pages (madvise(MADV_HUGEPAGE), Linux only) to reduce TLB
+        /// misses. Requires /sys/kernel/mm/transparent_hugepage/shmem_enabled to be "advise" or "always".
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        bool use_transparent_huge_pages{false};
+        /// \brief Fault in all pages of the region while mapping it, so that first accesses do not page fault.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        bool prefault{false};
+        /// \brief Lock the pages of the region into RAM (mlock), which also faults them in. Subject to
+        /// RLIMIT_MEMLOCK.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        bool lock_in_memory{false};
+        /// \brief Allocate the pages of the region only on the given NUMA node (mbind with MPOL_BIND, Linux only).
+        /// The policy is set before any page of the mapping is faulted in by this process.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::optional<std::uint32_t> numa_node{};
+    };
+
     class AccessControl
     {
       public:
@@ -74,6 +121,8 @@ class ISharedMemoryResource : public ManagedMemoryResource
     virtual FileDescriptor GetFileDescriptor() const noexcept = 0;
     virtual bool IsShmInTypedMemory() const noexcept = 0;
     virtual std::string_view GetIdentifier() const noexcept = 0;
+    /// \brief Returns the mapping options which have been applied to the mapping of the calling process.
+    virtual MappingOptions GetMappingOptions() const noexcept = 0;
 
   protected:
     ISharedMemoryResource(const ISharedMemoryResource&) noexcept = default;
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <optional>
 #include <thread>
@@ -33,9 +34,43 @@ namespace score::memory::shared::detail
 namespace
 {
 
-bool DoesRegionIteratorOverlapWithExistingRegionInMap(
-    const std::map<std::uintptr_t, std::uintptr_t>::const_iterator region_it,
-    const std::map<std::uintptr_t, std::uintptr_t>& map) noexcept
+/// \brief Result of a lookup of a thread: either a known region or the gap between two known regions (both bounds
+/// inclusive), which is valid as long as the latest generation of the map equals generation.
+struct CachedLookup
+{
+    std::uint64_t generation{0U};
+    std::uintptr_t first_address{0U};
+    std::uintptr_t last_address{0U};
+};
+
+/// \brief Source of the generations of all maps. Zero is never handed out, so a default initialized CachedLookup
+/// never matches.
+std::atomic<std::uint64_t> next_region_generation{1U};
+
+// Suppress "AUTOSAR C++14 A3-3-2" rule finding. This rule states: "Static and thread-local objects shall be
+// constant-initialized.".
+// Rationale: False positive, CachedLookup is a literal type with constant initializers.
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local CachedLookup last_region_lookup{};
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local CachedLookup last_gap_lookup{};
+
+std::uint64_t AcquireNextRegionGeneration() noexcept
+{
+    return next_region_generation.fetch_add(1U, std::memory_order_relaxed);
+}
+
+bool IsCachedLookupValidFor(const CachedLookup& cached_lookup,
+                            const std::uint64_t generation,
+                            const std::uintptr_t pointer) noexcept
+{
+    return ((cached_lookup.generation == generation) && (pointer >= cached_lookup.first_address) &&
+            (pointer <= cached_lookup.last_address));
+}
+
+template <class KnownRegionsType>
+bool DoesRegionIteratorOverlapWithExistingRegionInMap(const typename KnownRegionsType::const_iterator region_it,
+                                                      const KnownRegionsType& map) noexcept
 {
     if (map.size() == 1U)
     {
@@ -75,16 +110,16 @@ bool DoesRegionIteratorOverlapWithExistingRegionInMap(
 
 }  // namespace
 
-template <template <class> class AtomicIndirectorType>
-MemoryRegionMapImpl<AtomicIndirectorType>::AcquiredRefcountIndex::AcquiredRefcountIndex(
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
+MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::AcquiredRefcountIndex::AcquiredRefcountIndex(
     const std::uint8_t refcount_index,
     std::atomic<RegionVersionRefCountType>& ref_count) noexcept
     : index_{refcount_index}, ref_count_{ref_count}, owns_resource_{true}
 {
 }
 
-template <template <class> class AtomicIndirectorType>
-MemoryRegionMapImpl<AtomicIndirectorType>::AcquiredRefcountIndex::AcquiredRefcountIndex(
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
+MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::AcquiredRefcountIndex::AcquiredRefcountIndex(
     AcquiredRefcountIndex&& other) noexcept
     // Suppress "AUTOSAR C++14 A12-8-4", The rule states: "Move constructor shall not initialize its class
     // members and base classes using copy semantics".
@@ -95,7 +130,7 @@ MemoryRegionMapImpl<AtomicIndirectorType>::AcquiredRefcountIndex::AcquiredRefcou
     other.owns_resource_ = false;
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // Suppress "AUTOSAR C++14 A15-5-1" rule finding. This rule states: "All user-provided class destructors, deallocation
 // functions, move constructors, move assignment operators and swap functions shall not exit with an exception. A
 // noexcept exception specification shall be added to these functions as appropriate."
@@ -108,7 +143,7 @@ template <template <class> class AtomicIndirectorType>
 // std::terminate call.
 // coverity[autosar_cpp14_a15_5_3_violation : FALSE]
 // coverity[autosar_cpp14_a15_5_1_violation : FALSE]
-MemoryRegionMapImpl<AtomicIndirectorType>::AcquiredRefcountIndex::~AcquiredRefcountIndex() noexcept
+MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::AcquiredRefcountIndex::~AcquiredRefcountIndex() noexcept
 {
     if (owns_resource_)
     {
@@ -116,8 +151,9 @@ MemoryRegionMapImpl<AtomicIndirectorType>::AcquiredRefcountIndex::~AcquiredRefco
     }
 }
 
-template <template <class> class AtomicIndirectorType>
-MemoryRegionMapImpl<AtomicIndirectorType>::MemoryRegionMapImpl() noexcept
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
+MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::MemoryRegionMapImpl() noexcept
+    : latest_known_region_generation_{AcquireNextRegionGeneration()}
 {
     for (auto& element : known_regions_versions_refcounts_)
     {
@@ -126,7 +162,7 @@ MemoryRegionMapImpl<AtomicIndirectorType>::MemoryRegionMapImpl() noexcept
     known_regions_versions_refcounts_[0] = 0U;
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall
 // not be called implicitly."
 // Rationale: std::array::at() will throw an exception if the provided index is outside the bounds of
@@ -134,9 +170,20 @@ template <template <class> class AtomicIndirectorType>
 // process will terminate if an invalid index is provided and do not rely on any stack unwinding in case of an implicit
 // terminate.
 // coverity[autosar_cpp14_a15_5_3_violation]
-bool MemoryRegionMapImpl<AtomicIndirectorType>::UpdateKnownRegion(const std::uintptr_t memory_range_start,
-                                                                  const std::uintptr_t memory_range_end) noexcept
+bool MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::UpdateKnownRegion(
+    const std::uintptr_t memory_range_start,
+    const std::uintptr_t memory_range_end) noexcept
 {
+    // Writers are serialized, so the latest version can't change while we are checking it
+    const auto& latest_known_regions =
+        known_regions_versions_.at(static_cast<std::size_t>(latest_known_region_version_));
+    if (latest_known_regions.size() >= latest_known_regions.max_size())
+    {
+        mw::log::LogError("shm") << "Cannot add memory region, since the maximum number of known regions ("
+                                 << latest_known_regions.max_size() << ") is reached";
+        return false;
+    }
+
     // acquire a version slot, which is unused to copy the current (latest) version into it
     auto new_version_idx = AcquireRegionVersionForOverwrite();
     if (new_version_idx.has_value())
@@ -149,7 +196,7 @@ bool MemoryRegionMapImpl<AtomicIndirectorType>::UpdateKnownRegion(const std::uin
 
         // Check that the inserted range does not overlap with the previous memory region in the ordered map
         const auto inserted_region_it = insertion_result.first;
-        if (DoesRegionIteratorOverlapWithExistingRegionInMap(inserted_region_it, new_known_regions))
+        if (DoesRegionIteratorOverlapWithExistingRegionInMap<KnownRegionsType>(inserted_region_it, new_known_regions))
         {
             return false;
         }
@@ -161,6 +208,7 @@ bool MemoryRegionMapImpl<AtomicIndirectorType>::UpdateKnownRegion(const std::uin
 
         // ... and set the latest version to our new version
         latest_known_region_version_.store(new_version_idx.value(), std::memory_order_release);
+        latest_known_region_generation_.store(AcquireNextRegionGeneration(), std::memory_order_release);
         return true;
     }
     else
@@ -171,9 +219,10 @@ bool MemoryRegionMapImpl<AtomicIndirectorType>::UpdateKnownRegion(const std::uin
     }
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // coverity[autosar_cpp14_a15_5_3_violation] See rationale for std::array:at() autosar_cpp14_a15_5_3_violation above
-void MemoryRegionMapImpl<AtomicIndirectorType>::RemoveKnownRegion(const std::uintptr_t memory_range_start) noexcept
+void MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::RemoveKnownRegion(
+    const std::uintptr_t memory_range_start) noexcept
 {
     // acquire a version slot, which is unused to copy the current (latest) version into it
     auto new_version_idx = AcquireRegionVersionForOverwrite();
@@ -195,6 +244,7 @@ void MemoryRegionMapImpl<AtomicIndirectorType>::RemoveKnownRegion(const std::uin
 
         // ... and set the latest version to our new version
         latest_known_region_version_.store(new_version_idx.value(), std::memory_order_release);
+        latest_known_region_generation_.store(AcquireNextRegionGeneration(), std::memory_order_release);
     }
     else
     {
@@ -204,9 +254,9 @@ void MemoryRegionMapImpl<AtomicIndirectorType>::RemoveKnownRegion(const std::uin
     }
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // coverity[autosar_cpp14_a15_5_3_violation] See rationale for std::array:at() autosar_cpp14_a15_5_3_violation above
-void MemoryRegionMapImpl<AtomicIndirectorType>::ClearKnownRegions() noexcept
+void MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::ClearKnownRegions() noexcept
 {
     auto new_version_idx = AcquireRegionVersionForOverwrite();
     if (new_version_idx.has_value())
@@ -221,6 +271,7 @@ void MemoryRegionMapImpl<AtomicIndirectorType>::ClearKnownRegions() noexcept
 
         // ... and set the latest version to our new version
         latest_known_region_version_.store(new_version_idx.value(), std::memory_order_release);
+        latest_known_region_generation_.store(AcquireNextRegionGeneration(), std::memory_order_release);
     }
     else
     {
@@ -230,11 +281,21 @@ void MemoryRegionMapImpl<AtomicIndirectorType>::ClearKnownRegions() noexcept
     }
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // coverity[autosar_cpp14_a15_5_3_violation] See rationale for std::array:at() autosar_cpp14_a15_5_3_violation above
-auto MemoryRegionMapImpl<AtomicIndirectorType>::GetBoundsFromAddress(const std::uintptr_t pointer) const noexcept
-    -> std::optional<MemoryRegionBounds>
+auto MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::GetBoundsFromAddress(
+    const std::uintptr_t pointer) const noexcept -> std::optional<MemoryRegionBounds>
 {
+    const auto generation = latest_known_region_generation_.load(std::memory_order_acquire);
+    if (IsCachedLookupValidFor(last_region_lookup, generation, pointer))
+    {
+        return MemoryRegionBounds{last_region_lookup.first_address, last_region_lookup.last_address};
+    }
+    if (IsCachedLookupValidFor(last_gap_lookup, generation, pointer))
+    {
+        return {};
+    }
+
     auto latest_regions_version_index = AcquireLatestRegionVersionForRead();
 
     if (!latest_regions_version_index.has_value())
@@ -247,19 +308,18 @@ auto MemoryRegionMapImpl<AtomicIndirectorType>::GetBoundsFromAddress(const std::
     auto& latest_known_regions =
         known_regions_versions_.at(static_cast<std::size_t>(latest_regions_version_index.value().GetIndex()));
 
-    if (latest_known_regions.empty())
-    {
-        return {};
-    }
-
     // Find first memory range which has a starting address greater than the input pointer. This will return an iterator
     // to the memory range one past the desired range.
-    auto it = latest_known_regions.upper_bound(pointer);
-    if (it == latest_known_regions.begin())  // Pointer address is before the first memory range
+    const auto next_it = latest_known_regions.upper_bound(pointer);
+    const auto gap_last_address = (next_it == latest_known_regions.cend())
+                                      ? std::numeric_limits<std::uintptr_t>::max()
+                                      : (next_it->first - 1U);
+    if (next_it == latest_known_regions.cbegin())  // Pointer address is before the first memory range
     {
+        last_gap_lookup = CachedLookup{generation, 0U, gap_last_address};
         return {};
     }
-    --it;
+    const auto it = std::prev(next_it);
 
     const auto start_address = it->first;
     const auto end_address = it->second;
@@ -267,18 +327,21 @@ auto MemoryRegionMapImpl<AtomicIndirectorType>::GetBoundsFromAddress(const std::
     const bool pointer_in_memory_bounds = ((pointer >= start_address) && (pointer <= end_address));
     if (pointer_in_memory_bounds)
     {
+        last_region_lookup = CachedLookup{generation, start_address, end_address};
         const MemoryRegionBounds memory_bounds{start_address, end_address};
         return memory_bounds;
     }
     else
     {
+        // pointer > end_address, so end_address + 1 cannot overflow
+        last_gap_lookup = CachedLookup{generation, end_address + 1U, gap_last_address};
         return {};
     }
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // coverity[autosar_cpp14_a15_5_3_violation] See rationale for std::array:at() autosar_cpp14_a15_5_3_violation above
-size_t MemoryRegionMapImpl<AtomicIndirectorType>::GetSize() const noexcept
+size_t MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::GetSize() const noexcept
 {
     auto latest_regions_version_index = AcquireLatestRegionVersionForRead();
     if (!latest_regions_version_index.has_value())
@@ -293,10 +356,10 @@ size_t MemoryRegionMapImpl<AtomicIndirectorType>::GetSize() const noexcept
     return latest_known_regions.size();
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // coverity[autosar_cpp14_a15_5_3_violation] See rationale for std::array:at() autosar_cpp14_a15_5_3_violation above
-auto MemoryRegionMapImpl<AtomicIndirectorType>::AcquireLatestRegionVersionForRead() const noexcept
-    -> std::optional<typename MemoryRegionMapImpl<AtomicIndirectorType>::AcquiredRefcountIndex>
+auto MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::AcquireLatestRegionVersionForRead() const noexcept
+    -> std::optional<typename MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::AcquiredRefcountIndex>
 {
     // We use an unrealistic high max_retries value here, which should never be reached.
     // It would actually need an insane number of threads, which concurrently try to increment the refcount!
@@ -333,9 +396,10 @@ auto MemoryRegionMapImpl<AtomicIndirectorType>::AcquireLatestRegionVersionForRea
     return std::nullopt;
 }
 
-template <template <class> class AtomicIndirectorType>
+template <template <class> class AtomicIndirectorType, class KnownRegionsType>
 // coverity[autosar_cpp14_a15_5_3_violation] See rationale for std::array:at() autosar_cpp14_a15_5_3_violation above
-std::optional<std::uint8_t> MemoryRegionMapImpl<AtomicIndirectorType>::AcquireRegionVersionForOverwrite() noexcept
+auto MemoryRegionMapImpl<AtomicIndirectorType, KnownRegionsType>::AcquireRegionVersionForOverwrite() noexcept
+    -> std::optional<std::uint8_t>
 {
     // Arbitrary retry value here. It is expected, that when checking all known regions versions, the writer
     // will find one being unused! Because readers are accessing only the latest for a very short time ...
@@ -378,5 +442,7 @@ std::optional<std::uint8_t> MemoryRegionMapImpl<AtomicIndirectorType>::AcquireRe
 
 template class MemoryRegionMapImpl<memory::shared::AtomicIndirectorReal>;
 template class MemoryRegionMapImpl<memory::shared::AtomicIndirectorMock>;
+template class MemoryRegionMapImpl<memory::shared::AtomicIndirectorReal,
+                                   SortedRegionArray<kMaxNumberOfFlatMemoryRegions>>;
 
 }  // namespace score::memory::shared::detail
@@ -15,6 +15,7 @@
 
 #include "score/memory/shared/atomic_indirector.h"
 #include "score/memory/shared/memory_region_bounds.h"
+#include "score/memory/shared/sorted_region_array.h"
 
 #include <array>
 #include <atomic>
@@ -52,8 +53,16 @@ namespace detail
 ///          Lock-Free algo is based on multi-versioning/swap mechanism in conjunction with atomics.
 ///          Detailed description can be found here:
 ///          score/memory/design/shared_memory/Readme.md - chapter Bounds_Checking_Performance
-
-template <template <class> class AtomicIndirectorType = memory::shared::AtomicIndirectorReal>
+///
+///          On top of that, every thread caches the region and the gap between regions, which it looked up last. Every
+///          new regions version gets a generation, which is unique across all maps, and cached results are only used
+///          as long as their generation is still the latest one. So consecutive lookups within the same region (or
+///          outside of all regions) don't have to acquire a regions version.
+
+/// \tparam KnownRegionsType container of one regions version, mapping start addresses to end addresses. Has to provide
+///         the interface of std::map<std::uintptr_t, std::uintptr_t>, which is used here, e.g. SortedRegionArray.
+template <template <class> class AtomicIndirectorType = memory::shared::AtomicIndirectorReal,
+          class KnownRegionsType = std::map<std::uintptr_t, std::uintptr_t>>
 // Suppress "AUTOSAR C++14 M3-2-3" rule finding: "A type, object or function that is used in multiple translation units
 // shall be declared in one and only one file.".
 // this is false positive. MemoryRegionMapImpl is declared only once.
@@ -81,7 +90,7 @@ class MemoryRegionMapImpl final
 
     /// \brief Creates a new regions version based on the latest version and adds the given region to it and then marks
     ///        it as the latest regions version. Only adds the provided range if it doesn't overlap with another range
-    ///        that was already added via UpdateKnownRegions
+    ///        that was already added via UpdateKnownRegions and if KnownRegionsType can store another region
     /// \param memory_range_start
     /// \param memory_range_end
     /// \return true, if the range was inserted. Otherwise, false.
@@ -154,7 +163,7 @@ class MemoryRegionMapImpl final
     std::optional<std::uint8_t> AcquireRegionVersionForOverwrite() noexcept;
 
     /// \brief We have an array of different versions of known regions to support our lock-free CAS based read access
-    std::array<std::map<std::uintptr_t, std::uintptr_t>, VERSION_COUNT> known_regions_versions_{};
+    std::array<KnownRegionsType, VERSION_COUNT> known_regions_versions_{};
 
     /// \brief refcounters for the different versions of known regions in known_regions_versions_
     mutable std::array<std::atomic<RegionVersionRefCountType>, VERSION_COUNT> known_regions_versions_refcounts_{};
@@ -162,11 +171,29 @@ class MemoryRegionMapImpl final
 
     /// \brief index into known_regions_versions_, which represents the latest/newest version of known regions
     std::atomic_uint8_t latest_known_region_version_{0U};
+
+    /// \brief generation of the latest version of known regions. Updated after latest_known_region_version_, so a
+    /// reader, which sees a generation, sees at least the regions version it belongs to.
+    std::atomic<std::uint64_t> latest_known_region_generation_;
 };
 
 }  // namespace detail
 
+/// \brief Maximum number of regions, which can be known by a FlatMemoryRegionMap.
+constexpr std::size_t kMaxNumberOfFlatMemoryRegions{1024U};
+
+/// \brief MemoryRegionMap, which stores every regions version in a preallocated sorted array instead of a std::map.
+/// \details Lookups search contiguous memory and updates don't allocate. In turn, the number of regions is limited to
+///          kMaxNumberOfFlatMemoryRegions.
+using FlatMemoryRegionMap = detail::MemoryRegionMapImpl<memory::shared::AtomicIndirectorReal,
+                                                        detail::SortedRegionArray<kMaxNumberOfFlatMemoryRegions>>;
+
+// The flat implementation is selected by the bazel flag //score/memory/shared/flags:use_flat_memory_region_map
+#if defined(SCORE_MEMORY_SHARED_USE_FLAT_MEMORY_REGION_MAP)
+using MemoryRegionMap = FlatMemoryRegionMap;
+#else
 using MemoryRegionMap = detail::MemoryRegionMapImpl<>;
+#endif
 
 }  // namespace score::memory::shared
 
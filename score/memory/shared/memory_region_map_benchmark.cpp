@@ -0,0 +1,123 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/memory_region_map.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+using MapBasedMemoryRegionMap = detail::MemoryRegionMapImpl<>;
+
+constexpr std::uintptr_t kFirstRegionStartAddress{0x10000000U};
+constexpr std::uintptr_t kRegionDistance{0x10000U};
+constexpr std::uintptr_t kRegionSize{0x8000U};
+constexpr std::size_t kNumberOfLookupAddresses{4096U};
+
+std::uintptr_t GetRegionStartAddress(const std::size_t region_index)
+{
+    return kFirstRegionStartAddress + (static_cast<std::uintptr_t>(region_index) * kRegionDistance);
+}
+
+template <typename MemoryRegionMapType>
+std::unique_ptr<MemoryRegionMapType> CreateMapWithRegions(const std::size_t number_of_regions)
+{
+    auto map = std::make_unique<MemoryRegionMapType>();
+    for (std::size_t i = 0U; i < number_of_regions; ++i)
+    {
+        const bool inserted = map->UpdateKnownRegion(GetRegionStartAddress(i), GetRegionStartAddress(i) + kRegionSize);
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(inserted);
+    }
+    return map;
+}
+
+/// Addresses within the regions, which are concatenated random permutations of all regions. So consecutive lookups
+/// nearly always hit different regions and the per-thread cache of the last looked up region does not help.
+std::vector<std::uintptr_t> CreateLookupAddresses(const std::size_t number_of_regions)
+{
+    std::mt19937 generator{42U};
+    std::vector<std::size_t> region_indices(number_of_regions);
+    std::vector<std::uintptr_t> addresses{};
+    addresses.reserve(kNumberOfLookupAddresses);
+    while (addresses.size() < kNumberOfLookupAddresses)
+    {
+        std::iota(region_indices.begin(), region_indices.end(), std::size_t{0U});
+        std::shuffle(region_indices.begin(), region_indices.end(), generator);
+        for (const auto region_index : region_indices)
+        {
+            addresses.push_back(GetRegionStartAddress(region_index) + (kRegionSize / 2U));
+        }
+    }
+    addresses.resize(kNumberOfLookupAddresses);
+    return addresses;
+}
+
+template <typename MemoryRegionMapType>
+void GetBoundsFromAddress(benchmark::State& state)
+{
+    const auto number_of_regions = static_cast<std::size_t>(state.range(0));
+    const auto map = CreateMapWithRegions<MemoryRegionMapType>(number_of_regions);
+    const auto addresses = CreateLookupAddresses(number_of_regions);
+
+    std::size_t address_index{0U};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(map->GetBoundsFromAddress(addresses[address_index]));
+        address_index = (address_index + 1U) % kNumberOfLookupAddresses;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename MemoryRegionMapType>
+void UpdateAndRemoveKnownRegion(benchmark::State& state)
+{
+    const auto number_of_regions = static_cast<std::size_t>(state.range(0));
+    const auto map = CreateMapWithRegions<MemoryRegionMapType>(number_of_regions);
+
+    // The region is inserted in the middle of the existing regions
+    const auto start_address = GetRegionStartAddress(number_of_regions / 2U) + kRegionSize + 1U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(map->UpdateKnownRegion(start_address, start_address + 1U));
+        map->RemoveKnownRegion(start_address);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(GetBoundsFromAddress, MapBasedMemoryRegionMap)
+    ->ArgName("regions")
+    ->RangeMultiplier(8)
+    ->Range(8, 512);
+BENCHMARK_TEMPLATE(GetBoundsFromAddress, FlatMemoryRegionMap)->ArgName("regions")->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK_TEMPLATE(UpdateAndRemoveKnownRegion, MapBasedMemoryRegionMap)
+    ->ArgName("regions")
+    ->RangeMultiplier(8)
+    ->Range(8, 512);
+BENCHMARK_TEMPLATE(UpdateAndRemoveKnownRegion, FlatMemoryRegionMap)
+    ->ArgName("regions")
+    ->RangeMultiplier(8)
+    ->Range(8, 512);
+
+}  // namespace
+}  // namespace score::memory::shared
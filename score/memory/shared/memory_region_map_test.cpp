@@ -19,6 +19,7 @@
 #include "gtest/gtest.h"
 
 #include <chrono>
+#include <memory>
 #include <cstdint>
 #include <random>
 #include <thread>
@@ -65,15 +66,20 @@ class MemoryRegionMapAttorney
     MemoryRegionMapMock& memory_region_map_;
 };
 
+template <typename MemoryRegionMapType>
 class MemoryRegionMapTest : public ::testing::Test
 {
   public:
     MemoryRegionMapTest() = default;
 
-    MemoryRegionMap unit_{};
+    MemoryRegionMapType unit_{};
 };
 
-class MockMemoryRegionMapTest : public MemoryRegionMapTest
+// All tests are run for the std::map based and the flat implementation
+using MemoryRegionMapTypes = ::testing::Types<detail::MemoryRegionMapImpl<>, FlatMemoryRegionMap>;
+TYPED_TEST_SUITE(MemoryRegionMapTest, MemoryRegionMapTypes, );
+
+class MockMemoryRegionMapTest : public ::testing::Test
 {
   protected:
     using MemoryRegionMapMock = detail::MemoryRegionMapImpl<AtomicIndirectorMock>;
@@ -142,34 +148,35 @@ class MockMemoryRegionMapTest : public MemoryRegionMapTest
     AtomicMock<AtomicType> atomic_mock_;
 };
 
-TEST_F(MemoryRegionMapTest, ReturnsNullMemoryBoundsIfKnownRegionsEmpty)
+TYPED_TEST(MemoryRegionMapTest, ReturnsNullMemoryBoundsIfKnownRegionsEmpty)
 {
     // Given an empty MemoryRegionMap
     // When checking the memory bounds for a pointer
-    const auto foundMemoryBounds = unit_.GetBoundsFromAddress(std::uintptr_t{50U});
+    const auto foundMemoryBounds = this->unit_.GetBoundsFromAddress(std::uintptr_t{50U});
 
     // Then null memory bounds should be returned
     EXPECT_FALSE(foundMemoryBounds.has_value());
 }
 
-TEST_F(MemoryRegionMapTest, ReturnsMemoryBoundsForPointersInBounds)
+TYPED_TEST(MemoryRegionMapTest, ReturnsMemoryBoundsForPointersInBounds)
 {
     const MemoryRegionBounds firstMemoryBounds{50U, 100};
     const MemoryRegionBounds secondMemoryBounds{150U, 200};
 
     // Given 2 memory ranges are inserted into the MemoryRegionMap
-    EXPECT_TRUE(unit_.UpdateKnownRegion(firstMemoryBounds.GetStartAddress(), firstMemoryBounds.GetEndAddress()));
-    EXPECT_TRUE(unit_.UpdateKnownRegion(secondMemoryBounds.GetStartAddress(), secondMemoryBounds.GetEndAddress()));
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(firstMemoryBounds.GetStartAddress(), firstMemoryBounds.GetEndAddress()));
+    EXPECT_TRUE(
+        this->unit_.UpdateKnownRegion(secondMemoryBounds.GetStartAddress(), secondMemoryBounds.GetEndAddress()));
 
     // When checking the memory bounds for pointers inside the memory bounds
-    const auto firstFoundMemoryBounds0 = unit_.GetBoundsFromAddress(std::uintptr_t{50});
-    const auto firstFoundMemoryBounds1 = unit_.GetBoundsFromAddress(std::uintptr_t{75});
-    const auto firstFoundMemoryBounds2 = unit_.GetBoundsFromAddress(std::uintptr_t{100});
-    const auto secondFoundMemoryBounds0 = unit_.GetBoundsFromAddress(std::uintptr_t{150});
-    const auto secondFoundMemoryBounds1 = unit_.GetBoundsFromAddress(std::uintptr_t{175});
-    const auto secondFoundMemoryBounds2 = unit_.GetBoundsFromAddress(std::uintptr_t{200});
+    const auto firstFoundMemoryBounds0 = this->unit_.GetBoundsFromAddress(std::uintptr_t{50});
+    const auto firstFoundMemoryBounds1 = this->unit_.GetBoundsFromAddress(std::uintptr_t{75});
+    const auto firstFoundMemoryBounds2 = this->unit_.GetBoundsFromAddress(std::uintptr_t{100});
+    const auto secondFoundMemoryBounds0 = this->unit_.GetBoundsFromAddress(std::uintptr_t{150});
+    const auto secondFoundMemoryBounds1 = this->unit_.GetBoundsFromAddress(std::uintptr_t{175});
+    const auto secondFoundMemoryBounds2 = this->unit_.GetBoundsFromAddress(std::uintptr_t{200});
 
-    const auto notFoundMemoryBounds = unit_.GetBoundsFromAddress(std::uintptr_t{500});
+    const auto notFoundMemoryBounds = this->unit_.GetBoundsFromAddress(std::uintptr_t{500});
 
     // Then the correct bounds should be returned
     ASSERT_TRUE(firstFoundMemoryBounds0.has_value());
@@ -194,21 +201,30 @@ class MemoryRegionMapUpdateRegionParamaterisedFixture
 {
 };
 
-TEST_P(MemoryRegionMapUpdateRegionParamaterisedFixture,
-       UpdateKnownRegionFailsIfProvidedMemoryRangeOverlapsWithExistingRange)
+template <typename MemoryRegionMapType>
+void ExpectUpdateKnownRegionResults(
+    const std::vector<std::pair<std::pair<std::uintptr_t, std::uintptr_t>, bool>>& ranges_to_insert)
 {
-    MemoryRegionMap unit{};
-    const auto ranges_to_insert = GetParam();
+    auto unit = std::make_unique<MemoryRegionMapType>();
 
     for (const auto& range_pair : ranges_to_insert)
     {
         const auto& range_to_insert = range_pair.first;
         const bool should_update_succeed = range_pair.second;
 
-        EXPECT_EQ(unit.UpdateKnownRegion(range_to_insert.first, range_to_insert.second), should_update_succeed);
+        EXPECT_EQ(unit->UpdateKnownRegion(range_to_insert.first, range_to_insert.second), should_update_succeed);
     }
 }
 
+TEST_P(MemoryRegionMapUpdateRegionParamaterisedFixture,
+       UpdateKnownRegionFailsIfProvidedMemoryRangeOverlapsWithExistingRange)
+{
+    const auto ranges_to_insert = GetParam();
+
+    ExpectUpdateKnownRegionResults<detail::MemoryRegionMapImpl<>>(ranges_to_insert);
+    ExpectUpdateKnownRegionResults<FlatMemoryRegionMap>(ranges_to_insert);
+}
+
 INSTANTIATE_TEST_SUITE_P(MemoryRegionMapUpdateRegionParamaterisedFixture,
                          MemoryRegionMapUpdateRegionParamaterisedFixture,
                          ::testing::Values(
@@ -260,68 +276,161 @@ INSTANTIATE_TEST_SUITE_P(MemoryRegionMapUpdateRegionParamaterisedFixture,
                                  {{std::uintptr_t{80}, std::uintptr_t{280}}, false},
                              }));
 
-TEST_F(MemoryRegionMapTest, GetBoundsFromAddressWillNotReturnRangeForRegionWhichFailedToInsert)
+TYPED_TEST(MemoryRegionMapTest, GetBoundsFromAddressWillNotReturnRangeForRegionWhichFailedToInsert)
 {
     const MemoryRegionBounds validMemoryBounds{50U, 100U};
     const MemoryRegionBounds invalidMemoryBounds{10U, 60U};
 
     // Given a memory range is inserted into the MemoryRegionMap
-    EXPECT_TRUE(unit_.UpdateKnownRegion(validMemoryBounds.GetStartAddress(), validMemoryBounds.GetEndAddress()));
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(validMemoryBounds.GetStartAddress(), validMemoryBounds.GetEndAddress()));
 
     // When inserting a memory region which overlaps with the existing memory range
     // Then the region cannot be inserted
-    EXPECT_FALSE(unit_.UpdateKnownRegion(invalidMemoryBounds.GetStartAddress(), invalidMemoryBounds.GetEndAddress()));
+    EXPECT_FALSE(
+        this->unit_.UpdateKnownRegion(invalidMemoryBounds.GetStartAddress(), invalidMemoryBounds.GetEndAddress()));
 
     // and when calling GetBoundsFromAddress for a value within the invalid range but not within the valid range
     // Then an empty optional should be returned
-    EXPECT_FALSE(unit_.GetBoundsFromAddress(std::uintptr_t{40U}).has_value());
+    EXPECT_FALSE(this->unit_.GetBoundsFromAddress(std::uintptr_t{40U}).has_value());
 }
 
-TEST_F(MemoryRegionMapTest, InsertAndRemove)
+TYPED_TEST(MemoryRegionMapTest, InsertAndRemove)
 {
     const MemoryRegionBounds memoryBounds{50U, 100U};
 
     // Given a memory region is inserted into the MemoryRegionMap
-    EXPECT_TRUE(unit_.UpdateKnownRegion(memoryBounds.GetStartAddress(), memoryBounds.GetEndAddress()));
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(memoryBounds.GetStartAddress(), memoryBounds.GetEndAddress()));
 
     // When checking the memory bounds for pointers inside the memory regions
-    auto foundMemoryBounds = unit_.GetBoundsFromAddress(std::uintptr_t{50U});
+    auto foundMemoryBounds = this->unit_.GetBoundsFromAddress(std::uintptr_t{50U});
 
     // Then the correct bounds should be returned
     ASSERT_TRUE(foundMemoryBounds.has_value());
     EXPECT_EQ(foundMemoryBounds.value(), memoryBounds);
 
     // ... and when removing the memory bounds again
-    unit_.RemoveKnownRegion(memoryBounds.GetStartAddress());
+    this->unit_.RemoveKnownRegion(memoryBounds.GetStartAddress());
 
     // and when checking memory bounds for pointers inside the memory regions
-    foundMemoryBounds = unit_.GetBoundsFromAddress(std::uintptr_t{50U});
+    foundMemoryBounds = this->unit_.GetBoundsFromAddress(std::uintptr_t{50U});
 
     // then nothing should be found
     EXPECT_FALSE(foundMemoryBounds.has_value());
 }
 
-TEST_F(MemoryRegionMapTest, Clear)
+TYPED_TEST(MemoryRegionMapTest, Clear)
 {
     const MemoryRegionBounds firstMemoryBounds{50U, 100U};
     const MemoryRegionBounds secondMemoryBounds{150U, 200U};
 
     // Given 2 memory ranges are inserted into the MemoryRegionMap
-    EXPECT_TRUE(unit_.UpdateKnownRegion(firstMemoryBounds.GetStartAddress(), firstMemoryBounds.GetEndAddress()));
-    EXPECT_TRUE(unit_.UpdateKnownRegion(secondMemoryBounds.GetStartAddress(), secondMemoryBounds.GetEndAddress()));
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(firstMemoryBounds.GetStartAddress(), firstMemoryBounds.GetEndAddress()));
+    EXPECT_TRUE(
+        this->unit_.UpdateKnownRegion(secondMemoryBounds.GetStartAddress(), secondMemoryBounds.GetEndAddress()));
 
     // and when we clear the map
-    unit_.ClearKnownRegions();
+    this->unit_.ClearKnownRegions();
 
     // and then check for the bounds of the previously inserted regions
-    const auto firstFoundMemoryBounds = unit_.GetBoundsFromAddress(firstMemoryBounds.GetStartAddress());
-    const auto secondFoundMemoryBounds = unit_.GetBoundsFromAddress(secondMemoryBounds.GetStartAddress());
+    const auto firstFoundMemoryBounds = this->unit_.GetBoundsFromAddress(firstMemoryBounds.GetStartAddress());
+    const auto secondFoundMemoryBounds = this->unit_.GetBoundsFromAddress(secondMemoryBounds.GetStartAddress());
 
     // Then the regions shouldn't be there
     EXPECT_FALSE(firstFoundMemoryBounds.has_value());
     EXPECT_FALSE(secondFoundMemoryBounds.has_value());
 }
 
+TYPED_TEST(MemoryRegionMapTest, LookupAfterReplacingRegionReturnsNewBounds)
+{
+    const MemoryRegionBounds oldMemoryBounds{50U, 100U};
+    const MemoryRegionBounds newMemoryBounds{60U, 120U};
+
+    // Given a memory region, which was already looked up by this thread
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(oldMemoryBounds.GetStartAddress(), oldMemoryBounds.GetEndAddress()));
+    EXPECT_EQ(this->unit_.GetBoundsFromAddress(std::uintptr_t{75U}), oldMemoryBounds);
+
+    // When the region is replaced by another region, which contains the same address
+    this->unit_.RemoveKnownRegion(oldMemoryBounds.GetStartAddress());
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(newMemoryBounds.GetStartAddress(), newMemoryBounds.GetEndAddress()));
+
+    // Then looking up the same address again returns the bounds of the new region
+    EXPECT_EQ(this->unit_.GetBoundsFromAddress(std::uintptr_t{75U}), newMemoryBounds);
+}
+
+TYPED_TEST(MemoryRegionMapTest, LookupBetweenRegionsAfterInsertingRegionReturnsNewBounds)
+{
+    const MemoryRegionBounds firstMemoryBounds{50U, 100U};
+    const MemoryRegionBounds secondMemoryBounds{300U, 400U};
+    const MemoryRegionBounds insertedMemoryBounds{150U, 200U};
+
+    // Given an address between two memory regions, which was already looked up by this thread
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(firstMemoryBounds.GetStartAddress(), firstMemoryBounds.GetEndAddress()));
+    EXPECT_TRUE(
+        this->unit_.UpdateKnownRegion(secondMemoryBounds.GetStartAddress(), secondMemoryBounds.GetEndAddress()));
+    EXPECT_FALSE(this->unit_.GetBoundsFromAddress(std::uintptr_t{175U}).has_value());
+
+    // When a region, which contains that address, is inserted
+    EXPECT_TRUE(
+        this->unit_.UpdateKnownRegion(insertedMemoryBounds.GetStartAddress(), insertedMemoryBounds.GetEndAddress()));
+
+    // Then looking up the same address again returns the bounds of the inserted region
+    EXPECT_EQ(this->unit_.GetBoundsFromAddress(std::uintptr_t{175U}), insertedMemoryBounds);
+
+    // and the addresses directly next to the regions are still outside of all regions
+    EXPECT_FALSE(this->unit_.GetBoundsFromAddress(std::uintptr_t{101U}).has_value());
+    EXPECT_FALSE(this->unit_.GetBoundsFromAddress(std::uintptr_t{149U}).has_value());
+    EXPECT_FALSE(this->unit_.GetBoundsFromAddress(std::uintptr_t{201U}).has_value());
+    EXPECT_FALSE(this->unit_.GetBoundsFromAddress(std::uintptr_t{299U}).has_value());
+    EXPECT_EQ(this->unit_.GetBoundsFromAddress(std::uintptr_t{300U}), secondMemoryBounds);
+}
+
+TYPED_TEST(MemoryRegionMapTest, LookupsOfDifferentMapsDoNotInfluenceEachOther)
+{
+    const MemoryRegionBounds memoryBounds{50U, 100U};
+
+    // Given two maps, of which only one contains a memory region
+    auto other_unit = std::make_unique<TypeParam>();
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(memoryBounds.GetStartAddress(), memoryBounds.GetEndAddress()));
+
+    // When looking up an address of that region in both maps alternately
+    // Then only the map containing the region returns its bounds
+    for (std::size_t i = 0U; i < 2U; ++i)
+    {
+        EXPECT_EQ(this->unit_.GetBoundsFromAddress(std::uintptr_t{75U}), memoryBounds);
+        EXPECT_FALSE(other_unit->GetBoundsFromAddress(std::uintptr_t{75U}).has_value());
+    }
+}
+
+TEST(FlatMemoryRegionMapTest, UpdateKnownRegionFailsIfMaximumNumberOfRegionsIsReached)
+{
+    constexpr std::uintptr_t kRegionDistance{100U};
+    auto unit = std::make_unique<FlatMemoryRegionMap>();
+
+    // Given a FlatMemoryRegionMap, which contains the maximum number of regions
+    for (std::uintptr_t i = 1U; i <= kMaxNumberOfFlatMemoryRegions; ++i)
+    {
+        ASSERT_TRUE(unit->UpdateKnownRegion(i * kRegionDistance, (i * kRegionDistance) + 50U));
+    }
+
+    // When adding another region
+    const auto start_address = (kMaxNumberOfFlatMemoryRegions + 1U) * kRegionDistance;
+    const bool result = unit->UpdateKnownRegion(start_address, start_address + 50U);
+
+    // Then the region is not added
+    EXPECT_FALSE(result);
+    EXPECT_EQ(unit->GetSize(), kMaxNumberOfFlatMemoryRegions);
+    EXPECT_FALSE(unit->GetBoundsFromAddress(start_address).has_value());
+
+    // and the existing regions can still be found
+    const auto last_bounds = unit->GetBoundsFromAddress(kMaxNumberOfFlatMemoryRegions * kRegionDistance);
+    ASSERT_TRUE(last_bounds.has_value());
+    EXPECT_EQ(last_bounds.value().GetStartAddress(), kMaxNumberOfFlatMemoryRegions * kRegionDistance);
+
+    // and a region can be added again after removing one
+    unit->RemoveKnownRegion(kRegionDistance);
+    EXPECT_TRUE(unit->UpdateKnownRegion(start_address, start_address + 50U));
+}
+
 /// \brief multi-threaded test case with a writer changing the known_regions and N readers doing bounds-lookups.
 /// \details We have 100 test regions, which are step-by-step inserted into the region map and then step-by-step
 ///          removed again by the writer, which sleeps between each region map change. After the writer has done
@@ -335,7 +444,7 @@ TEST_F(MemoryRegionMapTest, Clear)
 ///          If the region was NOT found - either directly before or after the bounds-check the inserted flag noted by
 ///          the writer needed to be false (runtime of the writer and sleep times of the readers are such, that it is
 ///          almost impossible, that the flag is true at both times, but the reader still gets a negative bounds-check!)
-TEST_F(MemoryRegionMapTest, ConcurrentAccess)
+TYPED_TEST(MemoryRegionMapTest, ConcurrentAccess)
 {
     struct RegionWithFlag
     {
@@ -369,7 +478,7 @@ TEST_F(MemoryRegionMapTest, ConcurrentAccess)
     auto writer_activity = [&memory_regions, this]() {
         for (auto& reg : memory_regions)
         {
-            EXPECT_TRUE(unit_.UpdateKnownRegion(reg.region_.GetStartAddress(), reg.region_.GetEndAddress()));
+            EXPECT_TRUE(this->unit_.UpdateKnownRegion(reg.region_.GetStartAddress(), reg.region_.GetEndAddress()));
             reg.inserted_.store(true, std::memory_order_seq_cst);
             std::this_thread::sleep_for(2ms);
         }
@@ -378,7 +487,7 @@ TEST_F(MemoryRegionMapTest, ConcurrentAccess)
         {
             // we have inserted it in the 1st run ... let's be hyper-cautious
             ASSERT_TRUE(reg.inserted_);
-            unit_.RemoveKnownRegion(reg.region_.GetStartAddress());
+            this->unit_.RemoveKnownRegion(reg.region_.GetStartAddress());
             reg.inserted_.store(false, std::memory_order_seq_cst);
             std::this_thread::sleep_for(2ms);
         }
@@ -394,7 +503,7 @@ TEST_F(MemoryRegionMapTest, ConcurrentAccess)
             const auto random_index = distrib(gen);
             const auto& region = memory_regions[static_cast<std::size_t>(random_index)];
             const bool inserted_before = region.inserted_.load(std::memory_order_seq_cst);
-            const auto bounds = unit_.GetBoundsFromAddress(region.region_.GetStartAddress());
+            const auto bounds = this->unit_.GetBoundsFromAddress(region.region_.GetStartAddress());
             const bool inserted_after = region.inserted_.load(std::memory_order_seq_cst);
 
             if (bounds.has_value())
@@ -454,18 +563,21 @@ TEST_F(MockMemoryRegionMapTest, AcquiringVersionForWritingWhenAllVersionsAreCurr
     EXPECT_FALSE(index.has_value());
 }
 
-using MemoryRegionMapDeathTest = MemoryRegionMapTest;
-TEST_F(MemoryRegionMapDeathTest, RemovingNonExistantRegionTerminates)
+template <typename MemoryRegionMapType>
+using MemoryRegionMapDeathTest = MemoryRegionMapTest<MemoryRegionMapType>;
+TYPED_TEST_SUITE(MemoryRegionMapDeathTest, MemoryRegionMapTypes, );
+
+TYPED_TEST(MemoryRegionMapDeathTest, RemovingNonExistantRegionTerminates)
 {
     const uint8_t start_address{50};
     const MemoryRegionBounds memoryBounds{start_address, 100U};
 
     // Given a memory region is inserted into the MemoryRegionMap
-    EXPECT_TRUE(unit_.UpdateKnownRegion(memoryBounds.GetStartAddress(), memoryBounds.GetEndAddress()));
+    EXPECT_TRUE(this->unit_.UpdateKnownRegion(memoryBounds.GetStartAddress(), memoryBounds.GetEndAddress()));
 
     // When removing a memory range that hasn't been inserted
     // Then the program terminates
-    EXPECT_DEATH(unit_.RemoveKnownRegion(start_address + 1), ".*");
+    EXPECT_DEATH(this->unit_.RemoveKnownRegion(start_address + 1), ".*");
 }
 
 class MockMemoryRegionMapDeathTest : public MockMemoryRegionMapTest
@@ -21,6 +21,7 @@
 #include <score/utility.hpp>
 
 #include <exception>
+#include <memory>
 #include <optional>
 
 auto score::memory::shared::MemoryResourceRegistry::getInstance() -> MemoryResourceRegistry&
@@ -30,22 +31,33 @@ auto score::memory::shared::MemoryResourceRegistry::getInstance() -> MemoryResou
     // Documentation and example for Rule A3-3-2 in
     // https://www.autosar.org/fileadmin/standards/R20-11/AP/AUTOSAR_RS_CPP14Guidelines.pdf show that
     // MemoryResourceRegistry would need a constexpr constructor to be compliant. This is not possible here
-    // because MemoryResourceRegistry contains a std::shared_time_mutex and std::unordered_map which don't have
+    // because MemoryResourceRegistry contains a std::mutex, std::unordered_map and RcuDomain which don't have
     // constexpr constructors.
     // coverity[autosar_cpp14_a3_3_2_violation]
     return score::singleton::MeyerSingleton<MemoryResourceRegistry>::GetInstance();
 }
 
+score::memory::shared::MemoryResourceRegistry::~MemoryResourceRegistry() noexcept
+{
+    // Readers must not use the registry anymore while it is destroyed, so there is no need to synchronize.
+    delete identifier_table_.load(std::memory_order_relaxed);
+}
+
 auto score::memory::shared::MemoryResourceRegistry::at(const MemoryResourceIdentifier identifier) const noexcept
     -> ManagedMemoryResource*
 {
-    std::shared_lock<std::shared_timed_mutex> lock{this->mutex_};
-    const auto iterator = this->registry_.find(identifier);
-    if (iterator == this->registry_.cend())
+    const detail::RcuDomain::ReadSection read_section{rcu_domain_};
+    const auto* const identifier_table = identifier_table_.load(std::memory_order_seq_cst);
+    if (identifier_table == nullptr)
     {
         return nullptr;
     }
-    return iterator->second;
+    const auto* const registered_resource = identifier_table->Find(identifier);
+    if (registered_resource == nullptr)
+    {
+        return nullptr;
+    }
+    return registered_resource->resource;
 }
 
 auto score::memory::shared::MemoryResourceRegistry::insert_resource(
@@ -59,16 +71,22 @@ auto score::memory::shared::MemoryResourceRegistry::insert_resource(
         std::terminate();
     }
 
-    std::lock_guard<std::shared_timed_mutex> lock{this->mutex_};
+    void* const memory_range_start = resource->getBaseAddress();
+    const void* const memory_range_end = resource->getEndAddress();
+    const MemoryRegionBounds memory_bounds{CastPointerToInteger(memory_range_start),
+                                           CastPointerToInteger(memory_range_end)};
+
+    std::lock_guard<std::mutex> lock{this->writer_mutex_};
 
-    auto result = this->registry_.insert(input);
+    auto result = this->registry_.insert({input.first, detail::RegisteredResource{resource, memory_bounds}});
+    if (result.second)
+    {
+        PublishIdentifierTable();
+    }
 
     // If we successfully inserted the ID into the registry, add the memory_range to known_regions.
     if (!input.second->IsOffsetPtrBoundsCheckBypassingEnabled() && result.second)
     {
-        void* const memory_range_start = resource->getBaseAddress();
-        const void* const memory_range_end = resource->getEndAddress();
-
         if ((memory_range_start == nullptr) || (memory_range_end == nullptr))
         {
             score::mw::log::LogFatal("shm")
@@ -77,53 +95,59 @@ auto score::memory::shared::MemoryResourceRegistry::insert_resource(
             std::terminate();
         }
 
-        const auto memory_range_start_as_integer = CastPointerToInteger(memory_range_start);
-        const auto memory_range_end_as_integer = CastPointerToInteger(memory_range_end);
-
-        return region_map_.UpdateKnownRegion(memory_range_start_as_integer, memory_range_end_as_integer);
+        return region_map_.UpdateKnownRegion(memory_bounds.GetStartAddress(), memory_bounds.GetEndAddress());
     }
     return result.second;
 }
 
 void score::memory::shared::MemoryResourceRegistry::remove_resource(const MemoryResourceIdentifier identifier) noexcept
 {
-    std::lock_guard<std::shared_timed_mutex> lock{this->mutex_};
+    std::lock_guard<std::mutex> lock{this->writer_mutex_};
     const auto resource_it = this->registry_.find(identifier);
     if (resource_it != this->registry_.cend())
     {
-        if (!resource_it->second->IsOffsetPtrBoundsCheckBypassingEnabled())
+        if (!resource_it->second.resource->IsOffsetPtrBoundsCheckBypassingEnabled())
         {
-            const auto start_address = resource_it->second->getBaseAddress();
-            const auto start_address_as_integer = CastPointerToInteger(start_address);
-            region_map_.RemoveKnownRegion(start_address_as_integer);
+            region_map_.RemoveKnownRegion(resource_it->second.bounds.GetStartAddress());
         }
         score::cpp::ignore = this->registry_.erase(resource_it);
+        PublishIdentifierTable();
     }
 }
 
 auto score::memory::shared::MemoryResourceRegistry::clear() noexcept -> void
 {
-    std::lock_guard<std::shared_timed_mutex> lock{this->mutex_};
+    std::lock_guard<std::mutex> lock{this->writer_mutex_};
     this->registry_.clear();
+    PublishIdentifierTable();
     region_map_.ClearKnownRegions();
 }
 
 auto score::memory::shared::MemoryResourceRegistry::GetBoundsFromIdentifier(
     const MemoryResourceIdentifier identifier) const noexcept -> score::Result<MemoryRegionBounds>
 {
-    std::shared_lock<std::shared_timed_mutex> lock{this->mutex_};
-    const auto resource_it = this->registry_.find(identifier);
-    if (resource_it != this->registry_.cend())
+    const detail::RcuDomain::ReadSection read_section{rcu_domain_};
+    const auto* const identifier_table = identifier_table_.load(std::memory_order_seq_cst);
+    if (identifier_table != nullptr)
     {
-        const auto* const start_address = resource_it->second->getBaseAddress();
-        const auto* const end_address = resource_it->second->getEndAddress();
-        const auto start_address_as_integer = CastPointerToInteger(start_address);
-        const auto end_address_as_integer = CastPointerToInteger(end_address);
-        return {{start_address_as_integer, end_address_as_integer}};
+        const auto* const registered_resource = identifier_table->Find(identifier);
+        if (registered_resource != nullptr)
+        {
+            return registered_resource->bounds;
+        }
     }
     return MakeUnexpected(SharedMemoryErrorCode::UnknownSharedMemoryIdentifier);
 }
 
+void score::memory::shared::MemoryResourceRegistry::PublishIdentifierTable() noexcept
+{
+    auto new_identifier_table = std::make_unique<const detail::ResourceIdentifierTable>(registry_);
+    const std::unique_ptr<const detail::ResourceIdentifierTable> old_identifier_table{
+        identifier_table_.exchange(new_identifier_table.release(), std::memory_order_seq_cst)};
+    // Readers that loaded the old table before the exchange may still use it.
+    rcu_domain_.Synchronize();
+}
+
 auto score::memory::shared::MemoryResourceRegistry::GetBoundsFromAddress(const void* const pointer) const noexcept
     -> std::optional<MemoryRegionBounds>
 {
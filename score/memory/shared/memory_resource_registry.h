@@ -16,12 +16,15 @@
 #include "score/memory/shared/managed_memory_resource.h"
 #include "score/memory/shared/memory_region_bounds.h"
 #include "score/memory/shared/memory_region_map.h"
+#include "score/memory/shared/rcu_domain.h"
+#include "score/memory/shared/resource_identifier_table.h"
 #include "score/utils/meyer_singleton/meyer_singleton.h"
 
 #include "score/result/result.h"
 
+#include <atomic>
+#include <mutex>
 #include <optional>
-#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 
@@ -43,7 +46,9 @@ class MemoryResourceRegistryAttorney;
 
 /**
  * @brief A singleton within a process to store all instances of an ManagedMemoryResource.
- *        It is a thread-safe (multiple read, single write) implementation.
+ *        It is a thread-safe (multiple read, single write) implementation. Lookups by identifier are wait-free: They
+ *        read an immutable snapshot of all registered resources, which is republished by every modification and
+ *        reclaimed once no reader can still access it (read-copy-update). Modifications are serialized by a mutex.
  *
  *        It will be used by a MemoryResourceProxy to query its associated
  *        MemoryResource based on a common identifier.
@@ -65,7 +70,7 @@ class MemoryResourceRegistry final
   public:
     using MemoryResourceIdentifier = std::uint64_t;
 
-    ~MemoryResourceRegistry() = default;
+    ~MemoryResourceRegistry() noexcept;
     MemoryResourceRegistry(const MemoryResourceRegistry& other) = delete;
     MemoryResourceRegistry(MemoryResourceRegistry&& other) noexcept = delete;
     MemoryResourceRegistry& operator=(const MemoryResourceRegistry& other) & = delete;
@@ -106,6 +111,10 @@ class MemoryResourceRegistry final
   private:
     static void CheckResourceInput(score::memory::shared::ManagedMemoryResource* const resource);
 
+    /// \brief Publishes a snapshot of registry_ for readers and reclaims the previous one.
+    /// \pre writer_mutex_ is held by the caller.
+    void PublishIdentifierTable() noexcept;
+
     // Suppress "AUTOSAR C++14 A11-3-1" rule finding: "Friend declarations shall not be used.".
     // The 'friend' class is employed to encapsulate non-public members.
     // This design choice protects end users from implementation details
@@ -119,9 +128,13 @@ class MemoryResourceRegistry final
     /// \brief ctor is private because of singleton pattern.
     MemoryResourceRegistry() = default;
 
-    /// \brief shared (reader/writer) mutex for synchronized access to registry_.
-    mutable std::shared_timed_mutex mutex_{};
-    std::unordered_map<MemoryResourceIdentifier, ManagedMemoryResource*> registry_{};
+    /// \brief mutex which serializes all modifications of registry_ and region_map_.
+    std::mutex writer_mutex_{};
+    std::unordered_map<MemoryResourceIdentifier, detail::RegisteredResource> registry_{};
+
+    /// \brief snapshot of registry_ for readers, which is only accessed within a ReadSection of rcu_domain_.
+    std::atomic<const detail::ResourceIdentifierTable*> identifier_table_{nullptr};
+    detail::RcuDomain rcu_domain_{};
 
     MemoryRegionMap region_map_{};
 };
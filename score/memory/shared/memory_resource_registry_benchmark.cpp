@@ -0,0 +1,168 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/memory_resource_registry.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfResources{32U};
+constexpr std::uintptr_t kFirstResourceAddress{0x10000000U};
+constexpr std::uintptr_t kResourceSize{0x10000U};
+constexpr int kMaxNumberOfThreads{64};
+
+class FakeMemoryResource : public ManagedMemoryResource
+{
+  public:
+    explicit FakeMemoryResource(const std::uintptr_t base_address) noexcept
+        : base_address_{reinterpret_cast<void*>(base_address)},
+          end_address_{reinterpret_cast<void*>(base_address + kResourceSize)}
+    {
+    }
+    MemoryResourceProxy* getMemoryResourceProxy() noexcept override
+    {
+        return nullptr;
+    }
+    void* getBaseAddress() const noexcept override
+    {
+        return base_address_;
+    }
+    void* getUsableBaseAddress() const noexcept override
+    {
+        return base_address_;
+    }
+    std::size_t GetUserAllocatedBytes() const noexcept override
+    {
+        return 0U;
+    }
+    bool IsOffsetPtrBoundsCheckBypassingEnabled() const noexcept override
+    {
+        return false;
+    }
+
+  private:
+    const void* getEndAddress() const noexcept override
+    {
+        return end_address_;
+    }
+    void* do_allocate(const std::size_t, std::size_t) override
+    {
+        return nullptr;
+    }
+    void do_deallocate(void*, const std::size_t, std::size_t) override {}
+    bool do_is_equal(const memory_resource&) const noexcept override
+    {
+        return false;
+    }
+
+    void* const base_address_;
+    void* const end_address_;
+};
+
+MemoryResourceRegistry::MemoryResourceIdentifier GetIdentifier(const std::size_t resource_index)
+{
+    return static_cast<MemoryResourceRegistry::MemoryResourceIdentifier>(resource_index) + 1U;
+}
+
+/// Registers kNumberOfResources resources, which all threads look up by their identifier.
+class MemoryResourceRegistryFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            for (std::size_t i = 0U; i < kNumberOfResources; ++i)
+            {
+                resources_.push_back(std::make_unique<FakeMemoryResource>(kFirstResourceAddress + (i * kResourceSize)));
+                MemoryResourceRegistry::getInstance().insert_resource({GetIdentifier(i), resources_.back().get()});
+            }
+        }
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            MemoryResourceRegistry::getInstance().clear();
+            resources_.clear();
+        }
+    }
+
+  protected:
+    std::vector<std::unique_ptr<FakeMemoryResource>> resources_{};
+};
+
+BENCHMARK_DEFINE_F(MemoryResourceRegistryFixture, GetBoundsFromIdentifier)(benchmark::State& state)
+{
+    const auto& registry = MemoryResourceRegistry::getInstance();
+    std::size_t resource_index{static_cast<std::size_t>(state.thread_index())};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(registry.GetBoundsFromIdentifier(GetIdentifier(resource_index)));
+        resource_index = (resource_index + 1U) % kNumberOfResources;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(MemoryResourceRegistryFixture, GetBoundsFromIdentifier)
+    ->ThreadRange(1, kMaxNumberOfThreads)
+    ->UseRealTime();
+
+// Reference for the previous read path, which took a std::shared_timed_mutex in shared mode for every lookup
+class SharedTimedMutexRegistryFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            for (std::size_t i = 0U; i < kNumberOfResources; ++i)
+            {
+                const auto start_address = kFirstResourceAddress + (i * kResourceSize);
+                registry_[GetIdentifier(i)] = MemoryRegionBounds{start_address, start_address + kResourceSize};
+            }
+        }
+    }
+
+  protected:
+    mutable std::shared_timed_mutex mutex_{};
+    std::unordered_map<MemoryResourceRegistry::MemoryResourceIdentifier, MemoryRegionBounds> registry_{};
+};
+
+BENCHMARK_DEFINE_F(SharedTimedMutexRegistryFixture, GetBoundsFromIdentifier)(benchmark::State& state)
+{
+    std::size_t resource_index{static_cast<std::size_t>(state.thread_index())};
+    for (auto _ : state)
+    {
+        std::shared_lock<std::shared_timed_mutex> lock{mutex_};
+        benchmark::DoNotOptimize(registry_.find(GetIdentifier(resource_index))->second);
+        resource_index = (resource_index + 1U) % kNumberOfResources;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(SharedTimedMutexRegistryFixture, GetBoundsFromIdentifier)
+    ->ThreadRange(1, kMaxNumberOfThreads)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace score::memory::shared
@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <cstdint>
 #include <thread>
 #include <utility>
@@ -412,6 +413,68 @@ TEST_F(MemoryResourceRegistryMemoryBoundsTest, ReturnsErrorForInvalidIdentifier)
               SharedMemoryErrorCode::UnknownSharedMemoryIdentifier);
 }
 
+TEST_F(MemoryResourceRegistryMemoryBoundsTest, ReturnsNoMemoryBoundsFromIdentifierAfterResourceWasRemoved)
+{
+    // Given 2 memory ranges are inserted into the registry
+    InsertMemoryResourcesIntoRegistry();
+
+    // When removing the first one
+    unit.remove_resource(memory_resource_id0_);
+
+    // Then its identifier is unknown
+    const auto first_result = unit.GetBoundsFromIdentifier(memory_resource_id0_);
+    ASSERT_FALSE(first_result.has_value());
+    EXPECT_EQ(first_result.error(), SharedMemoryErrorCode::UnknownSharedMemoryIdentifier);
+
+    // and the second one is still found
+    const auto second_result = unit.GetBoundsFromIdentifier(memory_resource_id1_);
+    ASSERT_TRUE(second_result.has_value());
+    EXPECT_EQ(second_result.value(), secondMemoryBounds);
+}
+
+TEST_F(MemoryResourceRegistryMemoryBoundsTest, LookupsByIdentifierAreConsistentWhileResourcesAreModified)
+{
+    // Given one resource that stays registered
+    EXPECT_TRUE(unit.insert_resource({memory_resource_id0_, &resource_}));
+
+    // When readers look up both identifiers while another resource is repeatedly inserted and removed
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint32_t> inconsistent_lookups{0U};
+    std::vector<std::thread> readers{};
+    for (std::uint32_t i = 0U; i < 4U; ++i)
+    {
+        readers.emplace_back([this, &stop, &inconsistent_lookups]() {
+            while (!stop)
+            {
+                const auto first_result = unit.GetBoundsFromIdentifier(memory_resource_id0_);
+                if (!first_result.has_value() || (first_result.value() != firstMemoryBounds) ||
+                    (unit.at(memory_resource_id0_) != &resource_))
+                {
+                    inconsistent_lookups++;
+                }
+                const auto second_result = unit.GetBoundsFromIdentifier(memory_resource_id1_);
+                if (second_result.has_value() && (second_result.value() != secondMemoryBounds))
+                {
+                    inconsistent_lookups++;
+                }
+            }
+        });
+    }
+    for (std::uint32_t i = 0U; i < 1000U; ++i)
+    {
+        EXPECT_TRUE(unit.insert_resource({memory_resource_id1_, &resource2_}));
+        unit.remove_resource(memory_resource_id1_);
+    }
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    // Then the readers either found the correct bounds or no bounds of the removed resource
+    EXPECT_EQ(inconsistent_lookups, 0U);
+}
+
 using MemoryResourceRegistryOverlappingMemoryBoundsTest = MemoryResourceRegistryTest;
 TEST_F(MemoryResourceRegistryOverlappingMemoryBoundsTest, CannotInsertResourcesWithOverlappingMemoryBounds)
 {
@@ -0,0 +1,242 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_MPMC_QUEUE_H
+#define SCORE_LIB_MEMORY_SHARED_MPMC_QUEUE_H
+
+#include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
+#include "score/memory/shared/queue_waiter.h"
+#include "score/memory/shared/vector.h"
+
+#include <score/assert.hpp>
+#include <score/stop_token.hpp>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace score::memory::shared
+{
+
+/// \brief Bounded lock-free queue for any number of producers and consumers, which can be placed in shared memory.
+///
+/// \details Placement and element requirements are the same as for SpscQueue.
+///
+/// The algorithm is the bounded MPMC queue of Dmitry Vyukov: Every slot carries a sequence number, which tells whether
+/// the slot is free for the producer or filled for the consumer of a given position. Producers and consumers claim a
+/// position with a single compare-and-swap on their index and then only access their slot. So operations of different
+/// producers (or consumers) only collide on the index, never on the data.
+///
+/// TryPush() and TryPop() are lock-free. Push() and Pop() spin shortly and then block on a QueueWaiter until the
+/// operation succeeds.
+///
+/// \tparam T Element type. It is copied bytewise between processes and thus has to be trivially copyable.
+template <typename T>
+class MpmcQueue final
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are copied between processes bytewise");
+    static_assert(std::is_default_constructible_v<T>, "Slots are default constructed upfront");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Indices must be lock-free to be shared");
+
+  public:
+    using allocator_type = PolymorphicOffsetPtrAllocator<T>;
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// \brief Constructs an empty queue.
+    /// \param capacity Maximum number of elements in the queue. Must be a power of two and at least two.
+    /// \param allocator Allocator for the slots, which has to allocate from the memory the queue is placed in.
+    MpmcQueue(const size_type capacity, const allocator_type& allocator)
+        : enqueue_position_{0U},
+          dequeue_position_{0U},
+          cells_(capacity, allocator),
+          index_mask_{static_cast<std::uint64_t>(capacity) - 1U},
+          not_empty_waiter_{},
+          not_full_waiter_{}
+    {
+        // With a single cell, the sequence numbers of "free for position n + 1" and "filled at position n" are equal.
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE((capacity >= 2U) && ((capacity & (capacity - 1U)) == 0U),
+                                                          "Capacity must be a power of two and at least two");
+        for (std::uint64_t position = 0U; position <= index_mask_; ++position)
+        {
+            cells_[static_cast<size_type>(position)].sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpmcQueue() noexcept = default;
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) & = delete;
+    MpmcQueue(MpmcQueue&&) noexcept = delete;
+    MpmcQueue& operator=(MpmcQueue&&) & noexcept = delete;
+
+    /// \brief Appends a copy of value, if the queue is not full.
+    /// \return true if the value was appended, false if the queue was full.
+    bool TryPush(const T& value) noexcept
+    {
+        if (!TryPushWithoutNotification(value))
+        {
+            return false;
+        }
+        not_empty_waiter_.NotifyAll();
+        return true;
+    }
+
+    /// \brief Removes the oldest element, if the queue is not empty.
+    /// \return The removed element or an empty optional if the queue was empty.
+    std::optional<T> TryPop() noexcept
+    {
+        auto value = TryPopWithoutNotification();
+        if (value.has_value())
+        {
+            not_full_waiter_.NotifyAll();
+        }
+        return value;
+    }
+
+    /// \brief Appends a copy of value and blocks while the queue is full.
+    /// \return true if the value was appended, false if a stop was requested on the token before.
+    bool Push(const T& value, const score::cpp::stop_token& token) noexcept
+    {
+        for (std::uint32_t attempt = 0U; attempt < detail::kQueueSpinIterationsBeforeWaiting; ++attempt)
+        {
+            if (TryPush(value))
+            {
+                return true;
+            }
+        }
+        const bool pushed = not_full_waiter_.Wait(token, [this, &value]() noexcept {
+            return TryPushWithoutNotification(value);
+        });
+        if (pushed)
+        {
+            not_empty_waiter_.NotifyAll();
+        }
+        return pushed;
+    }
+
+    /// \brief Removes the oldest element and blocks while the queue is empty.
+    /// \return The removed element or an empty optional if a stop was requested on the token before.
+    std::optional<T> Pop(const score::cpp::stop_token& token) noexcept
+    {
+        for (std::uint32_t attempt = 0U; attempt < detail::kQueueSpinIterationsBeforeWaiting; ++attempt)
+        {
+            auto value = TryPop();
+            if (value.has_value())
+            {
+                return value;
+            }
+        }
+        std::optional<T> value{};
+        score::cpp::ignore = not_empty_waiter_.Wait(token, [this, &value]() noexcept {
+            value = TryPopWithoutNotification();
+            return value.has_value();
+        });
+        if (value.has_value())
+        {
+            not_full_waiter_.NotifyAll();
+        }
+        return value;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return cells_.size();
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<std::uint64_t> sequence;
+        T value;
+    };
+
+    // The difference of unwrapped positions, interpreted as signed value, tells which of them is ahead.
+    static std::int64_t Distance(const std::uint64_t from, const std::uint64_t to) noexcept
+    {
+        return static_cast<std::int64_t>(to - from);
+    }
+
+    bool TryPushWithoutNotification(const T& value) noexcept
+    {
+        auto position = enqueue_position_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& cell = cells_[static_cast<size_type>(position & index_mask_)];
+            const auto distance = Distance(position, cell.sequence.load(std::memory_order_acquire));
+            if (distance == 0)
+            {
+                // The cell is free for this position, try to claim it.
+                if (enqueue_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                {
+                    cell.value = value;
+                    cell.sequence.store(position + 1U, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (distance < 0)
+            {
+                // The cell still holds the element of the previous round, which was not consumed yet.
+                return false;
+            }
+            else
+            {
+                // Another producer claimed the position in the meantime.
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::optional<T> TryPopWithoutNotification() noexcept
+    {
+        auto position = dequeue_position_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& cell = cells_[static_cast<size_type>(position & index_mask_)];
+            const auto distance = Distance(position + 1U, cell.sequence.load(std::memory_order_acquire));
+            if (distance == 0)
+            {
+                // The cell is filled for this position, try to claim it.
+                if (dequeue_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                {
+                    const T value = cell.value;
+                    cell.sequence.store(position + index_mask_ + 1U, std::memory_order_release);
+                    return value;
+                }
+            }
+            else if (distance < 0)
+            {
+                // The cell was not filled yet.
+                return {};
+            }
+            else
+            {
+                // Another consumer claimed the position in the meantime.
+                position = dequeue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    alignas(detail::kQueueCacheLineSize) std::atomic<std::uint64_t> enqueue_position_;
+    alignas(detail::kQueueCacheLineSize) std::atomic<std::uint64_t> dequeue_position_;
+    alignas(detail::kQueueCacheLineSize) Vector<Cell> cells_;
+    std::uint64_t index_mask_;
+    detail::QueueWaiter not_empty_waiter_;
+    detail::QueueWaiter not_full_waiter_;
+};
+
+}  // namespace score::memory::shared
+
+#endif  // SCORE_LIB_MEMORY_SHARED_MPMC_QUEUE_H
@@ -0,0 +1,138 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/mpmc_queue.h"
+
+#include <score/assert_support.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+using Queue = MpmcQueue<std::uint64_t>;
+
+// Without a memory resource, the allocator falls back to the heap, which is sufficient for a single process.
+const Queue::allocator_type kHeapAllocator{};
+
+TEST(MpmcQueueTest, ElementsArePoppedInPushOrderAcrossWrapArounds)
+{
+    // Given an empty queue with a small capacity
+    Queue unit{4U, kHeapAllocator};
+    EXPECT_FALSE(unit.TryPop().has_value());
+
+    // When pushing and popping many more elements than the capacity
+    std::uint64_t next_to_push{0U};
+    std::uint64_t next_to_pop{0U};
+    while (next_to_pop < 100U)
+    {
+        while (unit.TryPush(next_to_push))
+        {
+            ++next_to_push;
+        }
+        ASSERT_EQ(next_to_push - next_to_pop, unit.capacity());
+
+        // Then the elements are popped in the order they were pushed
+        for (std::uint32_t i = 0U; i < 3U; ++i)
+        {
+            const auto value = unit.TryPop();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_EQ(value.value(), next_to_pop);
+            ++next_to_pop;
+        }
+    }
+}
+
+TEST(MpmcQueueTest, CapacityMustBeAPowerOfTwoAndAtLeastTwo)
+{
+    // When constructing a queue with an invalid capacity
+    // Then the program terminates
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(Queue(1U, kHeapAllocator));
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(Queue(6U, kHeapAllocator));
+}
+
+TEST(MpmcQueueTest, PopReturnsNothingWhenStopIsRequested)
+{
+    // Given an empty queue and a consumer which blocks in Pop()
+    Queue unit{4U, kHeapAllocator};
+    score::cpp::stop_source stop_source{};
+    std::thread consumer{[&unit, &stop_source]() {
+        // Then Pop() returns without an element
+        EXPECT_FALSE(unit.Pop(stop_source.get_token()).has_value());
+    }};
+
+    // When a stop is requested
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    stop_source.request_stop();
+    consumer.join();
+}
+
+TEST(MpmcQueueTest, ManyProducersAndConsumersTransferEveryElementExactlyOnce)
+{
+    // Given several producers which push distinct elements into a small queue
+    constexpr std::uint64_t kElementsPerProducer{20000U};
+    constexpr std::size_t kNumberOfProducers{4U};
+    constexpr std::size_t kNumberOfConsumers{4U};
+    constexpr std::uint64_t kNumberOfElements{kElementsPerProducer * kNumberOfProducers};
+    Queue unit{16U, kHeapAllocator};
+    std::array<std::thread, kNumberOfProducers> producers{};
+    for (std::size_t producer_index = 0U; producer_index < kNumberOfProducers; ++producer_index)
+    {
+        producers.at(producer_index) = std::thread{[&unit, producer_index]() {
+            for (std::uint64_t i = 0U; i < kElementsPerProducer; ++i)
+            {
+                ASSERT_TRUE(unit.Push((producer_index * kElementsPerProducer) + i, score::cpp::stop_token{}));
+            }
+        }};
+    }
+
+    // When several consumers pop concurrently until all elements were received
+    std::vector<std::atomic<std::uint32_t>> times_received(kNumberOfElements);
+    std::array<std::thread, kNumberOfConsumers> consumers{};
+    for (auto& consumer : consumers)
+    {
+        consumer = std::thread{[&unit, &times_received]() {
+            for (std::uint64_t i = 0U; i < (kNumberOfElements / kNumberOfConsumers); ++i)
+            {
+                const auto value = unit.Pop(score::cpp::stop_token{});
+                ASSERT_TRUE(value.has_value());
+                times_received.at(value.value())++;
+            }
+        }};
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    // Then every element was received exactly once
+    for (const auto& received : times_received)
+    {
+        ASSERT_EQ(received, 1U);
+    }
+}
+
+}  // namespace
+}  // namespace score::memory::shared
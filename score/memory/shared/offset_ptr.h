@@ -24,6 +24,7 @@
 #include <score/assert.hpp>
 #include <score/blank.hpp>
 #include <score/overload.hpp>
+#include <score/span.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -238,6 +239,13 @@ class OffsetPtr
         return GetPointerWithBoundsCheck(this, offset_, memory_bounds_, explicit_pointed_type_size);
     }
 
+    /// \brief Returns a span of count consecutive objects, starting at the pointed-to object.
+    /// \details The bounds check is done once for the whole span, so the returned span can be iterated without the
+    ///          overhead of a bounds check per element. The span is only valid as long as the memory region, in which
+    ///          the objects reside, is mapped.
+    template <class T = PointedType, class = detail_offset_ptr::enable_if_type_is_not_void<T, PointedType>>
+    score::cpp::span<PointedType> GetCheckedSpan(const std::size_t count) const;
+
     template <class T = PointedType, class = detail_offset_ptr::enable_if_type_is_not_void<T, PointedType>>
     // Suppress "AUTOSAR C++14 A13-5-2" rule finding:  All user-defined conversion operators shall be defined explicit.
     // Rationale: Using an offset pointer in a basic_string requires this conversion operator to be implicit.
@@ -621,6 +629,27 @@ auto OffsetPtr<PointedType>::operator*() const -> reference
     return ref;
 }
 
+// Enabled if PointedType is not void
+template <typename PointedType>
+template <class T, class>
+auto OffsetPtr<PointedType>::GetCheckedSpan(const std::size_t count) const -> score::cpp::span<PointedType>
+{
+    // Copy the offset once, since it can be changed by another process while we are checking it.
+    const auto offset = offset_;
+    if (offset == detail_offset_ptr::kNullPtrRepresentation)
+    {
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(count == 0U, "Cannot create a non-empty span from a nullptr.");
+        return {};
+    }
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
+        count <= (std::numeric_limits<std::size_t>::max() / sizeof(PointedType)),
+        "Calculating number of bytes of span would overflow std::size_t");
+
+    // NOLINTNEXTLINE(score-banned-function) See justification above class.
+    const pointer ptr = GetPointerWithBoundsCheck(this, offset, memory_bounds_, count * sizeof(PointedType));
+    return score::cpp::span<PointedType>{ptr, count};
+}
+
 template <typename PointedType>
 auto OffsetPtr<PointedType>::operator[](difference_type idx) const -> reference
 {
@@ -0,0 +1,39 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/queue_waiter.h"
+
+namespace score::memory::shared::detail
+{
+
+// The waiter is placed in shared memory and used by several processes, so it must not need a per-process state.
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Waiter count must be lock-free to be shared");
+
+QueueWaiter::QueueWaiter() noexcept : mutex_{}, condition_variable_{}, number_of_waiters_{0U} {}
+
+void QueueWaiter::NotifyAll() noexcept
+{
+    // Pairs with the fence in Wait(), see there.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (number_of_waiters_.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+    // A waiter holds the mutex from evaluating its operation until it blocks on the condition variable. Taking the
+    // mutex once ensures that the notification cannot fall in between.
+    {
+        const std::lock_guard<os::InterprocessMutex> lock{mutex_};
+    }
+    condition_variable_.notify_all();
+}
+
+}  // namespace score::memory::shared::detail
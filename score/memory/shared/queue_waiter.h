@@ -0,0 +1,86 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_QUEUE_WAITER_H
+#define SCORE_LIB_MEMORY_SHARED_QUEUE_WAITER_H
+
+#include "score/concurrency/interruptible_interprocess_condition_variable.h"
+#include "score/os/utils/interprocess/interprocess_mutex.h"
+
+#include <score/stop_token.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace score::memory::shared::detail
+{
+
+/// \brief Size used to separate the indices of the queue producers and consumers onto different cache lines.
+constexpr std::size_t kQueueCacheLineSize{64UL};
+
+/// \brief Number of failed attempts after which a blocking queue operation stops spinning and starts to wait.
+constexpr std::uint32_t kQueueSpinIterationsBeforeWaiting{128U};
+
+/// \brief Blocking fallback for the lock-free queues, which can be placed in shared memory.
+///
+/// \details Uses the same interprocess mutex and interruptible condition variable as
+/// score::os::InterprocessNotification. The one-shot notification itself does not fit, since a reset() by one of
+/// several waiters can swallow the notification for another one. Instead, the waiting condition is re-evaluated under
+/// the mutex.
+///
+/// Notifying is a single atomic load as long as nobody waits, so the lock-free fast path of the queues is not slowed
+/// down by the fallback.
+class QueueWaiter final
+{
+  public:
+    QueueWaiter() noexcept;
+    ~QueueWaiter() noexcept = default;
+
+    QueueWaiter(const QueueWaiter&) = delete;
+    QueueWaiter& operator=(const QueueWaiter&) & = delete;
+    QueueWaiter(QueueWaiter&&) noexcept = delete;
+    QueueWaiter& operator=(QueueWaiter&&) & noexcept = delete;
+
+    /// \brief Blocks until try_operation() returns true or a stop is requested on the token.
+    /// \details try_operation is called under a mutex which is shared by all waiters of this QueueWaiter, but not by
+    /// the threads that notify it. So it must not notify any QueueWaiter itself.
+    /// \return true if try_operation() succeeded, false if the wait was stopped before.
+    template <typename TryOperation>
+    bool Wait(const score::cpp::stop_token& token, TryOperation try_operation)
+    {
+        number_of_waiters_.fetch_add(1U);
+        // Pairs with the fence in NotifyAll(): Either the notifier sees this waiter or this waiter sees the state
+        // change which was done before the notification.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool succeeded{false};
+        {
+            std::unique_lock<os::InterprocessMutex> lock{mutex_};
+            succeeded = condition_variable_.wait(lock, token, try_operation);
+        }
+        number_of_waiters_.fetch_sub(1U);
+        return succeeded;
+    }
+
+    /// \brief Wakes up all threads of all processes which are blocked in Wait().
+    void NotifyAll() noexcept;
+
+  private:
+    os::InterprocessMutex mutex_;
+    concurrency::InterruptibleInterprocessConditionalVariable condition_variable_;
+    std::atomic<std::uint32_t> number_of_waiters_;
+};
+
+}  // namespace score::memory::shared::detail
+
+#endif  // SCORE_LIB_MEMORY_SHARED_QUEUE_WAITER_H
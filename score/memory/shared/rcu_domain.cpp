@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/rcu_domain.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace score::memory::shared::detail
+{
+
+namespace
+{
+
+// Suppress "AUTOSAR C++14 A3-3-2" rule finding. This rule states: "Static and thread-local objects shall be
+// constant-initialized.".
+// Both objects are constant-initialized, the finding is a false positive.
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+std::atomic<std::size_t> next_reader_slot_index{0U};
+// Index of the reader slot of the calling thread plus one, zero if no slot has been assigned yet. The slot index is
+// shared by all RcuDomains, so no per-domain state has to be cleaned up on thread exit.
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local std::size_t reader_slot_index_plus_one{0U};
+
+std::size_t GetReaderSlotIndex() noexcept
+{
+    if (reader_slot_index_plus_one == 0U)
+    {
+        const auto slot_index = next_reader_slot_index.fetch_add(1U, std::memory_order_relaxed);
+        reader_slot_index_plus_one = (slot_index % RcuDomain::kNumberOfReaderSlots) + 1U;
+    }
+    return reader_slot_index_plus_one - 1U;
+}
+
+}  // namespace
+
+RcuDomain::ReadSection::ReadSection(const RcuDomain& domain) noexcept : reader_counter_{domain.EnterReadSection()} {}
+
+RcuDomain::ReadSection::~ReadSection() noexcept
+{
+    // Release: All reads of published data within the ReadSection happen before a writer that observes the decrement
+    // reclaims the data.
+    reader_counter_.fetch_sub(1U, std::memory_order_release);
+}
+
+RcuDomain::RcuDomain() noexcept : reader_slots_{}, current_phase_{0U}, synchronize_mutex_{}
+{
+    for (auto& reader_slot : reader_slots_)
+    {
+        for (auto& reader_counter : reader_slot.reader_counters)
+        {
+            reader_counter.store(0U, std::memory_order_relaxed);
+        }
+    }
+}
+
+auto RcuDomain::EnterReadSection() const noexcept -> std::atomic<std::uint32_t>&
+{
+    auto& reader_slot = reader_slots_.at(GetReaderSlotIndex());
+    const auto phase = current_phase_.load(std::memory_order_seq_cst);
+    auto& reader_counter = reader_slot.reader_counters.at(phase);
+    // Sequentially consistent, so the increment is ordered before all loads of published data in the ReadSection. A
+    // writer that does not see the increment published its data before, so the reader sees the new data.
+    reader_counter.fetch_add(1U, std::memory_order_seq_cst);
+    return reader_counter;
+}
+
+void RcuDomain::Synchronize() noexcept
+{
+    std::lock_guard<std::mutex> lock{synchronize_mutex_};
+    for (std::uint32_t flip = 0U; flip < 2U; ++flip)
+    {
+        const auto old_phase = current_phase_.load(std::memory_order_relaxed);
+        current_phase_.store(old_phase ^ 1U, std::memory_order_seq_cst);
+        WaitForReadersOfPhase(old_phase);
+    }
+}
+
+void RcuDomain::WaitForReadersOfPhase(const std::uint32_t phase) const noexcept
+{
+    for (const auto& reader_slot : reader_slots_)
+    {
+        // Readers which enter after the phase flip use the other counter, so the counter is only decreasing apart from
+        // readers which loaded the phase right before the flip.
+        while (reader_slot.reader_counters.at(phase).load(std::memory_order_seq_cst) != 0U)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+}  // namespace score::memory::shared::detail
@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_RCU_DOMAIN_H
+#define SCORE_LIB_MEMORY_SHARED_RCU_DOMAIN_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace score::memory::shared::detail
+{
+
+/// \brief Size used to separate reader counters of different threads onto different cache lines.
+constexpr std::size_t kRcuDomainCacheLineSize{64UL};
+
+/// \brief Read-copy-update synchronization between many readers and rare writers.
+///
+/// \details Readers enclose their accesses to published data in a ReadSection. A writer publishes a new version of the
+/// data (e.g. by exchanging an atomic pointer) and calls Synchronize() before it reclaims the old version.
+/// Synchronize() returns once all ReadSections that could still see the old version have been left.
+///
+/// Entering and leaving a ReadSection is wait-free: It increments and decrements a counter, which is only shared with
+/// the few threads that are mapped to the same reader slot. Threads are assigned to slots round-robin, so up to
+/// kNumberOfReaderSlots threads never share a cache line. The counters are split into two phases. Synchronize() flips
+/// the phase and waits for the counters of the old phase to drain. It flips twice, since a reader may have loaded the
+/// phase right before a flip and increment the counter of the phase that is current again after the first flip.
+///
+/// All memory accesses that publish data and enter ReadSections have to be sequentially consistent.
+class RcuDomain final
+{
+  public:
+    static constexpr std::size_t kNumberOfReaderSlots{128U};
+
+    /// \brief Scope in which a reader may access published data. Must not outlive the RcuDomain.
+    class ReadSection final
+    {
+      public:
+        explicit ReadSection(const RcuDomain& domain) noexcept;
+        ~ReadSection() noexcept;
+
+        ReadSection(const ReadSection&) = delete;
+        ReadSection& operator=(const ReadSection&) & = delete;
+        ReadSection(ReadSection&&) noexcept = delete;
+        ReadSection& operator=(ReadSection&&) & noexcept = delete;
+
+      private:
+        std::atomic<std::uint32_t>& reader_counter_;
+    };
+
+    RcuDomain() noexcept;
+    ~RcuDomain() noexcept = default;
+
+    RcuDomain(const RcuDomain&) = delete;
+    RcuDomain& operator=(const RcuDomain&) & = delete;
+    RcuDomain(RcuDomain&&) noexcept = delete;
+    RcuDomain& operator=(RcuDomain&&) & noexcept = delete;
+
+    /// \brief Blocks until all ReadSections that were entered before the call have been left.
+    /// \pre Must not be called from within a ReadSection of this domain.
+    void Synchronize() noexcept;
+
+  private:
+    struct alignas(kRcuDomainCacheLineSize) ReaderSlot
+    {
+        std::array<std::atomic<std::uint32_t>, 2U> reader_counters;
+    };
+
+    std::atomic<std::uint32_t>& EnterReadSection() const noexcept;
+    void WaitForReadersOfPhase(const std::uint32_t phase) const noexcept;
+
+    // The counters are modified by readers which only have const access to the domain.
+    mutable std::array<ReaderSlot, kNumberOfReaderSlots> reader_slots_;
+    std::atomic<std::uint32_t> current_phase_;
+    std::mutex synchronize_mutex_;
+};
+
+}  // namespace score::memory::shared::detail
+
+#endif  // SCORE_LIB_MEMORY_SHARED_RCU_DOMAIN_H
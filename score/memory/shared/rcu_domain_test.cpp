@@ -0,0 +1,138 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/rcu_domain.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score::memory::shared::detail
+{
+namespace
+{
+
+TEST(RcuDomainTest, SynchronizeReturnsWithoutReaders)
+{
+    // Given a domain without readers
+    RcuDomain unit{};
+
+    // When synchronizing
+    unit.Synchronize();
+
+    // Then the call returns
+}
+
+TEST(RcuDomainTest, SynchronizeReturnsAfterLeftReadSections)
+{
+    // Given a domain in which a ReadSection was entered and left
+    RcuDomain unit{};
+    {
+        const RcuDomain::ReadSection read_section{unit};
+    }
+
+    // When synchronizing
+    unit.Synchronize();
+
+    // Then the call returns
+}
+
+TEST(RcuDomainTest, SynchronizeWaitsForReadSectionThatWasEnteredBefore)
+{
+    // Given a reader which is within a ReadSection
+    RcuDomain unit{};
+    std::atomic<bool> reader_entered{false};
+    std::atomic<bool> reader_may_leave{false};
+    std::thread reader{[&unit, &reader_entered, &reader_may_leave]() {
+        const RcuDomain::ReadSection read_section{unit};
+        reader_entered = true;
+        while (!reader_may_leave)
+        {
+            std::this_thread::yield();
+        }
+    }};
+    while (!reader_entered)
+    {
+        std::this_thread::yield();
+    }
+
+    // When synchronizing
+    std::atomic<bool> synchronize_returned{false};
+    std::thread writer{[&unit, &synchronize_returned]() {
+        unit.Synchronize();
+        synchronize_returned = true;
+    }};
+
+    // Then the call does not return while the reader is within the ReadSection
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(synchronize_returned);
+
+    // and returns once the reader left it
+    reader_may_leave = true;
+    reader.join();
+    writer.join();
+    EXPECT_TRUE(synchronize_returned);
+}
+
+TEST(RcuDomainTest, ReadersNeverSeeReclaimedData)
+{
+    // Given data which is published via an atomic pointer and marked as reclaimed after Synchronize()
+    struct Data
+    {
+        std::atomic<bool> reclaimed{false};
+    };
+    constexpr std::size_t kNumberOfVersions{1000U};
+    std::vector<Data> versions(kNumberOfVersions);
+    RcuDomain unit{};
+    std::atomic<Data*> published{&versions.front()};
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint32_t> reclaimed_data_seen{0U};
+
+    // When readers access the data concurrently to a writer which republishes it
+    std::array<std::thread, 4U> readers{};
+    for (auto& reader : readers)
+    {
+        reader = std::thread{[&unit, &published, &stop, &reclaimed_data_seen]() {
+            while (!stop)
+            {
+                const RcuDomain::ReadSection read_section{unit};
+                const auto* const data = published.load();
+                if (data->reclaimed)
+                {
+                    reclaimed_data_seen++;
+                }
+            }
+        }};
+    }
+    for (std::size_t version = 1U; version < kNumberOfVersions; ++version)
+    {
+        auto* const old_data = published.exchange(&versions.at(version));
+        unit.Synchronize();
+        old_data->reclaimed = true;
+    }
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    // Then no reader saw reclaimed data
+    EXPECT_EQ(reclaimed_data_seen, 0U);
+}
+
+}  // namespace
+}  // namespace score::memory::shared::detail
@@ -0,0 +1,84 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/resource_identifier_table.h"
+
+#include <score/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace score::memory::shared::detail
+{
+
+namespace
+{
+
+constexpr std::size_t kMinimumNumberOfSlots{8U};
+// 2^64 divided by the golden ratio, used to spread identifiers over the table (Fibonacci hashing).
+constexpr std::uint64_t kFibonacciHashMultiplier{0x9E3779B97F4A7C15U};
+
+std::size_t GetNumberOfSlots(const std::size_t number_of_resources) noexcept
+{
+    std::size_t number_of_slots{kMinimumNumberOfSlots};
+    while (number_of_slots < (2U * number_of_resources))
+    {
+        number_of_slots *= 2U;
+    }
+    return number_of_slots;
+}
+
+}  // namespace
+
+ResourceIdentifierTable::ResourceIdentifierTable(
+    const std::unordered_map<MemoryResourceIdentifier, RegisteredResource>& registered_resources)
+    : slots_(GetNumberOfSlots(registered_resources.size()), Slot{0U, RegisteredResource{nullptr, {}}}),
+      slot_index_mask_{slots_.size() - 1U}
+{
+    for (const auto& registered_resource : registered_resources)
+    {
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(registered_resource.second.resource != nullptr,
+                                                    "Registered resource must not be a nullptr");
+        auto slot_index = GetHomeSlotIndex(registered_resource.first);
+        while (slots_[slot_index].registered_resource.resource != nullptr)
+        {
+            slot_index = (slot_index + 1U) & slot_index_mask_;
+        }
+        slots_[slot_index] = Slot{registered_resource.first, registered_resource.second};
+    }
+}
+
+auto ResourceIdentifierTable::Find(const MemoryResourceIdentifier identifier) const noexcept
+    -> const RegisteredResource*
+{
+    // The table is never full, so the probing always terminates at an empty slot.
+    auto slot_index = GetHomeSlotIndex(identifier);
+    while (slots_[slot_index].registered_resource.resource != nullptr)
+    {
+        if (slots_[slot_index].identifier == identifier)
+        {
+            return &slots_[slot_index].registered_resource;
+        }
+        slot_index = (slot_index + 1U) & slot_index_mask_;
+    }
+    return nullptr;
+}
+
+auto ResourceIdentifierTable::GetHomeSlotIndex(const MemoryResourceIdentifier identifier) const noexcept
+    -> std::size_t
+{
+    // The upper bits of the product are the best mixed ones, the table size is a power of two.
+    const std::uint64_t hash = identifier * kFibonacciHashMultiplier;
+    return static_cast<std::size_t>(hash >> 32U) & slot_index_mask_;
+}
+
+}  // namespace score::memory::shared::detail
@@ -0,0 +1,77 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_RESOURCE_IDENTIFIER_TABLE_H
+#define SCORE_LIB_MEMORY_SHARED_RESOURCE_IDENTIFIER_TABLE_H
+
+#include "score/memory/shared/memory_region_bounds.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace score::memory::shared
+{
+
+class ManagedMemoryResource;
+
+namespace detail
+{
+
+/// \brief A registered memory resource together with the bounds it had on registration.
+struct RegisteredResource
+{
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+    // be private.".
+    // Rationale: Plain data without class invariants.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    ManagedMemoryResource* resource;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    MemoryRegionBounds bounds;
+};
+
+/// \brief Immutable hash table from memory resource identifiers to registered resources.
+///
+/// \details The table is built once from all registered resources and never modified afterwards, so any number of
+/// threads may look up identifiers without synchronization. It uses open addressing with linear probing in a single
+/// contiguous array, which is at most half full, so a lookup usually touches a single cache line.
+class ResourceIdentifierTable final
+{
+  public:
+    using MemoryResourceIdentifier = std::uint64_t;
+
+    /// \pre No resource in registered_resources is a nullptr.
+    explicit ResourceIdentifierTable(
+        const std::unordered_map<MemoryResourceIdentifier, RegisteredResource>& registered_resources);
+
+    /// \return the resource registered under the given identifier or nullptr, if there is none.
+    const RegisteredResource* Find(const MemoryResourceIdentifier identifier) const noexcept;
+
+  private:
+    struct Slot
+    {
+        MemoryResourceIdentifier identifier;
+        // A nullptr resource marks an empty slot.
+        RegisteredResource registered_resource;
+    };
+
+    std::size_t GetHomeSlotIndex(const MemoryResourceIdentifier identifier) const noexcept;
+
+    std::vector<Slot> slots_;
+    std::size_t slot_index_mask_;
+};
+
+}  // namespace detail
+}  // namespace score::memory::shared
+
+#endif  // SCORE_LIB_MEMORY_SHARED_RESOURCE_IDENTIFIER_TABLE_H
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/resource_identifier_table.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+
+namespace score::memory::shared::detail
+{
+namespace
+{
+
+using RegisteredResources = std::unordered_map<ResourceIdentifierTable::MemoryResourceIdentifier, RegisteredResource>;
+
+// The table never dereferences the resources, so any non-null address can be used.
+ManagedMemoryResource* GetFakeResource(const std::uintptr_t address)
+{
+    return reinterpret_cast<ManagedMemoryResource*>(address);
+}
+
+TEST(ResourceIdentifierTableTest, EmptyTableDoesNotFindAnyIdentifier)
+{
+    // Given a table that was built without any resources
+    const ResourceIdentifierTable unit{RegisteredResources{}};
+
+    // When looking up an identifier
+    // Then nothing is found
+    EXPECT_EQ(unit.Find(0U), nullptr);
+    EXPECT_EQ(unit.Find(42U), nullptr);
+}
+
+TEST(ResourceIdentifierTableTest, FindsRegisteredResourcesWithTheirBounds)
+{
+    // Given a table with two resources
+    const RegisteredResources registered_resources{
+        {10U, RegisteredResource{GetFakeResource(0x1000U), MemoryRegionBounds{0x1000U, 0x2000U}}},
+        {20U, RegisteredResource{GetFakeResource(0x3000U), MemoryRegionBounds{0x3000U, 0x5000U}}}};
+    const ResourceIdentifierTable unit{registered_resources};
+
+    // When looking up their identifiers
+    const auto* const first = unit.Find(10U);
+    const auto* const second = unit.Find(20U);
+
+    // Then the resources and bounds are returned
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->resource, GetFakeResource(0x1000U));
+    EXPECT_EQ(first->bounds, (MemoryRegionBounds{0x1000U, 0x2000U}));
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->resource, GetFakeResource(0x3000U));
+    EXPECT_EQ(second->bounds, (MemoryRegionBounds{0x3000U, 0x5000U}));
+
+    // and other identifiers are not found
+    EXPECT_EQ(unit.Find(30U), nullptr);
+}
+
+TEST(ResourceIdentifierTableTest, FindsAllOfManyRandomIdentifiers)
+{
+    // Given a table with many random identifiers, so that home slots collide
+    std::mt19937_64 generator{42U};
+    RegisteredResources registered_resources{};
+    for (std::uintptr_t i = 1U; i <= 1000U; ++i)
+    {
+        const RegisteredResource registered_resource{GetFakeResource(i), MemoryRegionBounds{i, i + 1U}};
+        registered_resources.insert({generator(), registered_resource});
+    }
+    const ResourceIdentifierTable unit{registered_resources};
+
+    // When looking up every identifier
+    // Then the resource registered under it is found
+    for (const auto& registered_resource : registered_resources)
+    {
+        const auto* const found = unit.Find(registered_resource.first);
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->resource, registered_resource.second.resource);
+    }
+
+    // and identifiers which were not registered are not found
+    for (std::uint32_t i = 0U; i < 1000U; ++i)
+    {
+        const auto identifier = generator();
+        if (registered_resources.count(identifier) == 0U)
+        {
+            EXPECT_EQ(unit.Find(identifier), nullptr);
+        }
+    }
+}
+
+}  // namespace
+}  // namespace score::memory::shared::detail
@@ -0,0 +1,344 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/segregated_fit_allocator.h"
+
+#include "score/memory/shared/pointer_arithmetic_util.h"
+
+#include <score/assert.hpp>
+#include <score/bit.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace score::memory::shared::detail
+{
+
+namespace
+{
+
+constexpr std::size_t kGranularity{alignof(std::max_align_t)};
+
+/// \brief Boundary tag in front of every block.
+class BlockHeader
+{
+  public:
+    static constexpr std::size_t kUsed{0x1U};
+    static constexpr std::size_t kPreviousUsed{0x2U};
+    static constexpr std::size_t kFlags{kUsed | kPreviousUsed};
+
+    std::size_t GetSize() const noexcept
+    {
+        return size_and_flags & ~kFlags;
+    }
+
+    bool IsUsed() const noexcept
+    {
+        return (size_and_flags & kUsed) != 0U;
+    }
+
+    bool IsPreviousUsed() const noexcept
+    {
+        return (size_and_flags & kPreviousUsed) != 0U;
+    }
+
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+    // be private.".
+    // Rationale: Plain boundary tag without class invariants.
+    // Size of the preceding block, only valid if that block is free.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t previous_size;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t size_and_flags;
+};
+
+/// \brief Links of a free block within its bin, stored behind its BlockHeader.
+class FreeLinks
+{
+  public:
+    // coverity[autosar_cpp14_m11_0_1_violation] see BlockHeader
+    std::size_t next;
+    // coverity[autosar_cpp14_m11_0_1_violation] see BlockHeader
+    std::size_t previous;
+};
+
+static_assert(sizeof(BlockHeader) % kGranularity == 0U, "Payload behind the header must be worst case aligned");
+static_assert(SegregatedFitAllocator::kNumberOfBins <= 32U, "Every bin needs a bit in State::non_empty_bins");
+
+constexpr std::size_t kMinimumBlockSize{CalculateAlignedSize(sizeof(BlockHeader) + sizeof(FreeLinks), kGranularity)};
+static_assert(kMinimumBlockSize >= (2U * kGranularity), "Size classes start with two units of kGranularity");
+
+BlockHeader& GetHeader(void* const base_address, const std::size_t offset) noexcept
+{
+    // Block headers are created by placement new at offsets within the arena before they are accessed.
+    return *static_cast<BlockHeader*>(AddOffsetToPointer(base_address, offset));
+}
+
+FreeLinks& GetFreeLinks(void* const base_address, const std::size_t offset) noexcept
+{
+    // The links of a free block are created by placement new directly behind its header, see InsertIntoBin().
+    return *static_cast<FreeLinks*>(AddOffsetToPointer(base_address, offset + sizeof(BlockHeader)));
+}
+
+}  // namespace
+
+SegregatedFitAllocator::State::State() noexcept : free_list_heads{}, non_empty_bins{0U}, free_bytes{0U} {}
+
+SegregatedFitAllocator::SegregatedFitAllocator(void* const base_address,
+                                               State& state,
+                                               std::atomic<std::size_t>& end_offset,
+                                               const std::size_t capacity) noexcept
+    : base_address_{base_address}, state_{state}, end_offset_{end_offset}, capacity_{capacity}
+{
+}
+
+auto SegregatedFitAllocator::GetBinIndex(const std::size_t block_size) noexcept -> std::size_t
+{
+    // Each power of two of the size in units of kGranularity is split into two bins by the bit behind the highest bit:
+    // [2, 3), [3, 4), [4, 6), [6, 8), [8, 12), ...
+    const auto units = std::max(block_size, kMinimumBlockSize) / kGranularity;
+    const auto highest_bit = static_cast<std::size_t>(std::numeric_limits<std::size_t>::digits - 1) -
+                             static_cast<std::size_t>(score::cpp::countl_zero(units));
+    const auto lowest_highest_bit = static_cast<std::size_t>(std::numeric_limits<std::size_t>::digits - 1) -
+                                    static_cast<std::size_t>(score::cpp::countl_zero(kMinimumBlockSize / kGranularity));
+    const auto second_highest_bit = (units >> (highest_bit - 1U)) & 1U;
+    const auto bin = (2U * (highest_bit - lowest_highest_bit)) + second_highest_bit;
+    return std::min(bin, kNumberOfBins - 1U);
+}
+
+auto SegregatedFitAllocator::Allocate(const std::size_t bytes, const std::size_t alignment) noexcept -> void*
+{
+    if ((bytes > capacity_) || (alignment > capacity_))
+    {
+        return nullptr;
+    }
+
+    const auto block_size =
+        std::max(CalculateAlignedSize(sizeof(BlockHeader) + bytes, kGranularity), kMinimumBlockSize);
+    // Over-aligned allocations need room to split off a leading free block.
+    const auto needs_padding = alignment > kGranularity;
+    const auto requested_size = needs_padding ? (block_size + alignment + kMinimumBlockSize) : block_size;
+
+    auto offset = TakeFreeBlock(requested_size);
+    if (offset == 0U)
+    {
+        offset = TakeBlockFromEnd(requested_size);
+        if (offset == 0U)
+        {
+            return nullptr;
+        }
+    }
+    if (needs_padding)
+    {
+        offset = SplitLeadingPadding(offset, alignment);
+    }
+    SplitTrailingRest(offset, block_size);
+    MarkUsed(offset);
+    return AddOffsetToPointer(base_address_, offset + sizeof(BlockHeader));
+}
+
+auto SegregatedFitAllocator::Deallocate(void* const memory) noexcept -> void
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+    auto offset = static_cast<std::size_t>(SubtractPointersBytes(memory, base_address_)) - sizeof(BlockHeader);
+    auto& header = GetHeader(base_address_, offset);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(header.IsUsed(), "Memory was not allocated or is already freed");
+    auto block_size = header.GetSize();
+
+    // Coalesce with the following block
+    const auto next_offset = offset + block_size;
+    if (next_offset != end_offset_.load(std::memory_order_relaxed))
+    {
+        const auto& next_header = GetHeader(base_address_, next_offset);
+        if (!next_header.IsUsed())
+        {
+            RemoveFromBin(next_offset);
+            block_size += next_header.GetSize();
+        }
+    }
+
+    // Coalesce with the preceding block
+    if (!header.IsPreviousUsed())
+    {
+        const auto previous_size = header.previous_size;
+        offset -= previous_size;
+        RemoveFromBin(offset);
+        block_size += previous_size;
+    }
+
+    ReleaseFreeBlock(offset, block_size);
+}
+
+auto SegregatedFitAllocator::TakeFreeBlock(const std::size_t block_size) noexcept -> std::size_t
+{
+    const auto bin = GetBinIndex(block_size);
+    // Blocks in large bins differ in size, so the fitting one has to be searched for. All blocks in later bins fit.
+    auto offset = state_.free_list_heads.at(bin);
+    while ((offset != 0U) && (GetHeader(base_address_, offset).GetSize() < block_size))
+    {
+        offset = GetFreeLinks(base_address_, offset).next;
+    }
+    if (offset == 0U)
+    {
+        const auto next_bin = FindNonEmptyBin(bin + 1U);
+        if (next_bin == kNumberOfBins)
+        {
+            return 0U;
+        }
+        offset = state_.free_list_heads.at(next_bin);
+    }
+    RemoveFromBin(offset);
+    return offset;
+}
+
+auto SegregatedFitAllocator::TakeBlockFromEnd(const std::size_t block_size) noexcept -> std::size_t
+{
+    const auto offset = end_offset_.load(std::memory_order_relaxed);
+    if (block_size > (capacity_ - offset))
+    {
+        return 0U;
+    }
+    // The block in front of the end offset is always in use, since free blocks that reach the end are given back.
+    // NOLINTNEXTLINE(score-no-dynamic-raw-memory): Placement new is used.
+    score::cpp::ignore = new (AddOffsetToPointer(base_address_, offset))
+        BlockHeader{0U, block_size | BlockHeader::kPreviousUsed};
+    end_offset_.store(offset + block_size, std::memory_order_relaxed);
+    return offset;
+}
+
+auto SegregatedFitAllocator::SplitLeadingPadding(const std::size_t offset, const std::size_t alignment) noexcept
+    -> std::size_t
+{
+    const auto payload_address = CastPointerToInteger(base_address_) + offset + sizeof(BlockHeader);
+    auto padding = CalculateAlignedSize(payload_address, alignment) - payload_address;
+    while ((padding != 0U) && (padding < kMinimumBlockSize))
+    {
+        padding += alignment;
+    }
+    if (padding == 0U)
+    {
+        return offset;
+    }
+
+    const auto block_size = GetHeader(base_address_, offset).GetSize();
+    const auto aligned_offset = offset + padding;
+    // NOLINTNEXTLINE(score-no-dynamic-raw-memory): Placement new is used.
+    score::cpp::ignore =
+        new (AddOffsetToPointer(base_address_, aligned_offset)) BlockHeader{padding, block_size - padding};
+    // The block in front of a taken block is always in use, so the padding cannot be coalesced any further.
+    ReleaseFreeBlock(offset, padding);
+    return aligned_offset;
+}
+
+auto SegregatedFitAllocator::SplitTrailingRest(const std::size_t offset, const std::size_t block_size) noexcept
+    -> void
+{
+    auto& header = GetHeader(base_address_, offset);
+    const auto rest_size = header.GetSize() - block_size;
+    if (rest_size < kMinimumBlockSize)
+    {
+        return;
+    }
+    header.size_and_flags = block_size | (header.size_and_flags & BlockHeader::kFlags);
+    // The block behind a taken block is in use or the end, so the rest cannot be coalesced any further.
+    ReleaseFreeBlock(offset + block_size, rest_size);
+}
+
+auto SegregatedFitAllocator::MarkUsed(const std::size_t offset) noexcept -> void
+{
+    auto& header = GetHeader(base_address_, offset);
+    header.size_and_flags |= BlockHeader::kUsed;
+    const auto next_offset = offset + header.GetSize();
+    if (next_offset != end_offset_.load(std::memory_order_relaxed))
+    {
+        GetHeader(base_address_, next_offset).size_and_flags |= BlockHeader::kPreviousUsed;
+    }
+}
+
+auto SegregatedFitAllocator::ReleaseFreeBlock(const std::size_t offset, const std::size_t block_size) noexcept -> void
+{
+    const auto next_offset = offset + block_size;
+    if (next_offset == end_offset_.load(std::memory_order_relaxed))
+    {
+        // Give back the end of the arena instead of keeping a free block there
+        end_offset_.store(offset, std::memory_order_relaxed);
+        return;
+    }
+
+    // Free blocks are coalesced immediately, so the block in front of a free block is always in use.
+    // NOLINTNEXTLINE(score-no-dynamic-raw-memory): Placement new is used.
+    score::cpp::ignore = new (AddOffsetToPointer(base_address_, offset))
+        BlockHeader{0U, block_size | BlockHeader::kPreviousUsed};
+    auto& next_header = GetHeader(base_address_, next_offset);
+    next_header.previous_size = block_size;
+    next_header.size_and_flags &= ~BlockHeader::kPreviousUsed;
+    InsertIntoBin(offset);
+}
+
+auto SegregatedFitAllocator::InsertIntoBin(const std::size_t offset) noexcept -> void
+{
+    const auto block_size = GetHeader(base_address_, offset).GetSize();
+    const auto bin = GetBinIndex(block_size);
+    auto& head = state_.free_list_heads.at(bin);
+    // NOLINTNEXTLINE(score-no-dynamic-raw-memory): Placement new is used.
+    score::cpp::ignore = new (AddOffsetToPointer(base_address_, offset + sizeof(BlockHeader))) FreeLinks{head, 0U};
+    if (head != 0U)
+    {
+        GetFreeLinks(base_address_, head).previous = offset;
+    }
+    head = offset;
+    state_.non_empty_bins |= std::uint32_t{1U} << bin;
+    score::cpp::ignore = state_.free_bytes.fetch_add(block_size, std::memory_order_relaxed);
+}
+
+auto SegregatedFitAllocator::RemoveFromBin(const std::size_t offset) noexcept -> void
+{
+    const auto block_size = GetHeader(base_address_, offset).GetSize();
+    const auto bin = GetBinIndex(block_size);
+    const auto& links = GetFreeLinks(base_address_, offset);
+    if (links.previous != 0U)
+    {
+        GetFreeLinks(base_address_, links.previous).next = links.next;
+    }
+    else
+    {
+        state_.free_list_heads.at(bin) = links.next;
+        if (links.next == 0U)
+        {
+            state_.non_empty_bins &= ~(std::uint32_t{1U} << bin);
+        }
+    }
+    if (links.next != 0U)
+    {
+        GetFreeLinks(base_address_, links.next).previous = links.previous;
+    }
+    score::cpp::ignore = state_.free_bytes.fetch_sub(block_size, std::memory_order_relaxed);
+}
+
+auto SegregatedFitAllocator::FindNonEmptyBin(const std::size_t first_bin) const noexcept -> std::size_t
+{
+    if (first_bin >= kNumberOfBins)
+    {
+        return kNumberOfBins;
+    }
+    // Ignore the bins in front of first_bin
+    const auto bins = state_.non_empty_bins & (std::numeric_limits<std::uint32_t>::max() << first_bin);
+    return (bins == 0U) ? kNumberOfBins : static_cast<std::size_t>(score::cpp::countr_zero(bins));
+}
+
+}  // namespace score::memory::shared::detail
@@ -0,0 +1,104 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_SEGREGATED_FIT_ALLOCATOR_H
+#define SCORE_LIB_MEMORY_SHARED_SEGREGATED_FIT_ALLOCATOR_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace score::memory::shared::detail
+{
+
+/// \brief Segregated-fit allocator with boundary tags and immediate coalescing for a memory arena that may be mapped at
+/// different addresses in different processes.
+///
+/// \details The arena reaches from the base address of the mapping up to the given capacity. Memory below the initial
+/// end offset (e.g. a control block) is not touched. Every block starts with a header that stores its size and the size
+/// of the preceding block, if that one is free. Free blocks are linked into one of kNumberOfBins size-class bins, two
+/// per power of two, starting at the minimum block size. The last bin takes all larger blocks. The number of bins is
+/// kept small, since the State is part of the control block of every shared memory region. All links are offsets
+/// relative to the base address, so the state can be shared between processes just like OffsetPtr.
+///
+/// Blocks at the end of the arena that are freed are given back by lowering the end offset, so the end offset is the
+/// high-water mark of the memory in use.
+///
+/// The allocator does not synchronize. All calls that work on the same State have to be serialized by the caller, e.g.
+/// by an interprocess mutex that lives next to the State.
+class SegregatedFitAllocator
+{
+  public:
+    static constexpr std::size_t kNumberOfBins{16U};
+
+    /// \brief State of the allocator that has to be placed in the shared memory region, e.g. in its control block.
+    class State
+    {
+      public:
+        State() noexcept;
+
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+        // be private.".
+        // Rationale: The State is only accessed by SegregatedFitAllocator, there are no class invariants on its own.
+        // Offsets of the first free block per bin, zero marks an empty bin.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::array<std::size_t, kNumberOfBins> free_list_heads;
+        // One bit per bin that is set if the bin is not empty.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::uint32_t non_empty_bins;
+        // Sum of the sizes of all free blocks including their headers.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::atomic<std::size_t> free_bytes;
+    };
+
+    /// \brief Creates an allocator that works on an existing arena.
+    /// \param base_address start of the mapping in the calling process. Must be aligned to alignof(std::max_align_t).
+    /// \param state allocator state within the arena.
+    /// \param end_offset offset behind the last block. Must be aligned to alignof(std::max_align_t).
+    /// \param capacity size of the arena in bytes, counted from base_address.
+    SegregatedFitAllocator(void* const base_address,
+                           State& state,
+                           std::atomic<std::size_t>& end_offset,
+                           const std::size_t capacity) noexcept;
+
+    /// \brief Allocates a block of at least the given size and alignment.
+    /// \return the allocated memory or nullptr, if the arena is exhausted.
+    void* Allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /// \brief Returns memory that was allocated by Allocate() and coalesces it with its free neighbours.
+    void Deallocate(void* const memory) noexcept;
+
+    /// \brief Bin in which a free block of the given size is stored.
+    static std::size_t GetBinIndex(const std::size_t block_size) noexcept;
+
+  private:
+    std::size_t TakeFreeBlock(const std::size_t block_size) noexcept;
+    std::size_t TakeBlockFromEnd(const std::size_t block_size) noexcept;
+    std::size_t SplitLeadingPadding(const std::size_t offset, const std::size_t alignment) noexcept;
+    void SplitTrailingRest(const std::size_t offset, const std::size_t block_size) noexcept;
+    void MarkUsed(const std::size_t offset) noexcept;
+    void ReleaseFreeBlock(const std::size_t offset, const std::size_t block_size) noexcept;
+
+    void InsertIntoBin(const std::size_t offset) noexcept;
+    void RemoveFromBin(const std::size_t offset) noexcept;
+    std::size_t FindNonEmptyBin(const std::size_t first_bin) const noexcept;
+
+    void* base_address_;
+    State& state_;
+    std::atomic<std::size_t>& end_offset_;
+    std::size_t capacity_;
+};
+
+}  // namespace score::memory::shared::detail
+
+#endif  // SCORE_LIB_MEMORY_SHARED_SEGREGATED_FIT_ALLOCATOR_H
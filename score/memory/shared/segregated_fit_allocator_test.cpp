@@ -0,0 +1,299 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/segregated_fit_allocator.h"
+
+#include "score/memory/shared/pointer_arithmetic_util.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace score::memory::shared::detail::test
+{
+namespace
+{
+
+constexpr std::size_t kArenaSize{64U * 1024U};
+// Offset of the first block, like the management space in front of the user memory of a SharedMemoryResource
+constexpr std::size_t kInitialEndOffset{256U};
+
+bool IsAligned(const void* const memory, const std::size_t alignment)
+{
+    return (CastPointerToInteger(memory) % alignment) == 0U;
+}
+
+class SegregatedFitAllocatorFixture : public ::testing::Test
+{
+  protected:
+    void* Allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t))
+    {
+        return unit_.Allocate(bytes, alignment);
+    }
+
+    std::size_t GetOffset(const void* const memory) const
+    {
+        return static_cast<std::size_t>(SubtractPointersBytes(memory, arena_.data()));
+    }
+
+    alignas(4096) std::array<std::uint8_t, kArenaSize> arena_{};
+    SegregatedFitAllocator::State state_{};
+    std::atomic<std::size_t> end_offset_{kInitialEndOffset};
+    SegregatedFitAllocator unit_{arena_.data(), state_, end_offset_, kArenaSize};
+};
+
+TEST_F(SegregatedFitAllocatorFixture, AllocationsAreDisjointAlignedAndWithinTheArena)
+{
+    RecordProperty("Description", "Allocated blocks shall be aligned, disjoint and within the arena.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // When allocating blocks of different sizes and alignments
+    auto* const first = Allocate(1U, 1U);
+    auto* const second = Allocate(100U, 8U);
+    auto* const third = Allocate(24U, 64U);
+
+    // Then every block is aligned and located behind the initial end offset
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(third, nullptr);
+    EXPECT_TRUE(IsAligned(first, alignof(std::max_align_t)));
+    EXPECT_TRUE(IsAligned(second, alignof(std::max_align_t)));
+    EXPECT_TRUE(IsAligned(third, 64U));
+    EXPECT_GT(GetOffset(first), kInitialEndOffset);
+
+    // and writing to all of them does not overwrite any other
+    std::memset(first, 0x11, 1U);
+    std::memset(second, 0x22, 100U);
+    std::memset(third, 0x33, 24U);
+    EXPECT_EQ(*static_cast<std::uint8_t*>(first), 0x11U);
+    EXPECT_EQ(static_cast<std::uint8_t*>(second)[99U], 0x22U);
+    EXPECT_EQ(static_cast<std::uint8_t*>(third)[0U], 0x33U);
+    EXPECT_LE(GetOffset(third) + 24U, end_offset_.load());
+}
+
+TEST_F(SegregatedFitAllocatorFixture, FreedBlockIsReusedForAllocationOfSameSize)
+{
+    RecordProperty("Description", "A freed block shall be reused for a later allocation that fits.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given two allocations of which the first is freed again
+    auto* const first = Allocate(64U);
+    auto* const second = Allocate(64U);
+    unit_.Deallocate(first);
+    const auto end_offset = end_offset_.load();
+
+    // When allocating the same size again
+    auto* const third = Allocate(64U);
+
+    // Then the freed block is reused and the arena does not grow
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(end_offset_.load(), end_offset);
+    EXPECT_NE(second, nullptr);
+    EXPECT_EQ(state_.free_bytes.load(), 0U);
+}
+
+TEST_F(SegregatedFitAllocatorFixture, FreeingTheLastBlockGivesBackTheEndOfTheArena)
+{
+    RecordProperty("Description", "Freeing all blocks shall reset the end offset to its initial value.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given three allocations
+    auto* const first = Allocate(32U);
+    auto* const second = Allocate(48U);
+    auto* const third = Allocate(16U);
+
+    // When freeing them in an order in which the last block is freed last
+    unit_.Deallocate(first);
+    unit_.Deallocate(second);
+    EXPECT_GT(state_.free_bytes.load(), 0U);
+    unit_.Deallocate(third);
+
+    // Then all blocks are coalesced and given back
+    EXPECT_EQ(end_offset_.load(), kInitialEndOffset);
+    EXPECT_EQ(state_.free_bytes.load(), 0U);
+}
+
+TEST_F(SegregatedFitAllocatorFixture, NeighbouringFreeBlocksAreCoalesced)
+{
+    RecordProperty("Description", "Neighbouring free blocks shall be coalesced into one block.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given three small blocks followed by a block that stays in use
+    auto* const first = Allocate(64U);
+    auto* const second = Allocate(64U);
+    auto* const third = Allocate(64U);
+    auto* const guard = Allocate(64U);
+    ASSERT_NE(guard, nullptr);
+
+    // When freeing the outer blocks first and the middle block last
+    unit_.Deallocate(first);
+    unit_.Deallocate(third);
+    unit_.Deallocate(second);
+
+    // Then an allocation of the combined size fits into the coalesced block
+    const auto end_offset = end_offset_.load();
+    auto* const combined = Allocate(3U * 64U);
+    EXPECT_EQ(combined, first);
+    EXPECT_EQ(end_offset_.load(), end_offset);
+}
+
+TEST_F(SegregatedFitAllocatorFixture, LargerFreeBlockIsSplit)
+{
+    RecordProperty("Description", "A free block that is larger than needed shall be split.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a large free block in front of a block that stays in use
+    auto* const large = Allocate(4096U);
+    auto* const guard = Allocate(16U);
+    ASSERT_NE(guard, nullptr);
+    unit_.Deallocate(large);
+
+    // When allocating two small blocks
+    auto* const first = Allocate(16U);
+    auto* const second = Allocate(16U);
+
+    // Then both are carved from the large free block
+    EXPECT_EQ(first, large);
+    EXPECT_GT(second, first);
+    EXPECT_LT(second, guard);
+}
+
+TEST_F(SegregatedFitAllocatorFixture, ExhaustedArenaReturnsNullptr)
+{
+    RecordProperty("Description", "An allocation that does not fit shall return nullptr.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // When allocating more than the arena can hold
+    // Then nullptr is returned and the arena is unchanged
+    EXPECT_EQ(Allocate(kArenaSize), nullptr);
+    EXPECT_EQ(Allocate(kArenaSize - kInitialEndOffset), nullptr);
+    EXPECT_EQ(end_offset_.load(), kInitialEndOffset);
+
+    // and an allocation that fits still succeeds
+    EXPECT_NE(Allocate(kArenaSize / 2U), nullptr);
+}
+
+TEST_F(SegregatedFitAllocatorFixture, StateIsIndependentOfTheMappingAddress)
+{
+    RecordProperty("Description",
+                   "The allocator state shall only contain offsets, so it can be used from a different mapping.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an arena with allocated and freed blocks
+    auto* const first = Allocate(64U);
+    auto* const second = Allocate(64U);
+    ASSERT_NE(second, nullptr);
+    unit_.Deallocate(first);
+
+    // When copying the arena to another address, as if it was mapped there by another process
+    alignas(4096) std::array<std::uint8_t, kArenaSize> other_mapping{};
+    other_mapping = arena_;
+    SegregatedFitAllocator other{other_mapping.data(), state_, end_offset_, kArenaSize};
+
+    // Then the freed block is found at the same offset within the other mapping
+    auto* const reused = other.Allocate(64U, alignof(std::max_align_t));
+    EXPECT_EQ(static_cast<std::size_t>(SubtractPointersBytes(reused, other_mapping.data())), GetOffset(first));
+}
+
+TEST_F(SegregatedFitAllocatorFixture, RandomAllocationsAndDeallocationsKeepArenaConsistent)
+{
+    RecordProperty("Description", "Random allocation patterns shall neither corrupt blocks nor leak memory.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    struct Allocation
+    {
+        std::uint8_t* memory;
+        std::size_t size;
+        std::uint8_t pattern;
+    };
+    std::vector<Allocation> allocations{};
+    std::mt19937 random_engine{42U};
+    std::uniform_int_distribution<std::size_t> size_distribution{1U, 2048U};
+
+    // When allocating, filling and freeing blocks in random order
+    for (std::uint32_t i{0U}; i < 2000U; ++i)
+    {
+        if (allocations.empty() || ((random_engine() % 3U) != 0U))
+        {
+            const auto size = size_distribution(random_engine);
+            const std::size_t alignment = ((random_engine() % 8U) == 0U) ? 64U : alignof(std::max_align_t);
+            auto* const memory = static_cast<std::uint8_t*>(Allocate(size, alignment));
+            if (memory == nullptr)
+            {
+                continue;
+            }
+            ASSERT_TRUE(IsAligned(memory, alignment));
+            const auto pattern = static_cast<std::uint8_t>(i);
+            std::memset(memory, pattern, size);
+            allocations.push_back(Allocation{memory, size, pattern});
+        }
+        else
+        {
+            const auto index = random_engine() % allocations.size();
+            const auto allocation = allocations.at(index);
+            // Then no other block has overwritten the content
+            for (std::size_t byte{0U}; byte < allocation.size; ++byte)
+            {
+                ASSERT_EQ(allocation.memory[byte], allocation.pattern);
+            }
+            unit_.Deallocate(allocation.memory);
+            allocations.erase(allocations.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+    }
+    for (const auto& allocation : allocations)
+    {
+        unit_.Deallocate(allocation.memory);
+    }
+
+    // and the whole arena is given back in the end
+    EXPECT_EQ(end_offset_.load(), kInitialEndOffset);
+    EXPECT_EQ(state_.free_bytes.load(), 0U);
+}
+
+TEST(SegregatedFitAllocatorBinTest, EveryPowerOfTwoIsSplitIntoTwoBins)
+{
+    RecordProperty("Description", "Block sizes shall be mapped to two size classes per power of two.");
+    RecordProperty("TestType", "requirements-based");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    constexpr std::size_t granularity{alignof(std::max_align_t)};
+
+    // The smallest blocks share the first bin
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(0U), 0U);
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(2U * granularity), 0U);
+    // and every power of two is split in the middle
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(3U * granularity), 1U);
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(4U * granularity), 2U);
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(5U * granularity), 2U);
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(6U * granularity), 3U);
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(8U * granularity), 4U);
+    // while all large blocks share the last bin
+    EXPECT_EQ(SegregatedFitAllocator::GetBinIndex(std::numeric_limits<std::size_t>::max()),
+              SegregatedFitAllocator::kNumberOfBins - 1U);
+}
+
+}  // namespace
+}  // namespace score::memory::shared::detail::test
@@ -42,32 +42,54 @@ auto score::memory::shared::SharedMemoryFactory::Create(std::string path,
                                                       InitializeCallback cb,
                                                       const std::size_t user_space_to_reserve,
                                                       const UserPermissions& permissions,
-                                                      const bool prefer_typed_memory) noexcept
+                                                      const bool prefer_typed_memory,
+                                                      const AllocationStrategy allocation_strategy,
+                                                      const MappingOptions& mapping_options) noexcept
     -> std::shared_ptr<ISharedMemoryResource>
 {
-    return instance().Create(std::move(path), std::move(cb), user_space_to_reserve, permissions, prefer_typed_memory);
+    return instance().Create(std::move(path),
+                             std::move(cb),
+                             user_space_to_reserve,
+                             permissions,
+                             prefer_typed_memory,
+                             allocation_strategy,
+                             mapping_options);
 }
 
 auto score::memory::shared::SharedMemoryFactory::CreateAnonymous(std::uint64_t shared_memory_resource_id,
                                                                InitializeCallback cb,
                                                                const std::size_t user_space_to_reserve,
                                                                const UserPermissions& permissions,
-                                                               const bool prefer_typed_memory) noexcept
+                                                               const bool prefer_typed_memory,
+                                                               const AllocationStrategy allocation_strategy,
+                                                               const MappingOptions& mapping_options) noexcept
     -> std::shared_ptr<ISharedMemoryResource>
 {
-    return instance().CreateAnonymous(
-        shared_memory_resource_id, std::move(cb), user_space_to_reserve, permissions, prefer_typed_memory);
+    return instance().CreateAnonymous(shared_memory_resource_id,
+                                      std::move(cb),
+                                      user_space_to_reserve,
+                                      permissions,
+                                      prefer_typed_memory,
+                                      allocation_strategy,
+                                      mapping_options);
 }
 
 auto SharedMemoryFactory::CreateOrOpen(std::string path,
                                        InitializeCallback cb,
                                        const std::size_t user_space_to_reserve,
                                        const SharedMemoryResource::AccessControl access_control,
-                                       const bool prefer_typed_memory) noexcept
+                                       const bool prefer_typed_memory,
+                                       const AllocationStrategy allocation_strategy,
+                                       const MappingOptions& mapping_options) noexcept
     -> std::shared_ptr<ISharedMemoryResource>
 {
-    return instance().CreateOrOpen(
-        std::move(path), std::move(cb), user_space_to_reserve, access_control, prefer_typed_memory);
+    return instance().CreateOrOpen(std::move(path),
+                                   std::move(cb),
+                                   user_space_to_reserve,
+                                   access_control,
+                                   prefer_typed_memory,
+                                   allocation_strategy,
+                                   mapping_options);
 }
 
 auto SharedMemoryFactory::Remove(const std::string& path) noexcept -> void
@@ -51,6 +51,8 @@ class SharedMemoryFactory
     using UserPermissionsMap = ISharedMemoryResource::UserPermissionsMap;
     using UserPermissions = ISharedMemoryResource::UserPermissions;
     using AccessControl = ISharedMemoryResource::AccessControl;
+    using AllocationStrategy = ISharedMemoryResource::AllocationStrategy;
+    using MappingOptions = ISharedMemoryResource::MappingOptions;
 
     /// \brief Obtain a memory resource for an existing memory region. The whole region will be mmapped.
     /// \param path name of the memory region to open: a string consisting of an initial
@@ -85,13 +87,21 @@ class SharedMemoryFactory
     ///        otherwise UserPermissionsMap containing the ACL (also, read/writable to the user)
     /// \param prefer_typed_memory specifying the preferred location of the shared-memory object: whether it
     ///        has to be allocated in typed memory or in the os system memory.
+    /// \param allocation_strategy how allocations within the created memory region are synchronized, see
+    ///        ISharedMemoryResource::AllocationStrategy.
+    /// \param mapping_options huge page, prefault, locking and NUMA options for mapping the region into this process,
+    ///        see ISharedMemoryResource::MappingOptions.
     /// \return a smart pointer to the shared-memory resource from the internal map. Nullptr if such a memory region
     ///         already exists or the shared-memory resource could not be created.
     static std::shared_ptr<ISharedMemoryResource> Create(std::string path,
                                                          InitializeCallback cb,
                                                          const std::size_t user_space_to_reserve,
                                                          const UserPermissions& permissions = UserPermissionsMap{},
-                                                         const bool prefer_typed_memory = false) noexcept;
+                                                         const bool prefer_typed_memory = false,
+                                                         const AllocationStrategy allocation_strategy =
+                                                             AllocationStrategy::kMonotonicLocked,
+                                                         const MappingOptions& mapping_options =
+                                                             MappingOptions{}) noexcept;
 
     /// \brief Obtain a memory resource for a newly created anonymous memory region.
     /// \attention This implementation only works in QNX environment because typed memory is only implemented for QNX
@@ -110,6 +120,10 @@ class SharedMemoryFactory
     ///        otherwise UserPermissionsMap containing the ACL (also, read/writable to the user)
     /// \param prefer_typed_memory specifying the preferred location of the shared-memory object: whether it
     ///        has to be allocated in typed memory or in the os system memory.
+    /// \param allocation_strategy how allocations within the created memory region are synchronized, see
+    ///        ISharedMemoryResource::AllocationStrategy.
+    /// \param mapping_options huge page, prefault, locking and NUMA options for mapping the region into this process,
+    ///        see ISharedMemoryResource::MappingOptions.
     /// \return a smart pointer to the shared-memory resource from the internal map. Nullptr if such a memory region
     ///         already exists or the shared-memory resource could not be created.
     static std::shared_ptr<ISharedMemoryResource> CreateAnonymous(
@@ -117,7 +131,9 @@ class SharedMemoryFactory
         InitializeCallback cb,
         const std::size_t user_space_to_reserve,
         const UserPermissions& permissions = UserPermissionsMap{},
-        const bool prefer_typed_memory = false) noexcept;
+        const bool prefer_typed_memory = false,
+        const AllocationStrategy allocation_strategy = AllocationStrategy::kMonotonicLocked,
+        const MappingOptions& mapping_options = MappingOptions{}) noexcept;
 
     /// \brief Obtain a memory resource for an existing or newly created memory region.
     /// \param path name of the memory region to open or create: a string consisting of an initial
@@ -130,13 +146,20 @@ class SharedMemoryFactory
     ///        2- allowedProviders_ list of the UIDs of allowed creators of the memory region (see details at Open)
     /// \param prefer_typed_memory specifying the preferred location of the shared-memory object whether it
     ///        has to be allocated in typed memory or in the os system memory.
+    /// \param allocation_strategy how allocations within the memory region are synchronized, if it gets created. In
+    ///        case an open is done, the strategy of the creator is used.
+    /// \param mapping_options options for mapping the region into this process, applied for a create and an open.
     /// \return a smart pointer to the shared-memory resource from the internal map.
     ///         If memory resource doesn't yet exist and creation failed, it returns a nullptr.
     static std::shared_ptr<ISharedMemoryResource> CreateOrOpen(std::string path,
                                                                InitializeCallback cb,
                                                                const std::size_t user_space_to_reserve,
                                                                const AccessControl access_control = {{}, {}},
-                                                               const bool prefer_typed_memory = false) noexcept;
+                                                               const bool prefer_typed_memory = false,
+                                                               const AllocationStrategy allocation_strategy =
+                                                                   AllocationStrategy::kMonotonicLocked,
+                                                               const MappingOptions& mapping_options =
+                                                                   MappingOptions{}) noexcept;
 
     /// \brief Removes any SharedMemoryResource corresponding to path from the SharedMemoryFactory
     /// \param path name of the memory region to open or create: a string consisting of an initial
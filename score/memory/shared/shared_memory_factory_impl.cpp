@@ -157,7 +157,9 @@ auto score::memory::shared::SharedMemoryFactoryImpl::Create(std::string path,
                                                           InitializeCallback cb,
                                                           const std::size_t user_space_to_reserve,
                                                           const UserPermissions& permissions,
-                                                          const bool prefer_typed_memory) noexcept
+                                                          const bool prefer_typed_memory,
+                                                          const AllocationStrategy allocation_strategy,
+                                                          const MappingOptions& mapping_options) noexcept
     -> std::shared_ptr<ISharedMemoryResource>
 {
     std::lock_guard<std::mutex> lock{mutex_};
@@ -176,8 +178,14 @@ auto score::memory::shared::SharedMemoryFactoryImpl::Create(std::string path,
     }
 
     const auto typed_memory_ptr = prefer_typed_memory ? typed_memory_ptr_ : nullptr;
-    const auto result = SharedMemoryResource::Create(
-        path, user_space_to_reserve, std::move(cb), permissions, &CreateAccessControlList, typed_memory_ptr);
+    const auto result = SharedMemoryResource::Create(path,
+                                                     user_space_to_reserve,
+                                                     std::move(cb),
+                                                     permissions,
+                                                     &CreateAccessControlList,
+                                                     typed_memory_ptr,
+                                                     allocation_strategy,
+                                                     mapping_options);
     if (!result.has_value())
     {
         score::mw::log::LogWarn("shm") << "Could not create Shared Memory " << path << ":" << result.error();
@@ -187,12 +195,14 @@ auto score::memory::shared::SharedMemoryFactoryImpl::Create(std::string path,
     return std::static_pointer_cast<ISharedMemoryResource>(result.value());
 }
 
-auto score::memory::shared::SharedMemoryFactoryImpl::CreateAnonymous(std::uint64_t shared_memory_resource_id,
-                                                                   InitializeCallback cb,
-                                                                   const std::size_t user_space_to_reserve,
-                                                                   const UserPermissions& permissions,
-                                                                   const bool prefer_typed_memory) noexcept
-    -> std::shared_ptr<ISharedMemoryResource>
+auto score::memory::shared::SharedMemoryFactoryImpl::CreateAnonymous(
+    std::uint64_t shared_memory_resource_id,
+    InitializeCallback cb,
+    const std::size_t user_space_to_reserve,
+    const UserPermissions& permissions,
+    const bool prefer_typed_memory,
+    const AllocationStrategy allocation_strategy,
+    const MappingOptions& mapping_options) noexcept -> std::shared_ptr<ISharedMemoryResource>
 {
     std::lock_guard<std::mutex> lock{mutex_};
 
@@ -211,7 +221,9 @@ auto score::memory::shared::SharedMemoryFactoryImpl::CreateAnonymous(std::uint64
                                                               std::move(cb),
                                                               permissions,
                                                               &CreateAccessControlList,
-                                                              typed_memory_ptr);
+                                                              typed_memory_ptr,
+                                                              allocation_strategy,
+                                                              mapping_options);
     // LCOV_EXCL_START (Defensive programming: CreateAnonymous either returns a valid result or terminates.)
     // LCOV_EXCL_BR_START (See line coverage suppression explanation)
     if (!result.has_value())
@@ -230,7 +242,9 @@ auto score::memory::shared::SharedMemoryFactoryImpl::CreateOrOpen(
     InitializeCallback cb,
     const std::size_t user_space_to_reserve,
     const SharedMemoryResource::AccessControl access_control,
-    const bool prefer_typed_memory) noexcept -> std::shared_ptr<ISharedMemoryResource>
+    const bool prefer_typed_memory,
+    const AllocationStrategy allocation_strategy,
+    const MappingOptions& mapping_options) noexcept -> std::shared_ptr<ISharedMemoryResource>
 {
     std::lock_guard<std::mutex> lock{mutex_};
     auto resource = GetResourceIfAlreadyOpened(path, resources_);
@@ -250,7 +264,9 @@ auto score::memory::shared::SharedMemoryFactoryImpl::CreateOrOpen(
                                                                std::move(cb),
                                                                access_control.permissions_,
                                                                &CreateAccessControlList,
-                                                               typed_memory_ptr);
+                                                               typed_memory_ptr,
+                                                               allocation_strategy,
+                                                               mapping_options);
         if (!result.has_value())
         {
             score::mw::log::LogWarn("shm") << __func__ << __LINE__ << "Could not create or open Shared Memory " << path
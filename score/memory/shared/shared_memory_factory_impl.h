@@ -39,19 +39,25 @@ class SharedMemoryFactoryImpl final : public ISharedMemoryFactory
                                                   InitializeCallback cb,
                                                   const std::size_t user_space_to_reserve,
                                                   const UserPermissions& permissions,
-                                                  const bool prefer_typed_memory) noexcept override;
+                                                  const bool prefer_typed_memory,
+                                                  const AllocationStrategy allocation_strategy,
+                                                  const MappingOptions& mapping_options) noexcept override;
 
     std::shared_ptr<ISharedMemoryResource> CreateAnonymous(std::uint64_t shared_memory_resource_id,
                                                            InitializeCallback cb,
                                                            const std::size_t user_space_to_reserve,
                                                            const UserPermissions& permissions,
-                                                           const bool prefer_typed_memory) noexcept override;
+                                                           const bool prefer_typed_memory,
+                                                           const AllocationStrategy allocation_strategy,
+                                                           const MappingOptions& mapping_options) noexcept override;
 
     std::shared_ptr<ISharedMemoryResource> CreateOrOpen(std::string path,
                                                         InitializeCallback cb,
                                                         const std::size_t user_space_to_reserve,
                                                         const AccessControl access_control,
-                                                        const bool prefer_typed_memory) noexcept override;
+                                                        const bool prefer_typed_memory,
+                                                        const AllocationStrategy allocation_strategy,
+                                                        const MappingOptions& mapping_options) noexcept override;
 
     void Remove(const std::string& path) noexcept override;
 
@@ -34,17 +34,35 @@ class SharedMemoryFactoryMock : public ISharedMemoryFactory
 
     MOCK_METHOD(std::shared_ptr<ISharedMemoryResource>,
                 Create,
-                (std::string, InitializeCallback, const std::size_t, const UserPermissions&, const bool),
+                (std::string,
+                 InitializeCallback,
+                 const std::size_t,
+                 const UserPermissions&,
+                 const bool,
+                 const AllocationStrategy,
+                 const MappingOptions&),
                 (noexcept, override));
 
     MOCK_METHOD(std::shared_ptr<ISharedMemoryResource>,
                 CreateAnonymous,
-                (std::uint64_t, InitializeCallback, const std::size_t, const UserPermissions&, const bool),
+                (std::uint64_t,
+                 InitializeCallback,
+                 const std::size_t,
+                 const UserPermissions&,
+                 const bool,
+                 const AllocationStrategy,
+                 const MappingOptions&),
                 (noexcept, override));
 
     MOCK_METHOD(std::shared_ptr<ISharedMemoryResource>,
                 CreateOrOpen,
-                (std::string, InitializeCallback, const std::size_t, const AccessControl, const bool),
+                (std::string,
+                 InitializeCallback,
+                 const std::size_t,
+                 const AccessControl,
+                 const bool,
+                 const AllocationStrategy,
+                 const MappingOptions&),
                 (noexcept, override));
 
     MOCK_METHOD(void, Remove, (const std::string&), (noexcept, override));
@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/mpmc_queue.h"
+#include "score/memory/shared/shared_memory_factory.h"
+#include "score/memory/shared/spsc_queue.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+constexpr auto kSharedMemoryPath = "/shared_memory_queue_benchmark";
+constexpr std::size_t kResourceSize{1024U * 1024U};
+constexpr std::size_t kQueueCapacity{1024U};
+constexpr std::uint64_t kStopValue{std::numeric_limits<std::uint64_t>::max()};
+
+std::shared_ptr<ISharedMemoryResource> CreateResource() noexcept
+{
+    SharedMemoryFactory::RemoveStaleArtefacts(kSharedMemoryPath);
+    auto resource = SharedMemoryFactory::Create(
+        kSharedMemoryPath, [](std::shared_ptr<ISharedMemoryResource>) noexcept {}, kResourceSize);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(resource != nullptr, "Could not create shared memory region");
+    return resource;
+}
+
+template <typename Queue>
+Queue* ConstructQueue(ISharedMemoryResource& resource) noexcept
+{
+    return resource.construct<Queue>(kQueueCapacity, typename Queue::allocator_type{resource});
+}
+
+void WaitForChild(const pid_t child_pid) noexcept
+{
+    std::int32_t child_status{0};
+    const auto waited_pid = ::waitpid(child_pid, &child_status, 0);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE((waited_pid == child_pid) && WIFEXITED(child_status) &&
+                                                    (WEXITSTATUS(child_status) == 0),
+                                                "Child process failed");
+}
+
+/// The parent process streams elements to a consumer in a child process as fast as possible.
+template <typename Queue>
+void Throughput(benchmark::State& state)
+{
+    auto resource = CreateResource();
+    auto* const queue = ConstructQueue<Queue>(*resource);
+
+    const auto child_pid = ::fork();
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(child_pid != -1, "Could not fork");
+    if (child_pid == 0)
+    {
+        auto value = queue->Pop(score::cpp::stop_token{});
+        while (value.has_value() && (value.value() != kStopValue))
+        {
+            value = queue->Pop(score::cpp::stop_token{});
+        }
+        ::_exit(value.has_value() ? 0 : 1);
+    }
+
+    std::uint64_t value{0U};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(queue->Push(value, score::cpp::stop_token{}));
+        ++value;
+    }
+    score::cpp::ignore = queue->Push(kStopValue, score::cpp::stop_token{});
+    WaitForChild(child_pid);
+    state.SetItemsProcessed(state.iterations());
+
+    SharedMemoryFactory::Remove(kSharedMemoryPath);
+    resource.reset();
+}
+BENCHMARK_TEMPLATE(Throughput, SpscQueue<std::uint64_t>);
+BENCHMARK_TEMPLATE(Throughput, MpmcQueue<std::uint64_t>);
+
+/// The parent process sends an element to a child process, which sends it back. Measures the round trip latency.
+template <typename Queue>
+void PingPong(benchmark::State& state)
+{
+    auto resource = CreateResource();
+    auto* const requests = ConstructQueue<Queue>(*resource);
+    auto* const responses = ConstructQueue<Queue>(*resource);
+
+    const auto child_pid = ::fork();
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(child_pid != -1, "Could not fork");
+    if (child_pid == 0)
+    {
+        auto value = requests->Pop(score::cpp::stop_token{});
+        while (value.has_value() && (value.value() != kStopValue))
+        {
+            score::cpp::ignore = responses->Push(value.value(), score::cpp::stop_token{});
+            value = requests->Pop(score::cpp::stop_token{});
+        }
+        ::_exit(value.has_value() ? 0 : 1);
+    }
+
+    std::uint64_t value{0U};
+    for (auto _ : state)
+    {
+        score::cpp::ignore = requests->Push(value, score::cpp::stop_token{});
+        benchmark::DoNotOptimize(responses->Pop(score::cpp::stop_token{}));
+        ++value;
+    }
+    score::cpp::ignore = requests->Push(kStopValue, score::cpp::stop_token{});
+    WaitForChild(child_pid);
+
+    SharedMemoryFactory::Remove(kSharedMemoryPath);
+    resource.reset();
+}
+BENCHMARK_TEMPLATE(PingPong, SpscQueue<std::uint64_t>);
+BENCHMARK_TEMPLATE(PingPong, MpmcQueue<std::uint64_t>);
+
+// Reference for an IPC channel through the kernel
+void PipePingPong(benchmark::State& state)
+{
+    std::array<std::int32_t, 2U> requests{};
+    std::array<std::int32_t, 2U> responses{};
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE((::pipe(requests.data()) == 0) && (::pipe(responses.data()) == 0),
+                                                "Could not create pipes");
+
+    const auto child_pid = ::fork();
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(child_pid != -1, "Could not fork");
+    if (child_pid == 0)
+    {
+        std::uint64_t value{0U};
+        while ((::read(requests[0], &value, sizeof(value)) == sizeof(value)) && (value != kStopValue))
+        {
+            score::cpp::ignore = ::write(responses[1], &value, sizeof(value));
+        }
+        ::_exit(0);
+    }
+
+    std::uint64_t value{0U};
+    for (auto _ : state)
+    {
+        score::cpp::ignore = ::write(requests[1], &value, sizeof(value));
+        score::cpp::ignore = ::read(responses[0], &value, sizeof(value));
+        ++value;
+    }
+    value = kStopValue;
+    score::cpp::ignore = ::write(requests[1], &value, sizeof(value));
+    WaitForChild(child_pid);
+    for (const auto file_descriptor : {requests[0], requests[1], responses[0], responses[1]})
+    {
+        score::cpp::ignore = ::close(file_descriptor);
+    }
+}
+BENCHMARK(PipePingPong);
+
+}  // namespace
+}  // namespace score::memory::shared
@@ -41,6 +41,8 @@
 #include <score/utility.hpp>
 #include <cerrno>
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -127,6 +129,70 @@ class MakeSharedEnabler final : public SharedMemoryResource
     MakeSharedEnabler& operator=(MakeSharedEnabler&&) noexcept = delete;
 };
 
+// Allocations are only reserved concurrently, if the allocation offset can be modified by a lock-free atomic. Only
+// those are guaranteed to work across processes.
+static_assert(std::atomic<std::size_t>::is_always_lock_free, "Lock-free allocation needs a lock-free atomic size_t");
+
+// Size of the chunks that a thread reserves with AllocationStrategy::kMonotonicThreadLocalChunks. Allocations larger
+// than a quarter of a chunk are reserved directly, so at most a quarter of a chunk is wasted when a thread moves on.
+constexpr std::size_t kThreadLocalChunkSize{4096U};
+constexpr std::size_t kMaxThreadLocalChunkAllocationSize{kThreadLocalChunkSize / 4U};
+// Number of SharedMemoryResources for which a thread keeps a chunk at the same time.
+constexpr std::size_t kMaxThreadLocalChunks{4U};
+
+// Zero is never handed out, it marks an unused ThreadLocalChunk.
+std::atomic<std::uint64_t> next_instance_id{1U};
+
+/// \brief Part of the memory arena of a SharedMemoryResource from which one thread allocates without synchronization
+struct ThreadLocalChunk
+{
+    std::uint64_t instance_id;
+    // Offsets relative to the base address of the SharedMemoryResource
+    std::size_t next_offset;
+    std::size_t end_offset;
+};
+
+thread_local std::array<ThreadLocalChunk, kMaxThreadLocalChunks> thread_local_chunks{};
+thread_local std::size_t next_thread_local_chunk_to_replace{0U};
+
+ThreadLocalChunk& GetThreadLocalChunk(const std::uint64_t instance_id) noexcept
+{
+    for (auto& chunk : thread_local_chunks)
+    {
+        if (chunk.instance_id == instance_id)
+        {
+            return chunk;
+        }
+    }
+    // Replace the chunks round-robin, the rest of a replaced chunk stays unused
+    auto& chunk = thread_local_chunks.at(next_thread_local_chunk_to_replace);
+    next_thread_local_chunk_to_replace = (next_thread_local_chunk_to_replace + 1U) % kMaxThreadLocalChunks;
+    chunk = ThreadLocalChunk{instance_id, 0U, 0U};
+    return chunk;
+}
+
+void* AllocateFromChunk(void* const base_address,
+                        ThreadLocalChunk& chunk,
+                        const std::size_t bytes,
+                        const std::size_t alignment) noexcept
+{
+    // In our architecture we have a one-to-one mapping between pointers and integral values.
+    // Therefore, casting between the two is well-defined.
+    // The chunk offsets always lie within the already allocated part of the memory arena.
+    // NOLINTNEXTLINE(score-banned-function) see above
+    void* const chunk_start_address = AddOffsetToPointer(base_address, chunk.next_offset);
+    // NOLINTNEXTLINE(score-banned-function) see above
+    const void* const chunk_end_address = AddOffsetToPointer(base_address, chunk.end_offset);
+    void* const new_address_aligned =
+        detail::do_allocation_algorithm(chunk_start_address, chunk_end_address, bytes, alignment);
+    if (new_address_aligned != nullptr)
+    {
+        const auto offset = static_cast<std::size_t>(SubtractPointersBytes(new_address_aligned, base_address));
+        chunk.next_offset = safe_math::Add(offset, bytes).value();
+    }
+    return new_address_aligned;
+}
+
 template <typename... Args>
 static std::shared_ptr<SharedMemoryResource> CreateInstance(Args&&... args)
 {
@@ -356,9 +422,13 @@ score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Sh
     InitializeCallback initialize_callback,
     const UserPermissions& permissions,
     AccessControlListFactory acl_factory,
-    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr) noexcept
+    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr,
+    const AllocationStrategy allocation_strategy,
+    const MappingOptions& mapping_options) noexcept
 {
     auto resource = CreateInstance(std::move(input_path), std::move(acl_factory), typed_memory_ptr);
+    resource->allocation_strategy_ = allocation_strategy;
+    resource->mapping_options_ = mapping_options;
     const auto result = resource->CreateImpl(user_space_to_reserve, std::move(initialize_callback), permissions);
     if (!result.has_value())
     {
@@ -377,9 +447,13 @@ score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Sh
     InitializeCallback initialize_callback,
     const UserPermissions& permissions,
     AccessControlListFactory acl_factory,
-    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr) noexcept
+    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr,
+    const AllocationStrategy allocation_strategy,
+    const MappingOptions& mapping_options) noexcept
 {
     auto resource = CreateInstance(shared_memory_resource_id, std::move(acl_factory), typed_memory_ptr);
+    resource->allocation_strategy_ = allocation_strategy;
+    resource->mapping_options_ = mapping_options;
     const auto result = resource->CreateImpl(user_space_to_reserve, std::move(initialize_callback), permissions);
     // LCOV_EXCL_START (Defensive programming: CreateAnonymous either returns a valid result or terminates.)
     // LCOV_EXCL_BR_START (See line coverage suppression explanation)
@@ -402,9 +476,13 @@ score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Sh
     InitializeCallback initialize_callback,
     const UserPermissions& permissions,
     AccessControlListFactory acl_factory,
-    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr) noexcept
+    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr,
+    const AllocationStrategy allocation_strategy,
+    const MappingOptions& mapping_options) noexcept
 {
     auto resource = CreateInstance(std::move(input_path), std::move(acl_factory), typed_memory_ptr);
+    resource->allocation_strategy_ = allocation_strategy;
+    resource->mapping_options_ = mapping_options;
     const auto result = resource->CreateOrOpenImpl(user_space_to_reserve, std::move(initialize_callback), permissions);
     if (!result.has_value())
     {
@@ -480,7 +558,10 @@ SharedMemoryResource::SharedMemoryResource(std::variant<std::string, std::uint64
               ? score::cpp::hash_bytes(std::get<std::string>(identifier).data(), std::get<std::string>(identifier).size())
               : std::get<std::uint64_t>(identifier)},
       shared_memory_resource_identifier_{identifier},
-      start_{nullptr}
+      start_{nullptr},
+      allocation_strategy_{AllocationStrategy::kMonotonicLocked},
+      mapping_options_{},
+      instance_id_{next_instance_id.fetch_add(1U, std::memory_order_relaxed)}
 {
     // We use memory_identifier_ == 0 as a sentinel value in OffsetPtr to indicate that the OffsetPtr doesn't belong to
     // a MemoryResource. Therefore, memory_identifier_ can never be 0U. With the current implementation of
@@ -690,31 +771,35 @@ auto SharedMemoryResource::getMemoryResourceProxy() noexcept -> const MemoryReso
 
 auto SharedMemoryResource::do_allocate(const std::size_t bytes, const std::size_t alignment) -> void*
 {
-    std::lock_guard<score::os::InterprocessMutex> lock(this->control_block_->mutex);
-    /**
-     * For the proof of concept we agreed to use a monotonic allocation algorithm.
-     * So there is no need for any fancy logic.
-     */
-    const std::size_t already_allocated_bytes = this->control_block_->alreadyAllocatedBytes.load();
-    void* const allocation_start_address =
-        // In our architecture we have a one-to-one mapping between pointers and integral values.
-        // Therefore, casting between the two is well-defined.
-        // The base_adress_ points to the start of the memory arena for the allocation and alreadyAllocatedBytes is
-        // ensured by this class to not exceed the size of the memory arena.
-        // Therefore, the resulting pointer will always point into the memory arena.
-        // In C++23 std::start_lifetime_as_array can be used to inform the compiler.
-        // NOLINTNEXTLINE(score-banned-function) see above
-        AddOffsetToPointer(this->base_address_, already_allocated_bytes);
-    // In our architecture we have a one-to-one mapping between pointers and integral values.
-    // Therefore, casting between the two is well-defined.
-    // This pointer is not dereferenced.
-    // NOLINTNEXTLINE(score-banned-function) see above
-    void* const allocation_end_address = AddOffsetToPointer(this->base_address_, virtual_address_space_to_reserve_);
-    void* const new_address_aligned =
-        detail::do_allocation_algorithm(allocation_start_address, allocation_end_address, bytes, alignment);
+    void* new_address_aligned{nullptr};
+    switch (this->control_block_->allocationStrategy)
+    {
+        case AllocationStrategy::kMonotonicLockFree:
+            new_address_aligned = this->AllocateMonotonic(bytes, alignment);
+            break;
+        case AllocationStrategy::kMonotonicThreadLocalChunks:
+            new_address_aligned = this->AllocateFromThreadLocalChunk(bytes, alignment);
+            break;
+        case AllocationStrategy::kSegregatedFit:
+        {
+            std::lock_guard<score::os::InterprocessMutex> lock(this->control_block_->mutex);
+            new_address_aligned = this->GetSegregatedFitAllocator().Allocate(bytes, alignment);
+            break;
+        }
+        case AllocationStrategy::kMonotonicLocked:
+        default:
+        {
+            // The mutex serializes all allocations, so the allocation order and thereby the memory layout is
+            // reproducible for a deterministic set of allocations.
+            std::lock_guard<score::os::InterprocessMutex> lock(this->control_block_->mutex);
+            new_address_aligned = this->AllocateMonotonic(bytes, alignment);
+            break;
+        }
+    }
 
     if (new_address_aligned == nullptr)
     {
+        const std::size_t already_allocated_bytes = this->control_block_->alreadyAllocatedBytes.load();
         score::mw::log::LogFatal("shm")
             << "Cannot allocate shared memory block of size" << bytes << "with alignment " << alignment
             << " at: ["
@@ -722,16 +807,79 @@ auto SharedMemoryResource::do_allocate(const std::size_t bytes, const std::size_
             // Therefore, casting between the two is well-defined.
             // The resulting pointer is used for logging and is not dereferenced.
             // NOLINTNEXTLINE(score-banned-function) see above
-            << PointerToLogValue(allocation_start_address) << ":" << PointerToLogValue(allocation_end_address)
+            << PointerToLogValue(AddOffsetToPointer(this->base_address_, already_allocated_bytes)) << ":"
+            // NOLINTNEXTLINE(score-banned-function) see above
+            << PointerToLogValue(AddOffsetToPointer(this->base_address_, virtual_address_space_to_reserve_))
             << "]. Does not fit within shared memory segment: [" << PointerToLogValue(this->base_address_) << ":"
             << PointerToLogValue(this->getEndAddress()) << "]. Already allocated bytes: " << already_allocated_bytes
             << ". Virtual address space to reserve: " << virtual_address_space_to_reserve_;
         std::terminate();
     }
-    const auto padding = SubtractPointersBytes(new_address_aligned, allocation_start_address);
+    return new_address_aligned;
+}
+
+auto SharedMemoryResource::AllocateMonotonic(const std::size_t bytes, const std::size_t alignment) noexcept -> void*
+{
+    // In our architecture we have a one-to-one mapping between pointers and integral values.
+    // Therefore, casting between the two is well-defined.
+    // This pointer is not dereferenced.
+    // NOLINTNEXTLINE(score-banned-function) see above
+    void* const allocation_end_address = AddOffsetToPointer(this->base_address_, virtual_address_space_to_reserve_);
+    auto& already_allocated_bytes = this->control_block_->alreadyAllocatedBytes;
+    std::size_t allocated_bytes = already_allocated_bytes.load(std::memory_order_relaxed);
+    void* new_address_aligned{nullptr};
+    std::size_t updated_allocated_bytes{};
+    do
+    {
+        void* const allocation_start_address =
+            // In our architecture we have a one-to-one mapping between pointers and integral values.
+            // Therefore, casting between the two is well-defined.
+            // The base_adress_ points to the start of the memory arena for the allocation and alreadyAllocatedBytes is
+            // ensured by this class to not exceed the size of the memory arena.
+            // Therefore, the resulting pointer will always point into the memory arena.
+            // In C++23 std::start_lifetime_as_array can be used to inform the compiler.
+            // NOLINTNEXTLINE(score-banned-function) see above
+            AddOffsetToPointer(this->base_address_, allocated_bytes);
+        new_address_aligned =
+            detail::do_allocation_algorithm(allocation_start_address, allocation_end_address, bytes, alignment);
+        if (new_address_aligned == nullptr)
+        {
+            return nullptr;
+        }
+        const auto padding = SubtractPointersBytes(new_address_aligned, allocation_start_address);
+        const auto total_allocated_bytes = safe_math::Add(bytes, padding).value();
+        updated_allocated_bytes = safe_math::Add(allocated_bytes, total_allocated_bytes).value();
+        // Only the reservation of disjoint ranges needs to be atomic. Publishing their content is up to the user, as
+        // with the locked strategy.
+    } while (!already_allocated_bytes.compare_exchange_weak(
+        allocated_bytes, updated_allocated_bytes, std::memory_order_relaxed));
+    return new_address_aligned;
+}
+
+auto SharedMemoryResource::AllocateFromThreadLocalChunk(const std::size_t bytes, const std::size_t alignment) noexcept
+    -> void*
+{
+    if (safe_math::Add(bytes, alignment).value() > kMaxThreadLocalChunkAllocationSize)
+    {
+        return this->AllocateMonotonic(bytes, alignment);
+    }
 
-    const auto total_allocated_bytes = safe_math::Add(bytes, padding).value();
-    this->control_block_->alreadyAllocatedBytes += total_allocated_bytes;
+    auto& chunk = GetThreadLocalChunk(instance_id_);
+    void* new_address_aligned = AllocateFromChunk(this->base_address_, chunk, bytes, alignment);
+    if (new_address_aligned == nullptr)
+    {
+        // The rest of the current chunk is too small, so it is abandoned and the next one is reserved. Since an
+        // allocation takes at most a quarter of a chunk, at most a quarter of each chunk is wasted.
+        void* const new_chunk = this->AllocateMonotonic(kThreadLocalChunkSize, alignof(std::max_align_t));
+        if (new_chunk == nullptr)
+        {
+            // Close to exhaustion of the memory arena, use what is left directly
+            return this->AllocateMonotonic(bytes, alignment);
+        }
+        chunk.next_offset = static_cast<std::size_t>(SubtractPointersBytes(new_chunk, this->base_address_));
+        chunk.end_offset = safe_math::Add(chunk.next_offset, kThreadLocalChunkSize).value();
+        new_address_aligned = AllocateFromChunk(this->base_address_, chunk, bytes, alignment);
+    }
     return new_address_aligned;
 }
 
@@ -779,7 +927,9 @@ auto SharedMemoryResource::GetUserAllocatedBytes() const noexcept -> std::size_t
     // Rationale: alreadyAllocatedBytes is initialized with GetNeededManagementSpace() and is never reduced in size.
     // Therefore, subtracting GetNeededManagementSpace() could never result in a value less than 0.
     // coverity[autosar_cpp14_a4_7_1_violation]
-    return this->control_block_->alreadyAllocatedBytes - this->GetNeededManagementSpace();
+    // Free bytes are always part of the allocated bytes, so the result cannot become negative either.
+    return this->control_block_->alreadyAllocatedBytes - this->GetNeededManagementSpace() -
+           this->control_block_->segregatedFitState.free_bytes.load(std::memory_order_relaxed);
 }
 
 auto SharedMemoryResource::getEndAddress() const noexcept -> const void*
@@ -814,13 +964,28 @@ auto SharedMemoryResource::IsShmInTypedMemory() const noexcept -> bool
     return is_shm_in_typed_memory_;
 }
 
+auto SharedMemoryResource::GetMappingOptions() const noexcept -> MappingOptions
+{
+    return mapping_options_;
+}
+
 // coverity[autosar_cpp14_a0_1_3_violation] false-positive: part of the public API
-auto SharedMemoryResource::do_deallocate(void*, std::size_t, std::size_t) -> void
+auto SharedMemoryResource::do_deallocate(void* memory, std::size_t, std::size_t) -> void
+{
+    // The monotonic allocation strategies do not deallocate.
+    if (this->control_block_->allocationStrategy == AllocationStrategy::kSegregatedFit)
+    {
+        std::lock_guard<score::os::InterprocessMutex> lock(this->control_block_->mutex);
+        this->GetSegregatedFitAllocator().Deallocate(memory);
+    }
+}
+
+auto SharedMemoryResource::GetSegregatedFitAllocator() const noexcept -> detail::SegregatedFitAllocator
 {
-    /**
-     * For the proof of concept we agreed to use a monotonic allocation algorithm.
-     * Thus, no deallocation will be performed.
-     */
+    return detail::SegregatedFitAllocator{this->base_address_,
+                                          this->control_block_->segregatedFitState,
+                                          this->control_block_->alreadyAllocatedBytes,
+                                          virtual_address_space_to_reserve_};
 }
 
 // coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
@@ -893,13 +1058,18 @@ auto SharedMemoryResource::reserveSharedMemory() const noexcept -> void
 
 auto SharedMemoryResource::mapMemoryIntoProcess() noexcept -> void
 {
+    // Placement policies only affect pages that are faulted in after they have been set. So the mapping is only
+    // prefaulted by mmap() itself, if there are none.
+    const bool has_placement_policy =
+        mapping_options_.use_transparent_huge_pages || mapping_options_.numa_node.has_value();
+    const bool prefault_on_map = mapping_options_.prefault && (!has_placement_policy);
+    const auto map_flags =
+        prefault_on_map ? (::score::os::Mman::Map::kShared | ::score::os::Mman::Map::kPopulate)
+                        : ::score::os::Mman::Map::kShared;
+
     // get all the memory _we_ need
-    const auto result = ::score::os::Mman::instance().mmap(nullptr,
-                                                         virtual_address_space_to_reserve_,
-                                                         this->map_mode_,
-                                                         ::score::os::Mman::Map::kShared,
-                                                         this->file_descriptor_,
-                                                         0);
+    const auto result = ::score::os::Mman::instance().mmap(
+        nullptr, virtual_address_space_to_reserve_, this->map_mode_, map_flags, this->file_descriptor_, 0);
 
     if (!result.has_value())
     {
@@ -910,6 +1080,7 @@ auto SharedMemoryResource::mapMemoryIntoProcess() noexcept -> void
     }
 
     this->base_address_ = result.value();
+    ApplyMappingOptions(prefault_on_map);
     const bool inserted = MemoryResourceRegistry::getInstance().insert_resource({memory_identifier_, this});
     if (!inserted)
     {
@@ -921,12 +1092,63 @@ auto SharedMemoryResource::mapMemoryIntoProcess() noexcept -> void
     }
 }
 
+auto SharedMemoryResource::ApplyMappingOptions(const bool is_prefaulted) noexcept -> void
+{
+    const auto& mman = ::score::os::Mman::instance();
+    if (mapping_options_.numa_node.has_value())
+    {
+        const auto result =
+            mman.mbind(base_address_, virtual_address_space_to_reserve_, mapping_options_.numa_node.value());
+        if (!result.has_value())
+        {
+            score::mw::log::LogWarn("shm") << "Could not bind" << log_identification_ << "to NUMA node"
+                                         << mapping_options_.numa_node.value() << ":" << result.error();
+            mapping_options_.numa_node.reset();
+        }
+    }
+    if (mapping_options_.use_transparent_huge_pages)
+    {
+        const auto result =
+            mman.madvise(base_address_, virtual_address_space_to_reserve_, ::score::os::Mman::Advice::kHugePage);
+        if (!result.has_value())
+        {
+            score::mw::log::LogWarn("shm") << "Could not enable transparent huge pages for" << log_identification_
+                                         << ":" << result.error();
+            mapping_options_.use_transparent_huge_pages = false;
+        }
+    }
+    if (mapping_options_.prefault && (!is_prefaulted))
+    {
+        // Populating for writing allocates the pages, populating for reading maps the ones which already exist.
+        using Protection = ::score::os::Mman::Protection;
+        const bool is_writable = map_mode_ & Protection::kWrite;
+        const auto advice =
+            is_writable ? ::score::os::Mman::Advice::kPopulateWrite : ::score::os::Mman::Advice::kPopulateRead;
+        const auto result = mman.madvise(base_address_, virtual_address_space_to_reserve_, advice);
+        if (!result.has_value())
+        {
+            score::mw::log::LogWarn("shm") << "Could not prefault" << log_identification_ << ":" << result.error();
+            mapping_options_.prefault = false;
+        }
+    }
+    if (mapping_options_.lock_in_memory)
+    {
+        const auto result = mman.mlock(base_address_, virtual_address_space_to_reserve_);
+        if (!result.has_value())
+        {
+            score::mw::log::LogWarn("shm")
+                << "Could not lock" << log_identification_ << "into memory:" << result.error();
+            mapping_options_.lock_in_memory = false;
+        }
+    }
+}
+
 auto SharedMemoryResource::initializeControlBlock() noexcept -> void
 {
     // base_address_ is the address we got back from mmap() call and it is therefore guaranteed to be page aligned!
     // Proper usage of the operator new according to Autosar rule A18-5-10.
     // NOLINTNEXTLINE(score-no-dynamic-raw-memory): Placement new is used.
-    this->control_block_ = new (this->base_address_) ControlBlock(memory_identifier_);
+    this->control_block_ = new (this->base_address_) ControlBlock(memory_identifier_, allocation_strategy_);
     // we want the memory region, where later further allocations start from, to be "worst case aligned".
     // The main reason: Reproducibility of memory needs for a deterministic set of allocations.
     constexpr auto aligned_control_block_size = GetNeededManagementSpace();
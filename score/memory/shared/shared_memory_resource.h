@@ -17,6 +17,7 @@
 #include "score/memory/shared/lock_file.h"
 #include "score/memory/shared/memory_resource_proxy.h"
 #include "score/memory/shared/pointer_arithmetic_util.h"
+#include "score/memory/shared/segregated_fit_allocator.h"
 #include "score/memory/shared/typedshm/typedshm_wrapper/typed_memory.h"
 #include "score/os/errno.h"
 #include "score/os/fcntl.h"
@@ -80,6 +81,8 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     /**
      * @brief brief Get the number of bytes allocated by the user in the memory region.
      *        Does not include any house keeping data (such as a control block) allocated by the memory resource.
+     *        With AllocationStrategy::kMonotonicThreadLocalChunks, chunks reserved by threads are counted as a whole.
+     *        With AllocationStrategy::kSegregatedFit, deallocated bytes are not counted, but block headers are.
      * @return number of bytes already allocated by the user
      */
     std::size_t GetUserAllocatedBytes() const noexcept override;
@@ -129,6 +132,8 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
      */
     bool IsShmInTypedMemory() const noexcept override;
 
+    MappingOptions GetMappingOptions() const noexcept override;
+
   protected:
     /// \brief Constructor of the class SharedMemoryResource.
     /// \details Constructor should only be used by SharedMemoryResource::Create, SharedMemoryResource::Open or
@@ -207,6 +212,9 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     void CompensateUmask(const os::Stat::Mode target_rights) const noexcept;
 
     void mapMemoryIntoProcess() noexcept;
+    /// \brief Applies mapping_options_ to the mapping at base_address_ and resets the options that failed.
+    /// \param is_prefaulted whether the pages were already faulted in by mmap().
+    void ApplyMappingOptions(const bool is_prefaulted) noexcept;
     /// \brief initializes the control block, which will be located directly at the start address of the
     ///        SharedMemoryResource (see GetBaseAddress()).
     /// \details It initializes the start member, which points at the location, from where the first (user) memory
@@ -262,6 +270,8 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     /// \param typed_memory_ptr std::unique_ptr to TypedMemory object: When this ptr is not equal to nullptr, it is
     /// responsible of allocating the memory in the typed region, otherwise it is a nullptr by default and memory can be
     /// allocated in the system os.
+    /// \param allocation_strategy how allocations within the created shm-object are synchronized.
+    /// \param mapping_options options for mapping the shm-object into the calling process.
     /// \return in case of error an score::os::Error is returned.
     // coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
     static score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Create(
@@ -270,7 +280,9 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
         InitializeCallback initialize_callback,
         const UserPermissions& permissions,
         AccessControlListFactory acl_factory,
-        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr = nullptr) noexcept;
+        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr = nullptr,
+        const AllocationStrategy allocation_strategy = AllocationStrategy::kMonotonicLocked,
+        const MappingOptions& mapping_options = MappingOptions{}) noexcept;
 
     /// \brief Creates anonymous shared-mem-object.
     /// \attention This implementation only works in QNX environment because typed memory is only implemented for QNX
@@ -287,6 +299,8 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     /// \param typed_memory_ptr std::unique_ptr to TypedMemory object: When this ptr is not equal to nullptr, it is
     /// responsible of allocating the memory in the typed region, otherwise it is a nullptr by default and memory can be
     /// allocated in the system os.
+    /// \param allocation_strategy how allocations within the created shm-object are synchronized.
+    /// \param mapping_options options for mapping the shm-object into the calling process.
     /// \return in case of error an score::os::Error is returned.
     // coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
     static score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> CreateAnonymous(
@@ -295,7 +309,9 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
         InitializeCallback initialize_callback,
         const UserPermissions& permissions,
         AccessControlListFactory acl_factory,
-        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr) noexcept;
+        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr,
+        const AllocationStrategy allocation_strategy = AllocationStrategy::kMonotonicLocked,
+        const MappingOptions& mapping_options = MappingOptions{}) noexcept;
 
     /// \brief Creates shared-mem-object under the path (path_) if it not yet exists or opens it otherwise.
     /// \param input_path path of the memory region: a string that describes a regular file path name that will be
@@ -311,6 +327,8 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     /// \param typed_memory_ptr std::shared_ptr to TypedMemory object: When this ptr is not equal to nullptr, it is
     /// responsible of allocating the memory in the typed region, otherwise it is a nullptr by default and memory can be
     /// allocated in the system os.
+    /// \param allocation_strategy how allocations within the created shm-object are synchronized.
+    /// \param mapping_options options for mapping the shm-object into the calling process.
     /// \return in case of error an score::os::Error is returned.
     // coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
     static score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> CreateOrOpen(
@@ -319,7 +337,9 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
         InitializeCallback initialize_callback,
         const UserPermissions& permissions,
         AccessControlListFactory acl_factory,
-        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr) noexcept;
+        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr,
+        const AllocationStrategy allocation_strategy = AllocationStrategy::kMonotonicLocked,
+        const MappingOptions& mapping_options = MappingOptions{}) noexcept;
 
     /// \brief Opens shared-mem-object under the path (path_) and maps it into memory with the length of the underlying
     ///        shm-object file.
@@ -377,7 +397,14 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     class ControlBlock
     {
       public:
-        explicit ControlBlock(const std::size_t id) noexcept : mutex{}, alreadyAllocatedBytes{}, memoryResourceProxy{id}
+        explicit ControlBlock(
+            const std::size_t id,
+            const AllocationStrategy allocation_strategy = AllocationStrategy::kMonotonicLocked) noexcept
+            : mutex{},
+              alreadyAllocatedBytes{},
+              memoryResourceProxy{id},
+              allocationStrategy{allocation_strategy},
+              segregatedFitState{}
         {
         }
 
@@ -391,6 +418,11 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
         std::atomic<std::size_t> alreadyAllocatedBytes;
         // coverity[autosar_cpp14_m11_0_1_violation]
         MemoryResourceProxy memoryResourceProxy;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        AllocationStrategy allocationStrategy;
+        // Only used with AllocationStrategy::kSegregatedFit
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        detail::SegregatedFitAllocator::State segregatedFitState;
     };
 
     FileDescriptor file_descriptor_;
@@ -414,9 +446,23 @@ class SharedMemoryResource : public ISharedMemoryResource, public std::enable_sh
     // std::variant will contain shared_memory_resource_id (std::uint64_t) in case of anonymous shared memory resource
     std::variant<std::string, std::uint64_t> shared_memory_resource_identifier_;
     void* start_;
+    // Strategy handed over by the creator, the control block holds the one that is actually used
+    AllocationStrategy allocation_strategy_;
+    // Options for the mapping of this process, options that could not be applied are reset after mapping
+    MappingOptions mapping_options_;
+    // Process wide unique number of this instance, which identifies its thread local chunks
+    std::uint64_t instance_id_;
+
+    /// \brief Reserves bytes with the given alignment behind the already allocated bytes with a compare-and-swap.
+    /// \return The aligned address or nullptr if the region is exhausted.
+    void* AllocateMonotonic(const std::size_t bytes, const std::size_t alignment) noexcept;
+    /// \brief Serves small allocations from a chunk that the calling thread reserved via AllocateMonotonic().
+    void* AllocateFromThreadLocalChunk(const std::size_t bytes, const std::size_t alignment) noexcept;
+    /// \brief Allocator that works on the segregated-fit state in the control block. Calls have to hold its mutex.
+    detail::SegregatedFitAllocator GetSegregatedFitAllocator() const noexcept;
 
     void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
-    void do_deallocate(void*, std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override;
     // coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
     bool do_is_equal(const memory_resource& other) const noexcept override;
 
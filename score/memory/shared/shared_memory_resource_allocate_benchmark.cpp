@@ -0,0 +1,114 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/shared_memory_factory.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+using AllocationStrategy = ISharedMemoryResource::AllocationStrategy;
+
+constexpr auto kSharedMemoryPathPrefix = "/shared_memory_resource_allocate_benchmark_";
+constexpr std::size_t kAllocationSize{64U};
+constexpr benchmark::IterationCount kAllocationsPerThread{100000};
+constexpr int kMaxNumberOfThreads{16};
+// Large enough for all allocations of all threads, including the rest of partially used chunks.
+constexpr std::size_t kResourceSize{2U * static_cast<std::size_t>(kMaxNumberOfThreads) *
+                                    static_cast<std::size_t>(kAllocationsPerThread) * kAllocationSize};
+
+/// Threads allocate small blocks from one shared memory region. The region is recreated for every run, since
+/// the monotonic allocation never frees memory.
+class SharedMemoryResourceAllocateFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            path_ = std::string{kSharedMemoryPathPrefix} + std::to_string(state.range(0)) + "_" +
+                    std::to_string(state.threads());
+            SharedMemoryFactory::RemoveStaleArtefacts(path_);
+            resource_ = SharedMemoryFactory::Create(
+                path_,
+                [](std::shared_ptr<ISharedMemoryResource>) noexcept {},
+                kResourceSize,
+                permission::UserPermissionsMap{},
+                false,
+                static_cast<AllocationStrategy>(state.range(0)));
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(resource_ != nullptr, "Could not create shared memory region");
+        }
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            SharedMemoryFactory::Remove(path_);
+            resource_.reset();
+        }
+    }
+
+  protected:
+    std::string path_{};
+    std::shared_ptr<ISharedMemoryResource> resource_{};
+};
+
+BENCHMARK_DEFINE_F(SharedMemoryResourceAllocateFixture, Allocate)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(resource_->allocate(kAllocationSize, alignof(std::max_align_t)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(SharedMemoryResourceAllocateFixture, Allocate)
+    ->ArgName("strategy")
+    ->Arg(static_cast<std::int64_t>(AllocationStrategy::kMonotonicLocked))
+    ->Arg(static_cast<std::int64_t>(AllocationStrategy::kMonotonicLockFree))
+    ->Arg(static_cast<std::int64_t>(AllocationStrategy::kMonotonicThreadLocalChunks))
+    ->Arg(static_cast<std::int64_t>(AllocationStrategy::kSegregatedFit))
+    ->Iterations(kAllocationsPerThread)
+    ->ThreadRange(1, kMaxNumberOfThreads)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(SharedMemoryResourceAllocateFixture, AllocateAndDeallocate)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto* const memory = resource_->allocate(kAllocationSize, alignof(std::max_align_t));
+        benchmark::DoNotOptimize(memory);
+        resource_->deallocate(memory, kAllocationSize, alignof(std::max_align_t));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Only the segregated fit strategy reuses deallocated memory
+BENCHMARK_REGISTER_F(SharedMemoryResourceAllocateFixture, AllocateAndDeallocate)
+    ->ArgName("strategy")
+    ->Arg(static_cast<std::int64_t>(AllocationStrategy::kSegregatedFit))
+    ->Iterations(kAllocationsPerThread)
+    ->ThreadRange(1, kMaxNumberOfThreads)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace score::memory::shared
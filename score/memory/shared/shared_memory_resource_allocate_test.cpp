@@ -19,9 +19,13 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace score::memory::shared::test
 {
@@ -37,6 +41,49 @@ using Fcntl = score::os::Fcntl;
 using Error = score::os::Error;
 
 using ControlBlock = SharedMemoryResourceTestAttorney::ControlBlock;
+using AllocationStrategy = ISharedMemoryResource::AllocationStrategy;
+
+constexpr std::size_t kNumberOfAllocatingThreads{4U};
+constexpr std::size_t kAllocationsPerThread{100U};
+constexpr std::size_t kAllocationSize{16U};
+
+// Allocates concurrently from several threads and checks that all returned blocks lie within the memory region and
+// do not overlap.
+void ExpectConcurrentAllocationsAreDisjoint(SharedMemoryResource& resource, const void* const region_end)
+{
+    std::array<std::vector<void*>, kNumberOfAllocatingThreads> allocations{};
+    std::vector<std::thread> threads{};
+    for (auto& thread_allocations : allocations)
+    {
+        threads.emplace_back([&resource, &thread_allocations]() {
+            for (std::size_t i{0U}; i < kAllocationsPerThread; ++i)
+            {
+                thread_allocations.push_back(resource.allocate(kAllocationSize, alignof(std::uint64_t)));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<std::uintptr_t> addresses{};
+    for (const auto& thread_allocations : allocations)
+    {
+        for (auto* const allocation : thread_allocations)
+        {
+            EXPECT_TRUE(is_aligned(allocation, alignof(std::uint64_t)));
+            EXPECT_GE(allocation, resource.getUsableBaseAddress());
+            EXPECT_LE(static_cast<const void*>(static_cast<std::uint8_t*>(allocation) + kAllocationSize), region_end);
+            addresses.push_back(reinterpret_cast<std::uintptr_t>(allocation));
+        }
+    }
+    std::sort(addresses.begin(), addresses.end());
+    for (std::size_t i{1U}; i < addresses.size(); ++i)
+    {
+        EXPECT_GE(addresses.at(i) - addresses.at(i - 1U), kAllocationSize);
+    }
+}
 
 using SharedMemoryResourceAllocateTest = SharedMemoryResourceTest;
 TEST_F(SharedMemoryResourceAllocateTest, AssociatedMemoryResourceProxyForwardsCallsCorrectly)
@@ -340,4 +387,176 @@ TEST_F(SharedMemoryResourceAllocateDeathTest, AllocatingMultipleBlocksLargerThan
     EXPECT_DEATH(attorney2.getMemoryResourceProxy()->allocate(remaining_memory + 1), ".*");
 }
 
+TEST_F(SharedMemoryResourceAllocateTest, LockFreeStrategyHandsOutDisjointBlocksToConcurrentThreads)
+{
+    RecordProperty(
+        "Description",
+        "Concurrent allocations with the lock-free strategy shall return disjoint blocks within the region.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr std::int32_t file_descriptor = 5;
+    constexpr bool is_read_write = true;
+
+    alignas(std::max_align_t) std::array<std::uint8_t, TestValues::some_share_memory_size> dataRegion{};
+    auto id = score::cpp::hash_bytes(TestValues::sharedMemorySegmentPath, strlen(TestValues::sharedMemorySegmentPath));
+    auto* const control_block = new (dataRegion.data()) ControlBlock(id, AllocationStrategy::kMonotonicLockFree);
+    control_block->alreadyAllocatedBytes = SharedMemoryResourceTestAttorney::GetNeededManagementSpace();
+
+    // Given a SharedMemoryResource that opens a shared memory region created with the lock-free strategy
+    expectSharedMemorySuccessfullyOpened(file_descriptor, is_read_write, dataRegion.data());
+    auto resource_result = SharedMemoryResourceTestAttorney::Open(TestValues::sharedMemorySegmentPath, is_read_write);
+    ASSERT_TRUE(resource_result.has_value());
+    auto resource = resource_result.value();
+
+    // When allocating from several threads at the same time
+    // Then all blocks are aligned, within the region and do not overlap
+    ExpectConcurrentAllocationsAreDisjoint(*resource, dataRegion.data() + dataRegion.size());
+
+    // and exactly the requested bytes are accounted, since no padding is needed
+    EXPECT_EQ(resource->GetUserAllocatedBytes(), kNumberOfAllocatingThreads * kAllocationsPerThread * kAllocationSize);
+}
+
+TEST_F(SharedMemoryResourceAllocateTest, ThreadLocalChunksStrategyHandsOutDisjointBlocksToConcurrentThreads)
+{
+    RecordProperty("Description",
+                   "Concurrent allocations with the thread local chunks strategy shall return disjoint blocks within "
+                   "the region.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr std::int32_t file_descriptor = 5;
+    constexpr bool is_read_write = true;
+
+    alignas(std::max_align_t) std::array<std::uint8_t, TestValues::some_share_memory_size> dataRegion{};
+    auto id = score::cpp::hash_bytes(TestValues::sharedMemorySegmentPath, strlen(TestValues::sharedMemorySegmentPath));
+    auto* const control_block =
+        new (dataRegion.data()) ControlBlock(id, AllocationStrategy::kMonotonicThreadLocalChunks);
+    control_block->alreadyAllocatedBytes = SharedMemoryResourceTestAttorney::GetNeededManagementSpace();
+
+    // Given a SharedMemoryResource that opens a shared memory region created with the thread local chunks strategy
+    expectSharedMemorySuccessfullyOpened(file_descriptor, is_read_write, dataRegion.data());
+    auto resource_result = SharedMemoryResourceTestAttorney::Open(TestValues::sharedMemorySegmentPath, is_read_write);
+    ASSERT_TRUE(resource_result.has_value());
+    auto resource = resource_result.value();
+
+    // When allocating from several threads at the same time
+    // Then all blocks are aligned, within the region and do not overlap
+    ExpectConcurrentAllocationsAreDisjoint(*resource, dataRegion.data() + dataRegion.size());
+}
+
+TEST_F(SharedMemoryResourceAllocateTest, ThreadLocalChunksStrategyServesSmallAllocationsFromOneChunk)
+{
+    RecordProperty("Description",
+                   "With the thread local chunks strategy, small allocations of a thread shall be served from one "
+                   "reserved chunk and large allocations shall be reserved directly.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr std::int32_t file_descriptor = 5;
+    constexpr bool is_read_write = true;
+    constexpr std::size_t chunk_size{4096U};
+    constexpr std::size_t large_allocation_size{2048U};
+
+    alignas(std::max_align_t) std::array<std::uint8_t, TestValues::some_share_memory_size> dataRegion{};
+    auto id = score::cpp::hash_bytes(TestValues::sharedMemorySegmentPath, strlen(TestValues::sharedMemorySegmentPath));
+    auto* const control_block =
+        new (dataRegion.data()) ControlBlock(id, AllocationStrategy::kMonotonicThreadLocalChunks);
+    control_block->alreadyAllocatedBytes = SharedMemoryResourceTestAttorney::GetNeededManagementSpace();
+
+    // Given a SharedMemoryResource that opens a shared memory region created with the thread local chunks strategy
+    expectSharedMemorySuccessfullyOpened(file_descriptor, is_read_write, dataRegion.data());
+    auto resource_result = SharedMemoryResourceTestAttorney::Open(TestValues::sharedMemorySegmentPath, is_read_write);
+    ASSERT_TRUE(resource_result.has_value());
+    auto resource = resource_result.value();
+
+    // When allocating two small blocks
+    auto* const first_allocation = resource->allocate(kAllocationSize, alignof(std::uint64_t));
+    auto* const second_allocation = resource->allocate(kAllocationSize, alignof(std::uint64_t));
+
+    // Then they are placed next to each other in one reserved chunk
+    EXPECT_EQ(static_cast<std::uint8_t*>(first_allocation) + kAllocationSize, second_allocation);
+    EXPECT_EQ(resource->GetUserAllocatedBytes(), chunk_size);
+
+    // When allocating a large block
+    auto* const large_allocation = resource->allocate(large_allocation_size, alignof(std::uint64_t));
+
+    // Then it is reserved directly behind the chunk
+    EXPECT_EQ(large_allocation, static_cast<std::uint8_t*>(first_allocation) + chunk_size);
+    EXPECT_EQ(resource->GetUserAllocatedBytes(), chunk_size + large_allocation_size);
+}
+
+TEST_F(SharedMemoryResourceAllocateTest, SegregatedFitStrategyReusesDeallocatedMemory)
+{
+    RecordProperty("Description",
+                   "With the segregated fit strategy, deallocated memory shall be reused by later allocations.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr std::int32_t file_descriptor = 5;
+    constexpr bool is_read_write = true;
+
+    alignas(std::max_align_t) std::array<std::uint8_t, TestValues::some_share_memory_size> dataRegion{};
+    auto id = score::cpp::hash_bytes(TestValues::sharedMemorySegmentPath, strlen(TestValues::sharedMemorySegmentPath));
+    auto* const control_block = new (dataRegion.data()) ControlBlock(id, AllocationStrategy::kSegregatedFit);
+    control_block->alreadyAllocatedBytes = SharedMemoryResourceTestAttorney::GetNeededManagementSpace();
+
+    // Given a SharedMemoryResource that opens a shared memory region created with the segregated fit strategy
+    expectSharedMemorySuccessfullyOpened(file_descriptor, is_read_write, dataRegion.data());
+    auto resource_result = SharedMemoryResourceTestAttorney::Open(TestValues::sharedMemorySegmentPath, is_read_write);
+    ASSERT_TRUE(resource_result.has_value());
+    auto resource = resource_result.value();
+
+    // and two allocations of which the first is deallocated again
+    auto* const first_allocation = resource->allocate(kAllocationSize, alignof(std::uint64_t));
+    auto* const second_allocation = resource->allocate(kAllocationSize, alignof(std::uint64_t));
+    const auto allocated_bytes = resource->GetUserAllocatedBytes();
+    resource->deallocate(first_allocation, kAllocationSize, alignof(std::uint64_t));
+    EXPECT_LT(resource->GetUserAllocatedBytes(), allocated_bytes);
+
+    // When allocating the same size again
+    auto* const third_allocation = resource->allocate(kAllocationSize, alignof(std::uint64_t));
+
+    // Then the deallocated memory is reused
+    EXPECT_EQ(third_allocation, first_allocation);
+    EXPECT_EQ(resource->GetUserAllocatedBytes(), allocated_bytes);
+
+    // and deallocating everything gives back all memory
+    resource->deallocate(second_allocation, kAllocationSize, alignof(std::uint64_t));
+    resource->deallocate(third_allocation, kAllocationSize, alignof(std::uint64_t));
+    EXPECT_EQ(resource->GetUserAllocatedBytes(), 0U);
+}
+
+TEST_F(SharedMemoryResourceAllocateTest, SegregatedFitStrategyHandsOutDisjointBlocksToConcurrentThreads)
+{
+    RecordProperty("Description",
+                   "Concurrent allocations with the segregated fit strategy shall return disjoint blocks within the "
+                   "region.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr std::int32_t file_descriptor = 5;
+    constexpr bool is_read_write = true;
+
+    alignas(std::max_align_t) std::array<std::uint8_t, TestValues::some_share_memory_size> dataRegion{};
+    auto id = score::cpp::hash_bytes(TestValues::sharedMemorySegmentPath, strlen(TestValues::sharedMemorySegmentPath));
+    auto* const control_block = new (dataRegion.data()) ControlBlock(id, AllocationStrategy::kSegregatedFit);
+    control_block->alreadyAllocatedBytes = SharedMemoryResourceTestAttorney::GetNeededManagementSpace();
+
+    // Given a SharedMemoryResource that opens a shared memory region created with the segregated fit strategy
+    expectSharedMemorySuccessfullyOpened(file_descriptor, is_read_write, dataRegion.data());
+    auto resource_result = SharedMemoryResourceTestAttorney::Open(TestValues::sharedMemorySegmentPath, is_read_write);
+    ASSERT_TRUE(resource_result.has_value());
+    auto resource = resource_result.value();
+
+    // When allocating from several threads at the same time
+    // Then all blocks are aligned, within the region and do not overlap
+    ExpectConcurrentAllocationsAreDisjoint(*resource, dataRegion.data() + dataRegion.size());
+}
+
 }  // namespace score::memory::shared::test
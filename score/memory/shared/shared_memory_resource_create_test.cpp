@@ -560,6 +560,145 @@ TEST_F(SharedMemoryResourceCreateTest, CreatingSharedMemoryFillsRegistryKnownReg
               TestValues::some_share_memory_size + SharedMemoryResourceTestAttorney::GetNeededManagementSpace());
 }
 
+TEST_F(SharedMemoryResourceCreateTest, MappingOptionsAreAppliedToTheMappedRegion)
+{
+    constexpr std::int32_t file_descriptor = 1;
+    constexpr std::int32_t lock_file_descriptor = 5;
+    constexpr std::uint32_t numa_node{1U};
+
+    // Given that we can successfully create a shared memory region
+    alignas(std::alignment_of<ControlBlock>::value) std::array<std::uint8_t, 500U> dataRegion{};
+    expectSharedMemorySuccessfullyCreated(file_descriptor, lock_file_descriptor, dataRegion.data());
+
+    // Then the mapped region is bound to the NUMA node before it is backed by huge pages, prefaulted and locked
+    {
+        InSequence sequence{};
+        EXPECT_CALL(*mman_mock_, mbind(dataRegion.data(), _, numa_node)).WillOnce(Return(score::cpp::blank{}));
+        EXPECT_CALL(*mman_mock_, madvise(dataRegion.data(), _, Mman::Advice::kHugePage))
+            .WillOnce(Return(score::cpp::blank{}));
+        EXPECT_CALL(*mman_mock_, madvise(dataRegion.data(), _, Mman::Advice::kPopulateWrite))
+            .WillOnce(Return(score::cpp::blank{}));
+        EXPECT_CALL(*mman_mock_, mlock(dataRegion.data(), _)).WillOnce(Return(score::cpp::blank{}));
+    }
+
+    // and the memory region is safely unmapped on destruction
+    EXPECT_CALL(*mman_mock_, munmap(_, _));
+    EXPECT_CALL(*unistd_mock_, close(file_descriptor));
+
+    // When constructing a SharedMemoryResource with all mapping options
+    SharedMemoryResource::MappingOptions mapping_options{};
+    mapping_options.use_transparent_huge_pages = true;
+    mapping_options.prefault = true;
+    mapping_options.lock_in_memory = true;
+    mapping_options.numa_node = numa_node;
+    auto resource_result = SharedMemoryResourceTestAttorney::Create(TestValues::sharedMemorySegmentPath,
+                                                                    TestValues::some_share_memory_size,
+                                                                    emptyInitCallback,
+                                                                    {},
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    mapping_options);
+    ASSERT_TRUE(resource_result.has_value());
+
+    // Then all options are reported as applied
+    const auto applied_options = resource_result.value()->GetMappingOptions();
+    EXPECT_TRUE(applied_options.use_transparent_huge_pages);
+    EXPECT_TRUE(applied_options.prefault);
+    EXPECT_TRUE(applied_options.lock_in_memory);
+    EXPECT_EQ(applied_options.numa_node, numa_node);
+}
+
+TEST_F(SharedMemoryResourceCreateTest, MappingOptionsThatCouldNotBeAppliedAreReportedAsNotApplied)
+{
+    constexpr std::int32_t file_descriptor = 1;
+    constexpr std::int32_t lock_file_descriptor = 5;
+
+    // Given that we can successfully create a shared memory region
+    alignas(std::alignment_of<ControlBlock>::value) std::array<std::uint8_t, 500U> dataRegion{};
+    expectSharedMemorySuccessfullyCreated(file_descriptor, lock_file_descriptor, dataRegion.data());
+
+    // but neither binding to a NUMA node, nor huge pages, nor locking is possible
+    EXPECT_CALL(*mman_mock_, mbind(_, _, _))
+        .WillOnce(Return(score::cpp::make_unexpected(Error::createFromErrno(ENOTSUP))));
+    EXPECT_CALL(*mman_mock_, madvise(_, _, Mman::Advice::kHugePage))
+        .WillOnce(Return(score::cpp::make_unexpected(Error::createFromErrno(EINVAL))));
+    EXPECT_CALL(*mman_mock_, mlock(_, _)).WillOnce(Return(score::cpp::make_unexpected(Error::createFromErrno(EPERM))));
+
+    // and the memory region is safely unmapped on destruction
+    EXPECT_CALL(*mman_mock_, munmap(_, _));
+    EXPECT_CALL(*unistd_mock_, close(file_descriptor));
+
+    // When constructing a SharedMemoryResource with these mapping options
+    SharedMemoryResource::MappingOptions mapping_options{};
+    mapping_options.use_transparent_huge_pages = true;
+    mapping_options.lock_in_memory = true;
+    mapping_options.numa_node = 0U;
+    auto resource_result = SharedMemoryResourceTestAttorney::Create(TestValues::sharedMemorySegmentPath,
+                                                                    TestValues::some_share_memory_size,
+                                                                    emptyInitCallback,
+                                                                    {},
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    mapping_options);
+
+    // Then the resource is still created
+    ASSERT_TRUE(resource_result.has_value());
+
+    // but the options are reported as not applied
+    const auto applied_options = resource_result.value()->GetMappingOptions();
+    EXPECT_FALSE(applied_options.use_transparent_huge_pages);
+    EXPECT_FALSE(applied_options.lock_in_memory);
+    EXPECT_FALSE(applied_options.numa_node.has_value());
+}
+
+TEST_F(SharedMemoryResourceCreateTest, PrefaultWithoutPlacementPolicyPopulatesTheMappingWhenMapping)
+{
+    InSequence sequence{};
+    constexpr std::int32_t file_descriptor = 1;
+    constexpr std::int32_t lock_file_descriptor = 5;
+
+    // Given that we can create the lock file and the shared memory
+    alignas(std::alignment_of<ControlBlock>::value) std::array<std::uint8_t, 500U> dataRegion{};
+    expectCreateLockFileReturns(TestValues::sharedMemorySegmentLockPath, lock_file_descriptor);
+    expectShmOpenWithCreateFlagReturns(TestValues::sharedMemorySegmentPath, file_descriptor);
+    expectFstatReturns(file_descriptor);
+    EXPECT_CALL(*unistd_mock_, ftruncate(_, _)).WillOnce(Return(score::cpp::blank{}));
+
+    // Then the memory is mapped with the populate flag
+    EXPECT_CALL(*mman_mock_,
+                mmap(nullptr,
+                     _,
+                     Mman::Protection::kRead | Mman::Protection::kWrite,
+                     Mman::Map::kShared | Mman::Map::kPopulate,
+                     file_descriptor,
+                     0))
+        .WillOnce(Return(dataRegion.data()));
+
+    // and is not populated a second time
+    EXPECT_CALL(*mman_mock_, madvise(_, _, _)).Times(0);
+
+    // and afterwards the lock file is cleaned up and the memory region is safely unmapped on destruction
+    EXPECT_CALL(*unistd_mock_, close(lock_file_descriptor));
+    EXPECT_CALL(*unistd_mock_, unlink(StrEq(TestValues::sharedMemorySegmentLockPath)));
+    EXPECT_CALL(*mman_mock_, munmap(_, _));
+    EXPECT_CALL(*unistd_mock_, close(file_descriptor));
+
+    // When constructing a SharedMemoryResource which shall be prefaulted
+    SharedMemoryResource::MappingOptions mapping_options{};
+    mapping_options.prefault = true;
+    auto resource_result = SharedMemoryResourceTestAttorney::Create(TestValues::sharedMemorySegmentPath,
+                                                                    TestValues::some_share_memory_size,
+                                                                    emptyInitCallback,
+                                                                    {},
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    mapping_options);
+    ASSERT_TRUE(resource_result.has_value());
+
+    // Then prefaulting is reported as applied
+    EXPECT_TRUE(resource_result.value()->GetMappingOptions().prefault);
+}
+
 TEST_F(SharedMemoryResourceCreateTest, UnableToOverwriteSharedMemorySegment)
 {
     InSequence sequence{};
@@ -45,6 +45,7 @@ class SharedMemoryResourceHeapAllocatorMock : public ISharedMemoryResource
     MOCK_METHOD(bool, IsOffsetPtrBoundsCheckBypassingEnabled, (), (const, noexcept, override));
 
     MOCK_METHOD(std::string_view, GetIdentifier, (), (const, noexcept, override));
+    MOCK_METHOD(MappingOptions, GetMappingOptions, (), (const, noexcept, override));
 
     const MemoryResourceProxy* getMemoryResourceProxy() noexcept override
     {
@@ -0,0 +1,137 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/shared_memory_factory.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+
+#include <sys/resource.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+using MappingOptions = ISharedMemoryResource::MappingOptions;
+
+constexpr auto kSharedMemoryPath = "/shared_memory_resource_mapping_benchmark";
+constexpr std::size_t kResourceSize{64U * 1024U * 1024U};
+constexpr std::size_t kPageSize{4096U};
+constexpr std::size_t kNumberOfRandomAccesses{1024U * 1024U};
+
+// Bits of the benchmark argument, which select the mapping options.
+constexpr std::int64_t kTransparentHugePagesBit{1};
+constexpr std::int64_t kPrefaultBit{2};
+constexpr std::int64_t kLockInMemoryBit{4};
+
+MappingOptions GetMappingOptions(const std::int64_t option_bits) noexcept
+{
+    MappingOptions mapping_options{};
+    mapping_options.use_transparent_huge_pages = (option_bits & kTransparentHugePagesBit) != 0;
+    mapping_options.prefault = (option_bits & kPrefaultBit) != 0;
+    mapping_options.lock_in_memory = (option_bits & kLockInMemoryBit) != 0;
+    return mapping_options;
+}
+
+std::shared_ptr<ISharedMemoryResource> CreateResource(const MappingOptions& mapping_options) noexcept
+{
+    SharedMemoryFactory::RemoveStaleArtefacts(kSharedMemoryPath);
+    auto resource = SharedMemoryFactory::Create(
+        kSharedMemoryPath,
+        [](std::shared_ptr<ISharedMemoryResource>) noexcept {},
+        kResourceSize,
+        permission::UserPermissionsMap{},
+        false,
+        ISharedMemoryResource::AllocationStrategy::kMonotonicLocked,
+        mapping_options);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(resource != nullptr, "Could not create shared memory region");
+    return resource;
+}
+
+std::int64_t GetMinorPageFaults() noexcept
+{
+    rusage usage{};
+    ::getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::int64_t>(usage.ru_minflt);
+}
+
+void TouchEveryPage(const ISharedMemoryResource& resource) noexcept
+{
+    auto* const start = static_cast<volatile std::uint8_t*>(resource.getUsableBaseAddress());
+    for (std::size_t offset = 0U; offset < kResourceSize; offset += kPageSize)
+    {
+        start[offset] = 1U;
+    }
+}
+
+/// Measures the creation of a region including the first write to each of its pages and counts the minor page faults
+/// which are taken during the first touch.
+void CreateAndTouch(benchmark::State& state)
+{
+    const auto mapping_options = GetMappingOptions(state.range(0));
+    std::int64_t first_touch_page_faults{0};
+    MappingOptions applied_options{};
+    for (auto _ : state)
+    {
+        auto resource = CreateResource(mapping_options);
+        const auto page_faults_before_touch = GetMinorPageFaults();
+        TouchEveryPage(*resource);
+        first_touch_page_faults += GetMinorPageFaults() - page_faults_before_touch;
+        applied_options = resource->GetMappingOptions();
+
+        state.PauseTiming();
+        SharedMemoryFactory::Remove(kSharedMemoryPath);
+        resource.reset();
+        state.ResumeTiming();
+    }
+    state.counters["first_touch_page_faults"] =
+        benchmark::Counter(static_cast<double>(first_touch_page_faults), benchmark::Counter::kAvgIterations);
+    state.counters["huge_pages_applied"] = applied_options.use_transparent_huge_pages ? 1.0 : 0.0;
+    state.counters["locked_applied"] = applied_options.lock_in_memory ? 1.0 : 0.0;
+}
+BENCHMARK(CreateAndTouch)
+    ->ArgName("options")
+    ->DenseRange(0, kTransparentHugePagesBit | kPrefaultBit | kLockInMemoryBit)
+    ->Unit(benchmark::kMillisecond);
+
+/// Measures the latency of reads at random addresses of an already touched region, which mainly depends on the
+/// TLB misses and thus on the page size backing the region.
+void RandomAccess(benchmark::State& state)
+{
+    auto resource = CreateResource(GetMappingOptions(state.range(0)));
+    TouchEveryPage(*resource);
+    const auto* const start = static_cast<const volatile std::uint8_t*>(resource->getUsableBaseAddress());
+
+    std::mt19937_64 generator{42U};
+    std::uniform_int_distribution<std::size_t> offset_distribution{0U, kResourceSize - 1U};
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0U; i < kNumberOfRandomAccesses; ++i)
+        {
+            benchmark::DoNotOptimize(start[offset_distribution(generator)]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kNumberOfRandomAccesses));
+
+    SharedMemoryFactory::Remove(kSharedMemoryPath);
+}
+BENCHMARK(RandomAccess)->ArgName("options")->Arg(0)->Arg(kTransparentHugePagesBit)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace score::memory::shared
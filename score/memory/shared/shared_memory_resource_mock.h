@@ -52,6 +52,7 @@ class SharedMemoryResourceMock : public ISharedMemoryResource
     MOCK_METHOD(bool, IsOffsetPtrBoundsCheckBypassingEnabled, (), (const, noexcept, override));
 
     MOCK_METHOD(std::string_view, GetIdentifier, (), (const, noexcept, override));
+    MOCK_METHOD(MappingOptions, GetMappingOptions, (), (const, noexcept, override));
 };
 
 }  // namespace score::memory::shared
@@ -109,7 +109,8 @@ score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Sh
     SharedMemoryResource::InitializeCallback initialize_callback,
     const UserPermissions& permissions,
     score::os::IAccessControlList* acl_control_list,
-    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr) noexcept
+    std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr,
+    const SharedMemoryResource::MappingOptions& mapping_options) noexcept
 {
     if (acl_control_list == nullptr)
     {
@@ -121,7 +122,9 @@ score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Sh
             [](std::int32_t file_descriptor) mutable noexcept -> std::unique_ptr<score::os::IAccessControlList> {
                 return std::make_unique<score::os::AccessControlList>(file_descriptor);
             },
-            typed_memory_ptr);
+            typed_memory_ptr,
+            SharedMemoryResource::AllocationStrategy::kMonotonicLocked,
+            mapping_options);
     }
     else
     {
@@ -133,7 +136,9 @@ score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> Sh
             [acl_control_list](std::int32_t) noexcept -> std::unique_ptr<score::os::IAccessControlList> {
                 return std::make_unique<IAccessControlListMockWrapper>(acl_control_list);
             },
-            typed_memory_ptr);
+            typed_memory_ptr,
+            SharedMemoryResource::AllocationStrategy::kMonotonicLocked,
+            mapping_options);
     }
 }
 
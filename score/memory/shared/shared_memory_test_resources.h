@@ -88,7 +88,8 @@ class SharedMemoryResourceTestAttorney
         SharedMemoryResource::InitializeCallback initialize_callback,
         const UserPermissions& permissions = {},
         score::os::IAccessControlList* acl_control_list = nullptr,
-        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr = nullptr) noexcept;
+        std::shared_ptr<score::memory::shared::TypedMemory> typed_memory_ptr = nullptr,
+        const SharedMemoryResource::MappingOptions& mapping_options = {}) noexcept;
 
     static score::cpp::expected<std::shared_ptr<SharedMemoryResource>, score::os::Error> CreateAnonymous(
         std::uint64_t shared_memory_resource_id,
@@ -0,0 +1,182 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_SORTED_REGION_ARRAY_H
+#define SCORE_LIB_MEMORY_SHARED_SORTED_REGION_ARRAY_H
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace score::memory::shared::detail
+{
+
+/// \brief Memory regions stored as pairs of start and end address in an array of fixed capacity, which is sorted by the
+/// start address.
+///
+/// \details Provides the part of the interface of std::map<std::uintptr_t, std::uintptr_t>, which is used by
+///          MemoryRegionMapImpl. Opposed to std::map, the regions are stored contiguously and no memory is allocated,
+///          neither when inserting nor when copying. Only the used part of the array is copied. Lookups use a
+///          branchless binary search. Insertion and removal move the regions behind the changed position, which is
+///          cheap for the few hundred regions a process maps.
+template <std::size_t Capacity>
+class SortedRegionArray
+{
+    static_assert(Capacity > 0U, "SortedRegionArray must be able to store at least one region");
+
+  public:
+    using key_type = std::uintptr_t;
+    using mapped_type = std::uintptr_t;
+    using value_type = std::pair<key_type, mapped_type>;
+    using size_type = std::size_t;
+    using const_iterator = const value_type*;
+
+    SortedRegionArray() noexcept = default;
+    ~SortedRegionArray() noexcept = default;
+
+    SortedRegionArray(const SortedRegionArray& other) noexcept : regions_{}, size_{other.size_}
+    {
+        score::cpp::ignore = std::copy_n(other.regions_.cbegin(), other.size_, regions_.begin());
+    }
+
+    SortedRegionArray& operator=(const SortedRegionArray& other) & noexcept
+    {
+        if (this != &other)
+        {
+            score::cpp::ignore = std::copy_n(other.regions_.cbegin(), other.size_, regions_.begin());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    SortedRegionArray(SortedRegionArray&&) noexcept = delete;
+    SortedRegionArray& operator=(SortedRegionArray&&) & noexcept = delete;
+
+    const_iterator cbegin() const noexcept
+    {
+        return regions_.data();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return regions_.data() + size_;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0U;
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    static constexpr size_type max_size() noexcept
+    {
+        return Capacity;
+    }
+
+    /// \brief Returns the first region with a start address greater than key or cend(), if there is none.
+    const_iterator upper_bound(const key_type key) const noexcept
+    {
+        if (size_ == 0U)
+        {
+            return cend();
+        }
+        // Branchless binary search: The range, which contains the result, is halved in every step without a data
+        // dependent branch, which can be mispredicted.
+        const value_type* base = regions_.data();
+        size_type length = size_;
+        while (length > 1U)
+        {
+            const size_type half = length / 2U;
+            base = (base[half].first <= key) ? (base + half) : base;
+            length -= half;
+        }
+        return (base->first <= key) ? (base + 1) : base;
+    }
+
+    const_iterator find(const key_type key) const noexcept
+    {
+        const auto it = upper_bound(key);
+        if ((it != cbegin()) && ((it - 1)->first == key))
+        {
+            return it - 1;
+        }
+        return cend();
+    }
+
+    /// \brief Inserts the region, if there is no region with the same start address yet.
+    /// \pre size() < max_size()
+    /// \return the inserted or already existing region and whether the region was inserted.
+    std::pair<const_iterator, bool> insert(const value_type& region) noexcept
+    {
+        const auto existing_it = find(region.first);
+        if (existing_it != cend())
+        {
+            return {existing_it, false};
+        }
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(size_ < Capacity, "SortedRegionArray is full");
+
+        const auto index = static_cast<size_type>(upper_bound(region.first) - cbegin());
+        score::cpp::ignore = std::move_backward(
+            regions_.begin() + static_cast<std::ptrdiff_t>(index),
+            regions_.begin() + static_cast<std::ptrdiff_t>(size_),
+            regions_.begin() + static_cast<std::ptrdiff_t>(size_ + 1U));
+        regions_[index] = region;
+        ++size_;
+        return {cbegin() + index, true};
+    }
+
+    /// \brief Removes the region at the given position.
+    /// \return the region behind the removed one.
+    const_iterator erase(const const_iterator position) noexcept
+    {
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE((position >= cbegin()) && (position < cend()),
+                                                    "Cannot erase region outside of SortedRegionArray");
+        const auto index = static_cast<std::ptrdiff_t>(position - cbegin());
+        score::cpp::ignore = std::move(regions_.begin() + index + 1,
+                                       regions_.begin() + static_cast<std::ptrdiff_t>(size_),
+                                       regions_.begin() + index);
+        --size_;
+        return cbegin() + index;
+    }
+
+    void clear() noexcept
+    {
+        size_ = 0U;
+    }
+
+  private:
+    std::array<value_type, Capacity> regions_{};
+    size_type size_{0U};
+};
+
+}  // namespace score::memory::shared::detail
+
+#endif  // SCORE_LIB_MEMORY_SHARED_SORTED_REGION_ARRAY_H
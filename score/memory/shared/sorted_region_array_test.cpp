@@ -0,0 +1,161 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/sorted_region_array.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+
+namespace score::memory::shared::detail
+{
+namespace
+{
+
+using Regions = SortedRegionArray<8U>;
+
+TEST(SortedRegionArrayTest, InsertedRegionsAreSortedByStartAddress)
+{
+    // Given an empty SortedRegionArray
+    Regions unit{};
+    EXPECT_TRUE(unit.empty());
+
+    // When inserting regions in arbitrary order
+    EXPECT_TRUE(unit.insert({300U, 350U}).second);
+    EXPECT_TRUE(unit.insert({100U, 150U}).second);
+    EXPECT_TRUE(unit.insert({200U, 250U}).second);
+
+    // Then they are stored sorted by their start address
+    ASSERT_EQ(unit.size(), 3U);
+    EXPECT_EQ(unit.cbegin()[0], (Regions::value_type{100U, 150U}));
+    EXPECT_EQ(unit.cbegin()[1], (Regions::value_type{200U, 250U}));
+    EXPECT_EQ(unit.cbegin()[2], (Regions::value_type{300U, 350U}));
+}
+
+TEST(SortedRegionArrayTest, InsertingExistingStartAddressReturnsExistingRegion)
+{
+    // Given a SortedRegionArray with one region
+    Regions unit{};
+    ASSERT_TRUE(unit.insert({100U, 150U}).second);
+
+    // When inserting a region with the same start address
+    const auto result = unit.insert({100U, 200U});
+
+    // Then the existing region is returned and not changed
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(result.first, unit.cbegin());
+    EXPECT_EQ(result.first->second, 150U);
+    EXPECT_EQ(unit.size(), 1U);
+}
+
+TEST(SortedRegionArrayTest, EraseRemovesOnlyTheGivenRegion)
+{
+    // Given a SortedRegionArray with three regions
+    Regions unit{};
+    ASSERT_TRUE(unit.insert({100U, 150U}).second);
+    ASSERT_TRUE(unit.insert({200U, 250U}).second);
+    ASSERT_TRUE(unit.insert({300U, 350U}).second);
+
+    // When erasing the middle region
+    const auto next = unit.erase(unit.find(200U));
+
+    // Then the other regions remain in order
+    ASSERT_EQ(unit.size(), 2U);
+    EXPECT_EQ(next->first, 300U);
+    EXPECT_EQ(unit.find(200U), unit.cend());
+    EXPECT_EQ(unit.cbegin()[0].first, 100U);
+    EXPECT_EQ(unit.cbegin()[1].first, 300U);
+}
+
+TEST(SortedRegionArrayTest, CopyContainsSameRegions)
+{
+    // Given a SortedRegionArray with two regions
+    Regions unit{};
+    ASSERT_TRUE(unit.insert({100U, 150U}).second);
+    ASSERT_TRUE(unit.insert({200U, 250U}).second);
+
+    // When copying it into an array with more regions
+    Regions copy{};
+    ASSERT_TRUE(copy.insert({50U, 60U}).second);
+    ASSERT_TRUE(copy.insert({70U, 80U}).second);
+    ASSERT_TRUE(copy.insert({90U, 95U}).second);
+    copy = unit;
+    const Regions copy_constructed{unit};
+
+    // Then both copies contain exactly the regions of the original
+    ASSERT_EQ(copy.size(), 2U);
+    ASSERT_EQ(copy_constructed.size(), 2U);
+    EXPECT_TRUE(std::equal(unit.cbegin(), unit.cend(), copy.cbegin()));
+    EXPECT_TRUE(std::equal(unit.cbegin(), unit.cend(), copy_constructed.cbegin()));
+}
+
+TEST(SortedRegionArrayTest, ClearRemovesAllRegions)
+{
+    // Given a SortedRegionArray with one region
+    Regions unit{};
+    ASSERT_TRUE(unit.insert({100U, 150U}).second);
+
+    // When clearing it
+    unit.clear();
+
+    // Then it is empty
+    EXPECT_TRUE(unit.empty());
+    EXPECT_EQ(unit.find(100U), unit.cend());
+}
+
+TEST(SortedRegionArrayDeathTest, InsertingIntoFullArrayTerminates)
+{
+    // Given a full SortedRegionArray
+    Regions unit{};
+    for (std::uintptr_t i = 1U; i <= Regions::max_size(); ++i)
+    {
+        ASSERT_TRUE(unit.insert({i * 100U, (i * 100U) + 50U}).second);
+    }
+
+    // When inserting another region
+    // Then the program terminates
+    EXPECT_DEATH(score::cpp::ignore = unit.insert({50U, 60U}), ".*");
+}
+
+TEST(SortedRegionArrayTest, LookupsMatchStdMap)
+{
+    // Given a SortedRegionArray and a std::map with the same random regions
+    SortedRegionArray<64U> unit{};
+    std::map<std::uintptr_t, std::uintptr_t> expected{};
+    std::mt19937 generator{42U};
+    std::uniform_int_distribution<std::uintptr_t> address_distribution{1U, 1000U};
+    while (expected.size() < unit.max_size())
+    {
+        const auto start_address = address_distribution(generator) * 16U;
+        EXPECT_EQ(unit.insert({start_address, start_address + 8U}).second,
+                  expected.insert({start_address, start_address + 8U}).second);
+    }
+
+    // When looking up every address of the used address range
+    // Then upper_bound and find return the same regions as std::map
+    for (std::uintptr_t address = 0U; address <= 1001U * 16U; ++address)
+    {
+        const auto upper_bound = unit.upper_bound(address);
+        const auto expected_upper_bound = expected.upper_bound(address);
+        ASSERT_EQ(std::distance(unit.cbegin(), upper_bound), std::distance(expected.begin(), expected_upper_bound));
+
+        const bool is_found = (unit.find(address) != unit.cend());
+        ASSERT_EQ(is_found, expected.find(address) != expected.cend());
+    }
+}
+
+}  // namespace
+}  // namespace score::memory::shared::detail
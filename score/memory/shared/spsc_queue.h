@@ -0,0 +1,216 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MEMORY_SHARED_SPSC_QUEUE_H
+#define SCORE_LIB_MEMORY_SHARED_SPSC_QUEUE_H
+
+#include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
+#include "score/memory/shared/queue_waiter.h"
+#include "score/memory/shared/vector.h"
+
+#include <score/assert.hpp>
+#include <score/stop_token.hpp>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace score::memory::shared
+{
+
+/// \brief Bounded lock-free queue for exactly one producer and one consumer, which can be placed in shared memory.
+///
+/// \details The queue is constructed within a ManagedMemoryResource (e.g. via ManagedMemoryResource::construct()) and
+/// allocates its slots from the same resource. Since it only contains atomics, offset pointers and interprocess
+/// synchronization primitives, the producer and the consumer can live in different processes, which map the memory
+/// at different addresses.
+///
+/// TryPush() and TryPop() are wait-free. Each side keeps a private copy of the index of the other side and only
+/// reloads it when the queue looks full or empty, so the cache line of the other side is only touched once per batch.
+/// Push() and Pop() spin shortly and then block on a QueueWaiter until the operation succeeds.
+///
+/// \tparam T Element type. It is copied bytewise between processes and thus has to be trivially copyable.
+template <typename T>
+class SpscQueue final
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are copied between processes bytewise");
+    static_assert(std::is_default_constructible_v<T>, "Slots are default constructed upfront");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Indices must be lock-free to be shared");
+
+  public:
+    using allocator_type = PolymorphicOffsetPtrAllocator<T>;
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// \brief Constructs an empty queue.
+    /// \param capacity Maximum number of elements in the queue. Must be a power of two.
+    /// \param allocator Allocator for the slots, which has to allocate from the memory the queue is placed in.
+    SpscQueue(const size_type capacity, const allocator_type& allocator)
+        : head_{0U},
+          cached_tail_{0U},
+          tail_{0U},
+          cached_head_{0U},
+          slots_(capacity, allocator),
+          index_mask_{static_cast<std::uint64_t>(capacity) - 1U},
+          not_empty_waiter_{},
+          not_full_waiter_{}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE((capacity != 0U) && ((capacity & (capacity - 1U)) == 0U),
+                                                          "Capacity must be a power of two");
+    }
+
+    ~SpscQueue() noexcept = default;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) & = delete;
+    SpscQueue(SpscQueue&&) noexcept = delete;
+    SpscQueue& operator=(SpscQueue&&) & noexcept = delete;
+
+    /// \brief Appends a copy of value, if the queue is not full. Must only be called by the producer.
+    /// \return true if the value was appended, false if the queue was full.
+    bool TryPush(const T& value) noexcept
+    {
+        if (!TryPushWithoutNotification(value))
+        {
+            return false;
+        }
+        not_empty_waiter_.NotifyAll();
+        return true;
+    }
+
+    /// \brief Removes the oldest element, if the queue is not empty. Must only be called by the consumer.
+    /// \return The removed element or an empty optional if the queue was empty.
+    std::optional<T> TryPop() noexcept
+    {
+        auto value = TryPopWithoutNotification();
+        if (value.has_value())
+        {
+            not_full_waiter_.NotifyAll();
+        }
+        return value;
+    }
+
+    /// \brief Appends a copy of value and blocks while the queue is full. Must only be called by the producer.
+    /// \return true if the value was appended, false if a stop was requested on the token before.
+    bool Push(const T& value, const score::cpp::stop_token& token) noexcept
+    {
+        for (std::uint32_t attempt = 0U; attempt < detail::kQueueSpinIterationsBeforeWaiting; ++attempt)
+        {
+            if (TryPush(value))
+            {
+                return true;
+            }
+        }
+        const bool pushed = not_full_waiter_.Wait(token, [this, &value]() noexcept {
+            return TryPushWithoutNotification(value);
+        });
+        if (pushed)
+        {
+            not_empty_waiter_.NotifyAll();
+        }
+        return pushed;
+    }
+
+    /// \brief Removes the oldest element and blocks while the queue is empty. Must only be called by the consumer.
+    /// \return The removed element or an empty optional if a stop was requested on the token before.
+    std::optional<T> Pop(const score::cpp::stop_token& token) noexcept
+    {
+        for (std::uint32_t attempt = 0U; attempt < detail::kQueueSpinIterationsBeforeWaiting; ++attempt)
+        {
+            auto value = TryPop();
+            if (value.has_value())
+            {
+                return value;
+            }
+        }
+        std::optional<T> value{};
+        score::cpp::ignore = not_empty_waiter_.Wait(token, [this, &value]() noexcept {
+            value = TryPopWithoutNotification();
+            return value.has_value();
+        });
+        if (value.has_value())
+        {
+            not_full_waiter_.NotifyAll();
+        }
+        return value;
+    }
+
+    /// \brief Returns the number of elements at the time of the call, which may be outdated when it returns.
+    size_type size() const noexcept
+    {
+        // Loading head_ first ensures that the loaded tail is not behind it.
+        const auto head = head_.load(std::memory_order_acquire);
+        const auto tail = tail_.load(std::memory_order_acquire);
+        return static_cast<size_type>(tail - head);
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0U;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+  private:
+    bool TryPushWithoutNotification(const T& value) noexcept
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if ((tail - cached_head_) > index_mask_)
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if ((tail - cached_head_) > index_mask_)
+            {
+                return false;
+            }
+        }
+        slots_[static_cast<size_type>(tail & index_mask_)] = value;
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<T> TryPopWithoutNotification() noexcept
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+            {
+                return {};
+            }
+        }
+        const T value = slots_[static_cast<size_type>(head & index_mask_)];
+        head_.store(head + 1U, std::memory_order_release);
+        return value;
+    }
+
+    // Written by the consumer. Indices are not wrapped, 64 bit never overflow in practice.
+    alignas(detail::kQueueCacheLineSize) std::atomic<std::uint64_t> head_;
+    std::uint64_t cached_tail_;
+    // Written by the producer.
+    alignas(detail::kQueueCacheLineSize) std::atomic<std::uint64_t> tail_;
+    std::uint64_t cached_head_;
+    alignas(detail::kQueueCacheLineSize) Vector<T> slots_;
+    std::uint64_t index_mask_;
+    detail::QueueWaiter not_empty_waiter_;
+    detail::QueueWaiter not_full_waiter_;
+};
+
+}  // namespace score::memory::shared
+
+#endif  // SCORE_LIB_MEMORY_SHARED_SPSC_QUEUE_H
@@ -0,0 +1,240 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/spsc_queue.h"
+
+#include "score/memory/shared/shared_memory_factory.h"
+
+#include <score/assert_support.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+using Queue = SpscQueue<std::uint64_t>;
+
+// Without a memory resource, the allocator falls back to the heap, which is sufficient for a single process.
+const Queue::allocator_type kHeapAllocator{};
+
+TEST(SpscQueueTest, TryPopOnEmptyQueueReturnsNothing)
+{
+    // Given an empty queue
+    Queue unit{4U, kHeapAllocator};
+
+    // When trying to pop an element
+    // Then nothing is returned
+    EXPECT_FALSE(unit.TryPop().has_value());
+    EXPECT_TRUE(unit.empty());
+}
+
+TEST(SpscQueueTest, ElementsArePoppedInPushOrderAcrossWrapArounds)
+{
+    // Given a queue with a small capacity
+    Queue unit{4U, kHeapAllocator};
+
+    // When pushing and popping many more elements than the capacity
+    std::uint64_t next_to_push{0U};
+    std::uint64_t next_to_pop{0U};
+    while (next_to_pop < 100U)
+    {
+        while (unit.TryPush(next_to_push))
+        {
+            ++next_to_push;
+        }
+        ASSERT_EQ(unit.size(), unit.capacity());
+
+        // Then the elements are popped in the order they were pushed
+        for (std::uint32_t i = 0U; i < 3U; ++i)
+        {
+            const auto value = unit.TryPop();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_EQ(value.value(), next_to_pop);
+            ++next_to_pop;
+        }
+    }
+}
+
+TEST(SpscQueueTest, TryPushFailsWhenFull)
+{
+    // Given a full queue
+    Queue unit{2U, kHeapAllocator};
+    ASSERT_TRUE(unit.TryPush(1U));
+    ASSERT_TRUE(unit.TryPush(2U));
+
+    // When trying to push another element
+    // Then it is rejected
+    EXPECT_FALSE(unit.TryPush(3U));
+
+    // and can be pushed once an element was popped
+    EXPECT_EQ(unit.TryPop(), 1U);
+    EXPECT_TRUE(unit.TryPush(3U));
+}
+
+TEST(SpscQueueTest, CapacityMustBeAPowerOfTwo)
+{
+    // When constructing a queue with a capacity that is not a power of two
+    // Then the program terminates
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(Queue(3U, kHeapAllocator));
+}
+
+TEST(SpscQueueTest, PopBlocksUntilAnElementIsPushed)
+{
+    // Given an empty queue and a consumer which blocks in Pop()
+    Queue unit{4U, kHeapAllocator};
+    std::atomic<bool> popped{false};
+    std::thread consumer{[&unit, &popped]() {
+        const auto value = unit.Pop(score::cpp::stop_token{});
+        EXPECT_EQ(value, 42U);
+        popped = true;
+    }};
+
+    // When an element is pushed after the consumer started waiting
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(popped);
+    ASSERT_TRUE(unit.TryPush(42U));
+
+    // Then the consumer returns with it
+    consumer.join();
+    EXPECT_TRUE(popped);
+}
+
+TEST(SpscQueueTest, PopReturnsNothingWhenStopIsRequested)
+{
+    // Given an empty queue and a consumer which blocks in Pop()
+    Queue unit{4U, kHeapAllocator};
+    score::cpp::stop_source stop_source{};
+    std::thread consumer{[&unit, &stop_source]() {
+        // Then Pop() returns without an element
+        EXPECT_FALSE(unit.Pop(stop_source.get_token()).has_value());
+    }};
+
+    // When a stop is requested
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    stop_source.request_stop();
+    consumer.join();
+}
+
+TEST(SpscQueueTest, PushBlocksWhileTheQueueIsFull)
+{
+    // Given a full queue and a producer which blocks in Push()
+    Queue unit{2U, kHeapAllocator};
+    ASSERT_TRUE(unit.TryPush(1U));
+    ASSERT_TRUE(unit.TryPush(2U));
+    std::atomic<bool> pushed{false};
+    std::thread producer{[&unit, &pushed]() {
+        EXPECT_TRUE(unit.Push(3U, score::cpp::stop_token{}));
+        pushed = true;
+    }};
+
+    // When an element is popped after the producer started waiting
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(pushed);
+    EXPECT_EQ(unit.TryPop(), 1U);
+
+    // Then the producer appends its element
+    producer.join();
+    EXPECT_TRUE(pushed);
+    EXPECT_EQ(unit.TryPop(), 2U);
+    EXPECT_EQ(unit.TryPop(), 3U);
+}
+
+TEST(SpscQueueTest, ProducerAndConsumerThreadTransferAllElementsInOrder)
+{
+    // Given a producer and a consumer thread on a small queue
+    constexpr std::uint64_t kNumberOfElements{200000U};
+    Queue unit{8U, kHeapAllocator};
+    std::thread producer{[&unit]() {
+        for (std::uint64_t value = 0U; value < kNumberOfElements; ++value)
+        {
+            ASSERT_TRUE(unit.Push(value, score::cpp::stop_token{}));
+        }
+    }};
+
+    // When the consumer pops all elements
+    // Then it receives them in order
+    for (std::uint64_t expected_value = 0U; expected_value < kNumberOfElements; ++expected_value)
+    {
+        const auto value = unit.Pop(score::cpp::stop_token{});
+        ASSERT_EQ(value, expected_value);
+    }
+    producer.join();
+    EXPECT_TRUE(unit.empty());
+}
+
+TEST(SpscQueueTest, ElementsArePassedBetweenProcesses)
+{
+    // Given a queue within a shared memory region, which is opened by a child process
+    constexpr std::uint64_t kNumberOfElements{10000U};
+    const std::string path{"/spsc_queue_test_" + std::to_string(::getpid())};
+    SharedMemoryFactory::RemoveStaleArtefacts(path);
+    const auto child_pid = ::fork();
+    ASSERT_NE(child_pid, -1);
+    if (child_pid == 0)
+    {
+        // The child maps the region on its own, so it can be placed at another address than in the parent.
+        std::shared_ptr<ManagedMemoryResource> resource{};
+        while (resource == nullptr)
+        {
+            resource = SharedMemoryFactory::Open(path, true);
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        std::uintptr_t queue_address = reinterpret_cast<std::uintptr_t>(resource->getUsableBaseAddress());
+        queue_address = (queue_address + alignof(Queue) - 1U) & ~(alignof(Queue) - 1U);
+        auto& queue = *reinterpret_cast<Queue*>(queue_address);
+
+        // When the child pushes elements
+        for (std::uint64_t value = 0U; value < kNumberOfElements; ++value)
+        {
+            if (!queue.Push(value, score::cpp::stop_token{}))
+            {
+                ::_exit(1);
+            }
+        }
+        ::_exit(0);
+    }
+
+    Queue* queue{nullptr};
+    auto resource =
+        SharedMemoryFactory::Create(path, [&queue](std::shared_ptr<ISharedMemoryResource> created_resource) {
+            queue = created_resource->construct<Queue>(16U, Queue::allocator_type{*created_resource});
+        }, 4096U);
+    ASSERT_NE(resource, nullptr);
+    ASSERT_NE(queue, nullptr);
+
+    // Then the parent pops all of them in order
+    for (std::uint64_t expected_value = 0U; expected_value < kNumberOfElements; ++expected_value)
+    {
+        const auto value = queue->Pop(score::cpp::stop_token{});
+        ASSERT_EQ(value, expected_value);
+    }
+    std::int32_t child_status{0};
+    ASSERT_EQ(::waitpid(child_pid, &child_status, 0), child_pid);
+    EXPECT_TRUE(WIFEXITED(child_status));
+    EXPECT_EQ(WEXITSTATUS(child_status), 0);
+    SharedMemoryFactory::Remove(path);
+}
+
+}  // namespace
+}  // namespace score::memory::shared
@@ -85,6 +85,31 @@ TEST(OffsetPtrBoundsCheckDeathTest, IndexDereferenceGoesOutOfMemoryRegion)
     SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(offset_ptr[gMemoryPool.GetEndOfValidRegion() - gMemoryPool.GetStartOfValidRegion()]);
 }
 
+TEST(OffsetPtrBoundsCheckDeathTest, CheckedSpanGoesOutOfMemoryRegion)
+{
+    // Given a memory resource with a certain size and an OffsetPtr in it pointing to the start of the memory region
+    BoundsCheckMemoryPoolGuard<PointedType> memory_pool_guard{gMemoryPool};
+    MyBoundedMemoryResource memory_resource{{gMemoryPool.GetStartOfValidRegion(), gMemoryPool.GetEndOfValidRegion()}};
+    auto* const ptr_to_offset_ptr = CreateOffsetPtr<PointedType>(gMemoryPool.GetOffsetPtrAddressInValidRange(),
+                                                                 gMemoryPool.GetPointedToAddressInValidRange());
+    const auto copied_offset_ptr = *ptr_to_offset_ptr;
+    const auto max_number_of_elements = static_cast<std::size_t>(gMemoryPool.GetEndOfValidRegion() -
+                                                                 gMemoryPool.GetStartOfValidRegion()) /
+                                        sizeof(PointedType);
+
+    // When getting a span, which fits into the memory region
+    // Then the span covers all requested elements
+    EXPECT_EQ(ptr_to_offset_ptr->GetCheckedSpan(max_number_of_elements).size(), max_number_of_elements);
+    EXPECT_EQ(copied_offset_ptr.GetCheckedSpan(max_number_of_elements).size(), max_number_of_elements);
+
+    // When getting a span, which goes out of the memory region
+    // Then the bounds checking kicks in, also for an OffsetPtr that was copied out of the memory region
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::cpp::ignore = ptr_to_offset_ptr->GetCheckedSpan(max_number_of_elements + 1U));
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::cpp::ignore = copied_offset_ptr.GetCheckedSpan(max_number_of_elements + 1U));
+}
+
 std::vector<TestParams> GenerateOffsetPtrAddressesThatPassBoundsChecks(BoundsCheckMemoryPool<PointedType>& memory_pool)
 {
     // OffsetPtr that lies inside valid range will not die if start address of pointed-to object is in the same range.
@@ -306,6 +331,27 @@ TEST_P(OffsetPtrBoundsCheckFixture, ArrowOperatorReturnsCorrectPointer)
     EXPECT_EQ(actual_pointed_to_address, reinterpret_cast<PointedType*>(params.pointed_to_address));
 }
 
+TEST_P(OffsetPtrBoundsCheckFixture, GettingCheckedSpanReturnsCorrectPointer)
+{
+    RecordProperty("Verifies", "SCR-5899238");
+    RecordProperty("Description", "Checks that calling GetCheckedSpan() performs bounds checking");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const auto& params = GetParam();
+
+    // Given a memory region registered with the MemoryResourceRegistry and an OffsetPtr
+    auto* const ptr_to_offset_ptr = CreateOffsetPtr<PointedType>(params.ptr_to_offset_ptr, params.pointed_to_address);
+
+    // When getting a span of one element from the OffsetPtr
+    const auto span = ptr_to_offset_ptr->GetCheckedSpan(1U);
+
+    // Then the span should start at the initial pointed-to address
+    EXPECT_EQ(span.data(), reinterpret_cast<PointedType*>(params.pointed_to_address));
+    EXPECT_EQ(span.size(), 1U);
+}
+
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(OffsetPtrCreationStartChecksPass, OffsetPtrBoundsCheckFixture,
     ::testing::ValuesIn(GenerateOffsetPtrAddressesThatPassBoundsChecks(gMemoryPool))
@@ -431,6 +477,24 @@ TEST_P(OffsetPtrBoundsCheckDeathFixture, ArrowOperatorTerminates)
     SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(score::cpp::ignore = (*ptr_to_offset_ptr).operator->());
 }
 
+TEST_P(OffsetPtrBoundsCheckDeathFixture, GettingCheckedSpanTerminates)
+{
+    RecordProperty("Verifies", "SCR-5899238");
+    RecordProperty("Description", "Checks that calling GetCheckedSpan() performs bounds checking");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const auto& params = GetParam();
+
+    // Given a memory region registered with the MemoryResourceRegistry and an OffsetPtr
+    auto* const ptr_to_offset_ptr = CreateOffsetPtr<PointedType>(params.ptr_to_offset_ptr, params.pointed_to_address);
+
+    // When getting a span of one element from the OffsetPtr
+    // Then the program should terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(score::cpp::ignore = ptr_to_offset_ptr->GetCheckedSpan(1U));
+}
+
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(OffsetPtrBoundChecksFail, OffsetPtrBoundsCheckDeathFixture, ::testing::ValuesIn(
     GenerateOffsetPtrAddressesThatFailsBoundsChecks(gMemoryPool, gSecondMemoryPool)
@@ -13,8 +13,17 @@
 #ifndef SCORE_LIB_MEMORY_SHARED_VECTOR_H
 #define SCORE_LIB_MEMORY_SHARED_VECTOR_H
 
+#include "score/memory/shared/memory_resource_registry.h"
+#include "score/memory/shared/offset_ptr.h"
+#include "score/memory/shared/offset_ptr_bounds_check.h"
+#include "score/memory/shared/pointer_arithmetic_util.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
+#include <score/assert.hpp>
+#include <score/span.hpp>
+
+#include <cstddef>
+
 #include <scoped_allocator>
 #include <vector>
 
@@ -48,6 +57,56 @@ inline bool operator==(std::vector<T> lhs, const Vector<T>& rhs) noexcept
     return (std::equal(lhs.begin(), lhs.end(), rhs.begin()) == true);
 }
 
+namespace detail_vector
+{
+
+/// \brief Returns a span of count elements starting at data. If the vector lies in a memory region, the elements are
+///        bounds checked against that region, as the OffsetPtrs stored in the vector would be.
+template <typename T>
+score::cpp::span<T> GetCheckedSpan(const void* const vector_address,
+                                   const std::size_t vector_size,
+                                   T* const data,
+                                   const std::size_t count)
+{
+    if (count == 0U)
+    {
+        return {};
+    }
+    if (detail_offset_ptr::IsBoundsCheckingEnabled())
+    {
+        const auto vector_bounds = MemoryResourceRegistry::getInstance().GetBoundsFromAddress(vector_address);
+        if (vector_bounds.has_value())
+        {
+            // The size of a vector is limited by its max_size(), so count * sizeof(T) cannot overflow.
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(
+                DoesOffsetPtrInSharedMemoryPassBoundsChecks(vector_address,
+                                                            SubtractPointersBytes(data, vector_address),
+                                                            vector_bounds.value(),
+                                                            count * sizeof(T),
+                                                            vector_size));
+        }
+    }
+    return score::cpp::span<T>{data, count};
+}
+
+}  // namespace detail_vector
+
+/// \brief Returns a span over all elements of the vector, which is bounds checked once as a whole.
+/// \details Iterating a Vector dereferences an OffsetPtr and therefore does a bounds check per element. Tight loops
+///          over large vectors should iterate the span instead. The span is invalidated like the iterators of the
+///          vector.
+template <typename T>
+score::cpp::span<T> GetCheckedSpan(Vector<T>& vector)
+{
+    return detail_vector::GetCheckedSpan(&vector, sizeof(vector), vector.data(), vector.size());
+}
+
+template <typename T>
+score::cpp::span<const T> GetCheckedSpan(const Vector<T>& vector)
+{
+    return detail_vector::GetCheckedSpan(&vector, sizeof(vector), vector.data(), vector.size());
+}
+
 }  // namespace score::memory::shared
 
 #endif  // SCORE_LIB_MEMORY_SHARED_VECTOR_H
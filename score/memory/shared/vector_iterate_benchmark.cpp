@@ -0,0 +1,108 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/memory/shared/offset_ptr.h"
+#include "score/memory/shared/shared_memory_factory.h"
+#include "score/memory/shared/vector.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace score::memory::shared
+{
+namespace
+{
+
+constexpr auto kSharedMemoryPath = "/vector_iterate_benchmark";
+constexpr std::size_t kNumberOfElements{1000000U};
+constexpr std::size_t kResourceSize{2U * kNumberOfElements * sizeof(std::uint32_t)};
+
+/// A Vector with 1M elements is placed in a shared memory region and iterated in every benchmark iteration.
+class VectorIterateFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State&) override
+    {
+        SharedMemoryFactory::RemoveStaleArtefacts(kSharedMemoryPath);
+        resource_ = SharedMemoryFactory::Create(
+            kSharedMemoryPath, [](std::shared_ptr<ISharedMemoryResource>) noexcept {}, kResourceSize);
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(resource_ != nullptr, "Could not create shared memory region");
+        vector_ = resource_->construct<Vector<std::uint32_t>>(kNumberOfElements, 1U, *resource_);
+    }
+
+    void TearDown(const benchmark::State&) override
+    {
+        SharedMemoryFactory::Remove(kSharedMemoryPath);
+        vector_ = nullptr;
+        resource_.reset();
+    }
+
+  protected:
+    std::shared_ptr<ISharedMemoryResource> resource_{};
+    Vector<std::uint32_t>* vector_{nullptr};
+};
+
+BENCHMARK_DEFINE_F(VectorIterateFixture, IterateWithBoundsCheckPerElement)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::uint64_t sum{0U};
+        for (const auto value : *vector_)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kNumberOfElements));
+}
+BENCHMARK_REGISTER_F(VectorIterateFixture, IterateWithBoundsCheckPerElement);
+
+BENCHMARK_DEFINE_F(VectorIterateFixture, IterateCheckedSpan)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::uint64_t sum{0U};
+        for (const auto value : GetCheckedSpan(*vector_))
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kNumberOfElements));
+}
+BENCHMARK_REGISTER_F(VectorIterateFixture, IterateCheckedSpan);
+
+// Reference for the cost of iterating without any bounds checks
+BENCHMARK_DEFINE_F(VectorIterateFixture, IterateWithoutBoundsChecks)(benchmark::State& state)
+{
+    const bool was_bounds_checking_enabled = EnableOffsetPtrBoundsChecking(false);
+    for (auto _ : state)
+    {
+        std::uint64_t sum{0U};
+        for (const auto value : *vector_)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    EnableOffsetPtrBoundsChecking(was_bounds_checking_enabled);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kNumberOfElements));
+}
+BENCHMARK_REGISTER_F(VectorIterateFixture, IterateWithoutBoundsChecks);
+
+}  // namespace
+}  // namespace score::memory::shared
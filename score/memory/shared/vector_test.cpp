@@ -12,10 +12,15 @@
  ********************************************************************************/
 #include "score/memory/shared/vector.h"
 
+#include "score/memory/shared/fake/my_bounded_memory_resource.h"
 #include "score/memory/shared/fake/my_memory_resource.h"
 
+#include <score/assert_support.hpp>
+
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 namespace score::memory::shared
 {
 namespace
@@ -113,5 +118,61 @@ TEST(Vector, CanConstructWithIterators)
     score::memory::shared::Vector<std::uint8_t> unit(test.cbegin(), test.cend());
 }
 
+TEST(Vector, CheckedSpanContainsAllElements)
+{
+    // Given a Vector with some elements
+    test::MyMemoryResource memory{};
+    score::memory::shared::Vector<std::uint8_t> unit{{1U, 2U, 3U}, memory};
+    const auto& const_unit = unit;
+
+    // When getting a checked span of it
+    const auto span = GetCheckedSpan(unit);
+    const auto const_span = GetCheckedSpan(const_unit);
+
+    // Then the spans contain all elements of the vector
+    EXPECT_TRUE(std::equal(span.begin(), span.end(), unit.begin(), unit.end()));
+    EXPECT_TRUE(std::equal(const_span.begin(), const_span.end(), unit.begin(), unit.end()));
+}
+
+TEST(Vector, CheckedSpanOfVectorInMemoryRegionContainsAllElements)
+{
+    // Given a Vector which lies together with its elements in a registered memory region
+    test::MyBoundedMemoryResource memory{1024U};
+    auto* const unit = memory.construct<score::memory::shared::Vector<std::uint8_t>>(memory);
+    unit->assign({1U, 2U, 3U});
+
+    // When getting a checked span of it
+    const auto span = GetCheckedSpan(*unit);
+
+    // Then the bounds check passes and the span contains all elements of the vector
+    EXPECT_TRUE(std::equal(span.begin(), span.end(), unit->begin(), unit->end()));
+}
+
+TEST(Vector, CheckedSpanBeyondMemoryRegionOfVectorViolatesContract)
+{
+    // Given a Vector in a registered memory region of 1024 bytes
+    test::MyBoundedMemoryResource memory{1024U};
+    auto* const unit = memory.construct<score::memory::shared::Vector<std::uint8_t>>(memory);
+    unit->assign({1U, 2U, 3U});
+
+    // When getting a span of more elements than the memory region can hold
+    // Then the bounds check kicks in
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::cpp::ignore = detail_vector::GetCheckedSpan(unit, sizeof(*unit), unit->data(), 1024U));
+}
+
+TEST(Vector, CheckedSpanOfEmptyVectorIsEmpty)
+{
+    // Given an empty Vector
+    test::MyMemoryResource memory{};
+    score::memory::shared::Vector<std::uint8_t> unit{memory};
+
+    // When getting a checked span of it
+    const auto span = GetCheckedSpan(unit);
+
+    // Then the span is empty
+    EXPECT_TRUE(span.empty());
+}
+
 }  // namespace
 }  // namespace score::memory::shared
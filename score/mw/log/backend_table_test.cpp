@@ -71,6 +71,11 @@ TEST(ModeToSlotIndexTest, CustomModeMapsToSlotFour)
     EXPECT_EQ(ModeToSlotIndex(LogMode::kCustom), 4U);
 }
 
+TEST(ModeToSlotIndexTest, BinaryFileModeMapsToSlotFive)
+{
+    EXPECT_EQ(ModeToSlotIndex(LogMode::kBinaryFile), 5U);
+}
+
 TEST(ModeToSlotIndexTest, InvalidModeReturnsSentinel)
 {
     EXPECT_EQ(ModeToSlotIndex(LogMode::kInvalid), kMaxBackendSlots);
@@ -135,6 +140,7 @@ TEST_F(BackendTableTest, IsBackendAvailableReturnsFalseWhenNotRegistered)
     EXPECT_FALSE(IsBackendAvailable(LogMode::kRemote));
     EXPECT_FALSE(IsBackendAvailable(LogMode::kSystem));
     EXPECT_FALSE(IsBackendAvailable(LogMode::kCustom));
+    EXPECT_FALSE(IsBackendAvailable(LogMode::kBinaryFile));
 }
 
 TEST_F(BackendTableTest, IsBackendAvailableReturnsTrueWhenRegistered)
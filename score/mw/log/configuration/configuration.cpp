@@ -209,6 +209,96 @@ void Configuration::SetDynamicDatarouterIdentifiers(const bool enable_dynamic_id
     dynamic_datarouter_identifiers_ = enable_dynamic_identifiers;
 }
 
+bool Configuration::GetAsyncDrainEnabled() const noexcept
+{
+    return async_drain_enabled_;
+}
+
+void Configuration::SetAsyncDrainEnabled(const bool async_drain_enabled) noexcept
+{
+    async_drain_enabled_ = async_drain_enabled;
+}
+
+score::cpp::optional<std::size_t> Configuration::GetAsyncDrainCpuAffinity() const noexcept
+{
+    return async_drain_cpu_affinity_;
+}
+
+void Configuration::SetAsyncDrainCpuAffinity(const std::size_t cpu) noexcept
+{
+    async_drain_cpu_affinity_ = cpu;
+}
+
+score::cpp::optional<std::int32_t> Configuration::GetAsyncDrainPriority() const noexcept
+{
+    return async_drain_priority_;
+}
+
+void Configuration::SetAsyncDrainPriority(const std::int32_t priority) noexcept
+{
+    async_drain_priority_ = priority;
+}
+
+std::chrono::milliseconds Configuration::GetAsyncDrainPeriod() const noexcept
+{
+    return async_drain_period_;
+}
+
+void Configuration::SetAsyncDrainPeriod(const std::chrono::milliseconds period) noexcept
+{
+    async_drain_period_ = period;
+}
+
+std::size_t Configuration::GetBinaryFileSegmentSize() const noexcept
+{
+    return binary_file_segment_size_bytes_;
+}
+
+void Configuration::SetBinaryFileSegmentSize(const std::size_t segment_size_bytes) noexcept
+{
+    binary_file_segment_size_bytes_ = segment_size_bytes;
+}
+
+std::size_t Configuration::GetBinaryFileNumberOfSegments() const noexcept
+{
+    return binary_file_number_of_segments_;
+}
+
+void Configuration::SetBinaryFileNumberOfSegments(const std::size_t number_of_segments) noexcept
+{
+    binary_file_number_of_segments_ = number_of_segments;
+}
+
+std::size_t Configuration::GetContextRateLimit() const noexcept
+{
+    return context_rate_limit_;
+}
+
+void Configuration::SetContextRateLimit(const std::size_t records_per_second) noexcept
+{
+    context_rate_limit_ = records_per_second;
+}
+
+std::size_t Configuration::GetContextRateLimitBurst() const noexcept
+{
+    return context_rate_limit_burst_;
+}
+
+void Configuration::SetContextRateLimitBurst(const std::size_t records) noexcept
+{
+    context_rate_limit_burst_ = records;
+}
+
+bool Configuration::GetCollapseRepeatedMessages() const noexcept
+{
+    return collapse_repeated_messages_;
+}
+
+void Configuration::SetCollapseRepeatedMessages(const bool collapse_repeated_messages) noexcept
+{
+    collapse_repeated_messages_ = collapse_repeated_messages;
+}
+
 }  // namespace detail
 }  // namespace log
 }  // namespace mw
@@ -17,6 +17,10 @@
 #include "score/mw/log/log_level.h"
 #include "score/mw/log/log_mode.h"
 
+#include "score/optional.hpp"
+
+#include <chrono>
+#include <cstdint>
 #include <string_view>
 
 #include <string>
@@ -84,6 +88,33 @@ class Configuration final
     bool GetDynamicDatarouterIdentifiers() const noexcept;
     void SetDynamicDatarouterIdentifiers(const bool enable_dynamic_identifiers) noexcept;
 
+    bool GetAsyncDrainEnabled() const noexcept;
+    void SetAsyncDrainEnabled(const bool async_drain_enabled) noexcept;
+
+    score::cpp::optional<std::size_t> GetAsyncDrainCpuAffinity() const noexcept;
+    void SetAsyncDrainCpuAffinity(const std::size_t cpu) noexcept;
+
+    score::cpp::optional<std::int32_t> GetAsyncDrainPriority() const noexcept;
+    void SetAsyncDrainPriority(const std::int32_t priority) noexcept;
+
+    std::chrono::milliseconds GetAsyncDrainPeriod() const noexcept;
+    void SetAsyncDrainPeriod(const std::chrono::milliseconds period) noexcept;
+
+    std::size_t GetBinaryFileSegmentSize() const noexcept;
+    void SetBinaryFileSegmentSize(const std::size_t segment_size_bytes) noexcept;
+
+    std::size_t GetBinaryFileNumberOfSegments() const noexcept;
+    void SetBinaryFileNumberOfSegments(const std::size_t number_of_segments) noexcept;
+
+    std::size_t GetContextRateLimit() const noexcept;
+    void SetContextRateLimit(const std::size_t records_per_second) noexcept;
+
+    std::size_t GetContextRateLimitBurst() const noexcept;
+    void SetContextRateLimitBurst(const std::size_t records) noexcept;
+
+    bool GetCollapseRepeatedMessages() const noexcept;
+    void SetCollapseRepeatedMessages(const bool collapse_repeated_messages) noexcept;
+
     /// \brief Returns true if the log level is enabled for the context.
     /// \param use_console_default_level Set to true if threshold for console logging should be considered as default
     /// log level. Otherwise default_log_level_ will be used instead.
@@ -138,6 +169,33 @@ class Configuration final
 
     /// \brief Toggle between dynamic datarouter identifiers.
     bool dynamic_datarouter_identifiers_{false};
+
+    /// \brief Drain the slots of text backends from a dedicated thread instead of the logging threads.
+    bool async_drain_enabled_{false};
+
+    /// \brief CPU the drainer thread is pinned to.
+    score::cpp::optional<std::size_t> async_drain_cpu_affinity_{};
+
+    /// \brief SCHED_FIFO priority of the drainer thread.
+    score::cpp::optional<std::int32_t> async_drain_priority_{};
+
+    /// \brief Period in which the drainer thread polls for new slots when idle.
+    std::chrono::milliseconds async_drain_period_{1};
+
+    /// \brief Size of each memory-mapped segment file of the binary file backend.
+    std::size_t binary_file_segment_size_bytes_{1048576UL};
+
+    /// \brief Number of segment files the binary file backend keeps before it removes the oldest one.
+    std::size_t binary_file_number_of_segments_{4UL};
+
+    /// \brief Records per second each context may log, zero disables the rate limit.
+    std::size_t context_rate_limit_{0UL};
+
+    /// \brief Records a context may log at once after it was idle, on top of its rate limit.
+    std::size_t context_rate_limit_burst_{10UL};
+
+    /// \brief Replace identical consecutive messages of a context by one "repeated N times" record.
+    bool collapse_repeated_messages_{false};
 };
 
 }  // namespace detail
@@ -49,6 +49,15 @@ constexpr StringLiteral kNumberOfSlotsKey{"numberOfSlots"};
 constexpr StringLiteral kSlotSizeBytesKey{"slotSizeBytes"};
 constexpr StringLiteral kDatarouterUidKey{"datarouterUid"};
 constexpr StringLiteral kDynamicDatarouterIdentifiersKey{"dynamicDatarouterIdentifiers"};
+constexpr StringLiteral kAsyncDrainKey{"asyncDrain"};
+constexpr StringLiteral kAsyncDrainCpuAffinityKey{"asyncDrainCpuAffinity"};
+constexpr StringLiteral kAsyncDrainPriorityKey{"asyncDrainPriority"};
+constexpr StringLiteral kAsyncDrainPeriodMsKey{"asyncDrainPeriodMs"};
+constexpr StringLiteral kBinaryFileSegmentSizeBytesKey{"binaryFileSegmentSizeBytes"};
+constexpr StringLiteral kBinaryFileNumberOfSegmentsKey{"binaryFileNumberOfSegments"};
+constexpr StringLiteral kContextRateLimitKey{"contextRateLimit"};
+constexpr StringLiteral kContextRateLimitBurstKey{"contextRateLimitBurst"};
+constexpr StringLiteral kCollapseRepeatedMessagesKey{"collapseRepeatedMessages"};
 
 // Suppress Coverity warning because:
 // 1. 'constexpr' cannot be used with std::unordered_map.
@@ -71,7 +80,8 @@ const std::unordered_map<std::string_view, LogMode> kStringToLogMode{{{"kRemote"
                                                                       {"kConsole", LogMode::kConsole},
                                                                       {"kFile", LogMode::kFile},
                                                                       {"kSystem", LogMode::kSystem},
-                                                                      {"kCustom", LogMode::kCustom}}};
+                                                                      {"kCustom", LogMode::kCustom},
+                                                                      {"kBinaryFile", LogMode::kBinaryFile}}};
 
 /// \brief Provide user feedback in case a configuration file contains errors.
 template <typename T>
@@ -198,7 +208,7 @@ score::Result<LogMode> LogModeFromString(const std::string_view str) noexcept
     if (result == kStringToLogMode.end())
     {
         return MakeUnexpected(Error::kInvalidLogModeString,
-                              "Expected `kRemote`, `kConsole`, `kSystem`, `kFile` or `kCustom`.");
+                              "Expected `kRemote`, `kConsole`, `kSystem`, `kFile`, `kCustom` or `kBinaryFile`.");
     }
 
     return result->second;
@@ -430,6 +440,119 @@ score::Result<void> ParseDynamicDatarouterIdentifiers(const score::json::Object&
     // clang-format on
 }
 
+score::Result<void> ParseAsyncDrain(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<bool>(
+        root,
+        kAsyncDrainKey,
+        [&config](const auto value) noexcept { config.SetAsyncDrainEnabled(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseAsyncDrainCpuAffinity(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kAsyncDrainCpuAffinityKey,
+        [&config](const auto value) noexcept { config.SetAsyncDrainCpuAffinity(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseAsyncDrainPriority(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::int32_t>(
+        root,
+        kAsyncDrainPriorityKey,
+        [&config](const auto value) noexcept { config.SetAsyncDrainPriority(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseAsyncDrainPeriod(const score::json::Object& root, Configuration& config) noexcept
+{
+    const auto period = GetElementAs<std::uint32_t>(root, kAsyncDrainPeriodMsKey);
+    if (period.has_value() == false)
+    {
+        return score::MakeUnexpected<void>(period.error());
+    }
+    // A period of zero would make the drainer thread poll without ever sleeping.
+    if (period.value() == 0U)
+    {
+        return score::MakeUnexpected(Error::kInvalidConfigurationValue, "asyncDrainPeriodMs must be greater than 0");
+    }
+
+    config.SetAsyncDrainPeriod(std::chrono::milliseconds{period.value()});
+    return {};
+}
+
+score::Result<void> ParseBinaryFileSegmentSize(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kBinaryFileSegmentSizeBytesKey,
+        [&config](const auto value) noexcept { config.SetBinaryFileSegmentSize(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseBinaryFileNumberOfSegments(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kBinaryFileNumberOfSegmentsKey,
+        [&config](const auto value) noexcept { config.SetBinaryFileNumberOfSegments(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseContextRateLimit(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kContextRateLimitKey,
+        [&config](const auto value) noexcept { config.SetContextRateLimit(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseContextRateLimitBurst(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kContextRateLimitBurstKey,
+        [&config](const auto value) noexcept { config.SetContextRateLimitBurst(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseCollapseRepeatedMessages(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<bool>(
+        root,
+        kCollapseRepeatedMessagesKey,
+        [&config](const auto value) noexcept { config.SetCollapseRepeatedMessages(value); }
+    );
+    // clang-format on
+}
+
 void ParseConfigurationElements(const score::json::Object& root, const std::string& path, Configuration& config) noexcept
 {
     ReportOnError(ParseEcuId(root, config), path);
@@ -447,6 +570,15 @@ void ParseConfigurationElements(const score::json::Object& root, const std::stri
     ReportOnError(ParseSlotSizeBytes(root, config), path);
     ReportOnError(ParseDatarouterUid(root, config), path);
     ReportOnError(ParseDynamicDatarouterIdentifiers(root, config), path);
+    ReportOnError(ParseAsyncDrain(root, config), path);
+    ReportOnError(ParseAsyncDrainCpuAffinity(root, config), path);
+    ReportOnError(ParseAsyncDrainPriority(root, config), path);
+    ReportOnError(ParseAsyncDrainPeriod(root, config), path);
+    ReportOnError(ParseBinaryFileSegmentSize(root, config), path);
+    ReportOnError(ParseBinaryFileNumberOfSegments(root, config), path);
+    ReportOnError(ParseContextRateLimit(root, config), path);
+    ReportOnError(ParseContextRateLimitBurst(root, config), path);
+    ReportOnError(ParseCollapseRepeatedMessages(root, config), path);
 }
 
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings: "The std::terminate() function shall not be called implicitly".
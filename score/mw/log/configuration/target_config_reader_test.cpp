@@ -38,7 +38,8 @@ const LogLevel kAppConfigLogLevel{LogLevel::kError};
 const std::unordered_set<LogMode> kEcuConfigLogMode{LogMode::kRemote,
                                                     LogMode::kConsole,
                                                     LogMode::kFile,
-                                                    LogMode::kSystem};
+                                                    LogMode::kSystem,
+                                                    LogMode::kBinaryFile};
 const std::unordered_set<LogMode> kAppConfigLogMode{LogMode::kRemote};
 const std::string_view kAppDescription{"Application One Description"};
 const std::size_t kEcuConfigStackBufferSize{3000};
@@ -59,6 +60,13 @@ const std::size_t kNumberOfSlots{8};
 const std::size_t kSlotSizeBytes{1500};
 const std::size_t kDatarouterUid{1038};
 const bool kDynamicDatarouterIdentifiers{true};
+const std::size_t kAsyncDrainCpuAffinity{1};
+const std::int32_t kAsyncDrainPriority{10};
+const std::chrono::milliseconds kAsyncDrainPeriod{5};
+const std::size_t kBinaryFileSegmentSize{65536};
+const std::size_t kBinaryFileNumberOfSegments{3};
+const std::size_t kContextRateLimit{200};
+const std::size_t kContextRateLimitBurst{20};
 class TargetConfigReaderFixture : public ::testing::Test
 {
   public:
@@ -324,6 +332,48 @@ TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseSlotSizeBytes)
     EXPECT_EQ(GetReader().ReadConfig()->GetSlotSizeInBytes(), kSlotSizeBytes);
 }
 
+TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseAsyncDrainSettings)
+{
+    RecordProperty("Requirement", "SCR-1633316");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "TargetConfigReader shall parse the settings of the drainer thread correctly.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const auto config = GetReader().ReadConfig();
+    EXPECT_TRUE(config->GetAsyncDrainEnabled());
+    EXPECT_EQ(config->GetAsyncDrainCpuAffinity(), kAsyncDrainCpuAffinity);
+    EXPECT_EQ(config->GetAsyncDrainPriority(), kAsyncDrainPriority);
+    EXPECT_EQ(config->GetAsyncDrainPeriod(), kAsyncDrainPeriod);
+}
+
+TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseBinaryFileSettings)
+{
+    RecordProperty("Requirement", "SCR-1633316");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "TargetConfigReader shall parse the segment settings of the binary file backend.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const auto config = GetReader().ReadConfig();
+    EXPECT_EQ(config->GetBinaryFileSegmentSize(), kBinaryFileSegmentSize);
+    EXPECT_EQ(config->GetBinaryFileNumberOfSegments(), kBinaryFileNumberOfSegments);
+}
+
+TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseThrottlingSettings)
+{
+    RecordProperty("Requirement", "SCR-1633316");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "TargetConfigReader shall parse the rate limit and the collapsing of repetitions.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const auto config = GetReader().ReadConfig();
+    EXPECT_EQ(config->GetContextRateLimit(), kContextRateLimit);
+    EXPECT_EQ(config->GetContextRateLimitBurst(), kContextRateLimitBurst);
+    EXPECT_TRUE(config->GetCollapseRepeatedMessages());
+}
+
 TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseDynamicDatarouterIdentifiers)
 {
     RecordProperty("Requirement", "SCR-1633316");
@@ -415,6 +465,23 @@ TEST_F(TargetConfigReaderFixture, AppConfigInvalidLogLevelFallbackToEcuConfig)
     EXPECT_EQ(GetReader().ReadConfig()->GetDefaultLogLevel(), kEcuConfigLogLevel);
 }
 
+TEST_F(TargetConfigReaderFixture, AppConfigZeroAsyncDrainPeriodFallbackToEcuConfig)
+{
+    RecordProperty("Requirement", "SCR-7263548");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "TargetConfigReader fall back to the valid value from the ECU configuration file if the application "
+                   "config file contains an async drain period of zero.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    // The application config contains a drain period of zero, which would make the drainer thread spin.
+    SetConfigurationFiles({KEcuConfigFile(), KInvalidAppConfigFile()});
+
+    // ReadConfig shall still return the value from the ECU config.
+    EXPECT_EQ(GetReader().ReadConfig()->GetAsyncDrainPeriod(), kAsyncDrainPeriod);
+}
+
 TEST_F(TargetConfigReaderFixture, AppConfigInvalidLogModeFallbackToEcuConfig)
 {
     RecordProperty("Requirement", "SCR-7263548");
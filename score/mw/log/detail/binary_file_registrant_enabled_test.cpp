@@ -0,0 +1,57 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/backend_table.h"
+
+#include "gtest/gtest.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+TEST(BinaryFileRegistrantTest, BinaryFileBackendIsRegisteredAfterStaticInitialization)
+{
+    RecordProperty("Description", "The binary file backend registrant shall be registered for LogMode::kBinaryFile");
+    RecordProperty("TestType", "control-flow-analysis"); // data flow
+    RecordProperty("DerivationTechnique", "Analysis of functional dependencies");
+
+    EXPECT_TRUE(IsBackendAvailable(LogMode::kBinaryFile));
+}
+
+TEST(BinaryFileRegistrantTest, BinaryFileBackendCreatorReturnsNonNullRecorder)
+{
+    RecordProperty("Description",
+                   "The registered binary file backend shall return a non-null Recorder given valid configuration.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "Analysis of functional dependencies");
+
+    ASSERT_TRUE(IsBackendAvailable(LogMode::kBinaryFile));
+
+    Configuration config;
+    config.SetLogFilePath(::testing::TempDir());
+    auto recorder = CreateRecorderForMode(LogMode::kBinaryFile, config, score::cpp::pmr::get_default_resource());
+
+    EXPECT_NE(recorder, nullptr);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
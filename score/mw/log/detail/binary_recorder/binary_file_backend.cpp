@@ -0,0 +1,123 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_file_backend.h"
+
+#include "score/mw/log/drop_statistics.h"
+
+#include "static_reflection_with_serialization/serialization/for_logging.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+//  Bounds the time the drainer thread needs to notice a stop request:
+constexpr std::size_t kLimitSlotsInOneCycle{32U};
+
+}  // namespace
+
+BinaryFileBackend::BinaryFileBackend(std::unique_ptr<MpscRingBuffer<LogRecord>> allocator,
+                                     std::unique_ptr<MappedSegmentWriter> writer,
+                                     const DrainerThreadOptions& drainer_thread_options,
+                                     score::cpp::pmr::unique_ptr<score::os::Pthread> pthread) noexcept
+    : Backend(), buffer_allocator_{std::move(allocator)}, writer_{std::move(writer)}, drainer_thread_{}
+{
+    auto drain = [this]() noexcept {
+        return WritePublishedSlots(kLimitSlotsInOneCycle);
+    };
+    drainer_thread_ = std::make_unique<DrainerThread>(std::move(drain), drainer_thread_options, std::move(pthread));
+}
+
+BinaryFileBackend::~BinaryFileBackend()
+{
+    //  Write residual records once the drainer thread no longer accesses the writer:
+    drainer_thread_.reset();
+    std::ignore = WritePublishedSlots(buffer_allocator_->GetCapacity());
+}
+
+score::cpp::optional<SlotHandle> BinaryFileBackend::ReserveSlot() noexcept
+{
+    const auto slot = buffer_allocator_->AcquireSlotToWrite();
+    if (slot.has_value())
+    {
+        // MpscRingBuffer has capacity limited by CheckFoxMaxCapacity thus the cast is valid, see FileOutputBackend.
+        // coverity[autosar_cpp14_a4_7_1_violation]
+        return SlotHandle{static_cast<SlotIndex>(slot.value())};
+    }
+    return {};
+}
+
+void BinaryFileBackend::FlushSlot(const SlotHandle& slot) noexcept
+{
+    //  Publishing the slot hands it over to the drainer thread:
+    buffer_allocator_->ReleaseSlot(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+}
+
+LogRecord& BinaryFileBackend::GetLogRecord(const SlotHandle& slot) noexcept
+{
+    return buffer_allocator_->GetUnderlyingBufferFor(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+}
+
+bool BinaryFileBackend::WritePublishedSlots(const std::size_t limit_slots) noexcept
+{
+    for (std::size_t written{0U}; written < limit_slots; ++written)
+    {
+        const auto slot = buffer_allocator_->AcquireSlotToRead();
+        if (!slot.has_value())
+        {
+            return false;
+        }
+        WriteRecord(buffer_allocator_->GetUnderlyingBufferFor(slot.value()));
+        buffer_allocator_->ReleaseReadSlot(slot.value());
+    }
+    return true;
+}
+
+void BinaryFileBackend::WriteRecord(LogRecord& log_record) noexcept
+{
+    using score::common::visitor::logging_serializer;
+    const auto& log_entry = log_record.GetLogEntry();
+
+    //  Records that exceed a segment, find no mapped segment or cannot be serialized are dropped, like records that do
+    //  not find a free slot:
+    const auto size = logging_serializer::serialize_size(log_entry);
+    auto body = writer_->Reserve(size);
+    if (body.empty())
+    {
+        CountDroppedRecords(DropReason::kNotWritten);
+        return;
+    }
+    const auto written = logging_serializer::serialize(log_entry, body.data(), static_cast<std::size_t>(body.size()));
+    if (written != size)
+    {
+        CountDroppedRecords(DropReason::kNotWritten);
+        return;
+    }
+
+    RecordHeader header{};
+    header.timestamp_steady_nsec = log_entry.timestamp_steady_nsec;
+    header.timestamp_system_nsec = log_entry.timestamp_system_nsec;
+    writer_->Commit(header);
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
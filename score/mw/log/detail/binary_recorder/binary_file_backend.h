@@ -0,0 +1,70 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FILE_BACKEND_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FILE_BACKEND_H
+
+#include "score/mw/log/detail/backend.h"
+#include "score/mw/log/detail/binary_recorder/mapped_segment_writer.h"
+#include "score/mw/log/detail/mpsc_ring_buffer.h"
+#include "score/mw/log/detail/drainer_thread.h"
+
+#include <memory>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Backend that serializes flushed log records into memory-mapped segment files.
+///
+/// \details Records are serialized with score::common::visitor::logging_serializer, i.e. the STRUCT_VISITABLE
+/// description of LogEntry, directly into the mapping of the current segment. Serializing is left to a DrainerThread,
+/// which writes the published slots in the order in which they were reserved, like the asynchronous mode of
+/// FileOutputBackend. Thus logging threads only reserve, fill and publish slots and never contend on the writer.
+class BinaryFileBackend final : public Backend
+{
+  public:
+    BinaryFileBackend(std::unique_ptr<MpscRingBuffer<LogRecord>> allocator,
+                      std::unique_ptr<MappedSegmentWriter> writer,
+                      const DrainerThreadOptions& drainer_thread_options,
+                      score::cpp::pmr::unique_ptr<score::os::Pthread> pthread) noexcept;
+    BinaryFileBackend(const BinaryFileBackend&) = delete;
+    BinaryFileBackend(BinaryFileBackend&&) = delete;
+    BinaryFileBackend& operator=(const BinaryFileBackend&) = delete;
+    BinaryFileBackend& operator=(BinaryFileBackend&&) = delete;
+    ~BinaryFileBackend() override;
+
+    score::cpp::optional<SlotHandle> ReserveSlot() noexcept override;
+    void FlushSlot(const SlotHandle& slot) noexcept override;
+    LogRecord& GetLogRecord(const SlotHandle& slot) noexcept override;
+
+  private:
+    bool WritePublishedSlots(const std::size_t limit_slots) noexcept;
+    void WriteRecord(LogRecord& log_record) noexcept;
+
+    std::unique_ptr<MpscRingBuffer<LogRecord>> buffer_allocator_;
+    //  Only accessed by the drainer thread, and on destruction once the thread is stopped:
+    std::unique_ptr<MappedSegmentWriter> writer_;
+    std::unique_ptr<DrainerThread> drainer_thread_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FILE_BACKEND_H
@@ -0,0 +1,77 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/mapped_segment_writer.h"
+#include "score/mw/log/detail/binary_recorder/binary_file_backend.h"
+#include "score/mw/log/drop_statistics.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace test
+{
+namespace
+{
+
+constexpr std::size_t kSlotSize{64U};
+constexpr std::size_t kNumberOfSlots{2U};
+
+TEST(BinaryFileBackendTest, RecordsWithoutSegmentAreCountedAsNotWritten)
+{
+    ::testing::Test::RecordProperty("Description",
+                                    "Verifies that records which cannot be written are counted as dropped.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "error-guessing");
+
+    // Given a backend whose writer has no segment mapped
+    auto* const memory_resource = score::cpp::pmr::get_default_resource();
+    auto writer = std::make_unique<MappedSegmentWriter>(::testing::TempDir() + "/not/existing/dir/app",
+                                                        4096U,
+                                                        1U,
+                                                        score::os::Fcntl::Default(memory_resource),
+                                                        score::os::Unistd::Default(memory_resource),
+                                                        score::os::Mman::Default(memory_resource));
+    ASSERT_FALSE(writer->Open().has_value());
+    auto allocator = std::make_unique<MpscRingBuffer<LogRecord>>(
+        kNumberOfSlots, kNumberOfSlots * kSlotSize, [](score::cpp::pmr::memory_resource* const arena) noexcept {
+            return LogRecord{kSlotSize, arena};
+        });
+    auto backend = std::make_unique<BinaryFileBackend>(
+        std::move(allocator), std::move(writer), DrainerThreadOptions{}, score::os::Pthread::Default(memory_resource));
+    const auto dropped_before = GetDropStatistics().not_written;
+
+    // When a record is flushed and the backend is destroyed
+    const auto slot = backend->ReserveSlot();
+    ASSERT_TRUE(slot.has_value());
+    backend->FlushSlot(slot.value());
+    backend.reset();
+
+    // Then it is counted as not written
+    EXPECT_EQ(GetDropStatistics().not_written, dropped_before + 1U);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
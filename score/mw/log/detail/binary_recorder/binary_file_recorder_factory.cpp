@@ -0,0 +1,78 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_file_recorder_factory.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_file_backend.h"
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/detail/error.h"
+#include "score/mw/log/detail/initialization_reporter.h"
+
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+std::unique_ptr<Recorder> BinaryFileRecorderFactory::CreateConcreteLogRecorder(
+    const Configuration& config,
+    score::cpp::pmr::memory_resource* memory_resource)
+{
+    const auto app_id = config.GetAppId();
+    std::string file_path_prefix{config.GetLogFilePath()};
+    file_path_prefix.append("/").append(app_id.data(), app_id.size());
+
+    auto writer = std::make_unique<MappedSegmentWriter>(std::move(file_path_prefix),
+                                                        config.GetBinaryFileSegmentSize(),
+                                                        config.GetBinaryFileNumberOfSegments(),
+                                                        score::os::Fcntl::Default(memory_resource),
+                                                        score::os::Unistd::Default(memory_resource),
+                                                        score::os::Mman::Default(memory_resource));
+    const auto opened = writer->Open();
+    if (!opened.has_value())
+    {
+        ReportInitializationError(MakeError(Error::kLogFileCreationFailed, opened.error().ToString()),
+                                  config.GetLogFilePath(),
+                                  app_id);
+        return std::make_unique<EmptyRecorder>();
+    }
+
+    //  No header is built for binary records, so the arena only holds the payload buffers:
+    const auto slot_size = config.GetSlotSizeInBytes();
+    auto allocator = std::make_unique<MpscRingBuffer<LogRecord>>(
+        config.GetNumberOfSlots(),
+        config.GetNumberOfSlots() * slot_size,
+        [slot_size](score::cpp::pmr::memory_resource* const arena) noexcept {
+            return LogRecord{slot_size, arena};
+        });
+
+    //  Records are always written by a drainer thread, the asyncDrain settings apply to it:
+    DrainerThreadOptions drainer_thread_options{};
+    drainer_thread_options.period = config.GetAsyncDrainPeriod();
+    drainer_thread_options.cpu_affinity = config.GetAsyncDrainCpuAffinity();
+    drainer_thread_options.priority = config.GetAsyncDrainPriority();
+    auto backend = std::make_unique<BinaryFileBackend>(std::move(allocator),
+                                                       std::move(writer),
+                                                       drainer_thread_options,
+                                                       score::os::Pthread::Default(memory_resource));
+    return std::make_unique<BinaryRecorder>(config, std::move(backend));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,250 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+template <typename T>
+constexpr std::uint32_t TypeLengthOf() noexcept
+{
+    static_assert((sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U) || (sizeof(T) == 8U),
+                  "Unsupported argument size");
+    switch (sizeof(T))
+    {
+        case 1U:
+            return dlt_type_info::kTypeLength8Bit;
+        case 2U:
+            return dlt_type_info::kTypeLength16Bit;
+        case 4U:
+            return dlt_type_info::kTypeLength32Bit;
+        default:
+            return dlt_type_info::kTypeLength64Bit;
+    }
+}
+
+constexpr std::uint32_t CodingOf(const IntegerRepresentation representation) noexcept
+{
+    return static_cast<std::uint32_t>(representation) << dlt_type_info::kCodingShift;
+}
+
+template <typename T>
+AddArgumentResult PutArgument(VerbosePayload& payload, const std::uint32_t type_info, const T value) noexcept
+{
+    constexpr std::size_t kArgumentSize{sizeof(type_info) + sizeof(T)};
+    const auto written = payload.Put(
+        [type_info, value](const score::cpp::span<Byte> buffer) noexcept -> std::size_t {
+            if (static_cast<std::size_t>(buffer.size()) < kArgumentSize)
+            {
+                return 0U;
+            }
+            // NOLINTBEGIN(score-banned-function) memcpy is needed for unaligned stores
+            std::ignore = std::memcpy(buffer.data(), &type_info, sizeof(type_info));
+            std::ignore = std::memcpy(buffer.subspan(sizeof(type_info)).data(), &value, sizeof(T));
+            // NOLINTEND(score-banned-function) memcpy is needed for unaligned stores
+            return kArgumentSize;
+        },
+        kArgumentSize);
+    return (written == kArgumentSize) ? AddArgumentResult::kAdded : AddArgumentResult::kNotAdded;
+}
+
+template <typename T>
+AddArgumentResult PutUnsigned(VerbosePayload& payload, const T value, const IntegerRepresentation representation)
+{
+    return PutArgument(payload, dlt_type_info::kUnsigned | TypeLengthOf<T>() | CodingOf(representation), value);
+}
+
+template <typename T>
+AddArgumentResult PutSigned(VerbosePayload& payload, const T value)
+{
+    return PutArgument(payload, dlt_type_info::kSigned | TypeLengthOf<T>(), value);
+}
+
+/// \brief Puts type info, 16 bit length and data. A terminating zero is appended and counted if null_terminated.
+AddArgumentResult PutVariableLength(VerbosePayload& payload,
+                                    const std::uint32_t type_info,
+                                    const Byte* const data,
+                                    const std::size_t size,
+                                    const bool null_terminated) noexcept
+{
+    using LengthType = std::uint16_t;
+    constexpr std::size_t kFixedSize{sizeof(type_info) + sizeof(LengthType)};
+    //  The capture must fit into the storage of ReserveCallback, so the terminator size is derived inside:
+    const auto written = payload.Put(
+        [type_info, null_terminated, data, size](const score::cpp::span<Byte> buffer) noexcept -> std::size_t {
+            const std::size_t terminator_size = null_terminated ? 1U : 0U;
+            const auto available = static_cast<std::size_t>(buffer.size());
+            if (available < (kFixedSize + terminator_size))
+            {
+                return 0U;
+            }
+            //  Cut the data to the remaining capacity:
+            const std::size_t max_data_size =
+                std::min(available - kFixedSize - terminator_size,
+                         static_cast<std::size_t>(std::numeric_limits<LengthType>::max()) - terminator_size);
+            const std::size_t data_size = std::min(size, max_data_size);
+            const auto length = static_cast<LengthType>(data_size + terminator_size);
+            // NOLINTBEGIN(score-banned-function) memcpy is needed for unaligned stores
+            std::ignore = std::memcpy(buffer.data(), &type_info, sizeof(type_info));
+            std::ignore = std::memcpy(buffer.subspan(sizeof(type_info)).data(), &length, sizeof(length));
+            if (data_size > 0U)
+            {
+                std::ignore = std::memcpy(buffer.subspan(kFixedSize).data(), data, data_size);
+            }
+            // NOLINTEND(score-banned-function) memcpy is needed for unaligned stores
+            if (terminator_size > 0U)
+            {
+                buffer[static_cast<score::cpp::span<Byte>::size_type>(kFixedSize + data_size)] = '\0';
+            }
+            return kFixedSize + data_size + terminator_size;
+        },
+        kFixedSize + size + (null_terminated ? 1U : 0U));
+    return (written > 0U) ? AddArgumentResult::kAdded : AddArgumentResult::kNotAdded;
+}
+
+}  // namespace
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const bool data) noexcept
+{
+    return PutArgument(payload, dlt_type_info::kBool | dlt_type_info::kTypeLength8Bit, static_cast<std::uint8_t>(data));
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload,
+                                    const std::uint8_t data,
+                                    const IntegerRepresentation representation) noexcept
+{
+    return PutUnsigned(payload, data, representation);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload,
+                                    const std::uint16_t data,
+                                    const IntegerRepresentation representation) noexcept
+{
+    return PutUnsigned(payload, data, representation);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload,
+                                    const std::uint32_t data,
+                                    const IntegerRepresentation representation) noexcept
+{
+    return PutUnsigned(payload, data, representation);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload,
+                                    const std::uint64_t data,
+                                    const IntegerRepresentation representation) noexcept
+{
+    return PutUnsigned(payload, data, representation);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int8_t data) noexcept
+{
+    return PutSigned(payload, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int16_t data) noexcept
+{
+    return PutSigned(payload, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int32_t data) noexcept
+{
+    return PutSigned(payload, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int64_t data) noexcept
+{
+    return PutSigned(payload, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const float data) noexcept
+{
+    return PutArgument(payload, dlt_type_info::kFloat | TypeLengthOf<float>(), data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const double data) noexcept
+{
+    return PutArgument(payload, dlt_type_info::kFloat | TypeLengthOf<double>(), data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex8 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kHex);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex16 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kHex);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex32 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kHex);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex64 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kHex);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin8 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kBinary);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin16 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kBinary);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin32 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kBinary);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin64 data) noexcept
+{
+    return PutUnsigned(payload, data.value, IntegerRepresentation::kBinary);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::string_view data) noexcept
+{
+    constexpr bool kNullTerminated{true};
+    return PutVariableLength(
+        payload, dlt_type_info::kString | dlt_type_info::kStringCodingUtf8, data.data(), data.size(), kNullTerminated);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogRawBuffer data) noexcept
+{
+    constexpr bool kNullTerminated{false};
+    return PutVariableLength(
+        payload, dlt_type_info::kRaw, data.data(), static_cast<std::size_t>(data.size()), kNullTerminated);
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
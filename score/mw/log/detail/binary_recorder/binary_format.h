@@ -0,0 +1,96 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FORMAT_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FORMAT_H
+
+#include "score/mw/log/detail/add_argument_result.h"
+#include "score/mw/log/detail/integer_representation.h"
+#include "score/mw/log/detail/verbose_payload.h"
+#include "score/mw/log/log_types.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Bits of the 32 bit type info that precedes every argument of a DLT verbose payload (PRS_Dlt_00626).
+namespace dlt_type_info
+{
+constexpr std::uint32_t kTypeLengthMask{0x0FU};
+constexpr std::uint32_t kTypeLength8Bit{0x01U};
+constexpr std::uint32_t kTypeLength16Bit{0x02U};
+constexpr std::uint32_t kTypeLength32Bit{0x03U};
+constexpr std::uint32_t kTypeLength64Bit{0x04U};
+constexpr std::uint32_t kBool{0x10U};
+constexpr std::uint32_t kSigned{0x20U};
+constexpr std::uint32_t kUnsigned{0x40U};
+constexpr std::uint32_t kFloat{0x80U};
+constexpr std::uint32_t kString{0x200U};
+constexpr std::uint32_t kRaw{0x400U};
+constexpr std::uint32_t kCodingShift{15U};
+constexpr std::uint32_t kCodingMask{0x07U << kCodingShift};
+constexpr std::uint32_t kStringCodingUtf8{0x01U << kCodingShift};
+}  // namespace dlt_type_info
+
+/// \brief Encodes arguments in the binary DLT verbose format: the type info followed by the value in host byte order.
+///
+/// \details In contrast to TextFormat nothing is formatted on the logging thread. Every argument is either added as a
+/// whole or not at all, so that a payload can always be decoded. Strings and raw buffers are the exception, they are
+/// cut to the remaining capacity like in the text recorder.
+class BinaryFormat
+{
+  public:
+    static AddArgumentResult Log(VerbosePayload& payload, const bool data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload,
+                                 const std::uint8_t data,
+                                 const IntegerRepresentation representation = IntegerRepresentation::kDecimal) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload,
+                                 const std::uint16_t data,
+                                 const IntegerRepresentation representation = IntegerRepresentation::kDecimal) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload,
+                                 const std::uint32_t data,
+                                 const IntegerRepresentation representation = IntegerRepresentation::kDecimal) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload,
+                                 const std::uint64_t data,
+                                 const IntegerRepresentation representation = IntegerRepresentation::kDecimal) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int8_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int16_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int32_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int64_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const float data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const double data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex8 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex16 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex32 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex64 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin8 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin16 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin32 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin64 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::string_view data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogRawBuffer data) noexcept;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FORMAT_H
@@ -0,0 +1,199 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+#include "score/mw/log/detail/verbose_payload.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstring>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace test
+{
+namespace
+{
+
+template <typename T>
+T Read(const ByteVector& buffer, const std::size_t offset)
+{
+    T value{};
+    std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    return value;
+}
+
+class BinaryFormatFixture : public ::testing::Test
+{
+  public:
+    ByteVector buffer{};
+    VerbosePayload payload{100, buffer};
+    ByteVector small_buffer{};
+    VerbosePayload capacity_six_payload{6, small_buffer};
+};
+
+TEST_F(BinaryFormatFixture, UnsignedIntegerIsStoredWithTypeInfoAndValue)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that an uint32 is stored as type info and raw value.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an empty payload
+    // When logging an uint32
+    const auto result = BinaryFormat::Log(payload, std::uint32_t{0x12345678U});
+
+    // Then type info and value are stored
+    EXPECT_EQ(result, AddArgumentResult::kAdded);
+    ASSERT_EQ(buffer.size(), 8U);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 0U), dlt_type_info::kUnsigned | dlt_type_info::kTypeLength32Bit);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 4U), 0x12345678U);
+}
+
+TEST_F(BinaryFormatFixture, HexAndBinaryRepresentationsAreStoredAsCoding)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that hex and binary values carry their coding.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an empty payload
+    // When logging a hex and a binary value
+    EXPECT_EQ(BinaryFormat::Log(payload, LogHex16{0xABCDU}), AddArgumentResult::kAdded);
+    EXPECT_EQ(BinaryFormat::Log(payload, LogBin8{0x05U}), AddArgumentResult::kAdded);
+
+    // Then the coding bits reflect the representation
+    ASSERT_EQ(buffer.size(), 11U);
+    const auto hex_type_info = Read<std::uint32_t>(buffer, 0U);
+    EXPECT_EQ(hex_type_info & dlt_type_info::kTypeLengthMask, dlt_type_info::kTypeLength16Bit);
+    EXPECT_EQ((hex_type_info & dlt_type_info::kCodingMask) >> dlt_type_info::kCodingShift,
+              static_cast<std::uint32_t>(IntegerRepresentation::kHex));
+    EXPECT_EQ(Read<std::uint16_t>(buffer, 4U), 0xABCDU);
+    const auto bin_type_info = Read<std::uint32_t>(buffer, 6U);
+    EXPECT_EQ((bin_type_info & dlt_type_info::kCodingMask) >> dlt_type_info::kCodingShift,
+              static_cast<std::uint32_t>(IntegerRepresentation::kBinary));
+    EXPECT_EQ(buffer[10U], 0x05);
+}
+
+TEST_F(BinaryFormatFixture, SignedFloatAndBoolAreStoredWithTheirTypes)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies the type info of signed, float and bool values.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an empty payload
+    // When logging a signed, a double and a bool value
+    BinaryFormat::Log(payload, std::int16_t{-2});
+    BinaryFormat::Log(payload, 1.5);
+    BinaryFormat::Log(payload, true);
+
+    // Then each value is stored with its type info
+    ASSERT_EQ(buffer.size(), 6U + 12U + 5U);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 0U), dlt_type_info::kSigned | dlt_type_info::kTypeLength16Bit);
+    EXPECT_EQ(Read<std::int16_t>(buffer, 4U), -2);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 6U), dlt_type_info::kFloat | dlt_type_info::kTypeLength64Bit);
+    EXPECT_EQ(Read<double>(buffer, 10U), 1.5);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 18U), dlt_type_info::kBool | dlt_type_info::kTypeLength8Bit);
+    EXPECT_EQ(buffer[22U], 1);
+}
+
+TEST_F(BinaryFormatFixture, StringIsStoredWithLengthAndTerminatingZero)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a string is stored with length and terminator.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an empty payload
+    // When logging a string
+    const auto result = BinaryFormat::Log(payload, std::string_view{"abc"});
+
+    // Then type info, length including the terminator and the characters are stored
+    EXPECT_EQ(result, AddArgumentResult::kAdded);
+    ASSERT_EQ(buffer.size(), 10U);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 0U), dlt_type_info::kString | dlt_type_info::kStringCodingUtf8);
+    EXPECT_EQ(Read<std::uint16_t>(buffer, 4U), 4U);
+    EXPECT_EQ(std::string(buffer.data() + 6U, 3U), "abc");
+    EXPECT_EQ(buffer[9U], '\0');
+}
+
+TEST_F(BinaryFormatFixture, RawBufferIsStoredWithLength)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a raw buffer is stored with its length.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an empty payload
+    const std::array<char, 2U> data{'\x01', '\x02'};
+
+    // When logging a raw buffer
+    const auto result = BinaryFormat::Log(payload, LogRawBuffer{data.data(), data.size()});
+
+    // Then type info, length and data are stored without terminator
+    EXPECT_EQ(result, AddArgumentResult::kAdded);
+    ASSERT_EQ(buffer.size(), 8U);
+    EXPECT_EQ(Read<std::uint32_t>(buffer, 0U), dlt_type_info::kRaw);
+    EXPECT_EQ(Read<std::uint16_t>(buffer, 4U), 2U);
+    EXPECT_EQ(buffer[6U], '\x01');
+    EXPECT_EQ(buffer[7U], '\x02');
+}
+
+TEST_F(BinaryFormatFixture, StringIsTruncatedToRemainingCapacity)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a string is cut to the remaining capacity.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a payload with six bytes capacity
+    // When logging a string that does not fit
+    const auto result = BinaryFormat::Log(capacity_six_payload, std::string_view{"abc"});
+
+    // Then nothing is stored, since not even the terminator fits behind type info and length
+    EXPECT_EQ(result, AddArgumentResult::kNotAdded);
+    EXPECT_EQ(small_buffer.size(), 0U);
+
+    // And a string that partially fits into a payload with eight bytes capacity is cut
+    ByteVector buffer_eight{};
+    VerbosePayload capacity_eight_payload{8, buffer_eight};
+    EXPECT_EQ(BinaryFormat::Log(capacity_eight_payload, std::string_view{"abc"}), AddArgumentResult::kAdded);
+    ASSERT_EQ(buffer_eight.size(), 8U);
+    EXPECT_EQ(Read<std::uint16_t>(buffer_eight, 4U), 2U);
+    EXPECT_EQ(buffer_eight[6U], 'a');
+    EXPECT_EQ(buffer_eight[7U], '\0');
+}
+
+TEST_F(BinaryFormatFixture, ValueIsNotStoredPartially)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a value that does not fit is not stored at all.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a payload with six bytes capacity
+    // When logging a value that needs eight bytes
+    const auto result = BinaryFormat::Log(capacity_six_payload, std::uint32_t{1U});
+
+    // Then nothing is stored
+    EXPECT_EQ(result, AddArgumentResult::kNotAdded);
+    EXPECT_EQ(small_buffer.size(), 0U);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
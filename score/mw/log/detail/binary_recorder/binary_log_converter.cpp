@@ -0,0 +1,265 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_log_converter.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+#include "score/mw/log/detail/binary_recorder/segment_format.h"
+#include "score/mw/log/detail/text_recorder/text_format.h"
+#include "score/mw/log/detail/verbose_payload.h"
+
+#include "static_reflection_with_serialization/serialization/for_logging.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+//  A payload is limited to the slot size, the header to a few dozen characters. Every payload byte is rendered to at
+//  most three characters (raw buffers as hex digits followed by a space).
+constexpr std::size_t kMaxLineSize{4U * 65536U};
+
+/// \brief Reads a T from the front of data and advances data behind it.
+template <typename T>
+bool Read(score::cpp::span<const Byte>& data, T& value) noexcept
+{
+    if (static_cast<std::size_t>(data.size()) < sizeof(T))
+    {
+        return false;
+    }
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed for unaligned loads
+    std::ignore = std::memcpy(&value, data.data(), sizeof(T));
+    data = data.subspan(sizeof(T));
+    return true;
+}
+
+template <typename Unsigned, typename Signed>
+bool AppendInteger(score::cpp::span<const Byte>& data, const std::uint32_t type_info, VerbosePayload& line) noexcept
+{
+    Unsigned value{};
+    if (!Read(data, value))
+    {
+        return false;
+    }
+    if ((type_info & dlt_type_info::kSigned) != 0U)
+    {
+        TextFormat::Log(line, static_cast<Signed>(value));
+        return true;
+    }
+    const auto representation =
+        static_cast<IntegerRepresentation>((type_info & dlt_type_info::kCodingMask) >> dlt_type_info::kCodingShift);
+    TextFormat::Log(line, value, representation);
+    return true;
+}
+
+template <typename T>
+bool AppendFloatingPoint(score::cpp::span<const Byte>& data, VerbosePayload& line) noexcept
+{
+    T value{};
+    if (!Read(data, value))
+    {
+        return false;
+    }
+    TextFormat::Log(line, value);
+    return true;
+}
+
+bool AppendVariableLength(score::cpp::span<const Byte>& data, const std::uint32_t type_info, VerbosePayload& line) noexcept
+{
+    std::uint16_t length{};
+    if ((!Read(data, length)) || (static_cast<std::size_t>(data.size()) < length))
+    {
+        return false;
+    }
+    const auto value = data.first(length);
+    data = data.subspan(length);
+    if ((type_info & dlt_type_info::kString) != 0U)
+    {
+        //  The terminating zero is not printed:
+        const auto string_length = ((length > 0U) && (value[length - 1U] == '\0')) ? (length - 1U) : length;
+        TextFormat::Log(line, std::string_view{value.data(), string_length});
+    }
+    else
+    {
+        TextFormat::Log(line, LogRawBuffer{value.data(), value.size()});
+    }
+    return true;
+}
+
+/// \brief Renders the argument at the front of data and advances data behind it.
+bool AppendArgument(score::cpp::span<const Byte>& data, VerbosePayload& line) noexcept
+{
+    std::uint32_t type_info{};
+    if (!Read(data, type_info))
+    {
+        return false;
+    }
+    const auto type_length = type_info & dlt_type_info::kTypeLengthMask;
+    if ((type_info & dlt_type_info::kBool) != 0U)
+    {
+        std::uint8_t value{};
+        if (!Read(data, value))
+        {
+            return false;
+        }
+        TextFormat::Log(line, value != 0U);
+        return true;
+    }
+    if ((type_info & (dlt_type_info::kSigned | dlt_type_info::kUnsigned)) != 0U)
+    {
+        switch (type_length)
+        {
+            case dlt_type_info::kTypeLength8Bit:
+                return AppendInteger<std::uint8_t, std::int8_t>(data, type_info, line);
+            case dlt_type_info::kTypeLength16Bit:
+                return AppendInteger<std::uint16_t, std::int16_t>(data, type_info, line);
+            case dlt_type_info::kTypeLength32Bit:
+                return AppendInteger<std::uint32_t, std::int32_t>(data, type_info, line);
+            case dlt_type_info::kTypeLength64Bit:
+                return AppendInteger<std::uint64_t, std::int64_t>(data, type_info, line);
+            default:
+                return false;
+        }
+    }
+    if ((type_info & dlt_type_info::kFloat) != 0U)
+    {
+        switch (type_length)
+        {
+            case dlt_type_info::kTypeLength32Bit:
+                return AppendFloatingPoint<float>(data, line);
+            case dlt_type_info::kTypeLength64Bit:
+                return AppendFloatingPoint<double>(data, line);
+            default:
+                return false;
+        }
+    }
+    if ((type_info & (dlt_type_info::kString | dlt_type_info::kRaw)) != 0U)
+    {
+        return AppendVariableLength(data, type_info, line);
+    }
+    return false;
+}
+
+std::string_view LogLevelToString(const LogLevel level) noexcept
+{
+    switch (level)
+    {
+        case LogLevel::kOff:
+            return "off";
+        case LogLevel::kFatal:
+            return "fatal";
+        case LogLevel::kError:
+            return "error";
+        case LogLevel::kWarn:
+            return "warn";
+        case LogLevel::kInfo:
+            return "info";
+        case LogLevel::kDebug:
+            return "debug";
+        case LogLevel::kVerbose:
+            return "verbose";
+        default:
+            return "undefined";
+    }
+}
+
+}  // namespace
+
+BinaryLogConverter::BinaryLogConverter(const std::string_view ecu_id) noexcept : ecu_id_{ecu_id} {}
+
+score::cpp::optional<std::uint32_t> BinaryLogConverter::GetSequenceNumber(const score::cpp::span<const Byte> segment) noexcept
+{
+    auto data = segment;
+    SegmentHeader header{};
+    if ((!Read(data, header)) || (header.magic != kSegmentMagic) ||
+        (header.byte_order_mark != kSegmentByteOrderMark) || (header.version != kSegmentFormatVersion))
+    {
+        return {};
+    }
+    return header.sequence_number;
+}
+
+score::cpp::optional<std::size_t> BinaryLogConverter::Convert(const score::cpp::span<const Byte> segment,
+                                                              std::string& output) const
+{
+    if (!GetSequenceNumber(segment).has_value())
+    {
+        return {};
+    }
+
+    std::size_t number_of_records{0U};
+    auto data = segment.subspan(sizeof(SegmentHeader));
+    RecordHeader header{};
+    while (Read(data, header) && (header.size > 0U) && (static_cast<std::size_t>(data.size()) >= header.size))
+    {
+        LogEntry log_entry{};
+        const auto result =
+            score::common::visitor::logging_serializer::deserialize(data.data(), header.size, log_entry);
+        if (!static_cast<bool>(result))
+        {
+            break;
+        }
+        AppendLine(log_entry, header.timestamp_steady_nsec, header.timestamp_system_nsec, output);
+        ++number_of_records;
+        data = data.subspan(header.size);
+    }
+    return number_of_records;
+}
+
+void BinaryLogConverter::AppendLine(const LogEntry& log_entry,
+                                    const std::uint64_t timestamp_steady_nsec,
+                                    const std::uint64_t timestamp_system_nsec,
+                                    std::string& output) const
+{
+    ByteVector buffer{};
+    VerbosePayload line{kMaxLineSize, buffer};
+
+    const std::chrono::system_clock::time_point system_time{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds{static_cast<std::int64_t>(timestamp_system_nsec)})};
+    TextFormat::PutFormattedTime(line, system_time);
+    //  Steady time in units of 100 microseconds, like TextMessageBuilder:
+    TextFormat::Log(line, static_cast<std::uint32_t>(timestamp_steady_nsec / 100'000U));
+    TextFormat::Log(line, std::string_view{"000"});
+    TextFormat::Log(line, ecu_id_.GetStringView());
+    TextFormat::Log(line, log_entry.app_id.GetStringView());
+    TextFormat::Log(line, log_entry.ctx_id.GetStringView());
+    TextFormat::Log(line, std::string_view{"log"});
+    TextFormat::Log(line, LogLevelToString(log_entry.log_level));
+    TextFormat::Log(line, std::string_view{"verbose"});
+    TextFormat::Log(line, log_entry.num_of_args);
+
+    score::cpp::span<const Byte> payload{log_entry.payload.data(), log_entry.payload.size()};
+    while ((payload.size() > 0) && AppendArgument(payload, line))
+    {
+    }
+    TextFormat::TerminateLog(line);
+
+    const auto text = line.GetSpan();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the text is stored as bytes
+    output.append(reinterpret_cast<const char*>(text.data()), static_cast<std::size_t>(text.size()));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,69 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_CONVERTER_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_CONVERTER_H
+
+#include "score/mw/log/detail/log_entry.h"
+#include "score/mw/log/detail/logging_identifier.h"
+
+#include <score/optional.hpp>
+#include <score/span.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Converts segment files of the binary file recorder offline into the text that the console recorder prints.
+///
+/// \details Each record becomes one line, e.g.
+/// "2021/03/17 15:19:20.4360057 551684554 000 ECU1 APP CTX log info verbose 2 text 42"
+/// The arguments are rendered by TextFormat, so they look exactly like the ones of the text recorder.
+class BinaryLogConverter
+{
+  public:
+    /// \param ecu_id Printed in every line, since segment files do not contain the ECU ID
+    explicit BinaryLogConverter(const std::string_view ecu_id) noexcept;
+
+    /// \brief Returns the sequence number of segment, empty if segment does not start with a valid SegmentHeader.
+    static score::cpp::optional<std::uint32_t> GetSequenceNumber(const score::cpp::span<const Byte> segment) noexcept;
+
+    /// \brief Appends one line per record of segment to output.
+    ///
+    /// \return The number of converted records, empty if the segment header is invalid.
+    /// \details Conversion stops at the end of the written records or at the first record that cannot be decoded.
+    score::cpp::optional<std::size_t> Convert(const score::cpp::span<const Byte> segment, std::string& output) const;
+
+  private:
+    void AppendLine(const LogEntry& log_entry,
+                    const std::uint64_t timestamp_steady_nsec,
+                    const std::uint64_t timestamp_system_nsec,
+                    std::string& output) const;
+
+    LoggingIdentifier ecu_id_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_CONVERTER_H
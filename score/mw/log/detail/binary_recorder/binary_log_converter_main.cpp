@@ -0,0 +1,104 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_log_converter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+//  Offline converter of binary segment files to text:
+//
+//    binary_log_converter [--ecu <ECU ID>] <segment file>...
+//
+//  The segments are printed in the order of their sequence numbers, so the files of all runs can be passed at once,
+//  e.g. binary_log_converter /tmp/APP.*.mwlb
+
+namespace
+{
+
+using score::mw::log::detail::BinaryLogConverter;
+using score::mw::log::detail::Byte;
+
+struct Segment
+{
+    std::string path;
+    std::vector<Byte> data;
+    std::uint32_t sequence_number;
+};
+
+bool ReadFile(const std::string& path, std::vector<Byte>& data)
+{
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+    {
+        return false;
+    }
+    data.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::vector<std::string> arguments(argv + 1, argv + argc);
+    if (arguments.empty())
+    {
+        std::cerr << "Usage: binary_log_converter [--ecu <ECU ID>] <segment file>...\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string ecu_id{"ECU1"};
+    std::vector<Segment> segments{};
+    for (auto argument = arguments.cbegin(); argument != arguments.cend(); ++argument)
+    {
+        if ((*argument == "--ecu") && (std::next(argument) != arguments.cend()))
+        {
+            ++argument;
+            ecu_id = *argument;
+            continue;
+        }
+
+        Segment segment{*argument, {}, 0U};
+        if (!ReadFile(segment.path, segment.data))
+        {
+            std::cerr << "Cannot read " << segment.path << '\n';
+            return EXIT_FAILURE;
+        }
+        const auto sequence_number = BinaryLogConverter::GetSequenceNumber({segment.data.data(), segment.data.size()});
+        if (!sequence_number.has_value())
+        {
+            std::cerr << "Skipping " << segment.path << ": not a binary log segment\n";
+            continue;
+        }
+        segment.sequence_number = sequence_number.value();
+        segments.push_back(std::move(segment));
+    }
+    std::sort(segments.begin(), segments.end(), [](const Segment& lhs, const Segment& rhs) {
+        return lhs.sequence_number < rhs.sequence_number;
+    });
+
+    const BinaryLogConverter converter{ecu_id};
+    std::string text{};
+    for (const auto& segment : segments)
+    {
+        text.clear();
+        std::ignore = converter.Convert({segment.data.data(), segment.data.size()}, text);
+        std::cout << text;
+    }
+    return EXIT_SUCCESS;
+}
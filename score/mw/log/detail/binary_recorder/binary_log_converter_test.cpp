@@ -0,0 +1,197 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_log_converter.h"
+#include "score/mw/log/detail/binary_recorder/binary_file_recorder_factory.h"
+#include "score/mw/log/detail/binary_recorder/segment_format.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace test
+{
+namespace
+{
+
+using ::testing::HasSubstr;
+
+class BinaryLogConverterFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        config_.SetAppId("APP");
+        config_.SetLogFilePath(::testing::TempDir());
+        config_.SetDefaultLogLevel(LogLevel::kVerbose);
+        config_.SetBinaryFileSegmentSize(4096U);
+        config_.SetBinaryFileNumberOfSegments(1U);
+        RemoveSegmentFile();
+    }
+
+    void TearDown() override
+    {
+        RemoveSegmentFile();
+    }
+
+    std::vector<Byte> ReadSegmentFile() const
+    {
+        std::ifstream file{GetSegmentPath(), std::ios::binary};
+        return std::vector<Byte>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+  protected:
+    std::string GetSegmentPath() const
+    {
+        return ::testing::TempDir() + "/APP.0" + std::string{kSegmentFileExtension};
+    }
+
+    void RemoveSegmentFile() const
+    {
+        std::ignore = std::remove(GetSegmentPath().c_str());
+    }
+
+    Configuration config_{};
+    BinaryLogConverter converter_{"ECU1"};
+};
+
+TEST_F(BinaryLogConverterFixture, RecordsWrittenByBinaryRecorderAreConvertedToText)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies the round trip from BinaryRecorder to text.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a binary file recorder
+    {
+        auto recorder =
+            BinaryFileRecorderFactory{}.CreateLogRecorder(config_, score::cpp::pmr::get_default_resource());
+        ASSERT_NE(dynamic_cast<BinaryRecorder*>(recorder.get()), nullptr);
+
+        // When logging two records
+        auto slot = recorder->StartRecord("CTX", LogLevel::kInfo);
+        ASSERT_TRUE(slot.has_value());
+        recorder->Log(slot.value(), std::string_view{"text"});
+        recorder->Log(slot.value(), std::int32_t{42});
+        recorder->StopRecord(slot.value());
+
+        slot = recorder->StartRecord("CTX", LogLevel::kWarn);
+        ASSERT_TRUE(slot.has_value());
+        recorder->Log(slot.value(), LogHex8{0xABU});
+        recorder->Log(slot.value(), true);
+        recorder->StopRecord(slot.value());
+    }
+
+    // Then the converted segment contains one line per record in the layout of the text recorder
+    const auto segment = ReadSegmentFile();
+    const auto sequence_number = BinaryLogConverter::GetSequenceNumber(segment);
+    ASSERT_TRUE(sequence_number.has_value());
+    EXPECT_EQ(sequence_number.value(), 0U);
+
+    std::string text{};
+    const auto converted = converter_.Convert(segment, text);
+    ASSERT_TRUE(converted.has_value());
+    EXPECT_EQ(converted.value(), 2U);
+    EXPECT_THAT(text, HasSubstr(" 000 ECU1 APP CTX log info verbose 2 text 42 \n"));
+    EXPECT_THAT(text, HasSubstr(" 000 ECU1 APP CTX log warn verbose 2 ab True \n"));
+}
+
+TEST_F(BinaryLogConverterFixture, RecordsOfDisabledLogLevelAreNotWritten)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that records of a disabled log level are dropped.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a binary file recorder with log level info
+    config_.SetDefaultLogLevel(LogLevel::kInfo);
+    {
+        auto recorder =
+            BinaryFileRecorderFactory{}.CreateLogRecorder(config_, score::cpp::pmr::get_default_resource());
+
+        // When logging a debug record
+        // Then no slot is reserved
+        EXPECT_FALSE(recorder->StartRecord("CTX", LogLevel::kDebug).has_value());
+    }
+
+    // And the segment contains no record
+    std::string text{};
+    const auto converted = converter_.Convert(ReadSegmentFile(), text);
+    ASSERT_TRUE(converted.has_value());
+    EXPECT_EQ(converted.value(), 0U);
+    EXPECT_TRUE(text.empty());
+}
+
+TEST_F(BinaryLogConverterFixture, InvalidSegmentIsRejected)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that data without a segment header is rejected.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given data that does not start with a segment header
+    const std::vector<Byte> segment(64U, 'x');
+
+    // When converting it
+    std::string text{};
+    const auto converted = converter_.Convert(segment, text);
+
+    // Then the conversion fails without output
+    EXPECT_FALSE(converted.has_value());
+    EXPECT_FALSE(BinaryLogConverter::GetSequenceNumber(segment).has_value());
+    EXPECT_TRUE(text.empty());
+}
+
+TEST_F(BinaryLogConverterFixture, TruncatedRecordStopsConversion)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a record cut off at the end is not converted.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a segment with one record that is cut off behind its record header
+    {
+        auto recorder =
+            BinaryFileRecorderFactory{}.CreateLogRecorder(config_, score::cpp::pmr::get_default_resource());
+        auto slot = recorder->StartRecord("CTX", LogLevel::kInfo);
+        ASSERT_TRUE(slot.has_value());
+        recorder->Log(slot.value(), std::string_view{"text"});
+        recorder->StopRecord(slot.value());
+    }
+    auto segment = ReadSegmentFile();
+    segment.resize(sizeof(SegmentHeader) + sizeof(RecordHeader) + 1U);
+
+    // When converting it
+    std::string text{};
+    const auto converted = converter_.Convert(segment, text);
+
+    // Then no record is converted
+    ASSERT_TRUE(converted.has_value());
+    EXPECT_EQ(converted.value(), 0U);
+    EXPECT_TRUE(text.empty());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,67 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+#include "score/os/utils/high_resolution_steady_clock.h"
+
+#include <chrono>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+template <typename Clock>
+inline std::uint64_t NanosecondsSinceEpoch() noexcept
+{
+    const auto nanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    return static_cast<std::uint64_t>(nanoseconds);
+}
+
+}  //  anonymous namespace
+
+struct BinaryRecordFormat
+{
+    static void StartRecord(LogEntry& log_entry) noexcept
+    {
+        log_entry.timestamp_steady_nsec = NanosecondsSinceEpoch<score::os::HighResolutionSteadyClock>();
+        log_entry.timestamp_system_nsec = NanosecondsSinceEpoch<std::chrono::system_clock>();
+    }
+
+    template <typename T>
+    static AddArgumentResult Log(VerbosePayload& payload, const T data) noexcept
+    {
+        return BinaryFormat::Log(payload, data);
+    }
+};
+
+template class SlotRecorder<BinaryRecordFormat>;
+
+BinaryRecorder::BinaryRecorder(const detail::Configuration& config, std::unique_ptr<detail::Backend> backend) noexcept
+    : SlotRecorder<BinaryRecordFormat>(config, std::move(backend), false)
+{
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,53 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_H
+
+#include "score/mw/log/detail/slot_recorder.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Encodes the arguments of a BinaryRecorder in the binary DLT verbose format.
+struct BinaryRecordFormat;
+
+extern template class SlotRecorder<BinaryRecordFormat>;
+
+/// \brief Recorder that encodes arguments in the binary DLT verbose format instead of formatting them as text.
+///
+/// \details Together with BinaryFileBackend this implements the kBinaryFile log mode. Records carry the steady and the
+/// system clock at StartRecord(), the text is only produced offline by the binary_log_converter.
+class BinaryRecorder final : public SlotRecorder<BinaryRecordFormat>
+{
+  public:
+    BinaryRecorder(const detail::Configuration& config, std::unique_ptr<detail::Backend> backend) noexcept;
+    BinaryRecorder(BinaryRecorder&&) noexcept = delete;
+    BinaryRecorder(const BinaryRecorder&) noexcept = delete;
+    BinaryRecorder& operator=(BinaryRecorder&&) noexcept = delete;
+    BinaryRecorder& operator=(const BinaryRecorder&) noexcept = delete;
+
+    ~BinaryRecorder() override = default;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_H
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+#include "score/mw/log/detail/backend_mock.h"
+#include "score/mw/log/drop_statistics.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace test
+{
+namespace
+{
+
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+constexpr auto kContext = "ctx0";
+
+class BinaryRecorderFixture : public ::testing::Test
+{
+  protected:
+    std::unique_ptr<NiceMock<BackendMock>> backend_ = std::make_unique<NiceMock<BackendMock>>();
+    Configuration config_{};
+    SlotHandle slot_{};
+    LogRecord log_record_{};
+};
+
+TEST_F(BinaryRecorderFixture, StartRecordFillsTimestampsOfReservedSlot)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a reserved slot carries the clocks of the record.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a backend with a free slot
+    ON_CALL(*backend_, ReserveSlot()).WillByDefault(Return(slot_));
+    ON_CALL(*backend_, GetLogRecord(slot_)).WillByDefault(ReturnRef(log_record_));
+    BinaryRecorder recorder{config_, std::move(backend_)};
+
+    // When starting a record
+    const auto slot = recorder.StartRecord(kContext, LogLevel::kError);
+
+    // Then the slot is filled with the context and both clocks
+    ASSERT_TRUE(slot.has_value());
+    const auto& log_entry = log_record_.GetLogEntry();
+    EXPECT_EQ(log_entry.ctx_id.GetStringView(), kContext);
+    EXPECT_NE(log_entry.timestamp_steady_nsec, 0U);
+    EXPECT_NE(log_entry.timestamp_system_nsec, 0U);
+}
+
+TEST_F(BinaryRecorderFixture, MissingSlotIsCountedAsDropped)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that records without a free slot are counted.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "error-guessing");
+
+    // Given a backend whose slots are all in use
+    ON_CALL(*backend_, ReserveSlot()).WillByDefault(Return(score::cpp::optional<SlotHandle>{}));
+    BinaryRecorder recorder{config_, std::move(backend_)};
+    const auto dropped_before = GetDropStatistics().no_slot;
+
+    // When starting a record
+    const auto slot = recorder.StartRecord(kContext, LogLevel::kError);
+
+    // Then no slot is returned and the record is counted as dropped
+    EXPECT_FALSE(slot.has_value());
+    EXPECT_EQ(GetDropStatistics().no_slot, dropped_before + 1U);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,243 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/mapped_segment_writer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::int32_t kNoFileDescriptor{-1};
+
+bool IsValidHeader(const SegmentHeader& header) noexcept
+{
+    return (header.magic == kSegmentMagic) && (header.byte_order_mark == kSegmentByteOrderMark) &&
+           (header.version == kSegmentFormatVersion);
+}
+
+}  // namespace
+
+MappedSegmentWriter::MappedSegmentWriter(std::string file_path_prefix,
+                                         const std::size_t segment_size,
+                                         const std::size_t number_of_segments,
+                                         score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl,
+                                         score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
+                                         score::cpp::pmr::unique_ptr<score::os::Mman> mman) noexcept
+    : file_path_prefix_{std::move(file_path_prefix)},
+      segment_size_{segment_size},
+      number_of_segments_{(number_of_segments > 0U) ? number_of_segments : 1U},
+      fcntl_{std::move(fcntl)},
+      unistd_{std::move(unistd)},
+      mman_{std::move(mman)},
+      file_descriptor_{kNoFileDescriptor},
+      mapping_{nullptr},
+      write_offset_{0U},
+      reserved_size_{0U},
+      sequence_number_{0U},
+      next_sequence_number_{0U},
+      retry_backoff_{1U},
+      records_until_retry_{0U}
+{
+}
+
+MappedSegmentWriter::~MappedSegmentWriter() noexcept
+{
+    CloseSegment();
+}
+
+score::cpp::expected_blank<score::os::Error> MappedSegmentWriter::Open() noexcept
+{
+    next_sequence_number_ = FindNextSequenceNumber();
+    return StartSegment(next_sequence_number_);
+}
+
+std::string MappedSegmentWriter::GetSegmentPath(const std::uint32_t sequence_number) const
+{
+    const auto index = static_cast<std::size_t>(sequence_number) % number_of_segments_;
+    return file_path_prefix_ + "." + std::to_string(index) + std::string{kSegmentFileExtension};
+}
+
+std::uint32_t MappedSegmentWriter::GetSequenceNumber() const noexcept
+{
+    return sequence_number_;
+}
+
+std::uint32_t MappedSegmentWriter::FindNextSequenceNumber() const noexcept
+{
+    bool found{false};
+    std::uint32_t last_sequence_number{0U};
+    for (std::uint32_t index{0U}; index < number_of_segments_; ++index)
+    {
+        const auto path = GetSegmentPath(index);
+        const auto file_descriptor = fcntl_->open(path.c_str(), score::os::Fcntl::Open::kReadOnly);
+        if (!file_descriptor.has_value())
+        {
+            continue;
+        }
+        SegmentHeader header{};
+        const auto read = unistd_->pread(file_descriptor.value(), &header, sizeof(header), 0);
+        if (read.has_value() && (static_cast<std::size_t>(read.value()) == sizeof(header)) && IsValidHeader(header))
+        {
+            if ((!found) || (header.sequence_number > last_sequence_number))
+            {
+                last_sequence_number = header.sequence_number;
+            }
+            found = true;
+        }
+        std::ignore = unistd_->close(file_descriptor.value());
+    }
+    return found ? (last_sequence_number + 1U) : 0U;
+}
+
+score::cpp::expected_blank<score::os::Error> MappedSegmentWriter::StartSegment(
+    const std::uint32_t sequence_number) noexcept
+{
+    CloseSegment();
+
+    const auto path = GetSegmentPath(sequence_number);
+    using Open = score::os::Fcntl::Open;
+    using Mode = score::os::Stat::Mode;
+    const auto flags = Open::kReadWrite | Open::kCreate | Open::kTruncate | Open::kCloseOnExec;
+    const auto mode = Mode::kReadUser | Mode::kWriteUser | Mode::kReadGroup | Mode::kReadOthers;
+    const auto file_descriptor = fcntl_->open(path.c_str(), flags, mode);
+    if (!file_descriptor.has_value())
+    {
+        return score::cpp::make_unexpected(file_descriptor.error());
+    }
+    file_descriptor_ = file_descriptor.value();
+
+    //  Allocating the blocks up front turns a full file system into an error here instead of a SIGBUS on a later
+    //  write into the mapping:
+    const auto allocated = fcntl_->posix_fallocate(file_descriptor_, 0, static_cast<off_t>(segment_size_));
+    if (!allocated.has_value())
+    {
+        CloseSegment();
+        return score::cpp::make_unexpected(allocated.error());
+    }
+
+    using Protection = score::os::Mman::Protection;
+    const auto mapping = mman_->mmap(nullptr,
+                                     segment_size_,
+                                     Protection::kRead | Protection::kWrite,
+                                     score::os::Mman::Map::kShared,
+                                     file_descriptor_,
+                                     0);
+    if (!mapping.has_value())
+    {
+        CloseSegment();
+        return score::cpp::make_unexpected(mapping.error());
+    }
+    mapping_ = static_cast<Byte*>(mapping.value());
+
+    SegmentHeader header{};
+    header.sequence_number = sequence_number;
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed to store into the mapping
+    std::ignore = std::memcpy(mapping_, &header, sizeof(header));
+    write_offset_ = sizeof(header);
+    sequence_number_ = sequence_number;
+    next_sequence_number_ = sequence_number + 1U;
+    return {};
+}
+
+void MappedSegmentWriter::CloseSegment() noexcept
+{
+    if (mapping_ != nullptr)
+    {
+        std::ignore = mman_->munmap(mapping_, segment_size_);
+        mapping_ = nullptr;
+    }
+    if (file_descriptor_ != kNoFileDescriptor)
+    {
+        std::ignore = unistd_->close(file_descriptor_);
+        file_descriptor_ = kNoFileDescriptor;
+    }
+    write_offset_ = 0U;
+    reserved_size_ = 0U;
+}
+
+score::cpp::span<Byte> MappedSegmentWriter::Reserve(const std::size_t size) noexcept
+{
+    const std::size_t record_size = sizeof(RecordHeader) + size;
+    if ((segment_size_ < sizeof(SegmentHeader)) || (record_size > (segment_size_ - sizeof(SegmentHeader))))
+    {
+        return {};
+    }
+    if ((mapping_ == nullptr) && (!RetryNextSegment()))
+    {
+        return {};
+    }
+    if (record_size > (segment_size_ - write_offset_))
+    {
+        //  The zero bytes behind the last record mark the end of the segment:
+        if (!RetryNextSegment())
+        {
+            return {};
+        }
+    }
+    reserved_size_ = size;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are checked above
+    return {mapping_ + write_offset_ + sizeof(RecordHeader), static_cast<score::cpp::span<Byte>::size_type>(size)};
+}
+
+bool MappedSegmentWriter::RetryNextSegment() noexcept
+{
+    if (records_until_retry_ > 0U)
+    {
+        --records_until_retry_;
+        return false;
+    }
+    //  A failed attempt leaves no segment mapped, the sequence number is only advanced by a successful one:
+    if (!StartSegment(next_sequence_number_).has_value())
+    {
+        records_until_retry_ = retry_backoff_;
+        retry_backoff_ = (retry_backoff_ < kMaxRetryBackoff) ? (retry_backoff_ * 2U) : kMaxRetryBackoff;
+        return false;
+    }
+    retry_backoff_ = 1U;
+    return true;
+}
+
+void MappedSegmentWriter::Commit(RecordHeader header) noexcept
+{
+    if (mapping_ == nullptr)
+    {
+        return;
+    }
+    //  The size is published last and after a release fence, so that a reader of the mapping which acquires the size
+    //  never sees the size of an incomplete record. Until then the zero size marks the end of the written records:
+    const auto size = static_cast<std::uint32_t>(reserved_size_);
+    header.size = 0U;
+    // NOLINTBEGIN(score-banned-function, cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked in Reserve()
+    std::ignore = std::memcpy(mapping_ + write_offset_, &header, sizeof(header));
+    std::atomic_thread_fence(std::memory_order_release);
+    std::ignore = std::memcpy(mapping_ + write_offset_ + offsetof(RecordHeader, size), &size, sizeof(size));
+    // NOLINTEND(score-banned-function, cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked in Reserve()
+    write_offset_ += sizeof(header) + reserved_size_;
+    reserved_size_ = 0U;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,122 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_MAPPED_SEGMENT_WRITER_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_MAPPED_SEGMENT_WRITER_H
+
+#include "score/mw/log/detail/binary_recorder/segment_format.h"
+#include "score/mw/log/detail/log_entry.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/unistd.h"
+
+#include <score/expected.hpp>
+#include <score/span.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Appends records to a fixed number of preallocated, memory-mapped segment files in turn.
+///
+/// \details A segment is allocated on disk completely before it is mapped, so that writing a record is a plain copy
+/// into the mapping without any system call. If a record does not fit into the remainder of the current segment, the
+/// next segment is started. Segment files are reused in a round-robin manner: the file of the oldest segment is
+/// truncated and becomes the newest one. Sequence numbers continue the ones found in existing segment files, so that
+/// the segments of consecutive runs can be ordered by the converter.
+///
+/// If the next segment cannot be started, e.g. because the file system is full, records are rejected and starting the
+/// segment is retried on a later Reserve(). The number of records rejected until the next attempt doubles with every
+/// failed attempt, up to kMaxRetryBackoff, so that a persistent error does not cost a system call per record. A
+/// retry starts the segment whose start failed, also if that was the first one in Open().
+///
+/// Not thread-safe, the caller serializes access.
+class MappedSegmentWriter final
+{
+  public:
+    /// \param file_path_prefix Segments are named <file_path_prefix>.<index><kSegmentFileExtension>
+    /// \param segment_size Size of each segment file in bytes, including the SegmentHeader
+    /// \param number_of_segments Number of segment files that are used in turn
+    MappedSegmentWriter(std::string file_path_prefix,
+                        const std::size_t segment_size,
+                        const std::size_t number_of_segments,
+                        score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl,
+                        score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
+                        score::cpp::pmr::unique_ptr<score::os::Mman> mman) noexcept;
+    MappedSegmentWriter(const MappedSegmentWriter&) = delete;
+    MappedSegmentWriter(MappedSegmentWriter&&) = delete;
+    MappedSegmentWriter& operator=(const MappedSegmentWriter&) = delete;
+    MappedSegmentWriter& operator=(MappedSegmentWriter&&) = delete;
+    ~MappedSegmentWriter() noexcept;
+
+    /// \brief Starts the first segment. Must succeed before records can be written.
+    score::cpp::expected_blank<score::os::Error> Open() noexcept;
+
+    /// \brief Reserves size bytes for the body of the next record in the current segment, or in the next one if the
+    /// current segment is full.
+    ///
+    /// \return The span to place the body in, empty if the record is larger than a segment or no segment is mapped.
+    /// If no segment is mapped, starting the next one is retried once the backoff has elapsed.
+    /// \post The record is written on the next call to Commit(), otherwise its space is reused.
+    score::cpp::span<Byte> Reserve(const std::size_t size) noexcept;
+
+    /// \brief Writes header for the record whose body was placed in the span of the last Reserve().
+    /// \details The size field of header is overwritten with the reserved size and stored last, after a release fence.
+    void Commit(RecordHeader header) noexcept;
+
+    /// \brief Returns the sequence number of the current segment.
+    std::uint32_t GetSequenceNumber() const noexcept;
+
+    /// \brief Returns the path of the file that holds the segment with sequence_number.
+    std::string GetSegmentPath(const std::uint32_t sequence_number) const;
+
+    /// \brief Upper limit of the number of records that are rejected between two attempts to start a segment.
+    static constexpr std::uint32_t kMaxRetryBackoff{1024U};
+
+  private:
+    std::uint32_t FindNextSequenceNumber() const noexcept;
+    bool RetryNextSegment() noexcept;
+    score::cpp::expected_blank<score::os::Error> StartSegment(const std::uint32_t sequence_number) noexcept;
+    void CloseSegment() noexcept;
+
+    std::string file_path_prefix_;
+    std::size_t segment_size_;
+    std::size_t number_of_segments_;
+    score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_;
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_;
+    score::cpp::pmr::unique_ptr<score::os::Mman> mman_;
+
+    std::int32_t file_descriptor_;
+    Byte* mapping_;
+    std::size_t write_offset_;
+    std::size_t reserved_size_;
+    std::uint32_t sequence_number_;
+    std::uint32_t next_sequence_number_;
+    std::uint32_t retry_backoff_;
+    std::uint32_t records_until_retry_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_MAPPED_SEGMENT_WRITER_H
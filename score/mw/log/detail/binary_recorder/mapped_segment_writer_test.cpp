@@ -0,0 +1,324 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/mapped_segment_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace test
+{
+namespace
+{
+
+constexpr std::size_t kSegmentSize{4096U};
+constexpr std::size_t kNumberOfSegments{2U};
+
+class MappedSegmentWriterFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        prefix_ = ::testing::TempDir() + "/" + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        RemoveSegmentFiles();
+    }
+
+    void TearDown() override
+    {
+        RemoveSegmentFiles();
+    }
+
+    std::unique_ptr<MappedSegmentWriter> CreateWriter(const std::string& prefix) const
+    {
+        auto* const memory_resource = score::cpp::pmr::get_default_resource();
+        return std::make_unique<MappedSegmentWriter>(prefix,
+                                                     kSegmentSize,
+                                                     kNumberOfSegments,
+                                                     score::os::Fcntl::Default(memory_resource),
+                                                     score::os::Unistd::Default(memory_resource),
+                                                     score::os::Mman::Default(memory_resource));
+    }
+
+    std::vector<char> ReadFile(const std::string& path) const
+    {
+        std::ifstream file{path, std::ios::binary};
+        return std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    void WriteRecord(MappedSegmentWriter& writer, const std::size_t size, const char fill) const
+    {
+        auto body = writer.Reserve(size);
+        ASSERT_EQ(static_cast<std::size_t>(body.size()), size);
+        std::memset(body.data(), fill, size);
+        RecordHeader header{};
+        header.timestamp_steady_nsec = 42U;
+        writer.Commit(header);
+    }
+
+    std::string GetPath(const std::size_t index) const
+    {
+        return prefix_ + "." + std::to_string(index) + std::string{kSegmentFileExtension};
+    }
+
+  protected:
+    void RemoveSegmentFiles() const
+    {
+        for (std::size_t index{0U}; index < kNumberOfSegments; ++index)
+        {
+            std::ignore = std::remove(GetPath(index).c_str());
+        }
+    }
+
+    std::string prefix_{};
+};
+
+TEST_F(MappedSegmentWriterFixture, OpenCreatesPreallocatedSegmentWithHeader)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that Open() creates the first segment file.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given no segment files
+    auto writer = CreateWriter(prefix_);
+
+    // When opening the writer
+    ASSERT_TRUE(writer->Open().has_value());
+
+    // Then the first segment has the full size and a valid header with sequence number zero
+    EXPECT_EQ(writer->GetSequenceNumber(), 0U);
+    EXPECT_EQ(writer->GetSegmentPath(0U), GetPath(0U));
+    const auto content = ReadFile(GetPath(0U));
+    ASSERT_EQ(content.size(), kSegmentSize);
+    SegmentHeader header{};
+    std::memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(header.magic, kSegmentMagic);
+    EXPECT_EQ(header.byte_order_mark, kSegmentByteOrderMark);
+    EXPECT_EQ(header.version, kSegmentFormatVersion);
+    EXPECT_EQ(header.sequence_number, 0U);
+}
+
+TEST_F(MappedSegmentWriterFixture, CommittedRecordIsVisibleInFile)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a committed record is written behind its header.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an opened writer
+    auto writer = CreateWriter(prefix_);
+    ASSERT_TRUE(writer->Open().has_value());
+
+    // When writing a record
+    WriteRecord(*writer, 3U, 'x');
+
+    // Then the record header and body follow the segment header, and the next record header is zero
+    const auto content = ReadFile(GetPath(0U));
+    ASSERT_EQ(content.size(), kSegmentSize);
+    RecordHeader header{};
+    std::memcpy(&header, content.data() + sizeof(SegmentHeader), sizeof(header));
+    EXPECT_EQ(header.size, 3U);
+    EXPECT_EQ(header.timestamp_steady_nsec, 42U);
+    const auto body_offset = sizeof(SegmentHeader) + sizeof(RecordHeader);
+    EXPECT_EQ(std::string(content.data() + body_offset, 3U), "xxx");
+    RecordHeader end{};
+    std::memcpy(&end, content.data() + body_offset + 3U, sizeof(end));
+    EXPECT_EQ(end.size, 0U);
+}
+
+TEST_F(MappedSegmentWriterFixture, FullSegmentRotatesToNextSegmentAndWrapsAround)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that segments are used in a round-robin manner.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an opened writer
+    auto writer = CreateWriter(prefix_);
+    ASSERT_TRUE(writer->Open().has_value());
+
+    // When writing records that fill more than half of a segment each
+    constexpr std::size_t kBodySize{kSegmentSize / 2U};
+    WriteRecord(*writer, kBodySize, 'a');
+    WriteRecord(*writer, kBodySize, 'b');
+
+    // Then the second record starts the second segment
+    EXPECT_EQ(writer->GetSequenceNumber(), 1U);
+
+    // When writing another record
+    WriteRecord(*writer, kBodySize, 'c');
+
+    // Then the first file is reused for the third segment
+    EXPECT_EQ(writer->GetSequenceNumber(), 2U);
+    EXPECT_EQ(writer->GetSegmentPath(2U), GetPath(0U));
+    const auto content = ReadFile(GetPath(0U));
+    SegmentHeader header{};
+    std::memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(header.sequence_number, 2U);
+    EXPECT_EQ(content[sizeof(SegmentHeader) + sizeof(RecordHeader)], 'c');
+}
+
+TEST_F(MappedSegmentWriterFixture, SequenceNumberContinuesAfterReopen)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that sequence numbers continue from existing files.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given segment files of a previous run that reached sequence number one
+    {
+        auto writer = CreateWriter(prefix_);
+        ASSERT_TRUE(writer->Open().has_value());
+        WriteRecord(*writer, kSegmentSize / 2U, 'a');
+        WriteRecord(*writer, kSegmentSize / 2U, 'b');
+        ASSERT_EQ(writer->GetSequenceNumber(), 1U);
+    }
+
+    // When opening a new writer
+    auto writer = CreateWriter(prefix_);
+    ASSERT_TRUE(writer->Open().has_value());
+
+    // Then it continues with the next sequence number in the oldest file
+    EXPECT_EQ(writer->GetSequenceNumber(), 2U);
+    const auto content = ReadFile(GetPath(0U));
+    SegmentHeader header{};
+    std::memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(header.sequence_number, 2U);
+}
+
+TEST_F(MappedSegmentWriterFixture, RecordLargerThanSegmentIsRejected)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that a record larger than a segment is rejected.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an opened writer
+    auto writer = CreateWriter(prefix_);
+    ASSERT_TRUE(writer->Open().has_value());
+
+    // When reserving more than a segment can hold
+    const auto body = writer->Reserve(kSegmentSize);
+
+    // Then no space is returned and no segment is started
+    EXPECT_TRUE(body.empty());
+    EXPECT_EQ(writer->GetSequenceNumber(), 0U);
+}
+
+TEST_F(MappedSegmentWriterFixture, FailedRotationIsRetriedAfterBackoff)
+{
+    ::testing::Test::RecordProperty("Description",
+                                    "Verifies that a segment which cannot be started is retried on later records.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "error-guessing");
+
+    // Given an opened writer whose next segment file cannot be created
+    auto writer = CreateWriter(prefix_);
+    ASSERT_TRUE(writer->Open().has_value());
+    constexpr std::size_t kBodySize{kSegmentSize / 2U};
+    WriteRecord(*writer, kBodySize, 'a');
+    ASSERT_EQ(mkdir(GetPath(1U).c_str(), 0700), 0);
+
+    // When the current segment is full
+    // Then the record is rejected and the sequence number is kept
+    EXPECT_TRUE(writer->Reserve(kBodySize).empty());
+    EXPECT_EQ(writer->GetSequenceNumber(), 0U);
+
+    // When the segment file can be created again
+    ASSERT_EQ(rmdir(GetPath(1U).c_str()), 0);
+
+    // Then the record within the backoff is still rejected and the one after it starts the next segment
+    EXPECT_TRUE(writer->Reserve(kBodySize).empty());
+    WriteRecord(*writer, kBodySize, 'b');
+    EXPECT_EQ(writer->GetSequenceNumber(), 1U);
+    const auto content = ReadFile(GetPath(1U));
+    ASSERT_EQ(content.size(), kSegmentSize);
+    EXPECT_EQ(content[sizeof(SegmentHeader) + sizeof(RecordHeader)], 'b');
+}
+
+TEST_F(MappedSegmentWriterFixture, FailedOpenIsRetriedWithTheSequenceNumberOfExistingFiles)
+{
+    ::testing::Test::RecordProperty("Description",
+                                    "Verifies that a failed Open() is retried without overwriting newer segments.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "error-guessing");
+
+    // Given segment files of a previous run that reached sequence number one
+    {
+        auto writer = CreateWriter(prefix_);
+        ASSERT_TRUE(writer->Open().has_value());
+        WriteRecord(*writer, kSegmentSize / 2U, 'a');
+        WriteRecord(*writer, kSegmentSize / 2U, 'b');
+        ASSERT_EQ(writer->GetSequenceNumber(), 1U);
+    }
+    // And the file of the oldest segment cannot be created
+    ASSERT_EQ(std::remove(GetPath(0U).c_str()), 0);
+    ASSERT_EQ(mkdir(GetPath(0U).c_str(), 0700), 0);
+
+    // When opening a new writer fails
+    auto writer = CreateWriter(prefix_);
+    ASSERT_FALSE(writer->Open().has_value());
+
+    // And a later Reserve() succeeds once the file can be created again
+    ASSERT_EQ(rmdir(GetPath(0U).c_str()), 0);
+    WriteRecord(*writer, 1U, 'c');
+
+    // Then the segment that failed in Open() is started with the sequence number following the existing files
+    EXPECT_EQ(writer->GetSequenceNumber(), 2U);
+    SegmentHeader header{};
+    const auto oldest = ReadFile(GetPath(0U));
+    ASSERT_EQ(oldest.size(), kSegmentSize);
+    std::memcpy(&header, oldest.data(), sizeof(header));
+    EXPECT_EQ(header.sequence_number, 2U);
+
+    // And the newest segment of the previous run is kept
+    const auto newest = ReadFile(GetPath(1U));
+    ASSERT_EQ(newest.size(), kSegmentSize);
+    std::memcpy(&header, newest.data(), sizeof(header));
+    EXPECT_EQ(header.sequence_number, 1U);
+    EXPECT_EQ(newest[sizeof(SegmentHeader) + sizeof(RecordHeader)], 'b');
+}
+
+TEST_F(MappedSegmentWriterFixture, OpenFailsForMissingDirectory)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that Open() reports a file that cannot be created.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a writer for a directory that does not exist
+    auto writer = CreateWriter(::testing::TempDir() + "/not/existing/dir/app");
+
+    // When opening the writer
+    // Then an error is returned and nothing can be reserved
+    EXPECT_FALSE(writer->Open().has_value());
+    EXPECT_TRUE(writer->Reserve(1U).empty());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
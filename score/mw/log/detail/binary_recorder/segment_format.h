@@ -0,0 +1,76 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_SEGMENT_FORMAT_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_SEGMENT_FORMAT_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// Layout of a segment file of the binary file recorder:
+///
+///   SegmentHeader
+///   RecordHeader, LogEntry serialized by score::common::visitor::logging_serializer (RecordHeader::size bytes)
+///   RecordHeader, ...
+///   zero bytes up to the preallocated segment size
+///
+/// All values are stored in the byte order of the writer, which is identified by SegmentHeader::byte_order_mark. A
+/// RecordHeader whose size is zero marks the end of the written records. Both headers are copied with memcpy() and
+/// therefore have no alignment requirements within the file.
+
+/// \brief "MWLB": mw::log binary segment.
+constexpr std::array<char, 4U> kSegmentMagic{'M', 'W', 'L', 'B'};
+constexpr std::uint32_t kSegmentByteOrderMark{0x01020304U};
+constexpr std::uint32_t kSegmentFormatVersion{1U};
+
+/// \brief File name extension of segment files, the files are named <app id>.<segment index><extension>.
+constexpr std::string_view kSegmentFileExtension{".mwlb"};
+
+struct SegmentHeader
+{
+    std::array<char, 4U> magic{kSegmentMagic};
+    std::uint32_t byte_order_mark{kSegmentByteOrderMark};
+    std::uint32_t version{kSegmentFormatVersion};
+    /// \brief Increases with every segment that is started, also across restarts of the application.
+    std::uint32_t sequence_number{};
+};
+
+struct RecordHeader
+{
+    /// \brief Size of the serialized LogEntry that follows the header.
+    std::uint32_t size{};
+    /// \brief Keeps the timestamps at their natural alignment relative to the header.
+    std::uint32_t reserved{};
+    std::uint64_t timestamp_steady_nsec{};
+    std::uint64_t timestamp_system_nsec{};
+};
+
+static_assert(std::is_trivially_copyable<SegmentHeader>::value, "SegmentHeader is copied with memcpy()");
+static_assert(std::is_trivially_copyable<RecordHeader>::value, "RecordHeader is copied with memcpy()");
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_SEGMENT_FORMAT_H
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/drainer_thread.h"
+
+#include "score/os/utils/thread.h"
+
+#include <sched.h>
+#include <thread>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+DrainerThread::DrainerThread(DrainFunction drain,
+                             const DrainerThreadOptions& options,
+                             score::cpp::pmr::unique_ptr<score::os::Pthread> pthread) noexcept
+    : drain_{std::move(drain)},
+      options_{options},
+      pthread_{std::move(pthread)},
+      thread_{[this](const score::cpp::stop_token& stop_token) noexcept {
+          Run(stop_token);
+      }}
+{
+}
+
+DrainerThread::~DrainerThread() noexcept
+{
+    {
+        //  Requesting the stop under the lock ensures that the thread cannot miss the notification:
+        const std::lock_guard<std::mutex> lock{stop_mutex_};
+        std::ignore = thread_.request_stop();
+    }
+    stop_condition_.notify_all();
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+void DrainerThread::ApplySchedulingOptions() const noexcept
+{
+    if (options_.cpu_affinity.has_value())
+    {
+        std::ignore = score::os::set_thread_affinity(options_.cpu_affinity.value());
+    }
+
+    if (options_.priority.has_value() && (pthread_ != nullptr))
+    {
+        sched_param parameter{};
+        parameter.sched_priority = options_.priority.value();
+        std::ignore = pthread_->pthread_setschedparam(pthread_->self(), SCHED_FIFO, &parameter);
+    }
+}
+
+bool DrainerThread::WaitForNextCycle(const score::cpp::stop_token& stop_token) noexcept
+{
+    std::unique_lock<std::mutex> lock{stop_mutex_};
+    return stop_condition_.wait_for(lock, options_.period, [&stop_token]() noexcept {
+        return stop_token.stop_requested();
+    });
+}
+
+void DrainerThread::Drain(const score::cpp::stop_token& stop_token) noexcept
+{
+    //  Keep draining as long as the slot limit per cycle was the only reason to stop:
+    bool more_slots_pending = drain_();
+    while (more_slots_pending && (!stop_token.stop_requested()))
+    {
+        more_slots_pending = drain_();
+    }
+}
+
+void DrainerThread::Run(const score::cpp::stop_token& stop_token) noexcept
+{
+    ApplySchedulingOptions();
+
+    //  Residual data is written by the owner of the slots on destruction.
+    while (!WaitForNextCycle(stop_token))
+    {
+        Drain(stop_token);
+    }
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
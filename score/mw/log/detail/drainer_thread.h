@@ -0,0 +1,90 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_DRAINER_THREAD_H
+#define SCORE_MW_LOG_DETAIL_DRAINER_THREAD_H
+
+#include "score/os/pthread.h"
+
+#include <score/callback.hpp>
+#include <score/jthread.hpp>
+#include <score/optional.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Settings of the background thread that drains the slots of a backend.
+struct DrainerThreadOptions
+{
+    /// \brief Time the drainer sleeps once all published slots are written or the writer would block.
+    std::chrono::milliseconds period{1};
+    /// \brief CPU the drainer thread is pinned to, no pinning if empty.
+    score::cpp::optional<std::size_t> cpu_affinity{};
+    /// \brief SCHED_FIFO priority of the drainer thread, inherited scheduling if empty.
+    score::cpp::optional<std::int32_t> priority{};
+};
+
+/// \brief Drains the published slots of a backend from a dedicated thread.
+///
+/// \details Moves batching and writing off the stack of the logging threads. Producers only reserve, fill and publish
+/// slots. The thread never gets notified by producers, so that logging itself does not issue any
+/// system call; instead it polls with the configured period whenever there is nothing left to write. The condition
+/// variable is only used to cut the waiting short on destruction.
+class DrainerThread final
+{
+  public:
+    /// \brief Writes published slots, returns true if further slots could be written right away.
+    using DrainFunction = score::cpp::callback<bool()>;
+
+    DrainerThread(DrainFunction drain,
+                  const DrainerThreadOptions& options,
+                  score::cpp::pmr::unique_ptr<score::os::Pthread> pthread) noexcept;
+
+    DrainerThread(DrainerThread&&) noexcept = delete;
+    DrainerThread(const DrainerThread&) noexcept = delete;
+    DrainerThread& operator=(DrainerThread&&) noexcept = delete;
+    DrainerThread& operator=(const DrainerThread&) noexcept = delete;
+
+    /// \brief Requests the thread to stop and joins it.
+    ~DrainerThread() noexcept;
+
+  private:
+    void Run(const score::cpp::stop_token& stop_token) noexcept;
+    void ApplySchedulingOptions() const noexcept;
+    bool WaitForNextCycle(const score::cpp::stop_token& stop_token) noexcept;
+    void Drain(const score::cpp::stop_token& stop_token) noexcept;
+
+    DrainFunction drain_;
+    DrainerThreadOptions options_;
+    score::cpp::pmr::unique_ptr<score::os::Pthread> pthread_;
+    std::mutex stop_mutex_;
+    std::condition_variable stop_condition_;
+    score::cpp::jthread thread_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_DRAINER_THREAD_H
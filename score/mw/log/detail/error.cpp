@@ -76,6 +76,9 @@ std::string_view score::mw::log::detail::ErrorDomain::MessageFor(const score::re
         case Error::kFailedToCreateMessagePassingClient:
             error_msg = "Failed to create message passing client.";
             break;
+        case Error::kInvalidConfigurationValue:
+            error_msg = "Configuration value is out of the valid range.";
+            break;
         case Error::kUnknownError:
             error_msg = "Unknown Error";
             break;
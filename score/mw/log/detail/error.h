@@ -45,6 +45,7 @@ enum class Error : score::result::ErrorCode
     kBlockingTerminationSignalFailed,
     kMemoryResourceError,
     kFailedToCreateMessagePassingClient,
+    kInvalidConfigurationValue,
 };
 
 class ErrorDomain final : public score::result::ErrorDomain
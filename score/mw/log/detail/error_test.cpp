@@ -54,7 +54,8 @@ INSTANTIATE_TEST_SUITE_P(ErrorCodes,
                                            Error::kSetSharedMemoryPermissionsError,
                                            Error::kShutdownDuringInitialization,
                                            Error::kSloggerError,
-                                           Error::kLogFileCreationFailed));
+                                           Error::kLogFileCreationFailed,
+                                           Error::kInvalidConfigurationValue));
 
 TEST_P(LogDetailErrorFixture, EachErrorShallReturnNonEmptyMessage)
 {
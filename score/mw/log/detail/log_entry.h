@@ -17,6 +17,11 @@
 #include "score/mw/log/log_level.h"
 #include "static_reflection_with_serialization/visitor/visit_as_struct.h"
 
+#include <score/memory_resource.hpp>
+
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace score
@@ -29,7 +34,45 @@ namespace detail
 {
 
 using Byte = char;
-using ByteVector = std::vector<Byte>;
+
+/// \brief Polymorphic allocator that default-initializes elements which are added by resize().
+///
+/// \details VerbosePayload resizes its buffer to the reserved size before every write and shrinks it to the written
+/// size afterwards. Default initialization leaves these bytes untouched instead of zeroing them element by element.
+template <typename T>
+class DefaultInitializingAllocator : public score::cpp::pmr::polymorphic_allocator<T>
+{
+  public:
+    using score::cpp::pmr::polymorphic_allocator<T>::polymorphic_allocator;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = DefaultInitializingAllocator<U>;
+    };
+
+    template <typename U>
+    void construct(U* const pointer) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new (static_cast<void*>(pointer)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* const pointer, Args&&... args)
+    {
+        score::cpp::pmr::polymorphic_allocator<T>::construct(pointer, std::forward<Args>(args)...);
+    }
+
+    /// \brief Copies of a container use the default memory resource, like polymorphic_allocator.
+    DefaultInitializingAllocator select_on_container_copy_construction() const noexcept
+    {
+        return DefaultInitializingAllocator{};
+    }
+};
+
+//  Polymorphic allocator, so that the buffers of many records can be placed in one arena (see MpscRingBuffer). The
+//  record layout stays a pair of vectors, i.e. a LogEntry is not flat and its buffers are not inline.
+using ByteVector = std::vector<Byte, DefaultInitializingAllocator<Byte>>;
 /*
 Deviation from Rule M11-0-1:
 - Member data in non-POD class types shall be private.
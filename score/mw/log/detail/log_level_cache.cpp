@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/log_level_cache.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::uint32_t kNumberOfCachedLevels{8U};
+constexpr std::uint32_t kEnabledShift{8U};
+constexpr std::uint32_t kGenerationShift{32U};
+
+bool IsCachable(const LogLevel log_level) noexcept
+{
+    return static_cast<std::uint32_t>(log_level) < kNumberOfCachedLevels;
+}
+
+std::uint64_t KnownBit(const LogLevel log_level) noexcept
+{
+    return std::uint64_t{1U} << static_cast<std::uint32_t>(log_level);
+}
+
+std::uint64_t EnabledBit(const LogLevel log_level) noexcept
+{
+    return KnownBit(log_level) << kEnabledShift;
+}
+
+std::uint32_t GenerationOf(const std::uint64_t snapshot) noexcept
+{
+    return static_cast<std::uint32_t>(snapshot >> kGenerationShift);
+}
+
+}  // namespace
+
+LogLevelCache::LogLevelCache(const LogLevelCache&) noexcept : snapshot_{0U} {}
+
+LogLevelCache::LogLevelCache(LogLevelCache&&) noexcept : snapshot_{0U} {}
+
+//  Self-assignment is harmless, the cache is only emptied.
+LogLevelCache& LogLevelCache::operator=(const LogLevelCache&) noexcept
+{
+    snapshot_.store(0U, std::memory_order_relaxed);
+    return *this;
+}
+
+LogLevelCache& LogLevelCache::operator=(LogLevelCache&&) noexcept
+{
+    snapshot_.store(0U, std::memory_order_relaxed);
+    return *this;
+}
+
+score::cpp::optional<bool> LogLevelCache::Find(const LogLevel log_level, const std::uint32_t generation) const noexcept
+{
+    const auto snapshot = snapshot_.load(std::memory_order_relaxed);
+    if ((!IsCachable(log_level)) || (GenerationOf(snapshot) != generation) || ((snapshot & KnownBit(log_level)) == 0U))
+    {
+        return {};
+    }
+    return (snapshot & EnabledBit(log_level)) != 0U;
+}
+
+void LogLevelCache::Store(const LogLevel log_level, const std::uint32_t generation, const bool is_enabled) noexcept
+{
+    if (!IsCachable(log_level))
+    {
+        return;
+    }
+    const std::uint64_t level_bits = KnownBit(log_level) | (is_enabled ? EnabledBit(log_level) : 0U);
+    auto snapshot = snapshot_.load(std::memory_order_relaxed);
+    std::uint64_t desired{};
+    do
+    {
+        const auto base = (GenerationOf(snapshot) == generation)
+                              ? snapshot
+                              : (static_cast<std::uint64_t>(generation) << kGenerationShift);
+        desired = base | level_bits;
+    } while (!snapshot_.compare_exchange_weak(snapshot, desired, std::memory_order_relaxed));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
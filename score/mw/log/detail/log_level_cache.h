@@ -0,0 +1,63 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_LOG_LEVEL_CACHE_H
+#define SCORE_MW_LOG_DETAIL_LOG_LEVEL_CACHE_H
+
+#include "score/mw/log/log_level.h"
+
+#include "score/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Lock-free snapshot of which log levels are enabled for one context.
+///
+/// \details The snapshot belongs to one generation of the configured recorder (see Runtime::GetRecorderGeneration()).
+/// Storing a level of a newer generation drops all levels of the previous one, thus a changed recorder is asked again
+/// instead of answering with stale results. Copies start empty, since the cache is only an optimization of its owner.
+class LogLevelCache final
+{
+  public:
+    LogLevelCache() noexcept = default;
+    LogLevelCache(const LogLevelCache&) noexcept;
+    LogLevelCache(LogLevelCache&&) noexcept;
+    LogLevelCache& operator=(const LogLevelCache&) noexcept;
+    LogLevelCache& operator=(LogLevelCache&&) noexcept;
+    ~LogLevelCache() noexcept = default;
+
+    /// \brief Returns if log_level is enabled, or nothing if it was not stored for the given generation.
+    score::cpp::optional<bool> Find(const LogLevel log_level, const std::uint32_t generation) const noexcept;
+
+    /// \brief Stores if log_level is enabled for the given generation.
+    void Store(const LogLevel log_level, const std::uint32_t generation, const bool is_enabled) noexcept;
+
+  private:
+    //  Bits 0-7: level is known, bits 8-15: level is enabled, bits 32-63: generation of the snapshot.
+    std::atomic<std::uint64_t> snapshot_{0U};
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_LOG_LEVEL_CACHE_H
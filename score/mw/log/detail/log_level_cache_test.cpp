@@ -0,0 +1,114 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/log_level_cache.h"
+
+#include "gtest/gtest.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::uint32_t kGeneration{7U};
+
+TEST(LogLevelCache, StoredLevelsShallBeFoundForTheSameGeneration)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that stored levels are found independently of each other.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    LogLevelCache unit{};
+
+    // Given an empty cache
+    EXPECT_FALSE(unit.Find(LogLevel::kInfo, kGeneration).has_value());
+
+    // When storing one enabled and one disabled level
+    unit.Store(LogLevel::kInfo, kGeneration, true);
+    unit.Store(LogLevel::kDebug, kGeneration, false);
+
+    // Then both are found and all other levels are still unknown
+    EXPECT_EQ(unit.Find(LogLevel::kInfo, kGeneration), score::cpp::optional<bool>{true});
+    EXPECT_EQ(unit.Find(LogLevel::kDebug, kGeneration), score::cpp::optional<bool>{false});
+    EXPECT_FALSE(unit.Find(LogLevel::kVerbose, kGeneration).has_value());
+}
+
+TEST(LogLevelCache, NewGenerationShallInvalidateAllLevels)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that levels of a previous recorder generation are not reported.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    LogLevelCache unit{};
+    unit.Store(LogLevel::kInfo, kGeneration, true);
+    unit.Store(LogLevel::kDebug, kGeneration, true);
+
+    // When the recorder changed
+    EXPECT_FALSE(unit.Find(LogLevel::kInfo, kGeneration + 1U).has_value());
+
+    // And a level of the new generation is stored
+    unit.Store(LogLevel::kInfo, kGeneration + 1U, false);
+
+    // Then only this level is known
+    EXPECT_EQ(unit.Find(LogLevel::kInfo, kGeneration + 1U), score::cpp::optional<bool>{false});
+    EXPECT_FALSE(unit.Find(LogLevel::kDebug, kGeneration + 1U).has_value());
+}
+
+TEST(LogLevelCache, CopiesShallStartEmpty)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that copying or moving a cache does not transfer stored levels.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    LogLevelCache unit{};
+    unit.Store(LogLevel::kWarn, kGeneration, true);
+
+    LogLevelCache copy{unit};
+    LogLevelCache moved{std::move(unit)};
+    LogLevelCache assigned{};
+    assigned.Store(LogLevel::kWarn, kGeneration, true);
+    assigned = copy;
+
+    EXPECT_FALSE(copy.Find(LogLevel::kWarn, kGeneration).has_value());
+    EXPECT_FALSE(moved.Find(LogLevel::kWarn, kGeneration).has_value());
+    EXPECT_FALSE(assigned.Find(LogLevel::kWarn, kGeneration).has_value());
+}
+
+TEST(LogLevelCache, InvalidLevelShallNotBeCached)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that values outside of the LogLevel enumeration are never cached.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    LogLevelCache unit{};
+    const auto invalid_level = static_cast<LogLevel>(42U);
+
+    unit.Store(invalid_level, kGeneration, true);
+
+    EXPECT_FALSE(unit.Find(invalid_level, kGeneration).has_value());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -88,6 +88,22 @@ LogRecord::LogRecord(const std::size_t max_payload_size_bytes) noexcept
 {
 }
 
+LogRecord::LogRecord(const std::size_t max_payload_size_bytes,
+                     score::cpp::pmr::memory_resource* const memory_resource,
+                     const std::size_t max_header_size_bytes) noexcept
+    : log_entry_{LoggingIdentifier{""},
+                 LoggingIdentifier{""},
+                 ByteVector{memory_resource},
+                 std::uint64_t{},
+                 std::uint64_t{},
+                 std::uint8_t{},
+                 ByteVector{memory_resource},
+                 LogLevel{}},
+      verbose_payload_(max_payload_size_bytes, log_entry_.payload)
+{
+    log_entry_.header_buffer.reserve(max_header_size_bytes);
+}
+
 LogEntry& LogRecord::GetLogEntry() noexcept
 {
     // Returning address of non-static class member is justified by design
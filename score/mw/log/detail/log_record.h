@@ -31,6 +31,18 @@ class LogRecord
   public:
     explicit LogRecord(const std::size_t max_payload_size_bytes = 255U) noexcept;
 
+    /// \brief Constructs a LogRecord whose buffers are allocated upfront from memory_resource.
+    ///
+    /// \param max_payload_size_bytes Capacity of the payload buffer
+    /// \param memory_resource Memory resource of the payload and header buffer, e.g. the arena of an MpscRingBuffer
+    /// \param max_header_size_bytes Capacity of the header buffer, 0 leaves the reservation to the first user
+    ///
+    /// \details Copies and moved-to records allocate from the default memory resource, so they never outlive
+    /// memory_resource by accident.
+    LogRecord(const std::size_t max_payload_size_bytes,
+              score::cpp::pmr::memory_resource* const memory_resource,
+              const std::size_t max_header_size_bytes = 0U) noexcept;
+
     LogEntry& GetLogEntry() noexcept;
     const LogEntry& GetLogEntry() const noexcept;
     detail::VerbosePayload& GetVerbosePayload() noexcept;
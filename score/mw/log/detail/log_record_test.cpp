@@ -12,6 +12,7 @@
  ********************************************************************************/
 #include "score/mw/log/detail/log_record.h"
 
+#include "score/memory_resource.hpp"
 #include "score/optional.hpp"
 
 #include "score/quality/compiler_warnings/warnings.h"
@@ -73,6 +74,36 @@ TEST(LogRecord, LogRecordShallReturnExpectedVerbosePayload)
     EXPECT_EQ(unit.GetVerbosePayload().RemainingCapacity(), kMaxPayloadSize);
 }
 
+TEST(LogRecord, LogRecordShallAllocateBuffersFromGivenMemoryResource)
+{
+    RecordProperty("Requirement", "SCR-861534, 1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "LogRecord can reserve payload and header buffer upfront from a memory resource, while copies use "
+                   "the default memory resource.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    // Given an arena as memory resource
+    constexpr std::size_t kMaxHeaderSize = 32U;
+    score::cpp::pmr::monotonic_buffer_resource arena{kMaxPayloadSize + kMaxHeaderSize};
+
+    // When constructing a LogRecord from it
+    LogRecord unit{kMaxPayloadSize, &arena, kMaxHeaderSize};
+
+    // Then both buffers are reserved from the arena
+    EXPECT_EQ(unit.GetLogEntry().payload.get_allocator().resource(), &arena);
+    EXPECT_EQ(unit.GetLogEntry().header_buffer.get_allocator().resource(), &arena);
+    EXPECT_EQ(unit.GetLogEntry().payload.capacity(), kMaxPayloadSize);
+    EXPECT_EQ(unit.GetLogEntry().header_buffer.capacity(), kMaxHeaderSize);
+    EXPECT_EQ(unit.GetVerbosePayload().RemainingCapacity(), kMaxPayloadSize);
+
+    // And a copy does not refer to the arena
+    const LogRecord copy{unit};
+    EXPECT_EQ(copy.GetLogEntry().payload.get_allocator().resource(), score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(copy.GetVerbosePayload().RemainingCapacity(), kMaxPayloadSize);
+}
+
 TEST_P(LogRecordCopyAndMoveOperatorsFixture, LogRecordShallCopyAssignAndUpdateReferenceCorrectly)
 {
     RecordProperty("Requirement", "SCR-861534, 1016719");
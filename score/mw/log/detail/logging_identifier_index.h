@@ -0,0 +1,165 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_LOGGING_IDENTIFIER_INDEX_H
+#define SCORE_MW_LOG_DETAIL_LOGGING_IDENTIFIER_INDEX_H
+
+#include "score/mw/log/detail/logging_identifier.h"
+
+#include "score/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Wait-free, insert-only hash index from a LoggingIdentifier to an element that is owned elsewhere.
+///
+/// \details Open addressing with linear probing over a table that is allocated once on construction and holds at
+/// least twice the maximum number of elements. Each entry is claimed by a single compare-and-swap of its key, the
+/// element is published afterwards with release semantics. A reader that meets a claimed entry whose element is not
+/// published yet reports the key as missing, the same as if it had looked a moment earlier. Both operations probe at
+/// most all entries and are thus wait-free.
+template <typename Element>
+class LoggingIdentifierIndex
+{
+  public:
+    explicit LoggingIdentifierIndex(const std::size_t max_number_of_elements) noexcept;
+
+    /// \brief Returns the element stored for identifier, if any.
+    score::cpp::optional<std::reference_wrapper<Element>> Find(const LoggingIdentifier& identifier) const noexcept;
+
+    /// \brief Stores element for identifier.
+    /// Returns false if identifier was already stored, or the index is full; the stored element is unchanged then.
+    bool TryInsert(const LoggingIdentifier& identifier, Element& element) noexcept;
+
+  private:
+    struct Entry
+    {
+        //  0 if the entry is free, otherwise kOccupied and the four bytes of the identifier.
+        std::atomic<std::uint64_t> key{0U};
+        std::atomic<Element*> element{nullptr};
+    };
+
+    static constexpr std::uint64_t kOccupied{std::uint64_t{1U} << 32U};
+
+    static std::uint64_t KeyOf(const LoggingIdentifier& identifier) noexcept;
+    std::size_t HomeOf(const std::uint64_t key) const noexcept;
+
+    std::vector<Entry> entries_;
+    std::size_t mask_;
+    std::uint32_t shift_;
+};
+
+template <typename Element>
+LoggingIdentifierIndex<Element>::LoggingIdentifierIndex(const std::size_t max_number_of_elements) noexcept
+    : entries_{}, mask_{}, shift_{}
+{
+    //  A load factor of at most one half keeps the probe sequences short.
+    std::size_t size{2U};
+    std::uint32_t bits{1U};
+    while (size < (2U * max_number_of_elements))
+    {
+        size *= 2U;
+        ++bits;
+    }
+    entries_ = std::vector<Entry>(size);
+    mask_ = size - 1U;
+    shift_ = 32U - bits;
+}
+
+template <typename Element>
+std::uint64_t LoggingIdentifierIndex<Element>::KeyOf(const LoggingIdentifier& identifier) noexcept
+{
+    std::uint32_t value{};
+    static_assert(sizeof(value) == sizeof(LoggingIdentifier::data), "data must have the size of the key");
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed
+    std::ignore = std::memcpy(&value, identifier.data.data(), identifier.data.size());
+    return kOccupied | value;
+}
+
+template <typename Element>
+std::size_t LoggingIdentifierIndex<Element>::HomeOf(const std::uint64_t key) const noexcept
+{
+    //  Fibonacci hashing: the high bits of the product depend on all bytes of the identifier.
+    constexpr std::uint32_t kGoldenRatio{0x9E3779B9U};
+    const auto hash = static_cast<std::uint32_t>(static_cast<std::uint32_t>(key) * kGoldenRatio);
+    return static_cast<std::size_t>(hash >> shift_) & mask_;
+}
+
+template <typename Element>
+auto LoggingIdentifierIndex<Element>::Find(const LoggingIdentifier& identifier) const noexcept
+    -> score::cpp::optional<std::reference_wrapper<Element>>
+{
+    const auto key = KeyOf(identifier);
+    auto position = HomeOf(key);
+    for (std::size_t probe{0U}; probe < entries_.size(); ++probe)
+    {
+        const Entry& entry = entries_[position];
+        const auto stored_key = entry.key.load(std::memory_order_acquire);
+        if (stored_key == 0U)
+        {
+            break;
+        }
+        if (stored_key == key)
+        {
+            Element* const element = entry.element.load(std::memory_order_acquire);
+            if (element == nullptr)
+            {
+                break;
+            }
+            return std::ref(*element);
+        }
+        position = (position + 1U) & mask_;
+    }
+    return score::cpp::nullopt;
+}
+
+template <typename Element>
+bool LoggingIdentifierIndex<Element>::TryInsert(const LoggingIdentifier& identifier, Element& element) noexcept
+{
+    const auto key = KeyOf(identifier);
+    auto position = HomeOf(key);
+    for (std::size_t probe{0U}; probe < entries_.size(); ++probe)
+    {
+        Entry& entry = entries_[position];
+        std::uint64_t expected{0U};
+        if (entry.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel))
+        {
+            entry.element.store(&element, std::memory_order_release);
+            return true;
+        }
+        if (expected == key)
+        {
+            return false;
+        }
+        position = (position + 1U) & mask_;
+    }
+    return false;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_LOGGING_IDENTIFIER_INDEX_H
@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/logging_identifier_index.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+TEST(LoggingIdentifierIndex, InsertedElementsShallBeFound)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that elements are found by the identifier they were inserted with.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    LoggingIdentifierIndex<std::int32_t> unit{2U};
+    std::int32_t first{1};
+    std::int32_t second{2};
+
+    EXPECT_TRUE(unit.TryInsert(LoggingIdentifier{"CTX1"}, first));
+    EXPECT_TRUE(unit.TryInsert(LoggingIdentifier{""}, second));
+
+    EXPECT_EQ(&unit.Find(LoggingIdentifier{"CTX1"}).value().get(), &first);
+    EXPECT_EQ(&unit.Find(LoggingIdentifier{""}).value().get(), &second);
+    EXPECT_FALSE(unit.Find(LoggingIdentifier{"CTX2"}).has_value());
+}
+
+TEST(LoggingIdentifierIndex, InsertingKnownIdentifierShallKeepTheStoredElement)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that an identifier is stored only once.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    LoggingIdentifierIndex<std::int32_t> unit{2U};
+    std::int32_t first{1};
+    std::int32_t second{2};
+
+    EXPECT_TRUE(unit.TryInsert(LoggingIdentifier{"CTX1"}, first));
+    EXPECT_FALSE(unit.TryInsert(LoggingIdentifier{"CTX1"}, second));
+
+    EXPECT_EQ(&unit.Find(LoggingIdentifier{"CTX1"}).value().get(), &first);
+}
+
+TEST(LoggingIdentifierIndex, FullIndexShallRejectNewIdentifiers)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that inserting into and searching a full index terminates.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    //  A capacity of zero still results in the smallest table of two entries.
+    LoggingIdentifierIndex<std::int32_t> unit{0U};
+    std::array<std::int32_t, 3U> elements{};
+
+    EXPECT_TRUE(unit.TryInsert(LoggingIdentifier{"A"}, elements[0]));
+    EXPECT_TRUE(unit.TryInsert(LoggingIdentifier{"B"}, elements[1]));
+    EXPECT_FALSE(unit.TryInsert(LoggingIdentifier{"C"}, elements[2]));
+
+    EXPECT_FALSE(unit.Find(LoggingIdentifier{"C"}).has_value());
+    EXPECT_EQ(&unit.Find(LoggingIdentifier{"B"}).value().get(), &elements[1]);
+}
+
+TEST(LoggingIdentifierIndex, ConcurrentInsertionsShallAllBeFound)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that concurrently inserted identifiers do not overwrite each other.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    constexpr std::size_t kNumberOfThreads{4U};
+    constexpr std::size_t kElementsPerThread{64U};
+    LoggingIdentifierIndex<std::size_t> unit{kNumberOfThreads * kElementsPerThread};
+    std::vector<std::size_t> elements(kNumberOfThreads * kElementsPerThread);
+
+    std::vector<std::thread> threads{};
+    for (std::size_t thread{0U}; thread < kNumberOfThreads; ++thread)
+    {
+        threads.emplace_back([&unit, &elements, thread]() {
+            for (std::size_t i{thread * kElementsPerThread}; i < ((thread + 1U) * kElementsPerThread); ++i)
+            {
+                elements[i] = i;
+                EXPECT_TRUE(unit.TryInsert(LoggingIdentifier{std::to_string(i)}, elements[i]));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (std::size_t i{0U}; i < elements.size(); ++i)
+    {
+        const auto found = unit.Find(LoggingIdentifier{std::to_string(i)});
+        ASSERT_TRUE(found.has_value());
+        EXPECT_EQ(found.value().get(), i);
+    }
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
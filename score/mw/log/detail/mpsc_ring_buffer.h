@@ -0,0 +1,284 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_MPSC_RING_BUFFER_H
+#define SCORE_MW_LOG_DETAIL_MPSC_RING_BUFFER_H
+
+#include "score/assert.hpp"
+#include "score/memory_resource.hpp"
+#include "score/optional.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Size used to separate data that is written by different threads onto different cache lines.
+constexpr std::size_t kMpscRingBufferCacheLineSize{64UL};
+
+/// \brief A bounded Ring-Buffer that allows multiple producers to stream data to a single consumer in a lock-free
+/// manner.
+///
+/// \details Every cell carries its own sequence number (see D. Vyukov's bounded MPMC queue). A producer claims a cell
+/// by advancing the enqueue position only if the sequence of the target cell states that the consumer already
+/// returned it. Thus producers never touch cells that are still in use and the consumer can read all published cells
+/// in the order in which they were acquired. The enqueue and dequeue positions are placed on separate cache lines so
+/// that producers and the consumer do not invalidate each other on every access.
+///
+/// Lifecycle of a cell:
+/// AcquireSlotToWrite() -> GetUnderlyingBufferFor() -> ReleaseSlot() (producer side)
+/// AcquireSlotToRead() -> GetUnderlyingBufferFor() -> ReleaseReadSlot() (consumer side)
+///
+/// \tparam T Any type that shall be stored within the Ring-Buffer.
+template <typename T>
+class MpscRingBuffer final
+{
+  public:
+    /// \brief Constructs a Ring-Buffer of capacity, without further acquiring memory during runtime.
+    ///
+    /// \param capacity The size of how many elements of T shall be stored within the Ring-Buffer
+    explicit MpscRingBuffer(const std::size_t capacity, const T& initial_value = T{})
+        : enqueue_position_{0UL}, dequeue_position_{0UL}, element_arena_{}, buffer_(capacity)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(capacity > 0UL, "Capacity must not be zero");
+        std::size_t sequence{0UL};
+        for (auto& cell : buffer_)
+        {
+            cell.data = initial_value;
+            cell.sequence.store(sequence, std::memory_order_relaxed);
+            ++sequence;
+        }
+    }
+
+    /// \brief Constructs a Ring-Buffer of capacity whose elements are constructed in place, without copying an initial
+    /// value into every cell.
+    ///
+    /// \details The Ring-Buffer owns an arena of arena_size bytes that is passed to element_factory. Elements that take
+    /// their dynamic memory from the arena are laid out in one contiguous block instead of one heap allocation per
+    /// element. The arena is not synchronized, thus elements shall only allocate from it during construction. Elements
+    /// refer to their memory in the arena by plain pointers, so the arena is local to the process and can not be
+    /// mapped into shared memory.
+    ///
+    /// \param capacity The size of how many elements of T shall be stored within the Ring-Buffer
+    /// \param arena_size The number of bytes that the elements may allocate from the arena
+    /// \param element_factory Callable of signature T(score::cpp::pmr::memory_resource*), called once per element
+    template <typename ElementFactory>
+    MpscRingBuffer(const std::size_t capacity, const std::size_t arena_size, ElementFactory&& element_factory)
+        : enqueue_position_{0UL},
+          dequeue_position_{0UL},
+          element_arena_{std::make_unique<score::cpp::pmr::monotonic_buffer_resource>(
+              std::max(arena_size, std::size_t{1UL}),
+              score::cpp::pmr::get_default_resource())},
+          buffer_{}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(capacity > 0UL, "Capacity must not be zero");
+        buffer_.reserve(capacity);
+        for (std::size_t sequence{0UL}; sequence < capacity; ++sequence)
+        {
+            std::ignore = buffer_.emplace_back(sequence, element_factory, element_arena_.get());
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer(MpscRingBuffer&&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(MpscRingBuffer&&) = delete;
+    ~MpscRingBuffer() = default;
+
+    /// \brief Starts a Transaction for a producer to stream data into a slot
+    ///
+    /// \return The slot in which data can be written, empty if all slots are either written or not yet consumed.
+    ///
+    /// \post Slot is acquired and able to be written
+    score::cpp::optional<std::size_t> AcquireSlotToWrite() noexcept
+    {
+        auto position = enqueue_position_.value.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& cell = CellAt(position);
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == position)
+            {
+                if (enqueue_position_.value.compare_exchange_weak(
+                        position, position + 1UL, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    return IndexOf(position);
+                }
+                // On failure compare_exchange_weak() updated position with the current enqueue position.
+            }
+            else if (IsBehind(sequence, position))
+            {
+                // The cell still holds data of the previous lap that was not consumed yet, i.e. the buffer is full.
+                return {};
+            }
+            else
+            {
+                // Another producer claimed this position in the meantime.
+                position = enqueue_position_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// \brief Get a buffer for a specific slot to read or write data
+    ///
+    /// \param slot The slot where the underlying buffer shall be returned
+    /// \return The buffer of T for the respective slot
+    ///
+    /// \pre Slot is acquired by AcquireSlotToWrite() or AcquireSlotToRead()
+    T& GetUnderlyingBufferFor(const std::size_t slot) noexcept
+    {
+        return buffer_.at(slot).data;
+    }
+
+    /// \brief Publishes a slot to the consumer
+    /// \param slot The slot that is now no longer manipulated by the producer
+    ///
+    /// \pre slot was acquired by AcquireSlotToWrite() and data was written via GetUnderlyingBufferFor()
+    /// \post Slot can be obtained by the consumer via AcquireSlotToRead()
+    void ReleaseSlot(const std::size_t slot) noexcept
+    {
+        auto& cell = buffer_.at(slot);
+        // Only the owning producer modifies the sequence at this point, thus relaxed loading is sufficient.
+        cell.sequence.store(cell.sequence.load(std::memory_order_relaxed) + 1UL, std::memory_order_release);
+    }
+
+    /// \brief Returns a published slot to the consumer
+    ///
+    /// \param offset Distance to the oldest slot that was not yet released by the consumer. This allows the consumer
+    /// to read several slots before returning them in order via ReleaseReadSlot().
+    /// \return The slot to read from, empty if the slot was not yet published by its producer.
+    ///
+    /// \pre Must only be called by a single consumer at a time.
+    /// \post Calling again without ReleaseReadSlot() yields the same slot.
+    score::cpp::optional<std::size_t> AcquireSlotToRead(const std::size_t offset = 0UL) noexcept
+    {
+        if (offset >= buffer_.size())
+        {
+            return {};
+        }
+        const auto position = dequeue_position_.value.load(std::memory_order_relaxed) + offset;
+        const auto& cell = CellAt(position);
+        if (cell.sequence.load(std::memory_order_acquire) == (position + 1UL))
+        {
+            return IndexOf(position);
+        }
+        return {};
+    }
+
+    /// \brief Returns a slot that was read by the consumer to the producers
+    /// \param slot The slot that was obtained by AcquireSlotToRead()
+    ///
+    /// \pre slot is the last result of AcquireSlotToRead()
+    /// \post Slot can be acquired by a producer via AcquireSlotToWrite()
+    void ReleaseReadSlot(const std::size_t slot) noexcept
+    {
+        const auto position = dequeue_position_.value.load(std::memory_order_relaxed);
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(slot == IndexOf(position), "Slots must be read in order");
+        dequeue_position_.value.store(position + 1UL, std::memory_order_relaxed);
+        buffer_.at(slot).sequence.store(position + buffer_.size(), std::memory_order_release);
+    }
+
+    /// \brief Returns number of used elements, i.e. elements that are acquired by producers or not yet consumed.
+    ///
+    /// \return The number of used elements
+    std::size_t GetUsedCount() const noexcept
+    {
+        // Loading the dequeue position first guarantees that the difference can never become negative, since both
+        // positions only grow.
+        const auto dequeue_position = dequeue_position_.value.load(std::memory_order_relaxed);
+        const auto enqueue_position = enqueue_position_.value.load(std::memory_order_relaxed);
+        return std::min(enqueue_position - dequeue_position, buffer_.size());
+    }
+
+    /// \brief Returns the number of slots of the Ring-Buffer
+    std::size_t GetCapacity() const noexcept
+    {
+        return buffer_.size();
+    }
+
+  private:
+    struct alignas(kMpscRingBufferCacheLineSize) Cell
+    {
+        Cell() = default;
+
+        template <typename ElementFactory>
+        Cell(const std::size_t initial_sequence,
+             ElementFactory& element_factory,
+             score::cpp::pmr::memory_resource* const arena)
+            : sequence{initial_sequence}, data{element_factory(arena)}
+        {
+        }
+
+        // Only required to satisfy std::vector, cells are never relocated since the capacity is reserved upfront.
+        Cell(Cell&& other) noexcept
+            : sequence{other.sequence.load(std::memory_order_relaxed)}, data{std::move(other.data)}
+        {
+        }
+        Cell(const Cell&) = delete;
+        Cell& operator=(const Cell&) = delete;
+        Cell& operator=(Cell&&) = delete;
+        ~Cell() = default;
+
+        std::atomic<std::size_t> sequence{0UL};
+        T data{};
+    };
+
+    struct alignas(kMpscRingBufferCacheLineSize) PaddedPosition
+    {
+        explicit PaddedPosition(const std::size_t initial) noexcept : value{initial} {}
+        std::atomic<std::size_t> value;
+    };
+
+    std::size_t IndexOf(const std::size_t position) const noexcept
+    {
+        return position % buffer_.size();
+    }
+
+    Cell& CellAt(const std::size_t position) noexcept
+    {
+        return buffer_[IndexOf(position)];
+    }
+
+    static bool IsBehind(const std::size_t sequence, const std::size_t position) noexcept
+    {
+        // Positions are free running counters, the unsigned difference stays valid on wrap around.
+        return static_cast<std::ptrdiff_t>(sequence - position) < 0;
+    }
+
+    PaddedPosition enqueue_position_;
+    PaddedPosition dequeue_position_;
+
+    // Declared before buffer_, so that the elements are destructed before the memory they might still reference.
+    std::unique_ptr<score::cpp::pmr::monotonic_buffer_resource> element_arena_;
+
+    // For the beginning this is still an std::vector with standard allocator. Once we refactor the IPC to DataRouter,
+    // this data type will be directly placed in SharedMemory and a custom allocator will be added.
+    std::vector<Cell> buffer_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_MPSC_RING_BUFFER_H
@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/mpsc_ring_buffer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfSlots{255UL};
+constexpr std::size_t kPayloadSize{64UL};
+constexpr int kMaxNumberOfProducers{32};
+
+using Payload = std::array<std::uint8_t, kPayloadSize>;
+
+/// Producers acquire, fill and publish a slot while a dedicated consumer thread drains the ring buffer in order.
+class MpscRingBufferFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            unit_ = std::make_unique<MpscRingBuffer<Payload>>(kNumberOfSlots);
+            stop_consumer_ = false;
+            consumer_ = std::thread([this]() noexcept {
+                while (!stop_consumer_.load(std::memory_order_relaxed))
+                {
+                    const auto slot = unit_->AcquireSlotToRead();
+                    if (slot.has_value())
+                    {
+                        benchmark::DoNotOptimize(unit_->GetUnderlyingBufferFor(slot.value()));
+                        unit_->ReleaseReadSlot(slot.value());
+                    }
+                }
+            });
+        }
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            stop_consumer_ = true;
+            consumer_.join();
+            unit_.reset();
+        }
+    }
+
+  protected:
+    std::unique_ptr<MpscRingBuffer<Payload>> unit_{};
+    std::atomic<bool> stop_consumer_{false};
+    std::thread consumer_{};
+};
+
+BENCHMARK_DEFINE_F(MpscRingBufferFixture, ProduceAndPublish)(benchmark::State& state)
+{
+    std::int64_t dropped{0};
+    for (auto _ : state)
+    {
+        const auto slot = unit_->AcquireSlotToWrite();
+        if (slot.has_value())
+        {
+            unit_->GetUnderlyingBufferFor(slot.value()).fill(static_cast<std::uint8_t>(slot.value()));
+            unit_->ReleaseSlot(slot.value());
+        }
+        else
+        {
+            ++dropped;
+        }
+    }
+    state.counters["dropped"] = benchmark::Counter(static_cast<double>(dropped), benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_REGISTER_F(MpscRingBufferFixture, ProduceAndPublish)->ThreadRange(1, kMaxNumberOfProducers)->UseRealTime();
+
+/// Baseline: the producer-only CircularAllocator, where the producer itself returns the slot after writing.
+class CircularAllocatorFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            unit_ = std::make_unique<CircularAllocator<Payload>>(kNumberOfSlots);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            unit_.reset();
+        }
+    }
+
+  protected:
+    std::unique_ptr<CircularAllocator<Payload>> unit_{};
+};
+
+BENCHMARK_DEFINE_F(CircularAllocatorFixture, ProduceAndRelease)(benchmark::State& state)
+{
+    std::int64_t dropped{0};
+    for (auto _ : state)
+    {
+        const auto slot = unit_->AcquireSlotToWrite();
+        if (slot.has_value())
+        {
+            unit_->GetUnderlyingBufferFor(slot.value()).fill(static_cast<std::uint8_t>(slot.value()));
+            unit_->ReleaseSlot(slot.value());
+        }
+        else
+        {
+            ++dropped;
+        }
+    }
+    state.counters["dropped"] = benchmark::Counter(static_cast<double>(dropped), benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_REGISTER_F(CircularAllocatorFixture, ProduceAndRelease)
+    ->ThreadRange(1, kMaxNumberOfProducers)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
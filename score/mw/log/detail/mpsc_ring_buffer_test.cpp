@@ -0,0 +1,397 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/mpsc_ring_buffer.h"
+
+#include "score/vector.hpp"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+class MpscRingBufferFixture : public ::testing::Test
+{
+  public:
+    void WriteInto(MpscRingBuffer<std::int32_t>& unit, std::int32_t value) const noexcept
+    {
+        const auto slot = unit.AcquireSlotToWrite();
+        ASSERT_TRUE(slot.has_value());
+        unit.GetUnderlyingBufferFor(slot.value()) = value;
+        unit.ReleaseSlot(slot.value());
+    }
+
+    score::cpp::optional<std::int32_t> ReadFrom(MpscRingBuffer<std::int32_t>& unit) const noexcept
+    {
+        const auto slot = unit.AcquireSlotToRead();
+        if (!slot.has_value())
+        {
+            return {};
+        }
+        const auto value = unit.GetUnderlyingBufferFor(slot.value());
+        unit.ReleaseReadSlot(slot.value());
+        return value;
+    }
+};
+
+TEST_F(MpscRingBufferFixture, ElementsShallBeConstructedInPlaceFromTheArena)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The ring buffer shall construct every element once with the element factory and pass its arena.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a factory that reserves the memory of every element from the passed arena
+    constexpr std::size_t kCapacity{4U};
+    constexpr std::size_t kElementSize{16U};
+    std::size_t number_of_constructed_elements{0U};
+    std::vector<score::cpp::pmr::memory_resource*> arenas{};
+    const auto factory = [&](score::cpp::pmr::memory_resource* const arena) {
+        ++number_of_constructed_elements;
+        arenas.push_back(arena);
+        score::cpp::pmr::vector<std::uint8_t> element{arena};
+        element.reserve(kElementSize);
+        return element;
+    };
+
+    // When constructing the Ring-Buffer
+    MpscRingBuffer<score::cpp::pmr::vector<std::uint8_t>> unit{kCapacity, kCapacity * kElementSize, factory};
+
+    // Then every element was constructed exactly once from the same arena
+    EXPECT_EQ(number_of_constructed_elements, kCapacity);
+    ASSERT_EQ(arenas.size(), kCapacity);
+    EXPECT_NE(arenas.front(), nullptr);
+    EXPECT_NE(arenas.front(), score::cpp::pmr::get_default_resource());
+    for (std::size_t slot{0U}; slot < kCapacity; ++slot)
+    {
+        EXPECT_EQ(arenas.at(slot), arenas.front());
+        EXPECT_EQ(unit.GetUnderlyingBufferFor(slot).get_allocator().resource(), arenas.front());
+        EXPECT_EQ(unit.GetUnderlyingBufferFor(slot).capacity(), kElementSize);
+    }
+
+    // And the Ring-Buffer is usable as usual
+    const auto slot = unit.AcquireSlotToWrite();
+    ASSERT_TRUE(slot.has_value());
+    unit.ReleaseSlot(slot.value());
+    EXPECT_EQ(unit.AcquireSlotToRead(), slot);
+}
+
+TEST_F(MpscRingBufferFixture, EmptyBufferHasNothingToRead)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Reading from an empty ring buffer shall return an empty result.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given an empty Ring-Buffer
+    MpscRingBuffer<std::int32_t> unit{4};
+
+    // When reading from it
+    const auto slot = unit.AcquireSlotToRead();
+
+    // Then nothing can be read
+    EXPECT_FALSE(slot.has_value());
+    EXPECT_EQ(unit.GetUsedCount(), 0U);
+    EXPECT_EQ(unit.GetCapacity(), 4U);
+}
+
+TEST_F(MpscRingBufferFixture, InitialValueIsCopiedIntoEverySlot)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Every slot shall be initialized with the given initial value.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a Ring-Buffer constructed with an initial value
+    MpscRingBuffer<std::int32_t> unit{3, 42};
+
+    // Then every slot holds the initial value
+    for (std::size_t slot{0U}; slot < unit.GetCapacity(); ++slot)
+    {
+        EXPECT_EQ(unit.GetUnderlyingBufferFor(slot), 42);
+    }
+}
+
+TEST_F(MpscRingBufferFixture, AcquiredButUnpublishedSlotCannotBeRead)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A slot shall only be readable after the producer released it.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a Ring-Buffer with an acquired slot
+    MpscRingBuffer<std::int32_t> unit{4};
+    const auto slot = unit.AcquireSlotToWrite();
+    ASSERT_TRUE(slot.has_value());
+
+    // Then the slot is counted as used but cannot be read
+    EXPECT_EQ(unit.GetUsedCount(), 1U);
+    EXPECT_FALSE(unit.AcquireSlotToRead().has_value());
+
+    // When the producer publishes the slot
+    unit.ReleaseSlot(slot.value());
+
+    // Then it can be read
+    const auto read_slot = unit.AcquireSlotToRead();
+    ASSERT_TRUE(read_slot.has_value());
+    EXPECT_EQ(read_slot.value(), slot.value());
+}
+
+TEST_F(MpscRingBufferFixture, SlotsAreReadInAcquisitionOrder)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The consumer shall read slots in the order they were acquired, even if producers publish them in "
+                   "a different order.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a Ring-Buffer with two acquired slots
+    MpscRingBuffer<std::int32_t> unit{4};
+    const auto first = unit.AcquireSlotToWrite();
+    const auto second = unit.AcquireSlotToWrite();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    unit.GetUnderlyingBufferFor(first.value()) = 1;
+    unit.GetUnderlyingBufferFor(second.value()) = 2;
+
+    // When the second slot is published first
+    unit.ReleaseSlot(second.value());
+
+    // Then nothing can be read since the oldest slot is still written
+    EXPECT_FALSE(ReadFrom(unit).has_value());
+
+    // When the first slot is published as well
+    unit.ReleaseSlot(first.value());
+
+    // Then both values are read in acquisition order
+    EXPECT_EQ(ReadFrom(unit), 1);
+    EXPECT_EQ(ReadFrom(unit), 2);
+    EXPECT_FALSE(ReadFrom(unit).has_value());
+    EXPECT_EQ(unit.GetUsedCount(), 0U);
+}
+
+TEST_F(MpscRingBufferFixture, FullBufferRejectsProducerUntilConsumerReleases)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "When every slot is occupied acquiring another slot shall return an empty result until the "
+                   "consumer released a slot.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a full Ring-Buffer
+    MpscRingBuffer<std::int32_t> unit{2};
+    WriteInto(unit, 1);
+    WriteInto(unit, 2);
+    EXPECT_EQ(unit.GetUsedCount(), 2U);
+
+    // Then no further slot can be acquired
+    EXPECT_FALSE(unit.AcquireSlotToWrite().has_value());
+
+    // When the consumer reads one slot
+    EXPECT_EQ(ReadFrom(unit), 1);
+
+    // Then the producer can write again and wraps around
+    WriteInto(unit, 3);
+    EXPECT_EQ(ReadFrom(unit), 2);
+    EXPECT_EQ(ReadFrom(unit), 3);
+}
+
+TEST_F(MpscRingBufferFixture, ReadingSameSlotTwiceWithoutReleaseYieldsSameSlot)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Acquiring a slot to read without releasing it shall return the same slot again.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a Ring-Buffer with a published slot
+    MpscRingBuffer<std::int32_t> unit{2};
+    WriteInto(unit, 7);
+
+    // When acquiring the slot to read twice
+    const auto first = unit.AcquireSlotToRead();
+    const auto second = unit.AcquireSlotToRead();
+
+    // Then the same slot is returned
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first.value(), second.value());
+}
+
+TEST_F(MpscRingBufferFixture, ConsumerCanReadAheadBeforeReleasingSlots)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The consumer shall be able to read published slots ahead of the oldest unreleased slot and release "
+                   "them afterwards in order.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a Ring-Buffer with two published slots and one acquired slot
+    MpscRingBuffer<std::int32_t> unit{4};
+    WriteInto(unit, 1);
+    WriteInto(unit, 2);
+    const auto unpublished = unit.AcquireSlotToWrite();
+    ASSERT_TRUE(unpublished.has_value());
+
+    // When reading ahead
+    const auto first = unit.AcquireSlotToRead(0U);
+    const auto second = unit.AcquireSlotToRead(1U);
+
+    // Then both published slots can be read, but neither the unpublished one nor any slot beyond the capacity
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(unit.GetUnderlyingBufferFor(first.value()), 1);
+    EXPECT_EQ(unit.GetUnderlyingBufferFor(second.value()), 2);
+    EXPECT_FALSE(unit.AcquireSlotToRead(2U).has_value());
+    EXPECT_FALSE(unit.AcquireSlotToRead(4U).has_value());
+
+    // When releasing the first slot
+    unit.ReleaseReadSlot(first.value());
+
+    // Then the offsets are relative to the next unreleased slot
+    const auto next = unit.AcquireSlotToRead();
+    ASSERT_TRUE(next.has_value());
+    EXPECT_EQ(next.value(), second.value());
+    EXPECT_EQ(unit.GetUsedCount(), 2U);
+}
+
+TEST_F(MpscRingBufferFixture, MultipleProducersAndSingleConsumerTransferEveryValueOnce)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "When multiple producers write concurrently while a single consumer reads, every value shall be "
+                   "received exactly once and in per-producer order.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    constexpr std::size_t kNumberOfProducers{4U};
+    constexpr std::int32_t kValuesPerProducer{1000};
+
+    // Given a small Ring-Buffer shared by multiple producers
+    MpscRingBuffer<std::int32_t> unit{8};
+
+    // When all producers write their values while the consumer reads
+    std::array<std::thread, kNumberOfProducers> producers{};
+    for (std::size_t producer{}; producer < producers.size(); producer++)
+    {
+        producers.at(producer) = std::thread([&unit, producer]() noexcept {
+            for (std::int32_t value{}; value < kValuesPerProducer; value++)
+            {
+                score::cpp::optional<std::size_t> slot{};
+                while (!slot.has_value())
+                {
+                    slot = unit.AcquireSlotToWrite();
+                    std::this_thread::yield();
+                }
+                unit.GetUnderlyingBufferFor(slot.value()) =
+                    static_cast<std::int32_t>(producer) * kValuesPerProducer + value;
+                unit.ReleaseSlot(slot.value());
+            }
+        });
+    }
+
+    std::array<std::int32_t, kNumberOfProducers> next_expected_value{};
+    std::size_t received{0U};
+    bool in_order{true};
+    while (received < kNumberOfProducers * static_cast<std::size_t>(kValuesPerProducer))
+    {
+        const auto value = ReadFrom(unit);
+        if (value.has_value())
+        {
+            const auto producer = static_cast<std::size_t>(value.value() / kValuesPerProducer);
+            in_order = in_order && ((value.value() % kValuesPerProducer) == next_expected_value.at(producer));
+            next_expected_value.at(producer)++;
+            received++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    // Then every value was received once in order and the buffer is empty afterwards
+    EXPECT_TRUE(in_order);
+    for (const auto next_value : next_expected_value)
+    {
+        EXPECT_EQ(next_value, kValuesPerProducer);
+    }
+    EXPECT_EQ(unit.GetUsedCount(), 0U);
+}
+
+TEST_F(MpscRingBufferFixture, WritingFromMultipleThreadsIsSafeWithInsufficientCapacity)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "When writing with multiple threads in parallel and trying to allocate more slots than capacity "
+                   "without a consumer, the number of reserved slots shall be equal to the capacity.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a Ring-Buffer
+    constexpr std::size_t kNumberOfSlots{100};
+    MpscRingBuffer<std::int32_t> unit{kNumberOfSlots};
+
+    // When trying to write into it from multiple threads such that the number of slots is insufficient.
+    std::atomic<std::size_t> number_of_reserved_slots{0U};
+    std::vector<std::thread> threads{};
+    for (std::size_t counter{}; counter < 10U; counter++)
+    {
+        threads.emplace_back([&unit, &number_of_reserved_slots]() noexcept {
+            for (std::size_t number{}; number < 50; number++)
+            {
+                const auto slot = unit.AcquireSlotToWrite();
+                if (slot.has_value())
+                {
+                    unit.ReleaseSlot(slot.value());
+                    number_of_reserved_slots++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then the number of reserved slots is equal to the capacity.
+    EXPECT_EQ(number_of_reserved_slots.load(), kNumberOfSlots);
+    EXPECT_EQ(unit.GetUsedCount(), kNumberOfSlots);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
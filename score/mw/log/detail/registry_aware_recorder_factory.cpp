@@ -18,6 +18,7 @@
 #include "score/mw/log/detail/empty_recorder.h"
 #include "score/mw/log/detail/error.h"
 #include "score/mw/log/detail/initialization_reporter.h"
+#include "score/mw/log/detail/throttling_recorder.h"
 
 namespace score
 {
@@ -28,6 +29,21 @@ namespace log
 namespace detail
 {
 
+namespace
+{
+
+/// \brief Puts the throttling stage in front of all recorders if the configuration requests it.
+std::unique_ptr<Recorder> AddThrottlingStage(std::unique_ptr<Recorder> recorder, const Configuration& config) noexcept
+{
+    if (!ThrottlingRecorder::IsRequiredBy(config))
+    {
+        return recorder;
+    }
+    return std::make_unique<ThrottlingRecorder>(config, std::move(recorder));
+}
+
+}  // namespace
+
 std::unique_ptr<Recorder> RegistryAwareRecorderFactory::CreateRecorderFromLogMode(
     const LogMode& log_mode,
     const Configuration& config,
@@ -94,11 +110,11 @@ std::unique_ptr<Recorder> RegistryAwareRecorderFactory::CreateFromConfiguration(
 
     if (recorders.size() == 1U)
     {
-        return std::move(recorders[0]);
+        return AddThrottlingStage(std::move(recorders[0]), result.value());
     }
 
     // Composite recorder is needed if there are more than one activate recorder.
-    return std::make_unique<CompositeRecorder>(std::move(recorders));
+    return AddThrottlingStage(std::make_unique<CompositeRecorder>(std::move(recorders)), result.value());
 }
 
 /*
@@ -173,10 +189,10 @@ std::unique_ptr<Recorder> RegistryAwareRecorderFactory::CreateFromConfiguration(
 
     if (recorders.size() == 1U)
     {
-        return std::move(recorders[0]);
+        return AddThrottlingStage(std::move(recorders[0]), result.value());
     }
 
-    return std::make_unique<CompositeRecorder>(std::move(recorders));
+    return AddThrottlingStage(std::make_unique<CompositeRecorder>(std::move(recorders)), result.value());
 }
 
 std::unique_ptr<Recorder> RegistryAwareRecorderFactory::CreateWithConsoleLoggingOnly(
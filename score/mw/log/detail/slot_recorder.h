@@ -0,0 +1,291 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_SLOT_RECORDER_H
+#define SCORE_MW_LOG_DETAIL_SLOT_RECORDER_H
+
+#include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/backend.h"
+#include "score/mw/log/detail/dlt_argument_counter.h"
+#include "score/mw/log/detail/log_record.h"
+#include "score/mw/log/drop_statistics.h"
+#include "score/mw/log/recorder.h"
+
+#include <memory>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Recorder that fills the slots of a Backend, with the arguments encoded by RecordFormat.
+///
+/// \details RecordFormat provides
+/// - static void StartRecord(LogEntry&) noexcept, called for every reserved slot to fill in format specific fields,
+/// - static AddArgumentResult Log(VerbosePayload&, const T) noexcept for every argument type of the Recorder.
+///
+/// Records for which the backend has no free slot are counted as DropReason::kNoSlot.
+///
+/// The member functions are defined out of class, so that a recorder explicitly instantiates them once in its
+/// translation unit and declares the instantiation extern in its header.
+template <typename RecordFormat>
+class SlotRecorder : public Recorder
+{
+  public:
+    SlotRecorder(const detail::Configuration& config,
+                 std::unique_ptr<detail::Backend> backend,
+                 const bool check_log_level_for_console) noexcept;
+    SlotRecorder(SlotRecorder&&) noexcept = delete;
+    SlotRecorder(const SlotRecorder&) noexcept = delete;
+    SlotRecorder& operator=(SlotRecorder&&) noexcept = delete;
+    SlotRecorder& operator=(const SlotRecorder&) noexcept = delete;
+
+    ~SlotRecorder() override = default;
+
+    score::cpp::optional<SlotHandle> StartRecord(const std::string_view context_id,
+                                          const LogLevel log_level) noexcept override;
+    void StopRecord(const SlotHandle& slot) noexcept override;
+
+    void Log(const SlotHandle& slot, const bool data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint8_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int8_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint16_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int16_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint32_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int32_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint64_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int64_t data) noexcept override;
+    void Log(const SlotHandle& slot, const float data) noexcept override;
+    void Log(const SlotHandle& slot, const double data) noexcept override;
+    void Log(const SlotHandle& slot, const LogRawBuffer data) noexcept override;
+    void Log(const SlotHandle& slot, const std::string_view data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex8 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex16 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex32 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex64 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin8 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin16 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin32 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin64 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogSlog2Message data) noexcept override;
+
+    bool IsLogEnabled(const LogLevel&, const std::string_view) const noexcept override;
+
+  private:
+    template <typename T>
+    void GenericLog(const SlotHandle& slot_handle, const T data) noexcept;
+
+    std::unique_ptr<detail::Backend> backend_;
+
+    detail::Configuration config_;
+    bool check_log_level_for_console_;
+};
+
+template <typename RecordFormat>
+SlotRecorder<RecordFormat>::SlotRecorder(const detail::Configuration& config,
+                                         std::unique_ptr<detail::Backend> backend,
+                                         const bool check_log_level_for_console) noexcept
+    : Recorder(),
+      backend_(std::move(backend)),
+      config_(config),
+      check_log_level_for_console_{check_log_level_for_console}
+{
+}
+
+template <typename RecordFormat>
+score::cpp::optional<SlotHandle> SlotRecorder<RecordFormat>::StartRecord(const std::string_view context_id,
+                                                                  const LogLevel log_level) noexcept
+{
+    if (IsLogEnabled(log_level, context_id) == false)
+    {
+        return {};
+    }
+
+    auto slot_handle = backend_->ReserveSlot();
+    if (slot_handle.has_value())
+    {
+        auto& payload = backend_->GetLogRecord(slot_handle.value());
+        auto& log_entry = payload.GetLogEntry();
+
+        const auto app_id = config_.GetAppId();
+        log_entry.app_id = detail::LoggingIdentifier{app_id};
+        log_entry.ctx_id = detail::LoggingIdentifier{context_id};
+        log_entry.num_of_args = 0U;
+        log_entry.log_level = log_level;
+        RecordFormat::StartRecord(log_entry);
+        payload.GetVerbosePayload().Reset();
+    }
+    else
+    {
+        CountDroppedRecords(DropReason::kNoSlot);
+    }
+
+    return slot_handle;
+}
+
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::StopRecord(const SlotHandle& slot) noexcept
+{
+    backend_->FlushSlot(slot);
+}
+
+template <typename RecordFormat>
+bool SlotRecorder<RecordFormat>::IsLogEnabled(const LogLevel& log_level,
+                                              const std::string_view context) const noexcept
+{
+    return config_.IsLogLevelEnabled(log_level, context, check_log_level_for_console_);
+}
+
+template <typename RecordFormat>
+template <typename T>
+void SlotRecorder<RecordFormat>::GenericLog(const SlotHandle& slot_handle, const T data) noexcept
+{
+    auto& log_record = backend_->GetLogRecord(slot_handle);
+
+    detail::DltArgumentCounter counter{log_record.GetLogEntry().num_of_args};
+    std::ignore = counter.TryAddArgument([data, &log_record]() noexcept {
+        return RecordFormat::Log(log_record.GetVerbosePayload(), data);
+    });
+}
+
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const bool data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::uint8_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::int8_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::uint16_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::int16_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::uint32_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::int32_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::uint64_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::int64_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const float data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const double data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogRawBuffer data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const std::string_view data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogHex8 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogHex16 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogHex32 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogHex64 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogBin8 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogBin16 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogBin32 data) noexcept
+{
+    GenericLog(slot, data);
+}
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogBin64 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+template <typename RecordFormat>
+void SlotRecorder<RecordFormat>::Log(const SlotHandle& slot, const LogSlog2Message data) noexcept
+{
+// QNX-specific recorder
+// coverity[autosar_cpp14_a16_0_1_violation]
+#if defined __QNX__
+    auto& log_record = backend_->GetLogRecord(slot);
+    auto& log_entry = log_record.GetLogEntry();
+    log_entry.slog2_code = data.GetCode();
+// QNX-specific recorder
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+
+    GenericLog(slot, data.GetMessage());
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_SLOT_RECORDER_H
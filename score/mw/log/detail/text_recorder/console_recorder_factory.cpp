@@ -14,6 +14,8 @@
 #include "score/mw/log/detail/text_recorder/file_output_backend.h"
 #include "score/mw/log/detail/text_recorder/text_message_builder.h"
 
+#include <unistd.h>
+
 namespace score
 {
 namespace mw
@@ -35,14 +37,34 @@ std::unique_ptr<Backend> ConsoleRecorderFactory::CreateConsoleLoggingBackend(
     score::cpp::pmr::memory_resource* memory_resource) noexcept
 {
     auto message_builder = std::make_unique<TextMessageBuilder>(config.GetEcuId());
-    auto allocator = std::make_unique<CircularAllocator<LogRecord>>(config.GetNumberOfSlots(),
-                                                                    LogRecord{config.GetSlotSizeInBytes()});
+    //  The payload and header buffers of all slots are placed back to back in one arena owned by the Ring-Buffer:
+    const auto slot_size = config.GetSlotSizeInBytes();
+    const auto arena_size = config.GetNumberOfSlots() * (slot_size + TextMessageBuilder::kMaxHeaderSize);
+    auto allocator = std::make_unique<MpscRingBuffer<LogRecord>>(
+        config.GetNumberOfSlots(), arena_size, [slot_size](score::cpp::pmr::memory_resource* const arena) noexcept {
+            return LogRecord{slot_size, arena, TextMessageBuilder::kMaxHeaderSize};
+        });
+
+    if (config.GetAsyncDrainEnabled())
+    {
+        DrainerThreadOptions drainer_thread_options{};
+        drainer_thread_options.period = config.GetAsyncDrainPeriod();
+        drainer_thread_options.cpu_affinity = config.GetAsyncDrainCpuAffinity();
+        drainer_thread_options.priority = config.GetAsyncDrainPriority();
+        return std::make_unique<FileOutputBackend>(std::move(message_builder),
+                                                   STDOUT_FILENO,
+                                                   std::move(allocator),
+                                                   score::os::FcntlImpl::Default(memory_resource),
+                                                   score::os::SysUio::Default(memory_resource),
+                                                   drainer_thread_options,
+                                                   score::os::Pthread::Default(memory_resource));
+    }
 
     return std::make_unique<FileOutputBackend>(std::move(message_builder),
                                                STDOUT_FILENO,
                                                std::move(allocator),
                                                score::os::FcntlImpl::Default(memory_resource),
-                                               score::os::Unistd::Default(memory_resource));
+                                               score::os::SysUio::Default(memory_resource));
 }
 
 }  // namespace detail
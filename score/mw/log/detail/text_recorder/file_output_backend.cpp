@@ -25,12 +25,13 @@ namespace detail
 
 FileOutputBackend::FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
                                      const std::int32_t file_descriptor,
-                                     std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                                     std::unique_ptr<MpscRingBuffer<LogRecord>> allocator,
                                      score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
-                                     score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept
+                                     score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio) noexcept
     : Backend(),
       buffer_allocator_(std::move(allocator)),
-      slot_drainer_(std::move(message_builder), buffer_allocator_, file_descriptor, std::move(unistd))
+      slot_drainer_(std::move(message_builder), buffer_allocator_, file_descriptor, std::move(sys_uio)),
+      drainer_thread_{}
 {
     const auto flags = fcntl_instance->fcntl(file_descriptor, score::os::Fcntl::Command::kFileGetStatusFlags);
     if (flags.has_value())
@@ -42,14 +43,37 @@ FileOutputBackend::FileOutputBackend(std::unique_ptr<IMessageBuilder> message_bu
     }
 }
 
+FileOutputBackend::FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
+                                     const std::int32_t file_descriptor,
+                                     std::unique_ptr<MpscRingBuffer<LogRecord>> allocator,
+                                     score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                                     score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                                     const DrainerThreadOptions& drainer_thread_options,
+                                     score::cpp::pmr::unique_ptr<score::os::Pthread> pthread) noexcept
+    : FileOutputBackend(std::move(message_builder),
+                        file_descriptor,
+                        std::move(allocator),
+                        std::move(fcntl_instance),
+                        std::move(sys_uio))
+{
+    auto drain = [this]() noexcept {
+        const auto result = slot_drainer_.Flush();
+        return result.has_value() && (result.value() == SlotDrainer::FlushResult::kNumberOfProcessedSlotsExceeded);
+    };
+    drainer_thread_ = std::make_unique<DrainerThread>(std::move(drain), drainer_thread_options, std::move(pthread));
+}
+
 score::cpp::optional<SlotHandle> FileOutputBackend::ReserveSlot() noexcept
 {
-    slot_drainer_.Flush();
+    if (drainer_thread_ == nullptr)
+    {
+        std::ignore = slot_drainer_.Flush();
+    }
     const auto slot = buffer_allocator_->AcquireSlotToWrite();
 
     if (slot.has_value())
     {
-        // CircularAllocator has capacity limited by CheckFoxMaxCapacity thus the cast is valid:
+        // MpscRingBuffer has capacity limited by CheckFoxMaxCapacity thus the cast is valid:
         // We intentionally static cast to SlotIndex(uint8_t) to limit memory allocations
         // to the required levels during startup, since there is no need to support slots greater
         // than uint8 as per the current system needs.
@@ -61,8 +85,12 @@ score::cpp::optional<SlotHandle> FileOutputBackend::ReserveSlot() noexcept
 
 void FileOutputBackend::FlushSlot(const SlotHandle& slot) noexcept
 {
-    slot_drainer_.PushBack(slot);
-    slot_drainer_.Flush();
+    //  Publishing the slot hands it over to the SlotDrainer:
+    buffer_allocator_->ReleaseSlot(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+    if (drainer_thread_ == nullptr)
+    {
+        std::ignore = slot_drainer_.Flush();
+    }
 }
 
 LogRecord& FileOutputBackend::GetLogRecord(const SlotHandle& slot) noexcept
@@ -14,7 +14,8 @@
 #define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_FILE_OUTPUT_BACKEND_H
 
 #include "score/mw/log/detail/backend.h"
-#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/mpsc_ring_buffer.h"
+#include "score/mw/log/detail/drainer_thread.h"
 #include "score/mw/log/detail/text_recorder/slot_drainer.h"
 
 #include "score/os/fcntl_impl.h"
@@ -33,9 +34,22 @@ class FileOutputBackend final : public Backend
   public:
     FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
                       const std::int32_t file_descriptor,
-                      std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                      std::unique_ptr<MpscRingBuffer<LogRecord>> allocator,
                       score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
-                      score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept;
+                      score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio) noexcept;
+
+    /// \brief Creates a backend whose slots are drained by a dedicated background thread.
+    ///
+    /// \details In this mode ReserveSlot() and FlushSlot() never write to the file descriptor. Thus logging threads do
+    /// not contend on the drainer and issue no system calls.
+    FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
+                      const std::int32_t file_descriptor,
+                      std::unique_ptr<MpscRingBuffer<LogRecord>> allocator,
+                      score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                      score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                      const DrainerThreadOptions& drainer_thread_options,
+                      score::cpp::pmr::unique_ptr<score::os::Pthread> pthread) noexcept;
+
     /// \brief Before a producer can store data in our buffer, he has to reserve a slot.
     ///
     /// \return SlotHandle if a slot was able to be reserved, empty otherwise.
@@ -61,8 +75,10 @@ class FileOutputBackend final : public Backend
 
   private:
     // shared with SlotDrainer
-    std::shared_ptr<CircularAllocator<LogRecord>> buffer_allocator_;
+    std::shared_ptr<MpscRingBuffer<LogRecord>> buffer_allocator_;
     SlotDrainer slot_drainer_;
+    //  Only set in asynchronous mode. Declared after slot_drainer_ so that the thread is stopped first:
+    std::unique_ptr<DrainerThread> drainer_thread_;
 };
 
 }  // namespace detail
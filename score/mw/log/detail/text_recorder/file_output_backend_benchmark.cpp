@@ -0,0 +1,206 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/file_output_backend.h"
+#include "score/mw/log/detail/text_recorder/text_message_builder.h"
+
+#include "score/os/fcntl_impl.h"
+#include "score/os/pthread.h"
+#include "score/os/sys_uio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfSlots{255UL};
+constexpr std::size_t kSlotSizeInBytes{1024UL};
+constexpr int kMaxNumberOfProducers{8};
+
+enum class DrainMode : std::int64_t
+{
+    kInline = 0,
+    kAsync = 1,
+};
+
+/// Log-linear latency histogram: every power of two is split into kSubBuckets linear buckets, which keeps the relative
+/// error of the reported percentiles below 1 / kSubBuckets without allocating during the measurement.
+class LatencyHistogram
+{
+  public:
+    void Record(const std::uint64_t nanoseconds) noexcept
+    {
+        buckets_.at(BucketOf(nanoseconds))++;
+        count_++;
+    }
+
+    std::uint64_t Percentile(const double percentile) const noexcept
+    {
+        const auto rank = static_cast<std::uint64_t>(percentile * static_cast<double>(count_));
+        std::uint64_t seen{0U};
+        for (std::size_t bucket{0U}; bucket < buckets_.size(); ++bucket)
+        {
+            seen += buckets_.at(bucket);
+            if (seen > rank)
+            {
+                return UpperBoundOf(bucket);
+            }
+        }
+        return UpperBoundOf(buckets_.size() - 1U);
+    }
+
+  private:
+    static constexpr std::size_t kSubBucketBits{3U};
+    static constexpr std::size_t kSubBuckets{1U << kSubBucketBits};
+    static constexpr std::size_t kMagnitudes{64U - kSubBucketBits};
+
+    static std::size_t BucketOf(const std::uint64_t value) noexcept
+    {
+        if (value < kSubBuckets)
+        {
+            return static_cast<std::size_t>(value);
+        }
+        const auto magnitude = static_cast<std::size_t>(63 - __builtin_clzll(value)) - kSubBucketBits + 1U;
+        const auto sub_bucket = static_cast<std::size_t>(value >> (magnitude - 1U)) & (kSubBuckets - 1U);
+        return magnitude * kSubBuckets + sub_bucket;
+    }
+
+    static std::uint64_t UpperBoundOf(const std::size_t bucket) noexcept
+    {
+        if (bucket < kSubBuckets)
+        {
+            return bucket;
+        }
+        const auto magnitude = bucket / kSubBuckets;
+        const auto sub_bucket = bucket % kSubBuckets;
+        return ((kSubBuckets + sub_bucket + 1U) << (magnitude - 1U)) - 1U;
+    }
+
+    std::array<std::uint64_t, (kMagnitudes + 1U) * kSubBuckets> buckets_{};
+    std::uint64_t count_{0U};
+};
+
+/// Producers log into a FileOutputBackend that writes to /dev/null, either draining inline on the producer stack or
+/// from the background drainer thread.
+class FileOutputBackendFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            file_descriptor_ = ::open("/dev/null", O_WRONLY);
+            auto memory_resource = score::cpp::pmr::get_default_resource();
+            auto message_builder = std::make_unique<TextMessageBuilder>("ECU1");
+            auto allocator = std::make_unique<MpscRingBuffer<LogRecord>>(
+                kNumberOfSlots,
+                kNumberOfSlots * (kSlotSizeInBytes + TextMessageBuilder::kMaxHeaderSize),
+                [](score::cpp::pmr::memory_resource* const arena) noexcept {
+                    return LogRecord{kSlotSizeInBytes, arena, TextMessageBuilder::kMaxHeaderSize};
+                });
+            if (static_cast<DrainMode>(state.range(0)) == DrainMode::kAsync)
+            {
+                unit_ = std::make_unique<FileOutputBackend>(std::move(message_builder),
+                                                            file_descriptor_,
+                                                            std::move(allocator),
+                                                            score::os::FcntlImpl::Default(memory_resource),
+                                                            score::os::SysUio::Default(memory_resource),
+                                                            DrainerThreadOptions{},
+                                                            score::os::Pthread::Default(memory_resource));
+            }
+            else
+            {
+                unit_ = std::make_unique<FileOutputBackend>(std::move(message_builder),
+                                                            file_descriptor_,
+                                                            std::move(allocator),
+                                                            score::os::FcntlImpl::Default(memory_resource),
+                                                            score::os::SysUio::Default(memory_resource));
+            }
+        }
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        if (state.thread_index() == 0)
+        {
+            unit_.reset();
+            std::ignore = ::close(file_descriptor_);
+        }
+    }
+
+  protected:
+    std::int32_t file_descriptor_{-1};
+    std::unique_ptr<FileOutputBackend> unit_{};
+};
+
+BENCHMARK_DEFINE_F(FileOutputBackendFixture, LogLatency)(benchmark::State& state)
+{
+    LatencyHistogram histogram{};
+    std::int64_t dropped{0};
+    for (auto _ : state)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto slot = unit_->ReserveSlot();
+        if (slot.has_value())
+        {
+            auto& log_entry = unit_->GetLogRecord(slot.value()).GetLogEntry();
+            log_entry.app_id = LoggingIdentifier{"APP0"};
+            log_entry.ctx_id = LoggingIdentifier{"CTX0"};
+            log_entry.log_level = LogLevel::kInfo;
+            unit_->FlushSlot(slot.value());
+        }
+        else
+        {
+            ++dropped;
+        }
+        const auto end = std::chrono::steady_clock::now();
+        histogram.Record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    // Percentiles are computed per producer thread and averaged over all producers.
+    state.counters["p50_ns"] =
+        benchmark::Counter(static_cast<double>(histogram.Percentile(0.5)), benchmark::Counter::kAvgThreads);
+    state.counters["p99_ns"] =
+        benchmark::Counter(static_cast<double>(histogram.Percentile(0.99)), benchmark::Counter::kAvgThreads);
+    state.counters["p999_ns"] =
+        benchmark::Counter(static_cast<double>(histogram.Percentile(0.999)), benchmark::Counter::kAvgThreads);
+    state.counters["dropped"] = benchmark::Counter(static_cast<double>(dropped), benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_REGISTER_F(FileOutputBackendFixture, LogLatency)
+    ->ArgName("async")
+    ->Arg(static_cast<std::int64_t>(DrainMode::kInline))
+    ->Arg(static_cast<std::int64_t>(DrainMode::kAsync))
+    ->ThreadRange(1, kMaxNumberOfProducers)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
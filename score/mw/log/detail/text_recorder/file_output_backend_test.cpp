@@ -13,15 +13,19 @@
 #include "score/mw/log/detail/text_recorder/file_output_backend.h"
 
 #include "score/mw/log/configuration/configuration.h"
-#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/mpsc_ring_buffer.h"
 #include "score/mw/log/detail/error.h"
 #include "score/mw/log/detail/text_recorder/mock/message_builder_mock.h"
 
 #include "score/os/mocklib/fcntl_mock.h"
-#include "score/os/mocklib/unistdmock.h"
+#include "score/os/mocklib/mock_pthread.h"
+#include "score/os/mocklib/sys_uio_mock.h"
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <thread>
+
 namespace score
 {
 namespace mw
@@ -44,7 +48,7 @@ class FileOutputBackendFixture : public ::testing::Test
   public:
     void SetUp() override
     {
-        allocator_ = std::make_unique<CircularAllocator<LogRecord>>(pool_size_);
+        allocator_ = std::make_unique<MpscRingBuffer<LogRecord>>(pool_size_);
         raw_allocator_ptr_ = allocator_.get();
 
         message_builder_mock_ = std::make_unique<mock::MessageBuilderMock>();
@@ -58,8 +62,8 @@ class FileOutputBackendFixture : public ::testing::Test
   protected:
     const std::size_t pool_size_ = 4;
     const std::uint8_t data_table_[4] = {};
-    std::unique_ptr<CircularAllocator<LogRecord>> allocator_ = nullptr;
-    CircularAllocator<LogRecord>* raw_allocator_ptr_ = nullptr;
+    std::unique_ptr<MpscRingBuffer<LogRecord>> allocator_ = nullptr;
+    MpscRingBuffer<LogRecord>* raw_allocator_ptr_ = nullptr;
     std::unique_ptr<IMessageBuilder> message_builder_ = nullptr;
     std::unique_ptr<mock::MessageBuilderMock> message_builder_mock_ = nullptr;
     mock::MessageBuilderMock* raw_message_builder_mock_ = nullptr;
@@ -76,16 +80,22 @@ TEST_F(FileOutputBackendFixture, ReserveSlotShouldTriggerFlushing)
     RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
 
     auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
-    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
+
+    //  Given a slot that was published before
+    const auto published_slot = allocator_->AcquireSlotToWrite();
+    ASSERT_TRUE(published_slot.has_value());
+    allocator_->ReleaseSlot(published_slot.value());
+
     FileOutputBackend unit(std::move(message_builder_),
                            file_descriptor_,
                            std::move(allocator_),
                            std::move(fcntl_mock),
-                           std::move(unistd_mock));
+                           std::move(sys_uio_mock));
 
-    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))
-        .WillOnce(Return(OptionalSpan{}));
+    //  Expect the published slot to be drained
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
+    EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(Exactly(1));
 
     auto slot = unit.ReserveSlot();
     EXPECT_TRUE(slot.has_value());
@@ -100,21 +110,23 @@ TEST_F(FileOutputBackendFixture, FlushSlotShouldTriggerFlushing)
     RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
 
     auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
-    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
+    auto* sys_uio_mock_raw_ptr = sys_uio_mock.get();
 
     const auto& slot_index = allocator_->AcquireSlotToWrite();
     FileOutputBackend unit(std::move(message_builder_),
                            file_descriptor_,
                            std::move(allocator_),
                            std::move(fcntl_mock),
-                           std::move(unistd_mock));
+                           std::move(sys_uio_mock));
 
     EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))                              //  first unitialized
         .WillOnce(Return(SpanData(data_table_, sizeof(data_table_))))  //  actual data to be written
         .WillRepeatedly(Return(OptionalSpan{}));
 
     EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(Exactly(1));
+    EXPECT_CALL(*sys_uio_mock_raw_ptr, writev(file_descriptor_, _, 1))
+        .WillOnce(Return(static_cast<std::int64_t>(sizeof(data_table_))));
 
     unit.FlushSlot(SlotHandle{static_cast<SlotIndex>(slot_index.value())});
 }
@@ -134,17 +146,15 @@ TEST_F(FileOutputBackendFixture, DepletedAllocatorShouldCauseEmptyOptionalReturn
     }
 
     auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
-    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
 
     FileOutputBackend unit(std::move(message_builder_),
                            file_descriptor_,
                            std::move(allocator_),
                            std::move(fcntl_mock),
-                           std::move(unistd_mock));
+                           std::move(sys_uio_mock));
 
-    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))  //  first unitialized
-        .WillRepeatedly(Return(OptionalSpan{}));
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
 
     auto slot = unit.ReserveSlot();
     EXPECT_FALSE(slot.has_value());
@@ -159,12 +169,12 @@ TEST_F(FileOutputBackendFixture, GetLogRecordReturnsObjectSameAsAllocatorWould)
     RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
 
     auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
-    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
     FileOutputBackend unit(std::move(message_builder_),
                            file_descriptor_,
                            std::move(allocator_),
                            std::move(fcntl_mock),
-                           std::move(unistd_mock));
+                           std::move(sys_uio_mock));
 
     EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
     const auto slot = unit.ReserveSlot();
@@ -186,7 +196,7 @@ TEST_F(FileOutputBackendFixture, BackendConstructionShallCallNonBlockingFileSetu
 
     score::os::Fcntl::Open flags = score::os::Fcntl::Open::kReadWrite;
     auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
-    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
     auto* fcntl_mock_raw_ptr = fcntl_mock.get();
 
     //  Expect call to Fcntl setting Non-Blocking properties of a file:
@@ -204,7 +214,7 @@ TEST_F(FileOutputBackendFixture, BackendConstructionShallCallNonBlockingFileSetu
                            file_descriptor_,
                            std::move(allocator_),
                            std::move(fcntl_mock),
-                           std::move(unistd_mock));
+                           std::move(sys_uio_mock));
 }
 
 TEST_F(FileOutputBackendFixture, MissingFlagsShallSkipCallToSetupFile)
@@ -216,7 +226,7 @@ TEST_F(FileOutputBackendFixture, MissingFlagsShallSkipCallToSetupFile)
     RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
 
     auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
-    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
     auto* fcntl_mock_raw_ptr = fcntl_mock.get();
 
     //  Expect call to Fcntl setting Non-Blocking properties of a file:
@@ -231,7 +241,99 @@ TEST_F(FileOutputBackendFixture, MissingFlagsShallSkipCallToSetupFile)
                            file_descriptor_,
                            std::move(allocator_),
                            std::move(fcntl_mock),
-                           std::move(unistd_mock));
+                           std::move(sys_uio_mock));
+}
+
+TEST_F(FileOutputBackendFixture, AsyncModeShallNotFlushOnTheCallStackOfTheProducer)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "In asynchronous mode neither ReserveSlot nor FlushSlot shall drain slots on the caller's stack.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
+    auto pthread_mock = score::cpp::pmr::make_unique<score::os::MockPthread>(memory_resource_);
+
+    //  Given a drainer thread that does not wake up during the test
+    DrainerThreadOptions options{};
+    options.period = std::chrono::hours{1};
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
+    {
+        FileOutputBackend unit(std::move(message_builder_),
+                               file_descriptor_,
+                               std::move(allocator_),
+                               std::move(fcntl_mock),
+                               std::move(sys_uio_mock),
+                               options,
+                               std::move(pthread_mock));
+
+        //  Expect no message to be built while the producer logs
+        EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(0);
+
+        const auto slot = unit.ReserveSlot();
+        ASSERT_TRUE(slot.has_value());
+        unit.FlushSlot(slot.value());
+
+        //  Then the published slot is still pending
+        EXPECT_EQ(raw_allocator_ptr_->GetUsedCount(), 1U);
+
+        //  And residual data is written when the backend is destroyed
+        ::testing::Mock::VerifyAndClearExpectations(raw_message_builder_mock_);
+        EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
+        EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(1);
+    }
+}
+
+TEST_F(FileOutputBackendFixture, AsyncModeShallDrainPublishedSlotsFromTheDrainerThread)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "In asynchronous mode the drainer thread shall drain published slots and apply the configured "
+                   "priority.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
+    auto sys_uio_mock = score::cpp::pmr::make_unique<score::os::SysUioMock>(memory_resource_);
+    auto pthread_mock = score::cpp::pmr::make_unique<score::os::MockPthread>(memory_resource_);
+
+    //  Given a drainer thread with a priority
+    DrainerThreadOptions options{};
+    options.period = std::chrono::milliseconds{1};
+    options.priority = 10;
+
+    //  Expect the priority to be applied to the drainer thread
+    EXPECT_CALL(*pthread_mock, self()).WillOnce(Return(pthread_t{}));
+    EXPECT_CALL(*pthread_mock, pthread_setschedparam(_, SCHED_FIFO, _))
+        .WillOnce([](const pthread_t, const std::int32_t, const struct sched_param* const param) {
+            EXPECT_EQ(param->sched_priority, 10);
+            return score::cpp::expected_blank<score::os::Error>{};
+        });
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
+    EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(1);
+
+    FileOutputBackend unit(std::move(message_builder_),
+                           file_descriptor_,
+                           std::move(allocator_),
+                           std::move(fcntl_mock),
+                           std::move(sys_uio_mock),
+                           options,
+                           std::move(pthread_mock));
+
+    //  When a slot is published
+    const auto slot = unit.ReserveSlot();
+    ASSERT_TRUE(slot.has_value());
+    unit.FlushSlot(slot.value());
+
+    //  Then the drainer thread writes it eventually
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while ((raw_allocator_ptr_->GetUsedCount() != 0U) && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(raw_allocator_ptr_->GetUsedCount(), 0U);
 }
 
 }  // namespace
@@ -37,7 +37,9 @@ class IMessageBuilder
     IMessageBuilder& operator=(const IMessageBuilder&) noexcept = delete;
 
     /// \brief Get next span for consecutive memory area for next part of message that is getting serialized
-    /// \details Specific implementations may build and split message into different number of spans
+    /// \details Specific implementations may build and split message into different number of spans. The returned
+    /// memory shall stay valid until the LogRecord of the message is returned to the producers, i.e. beyond subsequent
+    /// calls of SetNextMessage(), such that spans of several messages can be written at once.
     virtual score::cpp::optional<score::cpp::span<const std::uint8_t>> GetNextSpan() noexcept = 0;
     /// \brief Set data for building next message
     /// \details Build header and payload from data contained in LogRecorder
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/non_blocking_vectored_writer.h"
+
+#include <algorithm>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+NonBlockingVectoredWriter::NonBlockingVectoredWriter(const std::int32_t file_handle,
+                                                     score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio) noexcept
+    : sys_uio_{std::move(sys_uio)}, file_handle_{file_handle}, spans_{}, number_of_spans_{0U}, first_pending_span_{0U}
+{
+}
+
+bool NonBlockingVectoredWriter::AddSpan(const score::cpp::span<const std::uint8_t>& span) noexcept
+{
+    if (number_of_spans_ >= spans_.size())
+    {
+        return false;
+    }
+
+    auto& entry = spans_.at(number_of_spans_);
+    // iovec is shared by readv() and writev(), the data is not modified by writev():
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) see above
+    entry.iov_base = const_cast<std::uint8_t*>(span.data());
+    entry.iov_len = static_cast<std::size_t>(span.size());
+    ++number_of_spans_;
+    return true;
+}
+
+void NonBlockingVectoredWriter::ConsumeWrittenBytes(std::size_t number_of_written_bytes) noexcept
+{
+    while ((first_pending_span_ < number_of_spans_) &&
+           (number_of_written_bytes >= spans_.at(first_pending_span_).iov_len))
+    {
+        number_of_written_bytes -= spans_.at(first_pending_span_).iov_len;
+        ++first_pending_span_;
+    }
+
+    if (first_pending_span_ < number_of_spans_)
+    {
+        //  Partial write of a span, continue behind the last written byte on the next call:
+        auto& entry = spans_.at(first_pending_span_);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) stays within the span that was added
+        entry.iov_base = static_cast<std::uint8_t*>(entry.iov_base) + number_of_written_bytes;
+        entry.iov_len -= number_of_written_bytes;
+    }
+}
+
+score::cpp::expected<NonBlockingVectoredWriter::Result, score::mw::log::detail::Error>
+NonBlockingVectoredWriter::FlushIntoFile() noexcept
+{
+    if (first_pending_span_ < number_of_spans_)
+    {
+        const auto number_of_pending_spans = number_of_spans_ - first_pending_span_;
+        const auto written = sys_uio_->writev(
+            file_handle_, &spans_.at(first_pending_span_), static_cast<std::int32_t>(number_of_pending_spans));
+        if (!written.has_value())
+        {
+            return score::cpp::make_unexpected(score::mw::log::detail::Error::kUnknownError);
+        }
+        ConsumeWrittenBytes(static_cast<std::size_t>(written.value()));
+    }
+
+    if (first_pending_span_ < number_of_spans_)
+    {
+        return Result::kWouldBlock;
+    }
+
+    number_of_spans_ = 0U;
+    first_pending_span_ = 0U;
+    return Result::kDone;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
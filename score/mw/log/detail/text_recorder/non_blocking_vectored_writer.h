@@ -0,0 +1,77 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NON_BLOCKING_VECTORED_WRITER_H
+#define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NON_BLOCKING_VECTORED_WRITER_H
+
+#include "score/mw/log/detail/error.h"
+#include "score/os/sys_uio.h"
+
+#include <score/span.hpp>
+
+#include <array>
+#include <climits>
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Gathers spans of many messages and writes them with a single writev() system call.
+///
+/// \details The writer only stores pointers to the spans, thus the memory of every added span has to stay valid until
+/// FlushIntoFile() returned Result::kDone. If the file descriptor accepts only a part of the data, the next call of
+/// FlushIntoFile() resumes from the first byte that was not written.
+class NonBlockingVectoredWriter final
+{
+  public:
+    enum class Result : std::uint8_t
+    {
+        kWouldBlock = 0,
+        kDone,
+    };
+
+    /// \brief Maximum number of spans that can be gathered into one system call.
+    static constexpr std::size_t kMaxNumberOfSpans{static_cast<std::size_t>(IOV_MAX)};
+
+    NonBlockingVectoredWriter(const std::int32_t file_handle,
+                              score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio) noexcept;
+
+    /// \brief Appends a span to the pending batch.
+    /// \return false if the batch already holds kMaxNumberOfSpans spans, the span was not added in this case.
+    bool AddSpan(const score::cpp::span<const std::uint8_t>& span) noexcept;
+
+    /// \brief Writes the pending batch to the file handle in a non blocking manner.
+    /// \return Result::kDone once every added span was written and the batch is empty again.
+    score::cpp::expected<Result, score::mw::log::detail::Error> FlushIntoFile() noexcept;
+
+  private:
+    void ConsumeWrittenBytes(std::size_t number_of_written_bytes) noexcept;
+
+    score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio_;
+    std::int32_t file_handle_;
+    std::array<iovec, kMaxNumberOfSpans> spans_;
+    std::size_t number_of_spans_;     // number of spans added to the current batch.
+    std::size_t first_pending_span_;  // first span that was not written completely.
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NON_BLOCKING_VECTORED_WRITER_H
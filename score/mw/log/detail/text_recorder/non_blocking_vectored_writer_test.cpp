@@ -0,0 +1,165 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/non_blocking_vectored_writer.h"
+
+#include "score/os/mocklib/sys_uio_mock.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+
+using ::testing::_;
+using ::testing::Return;
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+struct NonBlockingVectoredWriterTestFixture : ::testing::Test
+{
+    void SetUp() override
+    {
+        auto sys_uio = score::cpp::pmr::make_unique<score::os::SysUioMock>(score::cpp::pmr::get_default_resource());
+        sys_uio_ = sys_uio.get();
+        writer_ = std::make_unique<NonBlockingVectoredWriter>(k_file_descriptor_, std::move(sys_uio));
+    }
+
+    void TearDown() override
+    {
+        writer_.reset();
+        sys_uio_ = nullptr;
+    }
+
+  protected:
+    std::unique_ptr<NonBlockingVectoredWriter> writer_;
+    score::os::SysUioMock* sys_uio_{};
+
+    std::int32_t k_file_descriptor_{};
+    std::array<std::uint8_t, 8> first_payload_{};
+    std::array<std::uint8_t, 4> second_payload_{};
+};
+
+TEST_F(NonBlockingVectoredWriterTestFixture, EmptyBatchShallBeDoneWithoutSystemCall)
+{
+    RecordProperty("ParentRequirement", "SCR-861578");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "NonBlockingVectoredWriter shall not call writev if no span was added.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    EXPECT_CALL(*sys_uio_, writev(_, _, _)).Times(0);
+
+    ASSERT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, AllSpansShallBeWrittenWithOneSystemCall)
+{
+    RecordProperty("ParentRequirement", "SCR-861578");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "NonBlockingVectoredWriter shall pass all added spans to a single writev call.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    ASSERT_TRUE(writer_->AddSpan({first_payload_.data(), first_payload_.size()}));
+    ASSERT_TRUE(writer_->AddSpan({second_payload_.data(), second_payload_.size()}));
+
+    EXPECT_CALL(*sys_uio_, writev(k_file_descriptor_, _, 2))
+        .WillOnce([this](std::int32_t, const struct iovec* iov, std::int32_t) {
+            EXPECT_EQ(iov[0].iov_base, first_payload_.data());
+            EXPECT_EQ(iov[0].iov_len, first_payload_.size());
+            EXPECT_EQ(iov[1].iov_base, second_payload_.data());
+            EXPECT_EQ(iov[1].iov_len, second_payload_.size());
+            return static_cast<std::int64_t>(first_payload_.size() + second_payload_.size());
+        });
+
+    ASSERT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, PartialWriteShallResumeBehindLastWrittenByte)
+{
+    RecordProperty("ParentRequirement", "SCR-861578");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "NonBlockingVectoredWriter shall continue behind the last written byte if writev returned early.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    ASSERT_TRUE(writer_->AddSpan({first_payload_.data(), first_payload_.size()}));
+    ASSERT_TRUE(writer_->AddSpan({second_payload_.data(), second_payload_.size()}));
+
+    //  Given a write that ends within the second span
+    EXPECT_CALL(*sys_uio_, writev(k_file_descriptor_, _, 2))
+        .WillOnce(Return(static_cast<std::int64_t>(first_payload_.size() + 1U)));
+
+    ASSERT_EQ(NonBlockingVectoredWriter::Result::kWouldBlock, writer_->FlushIntoFile().value());
+
+    //  Then only the rest of the second span is written
+    EXPECT_CALL(*sys_uio_, writev(k_file_descriptor_, _, 1))
+        .WillOnce([this](std::int32_t, const struct iovec* iov, std::int32_t) {
+            EXPECT_EQ(iov[0].iov_base, &second_payload_[1]);
+            EXPECT_EQ(iov[0].iov_len, second_payload_.size() - 1U);
+            return static_cast<std::int64_t>(second_payload_.size() - 1U);
+        });
+
+    ASSERT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, AddingSpanToFullBatchShallFail)
+{
+    RecordProperty("ParentRequirement", "SCR-861578");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "NonBlockingVectoredWriter shall reject spans beyond kMaxNumberOfSpans until the batch was "
+                   "written.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    for (std::size_t span{0U}; span < NonBlockingVectoredWriter::kMaxNumberOfSpans; ++span)
+    {
+        ASSERT_TRUE(writer_->AddSpan({first_payload_.data(), first_payload_.size()}));
+    }
+    EXPECT_FALSE(writer_->AddSpan({first_payload_.data(), first_payload_.size()}));
+
+    EXPECT_CALL(*sys_uio_, writev(k_file_descriptor_, _, NonBlockingVectoredWriter::kMaxNumberOfSpans))
+        .WillOnce(Return(
+            static_cast<std::int64_t>(NonBlockingVectoredWriter::kMaxNumberOfSpans * first_payload_.size())));
+
+    ASSERT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+    EXPECT_TRUE(writer_->AddSpan({first_payload_.data(), first_payload_.size()}));
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, FailingSystemCallShallReturnError)
+{
+    RecordProperty("ParentRequirement", "SCR-861578");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "NonBlockingVectoredWriter cannot flush if the system call writev fails.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    ASSERT_TRUE(writer_->AddSpan({first_payload_.data(), first_payload_.size()}));
+
+    auto error = score::cpp::make_unexpected(score::os::Error::createFromErrno(EBADF));
+    EXPECT_CALL(*sys_uio_, writev(k_file_descriptor_, _, 1)).WillOnce(Return(error));
+
+    ASSERT_EQ(writer_->FlushIntoFile().error(), score::mw::log::detail::Error::kUnknownError);
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,270 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/number_formatting.h"
+
+#include <array>
+#include <cmath>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+//  128 bit arithmetic is only needed to scale the fraction of a double by 10^6 without rounding errors.
+//  __extension__ silences the pedantic warning about the non standard type, GCC and Clang both provide it.
+__extension__ using Uint128 = unsigned __int128;
+
+constexpr std::size_t kMaxDecimalDigits{20U};
+constexpr std::size_t kFixedPointDecimals{6U};
+constexpr std::uint64_t kFixedPointScale{1'000'000U};
+constexpr std::int32_t kDoubleSignificandBits{53};
+
+constexpr std::array<char, 200U> MakeDigitPairs() noexcept
+{
+    std::array<char, 200U> pairs{};
+    for (std::size_t number{0U}; number < 100U; ++number)
+    {
+        pairs[2U * number] = static_cast<char>('0' + (number / 10U));
+        pairs[(2U * number) + 1U] = static_cast<char>('0' + (number % 10U));
+    }
+    return pairs;
+}
+
+//  "00" "01" ... "99": converting two digits per division halves the number of divisions.
+constexpr std::array<char, 200U> kDigitPairs = MakeDigitPairs();
+constexpr std::array<char, 16U> kHexDigits{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+std::size_t CountDecimalDigits(const std::uint64_t value) noexcept
+{
+    std::size_t digits{1U};
+    for (std::uint64_t threshold{10U}; (digits < kMaxDecimalDigits) && (value >= threshold); threshold *= 10U)
+    {
+        ++digits;
+    }
+    return digits;
+}
+
+/// Writes value right aligned into field and fills the remaining leading characters with '0'.
+void WriteDecimalDigits(std::uint64_t value, const score::cpp::span<char> field) noexcept
+{
+    auto position = static_cast<std::size_t>(field.size());
+    while ((value >= 100U) && (position >= 2U))
+    {
+        const auto pair = static_cast<std::size_t>(value % 100U) * 2U;
+        value /= 100U;
+        position -= 2U;
+        field[position] = kDigitPairs.at(pair);
+        field[position + 1U] = kDigitPairs.at(pair + 1U);
+    }
+    while (position > 0U)
+    {
+        --position;
+        field[position] = static_cast<char>('0' + static_cast<char>(value % 10U));
+        value /= 10U;
+    }
+}
+
+/// Writes value in a base of 2^bits_per_digit, used for hexadecimal and octal output.
+template <std::uint32_t BitsPerDigit>
+std::size_t FormatPowerOfTwoBase(const std::uint64_t value, const score::cpp::span<char> destination) noexcept
+{
+    constexpr std::uint64_t kDigitMask{(std::uint64_t{1U} << BitsPerDigit) - 1U};
+    std::size_t digits{1U};
+    for (std::uint64_t rest{value >> BitsPerDigit}; rest != 0U; rest >>= BitsPerDigit)
+    {
+        ++digits;
+    }
+    if (static_cast<std::size_t>(destination.size()) < digits)
+    {
+        return 0U;
+    }
+
+    std::uint64_t rest{value};
+    for (std::size_t position{digits}; position > 0U; --position)
+    {
+        destination[position - 1U] = kHexDigits.at(static_cast<std::size_t>(rest & kDigitMask));
+        rest >>= BitsPerDigit;
+    }
+    return digits;
+}
+
+/// Rounds significand * 2^-shift * 10^6 half to even, shift is larger than 0.
+std::uint64_t ScaleFractionToMicroUnits(const std::uint64_t fraction, const std::int32_t shift) noexcept
+{
+    //  fraction < 2^53 and 10^6 < 2^20, thus every product with shift >= 74 is below one half and rounds to zero.
+    constexpr std::int32_t kMaxSignificantShift{73};
+    if (shift > kMaxSignificantShift)
+    {
+        return 0U;
+    }
+    const Uint128 product = static_cast<Uint128>(fraction) * kFixedPointScale;
+    const auto shift_width = static_cast<std::uint32_t>(shift);
+    auto micro_units = static_cast<std::uint64_t>(product >> shift_width);
+    const Uint128 remainder = product & ((Uint128{1U} << shift_width) - 1U);
+    const Uint128 half = Uint128{1U} << (shift_width - 1U);
+    if ((remainder > half) || ((remainder == half) && ((micro_units & 1U) != 0U)))
+    {
+        ++micro_units;
+    }
+    return micro_units;
+}
+
+}  // namespace
+
+std::size_t FormatDecimal(const std::uint64_t value, const score::cpp::span<char> destination) noexcept
+{
+    const auto digits = CountDecimalDigits(value);
+    if (static_cast<std::size_t>(destination.size()) < digits)
+    {
+        return 0U;
+    }
+    WriteDecimalDigits(value, destination.first(static_cast<score::cpp::span<char>::size_type>(digits)));
+    return digits;
+}
+
+std::size_t FormatDecimal(const std::int64_t value, const score::cpp::span<char> destination) noexcept
+{
+    if (value >= 0)
+    {
+        return FormatDecimal(static_cast<std::uint64_t>(value), destination);
+    }
+    if (destination.empty())
+    {
+        return 0U;
+    }
+    //  Unsigned negation is well defined and also covers the minimum value that has no positive counterpart:
+    const auto magnitude = std::uint64_t{0U} - static_cast<std::uint64_t>(value);
+    const auto digits = FormatDecimal(magnitude, destination.subspan(1U));
+    if (digits == 0U)
+    {
+        return 0U;
+    }
+    destination.front() = '-';
+    return digits + 1U;
+}
+
+std::size_t FormatZeroPaddedDecimal(const std::uint64_t value,
+                                    const std::size_t number_of_digits,
+                                    const score::cpp::span<char> destination) noexcept
+{
+    if ((static_cast<std::size_t>(destination.size()) < number_of_digits) ||
+        (CountDecimalDigits(value) > number_of_digits))
+    {
+        return 0U;
+    }
+    WriteDecimalDigits(value, destination.first(static_cast<score::cpp::span<char>::size_type>(number_of_digits)));
+    return number_of_digits;
+}
+
+std::size_t FormatHex(const std::uint64_t value, const score::cpp::span<char> destination) noexcept
+{
+    constexpr std::uint32_t kBitsPerHexDigit{4U};
+    return FormatPowerOfTwoBase<kBitsPerHexDigit>(value, destination);
+}
+
+std::size_t FormatOctal(const std::uint64_t value, const score::cpp::span<char> destination) noexcept
+{
+    constexpr std::uint32_t kBitsPerOctalDigit{3U};
+    return FormatPowerOfTwoBase<kBitsPerOctalDigit>(value, destination);
+}
+
+std::size_t FormatFixedPoint(const double value, const score::cpp::span<char> destination) noexcept
+{
+    if ((!std::isfinite(value)) || (static_cast<std::size_t>(destination.size()) < kMaxFixedPointCharacters))
+    {
+        return 0U;
+    }
+
+    //  |value| = significand * 2^-shift with an integral significand below 2^53:
+    std::int32_t exponent{0};
+    const double mantissa = std::frexp(std::fabs(value), &exponent);
+    constexpr std::int32_t kMaxExponent{64};
+    if (exponent > kMaxExponent)
+    {
+        return 0U;
+    }
+    const auto significand = static_cast<std::uint64_t>(std::ldexp(mantissa, kDoubleSignificandBits));
+    const std::int32_t shift = kDoubleSignificandBits - exponent;
+
+    std::uint64_t integral_part{0U};
+    std::uint64_t micro_units{0U};
+    if (shift <= 0)
+    {
+        //  Integral value, the significand is shifted by at most 64 - 53 bits and cannot overflow:
+        integral_part = significand << static_cast<std::uint32_t>(-shift);
+    }
+    else
+    {
+        constexpr std::int32_t kBitsOfUint64{64};
+        const std::uint64_t fraction_mask = (shift >= kBitsOfUint64)
+                                                ? ~std::uint64_t{0U}
+                                                : ((std::uint64_t{1U} << static_cast<std::uint32_t>(shift)) - 1U);
+        integral_part = (shift >= kBitsOfUint64) ? 0U : (significand >> static_cast<std::uint32_t>(shift));
+        micro_units = ScaleFractionToMicroUnits(significand & fraction_mask, shift);
+        if (micro_units == kFixedPointScale)
+        {
+            //  Rounding carried into the integral part, which stays below 2^53:
+            micro_units = 0U;
+            ++integral_part;
+        }
+    }
+
+    std::size_t length{0U};
+    if (std::signbit(value))
+    {
+        destination.front() = '-';
+        ++length;
+    }
+    length += FormatDecimal(integral_part, destination.subspan(length));
+    destination[length] = '.';
+    ++length;
+    length += FormatZeroPaddedDecimal(micro_units, kFixedPointDecimals, destination.subspan(length));
+    return length;
+}
+
+std::size_t FormatHexBytes(const score::cpp::span<const char> data, const score::cpp::span<char> destination) noexcept
+{
+    constexpr std::uint32_t kBitsPerNibble{4U};
+    constexpr std::uint32_t kNibbleMask{0x0FU};
+    const auto destination_size = static_cast<std::size_t>(destination.size());
+    std::size_t length{0U};
+    for (const char input : data)
+    {
+        if (length >= destination_size)
+        {
+            break;
+        }
+        const auto byte = static_cast<std::uint32_t>(static_cast<std::uint8_t>(input));
+        destination[length] = kHexDigits.at(static_cast<std::size_t>(byte >> kBitsPerNibble));
+        ++length;
+        if (length < destination_size)
+        {
+            destination[length] = kHexDigits.at(static_cast<std::size_t>(byte & kNibbleMask));
+            ++length;
+        }
+    }
+    return length;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NUMBER_FORMATTING_H
+#define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NUMBER_FORMATTING_H
+
+#include "score/span.hpp"
+
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+//  Formatting kernel of the text recorder. All functions write into a caller provided buffer without allocating and
+//  without going through the printf family, the produced text is identical to the printf conversion noted per function.
+//  Every function returns the number of characters written to the beginning of the destination, or 0 if the result
+//  does not fit into the destination.
+
+/// \brief Maximum number of characters of a formatted 64 bit integer (22 octal digits of std::uint64_t).
+constexpr std::size_t kMaxIntegerCharacters{22U};
+
+/// \brief Maximum number of characters produced by FormatFixedPoint(): sign, 20 integer digits, point and 6 decimals.
+constexpr std::size_t kMaxFixedPointCharacters{28U};
+
+/// \brief Same as "%lu".
+std::size_t FormatDecimal(const std::uint64_t value, const score::cpp::span<char> destination) noexcept;
+
+/// \brief Same as "%li".
+std::size_t FormatDecimal(const std::int64_t value, const score::cpp::span<char> destination) noexcept;
+
+/// \brief Same as "%0*lu", value has to fit into number_of_digits digits.
+std::size_t FormatZeroPaddedDecimal(const std::uint64_t value,
+                                    const std::size_t number_of_digits,
+                                    const score::cpp::span<char> destination) noexcept;
+
+/// \brief Same as "%lx".
+std::size_t FormatHex(const std::uint64_t value, const score::cpp::span<char> destination) noexcept;
+
+/// \brief Same as "%lo".
+std::size_t FormatOctal(const std::uint64_t value, const score::cpp::span<char> destination) noexcept;
+
+/// \brief Same as "%f", including the round-half-to-even of the exact binary value.
+/// \details Only finite values with a magnitude below 2^64 are handled, 0 is returned for all others so that the caller
+/// can fall back to std::snprintf for these rare cases.
+std::size_t FormatFixedPoint(const double value, const score::cpp::span<char> destination) noexcept;
+
+/// \brief Same as "%02hhx" per byte of data, stops at the end of the destination.
+/// \details In contrast to the other functions the output is cropped to the size of the destination, thus an odd sized
+/// destination receives only the high nibble of the last byte.
+std::size_t FormatHexBytes(const score::cpp::span<const char> data, const score::cpp::span<char> destination) noexcept;
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NUMBER_FORMATTING_H
@@ -0,0 +1,173 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/number_formatting.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+class NumberFormattingFixture : public ::testing::Test
+{
+  protected:
+    std::string Text(const std::size_t length) const
+    {
+        return std::string{characters_.data(), length};
+    }
+
+    static std::string Printf(const char* const format, const double value)
+    {
+        std::array<char, 512U> reference{};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) reference output of the replaced implementation
+        std::ignore = std::snprintf(reference.data(), reference.size(), format, value);
+        return std::string{reference.data()};
+    }
+
+    std::array<char, kMaxFixedPointCharacters> characters_{};
+};
+
+TEST_F(NumberFormattingFixture, DecimalShallCoverTheFullRangeOfSixtyFourBitIntegers)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies decimal formatting of the limits of signed and unsigned 64 bit integers.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    EXPECT_EQ(Text(FormatDecimal(std::uint64_t{0U}, characters_)), "0");
+    EXPECT_EQ(Text(FormatDecimal(std::numeric_limits<std::uint64_t>::max(), characters_)), "18446744073709551615");
+    EXPECT_EQ(Text(FormatDecimal(std::int64_t{-7}, characters_)), "-7");
+    EXPECT_EQ(Text(FormatDecimal(std::numeric_limits<std::int64_t>::min(), characters_)), "-9223372036854775808");
+    EXPECT_EQ(Text(FormatDecimal(std::numeric_limits<std::int64_t>::max(), characters_)), "9223372036854775807");
+}
+
+TEST_F(NumberFormattingFixture, ZeroPaddedDecimalShallFillLeadingDigitsWithZero)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies zero padded decimal formatting and rejection of values that do not fit.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    EXPECT_EQ(Text(FormatZeroPaddedDecimal(7U, 2U, characters_)), "07");
+    EXPECT_EQ(Text(FormatZeroPaddedDecimal(4321U, 6U, characters_)), "004321");
+    EXPECT_EQ(FormatZeroPaddedDecimal(100U, 2U, characters_), 0U);
+}
+
+TEST_F(NumberFormattingFixture, HexAndOctalShallMatchPrintf)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies hexadecimal and octal formatting of the unsigned 64 bit limits.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    EXPECT_EQ(Text(FormatHex(std::uint64_t{0U}, characters_)), "0");
+    EXPECT_EQ(Text(FormatHex(std::numeric_limits<std::uint64_t>::max(), characters_)), "ffffffffffffffff");
+    EXPECT_EQ(Text(FormatOctal(std::uint64_t{0U}, characters_)), "0");
+    EXPECT_EQ(Text(FormatOctal(std::numeric_limits<std::uint64_t>::max(), characters_)), "1777777777777777777777");
+}
+
+TEST_F(NumberFormattingFixture, TooSmallDestinationShallNotBeWritten)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that no conversion writes beyond the given destination.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const score::cpp::span<char> two_characters{characters_.data(), 2U};
+
+    EXPECT_EQ(FormatDecimal(std::uint64_t{123U}, two_characters), 0U);
+    EXPECT_EQ(FormatDecimal(std::int64_t{-12}, two_characters), 0U);
+    EXPECT_EQ(FormatHex(std::uint64_t{0x123U}, two_characters), 0U);
+    EXPECT_EQ(FormatOctal(std::uint64_t{0123U}, two_characters), 0U);
+    EXPECT_EQ(FormatFixedPoint(1.0, two_characters), 0U);
+}
+
+TEST_F(NumberFormattingFixture, FixedPointShallMatchPrintfIncludingRounding)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that fixed point formatting produces the same text as \"%f\", including the rounding of "
+                   "the exact binary value half to even.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const std::array<double, 14U> values{0.0,
+                                         -0.0,
+                                         1.23,
+                                         -1.23,
+                                         0.1,
+                                         123.4567895,
+                                         9.9999995,
+                                         0.0000005,
+                                         0.0000015,
+                                         -0.0000001,
+                                         1e-320,
+                                         static_cast<double>(1.23F),
+                                         4503599627370495.5,
+                                         18446744073709549568.0};
+    for (const auto value : values)
+    {
+        EXPECT_EQ(Text(FormatFixedPoint(value, characters_)), Printf("%f", value)) << "for value " << value;
+    }
+}
+
+TEST_F(NumberFormattingFixture, FixedPointShallLeaveUnsupportedValuesToTheCaller)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that values that are not finite or too large are not formatted.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    EXPECT_EQ(FormatFixedPoint(std::numeric_limits<double>::quiet_NaN(), characters_), 0U);
+    EXPECT_EQ(FormatFixedPoint(std::numeric_limits<double>::infinity(), characters_), 0U);
+    EXPECT_EQ(FormatFixedPoint(18446744073709551616.0, characters_), 0U);
+}
+
+TEST_F(NumberFormattingFixture, HexBytesShallBeCroppedToTheDestination)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that bytes are converted to two hex characters each and cropped at nibble granularity.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const std::array<char, 3U> data{'\x01', '\xAB', '\xF0'};
+
+    EXPECT_EQ(Text(FormatHexBytes(data, characters_)), "01abf0");
+    EXPECT_EQ(Text(FormatHexBytes(data, score::cpp::span<char>{characters_.data(), 3U})), "01a");
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -24,66 +24,77 @@ namespace detail
 {
 
 SlotDrainer::SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
-                         std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                         std::shared_ptr<MpscRingBuffer<LogRecord>> allocator,
                          const std::int32_t file_descriptor,
-                         score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
+                         score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
                          const std::size_t limit_slots_in_one_cycle)
     : allocator_(allocator),
       message_builder_(std::move(message_builder)),
-      non_blocking_writer_(file_descriptor, NonBlockingWriter::GetMaxChunkSize(), std::move(unistd)),
+      number_of_gathered_slots_{0U},
+      current_message_complete_{true},
+      pending_span_{},
+      non_blocking_writer_(file_descriptor, std::move(sys_uio)),
       limit_slots_in_one_cycle_(limit_slots_in_one_cycle)
 {
 }
 
-bool SlotDrainer::MoreSpansAvailableAndLoaded() noexcept
+bool SlotDrainer::GatherSpansOfCurrentMessage() noexcept
 {
-    //  remaining span flushed, try next span:
-    const auto span = message_builder_->GetNextSpan();
-    if (span.has_value())
+    while (!current_message_complete_)
     {
-        non_blocking_writer_.SetSpan(span.value());
-        return true;
+        const auto span = message_builder_->GetNextSpan();
+        if (!span.has_value())
+        {
+            current_message_complete_ = true;
+        }
+        else if (!non_blocking_writer_.AddSpan(span.value()))
+        {
+            //  Batch is full, the span is added to the next batch:
+            pending_span_ = span;
+            return false;
+        }
     }
-    return false;
+    return true;
 }
 
-score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> SlotDrainer::TryFlushSpans() noexcept
+bool SlotDrainer::GatherSpans(const std::size_t limit_slots) noexcept
 {
-    do
+    //  The batch is empty at this point, so the span left over from the previous batch always fits:
+    if (pending_span_.has_value() && non_blocking_writer_.AddSpan(pending_span_.value()))
     {
-        //  First try to flush remaining data from previous cycle:
-        const auto status = non_blocking_writer_.FlushIntoFile();
-        if (status.has_value())
-        {
-            if (status.value() != NonBlockingWriter::Result::kDone)
-            {
-                return FlushResult::kPartiallyProcessed;
-            }
-        }
-        else
+        pending_span_.reset();
+    }
+
+    while (GatherSpansOfCurrentMessage() && (number_of_gathered_slots_ < limit_slots))
+    {
+        //  Slots are only released once written, so the next slot is located behind all gathered ones:
+        const auto slot = allocator_->AcquireSlotToRead(number_of_gathered_slots_);
+        if (!slot.has_value())
         {
-            return score::cpp::make_unexpected(status.error());
+            break;
         }
-    } while (MoreSpansAvailableAndLoaded());
-
-    return FlushResult::kAllDataProcessed;  //  no more entries
+        message_builder_->SetNextMessage(allocator_->GetUnderlyingBufferFor(slot.value()));
+        ++number_of_gathered_slots_;
+        current_message_complete_ = false;
+    }
+    return number_of_gathered_slots_ > 0U;
 }
 
-bool SlotDrainer::MoreSlotsAvailableAndLoaded() noexcept
+std::size_t SlotDrainer::ReleaseWrittenSlots() noexcept
 {
-    if (circular_buffer_.empty())
+    //  The slot of a message whose spans did not fit into the batch completely must not be returned yet:
+    const std::size_t number_of_written_slots =
+        current_message_complete_ ? number_of_gathered_slots_ : (number_of_gathered_slots_ - 1U);
+    for (std::size_t count{0U}; count < number_of_written_slots; ++count)
     {
-        return false;
+        const auto slot = allocator_->AcquireSlotToRead();
+        if (slot.has_value())
+        {
+            allocator_->ReleaseReadSlot(slot.value());
+        }
     }
-    const auto& reference_to_slot = circular_buffer_.front();
-    circular_buffer_.pop_front();
-    current_slot_ = reference_to_slot;
-
-    //  Casting to more capable integer type:
-    auto& underlying_data =
-        allocator_->GetUnderlyingBufferFor(static_cast<std::size_t>(reference_to_slot.GetSlotOfSelectedRecorder()));
-    message_builder_->SetNextMessage(underlying_data);
-    return true;
+    number_of_gathered_slots_ -= number_of_written_slots;
+    return number_of_written_slots;
 }
 
 score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> SlotDrainer::TryFlushSlots() noexcept
@@ -91,46 +102,38 @@ score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> Sl
     std::size_t number_of_processed_slots = 0U;
     do
     {
-        const auto status = TryFlushSpans();
-        if ((!status.has_value()) || (FlushResult::kPartiallyProcessed == status.value()))
+        //  First try to flush remaining data from previous cycle:
+        const auto status = non_blocking_writer_.FlushIntoFile();
+        if (!status.has_value())
         {
-            //  error or "would block" -> return error or 'false'.
-            return status;
+            return score::cpp::make_unexpected(status.error());
         }
-        //  slot is flushed, try next one:
-        if (current_slot_.has_value())  // manually release slot
+        if (status.value() != NonBlockingVectoredWriter::Result::kDone)
         {
-            //  Casting to more capable integer type:
-            allocator_->ReleaseSlot(static_cast<std::size_t>(current_slot_.value().get().GetSlotOfSelectedRecorder()));
-            current_slot_.reset();
+            return FlushResult::kPartiallyProcessed;
         }
 
-        if (number_of_processed_slots > limit_slots_in_one_cycle_)
+        //  batch is written, return its slots to the producers:
+        number_of_processed_slots += ReleaseWrittenSlots();
+        if (number_of_processed_slots >= limit_slots_in_one_cycle_)
         {
             return FlushResult::kNumberOfProcessedSlotsExceeded;
         }
-        ++number_of_processed_slots;
-    } while (MoreSlotsAvailableAndLoaded());
+    } while (GatherSpans(limit_slots_in_one_cycle_ - number_of_processed_slots));
 
     return FlushResult::kAllDataProcessed;
 }
 
-void SlotDrainer::PushBack(const SlotHandle& slot) noexcept
-{
-    const std::lock_guard<std::mutex> lock(context_mutex_);
-    circular_buffer_.push_back(slot);
-}
-
-void SlotDrainer::Flush() noexcept
+score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> SlotDrainer::Flush() noexcept
 {
     const std::lock_guard<std::mutex> lock(context_mutex_);
-    std::ignore = TryFlushSlots();
+    return TryFlushSlots();
 }
 
 SlotDrainer::~SlotDrainer()
 {
     //  Try to flush residual data:
-    Flush();
+    std::ignore = Flush();
 }
 
 }  // namespace detail
@@ -13,13 +13,12 @@
 #ifndef SCORE_MW_LOG_DETAIL_TEXT_RECORDER_SLOT_DRAINER_H
 #define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_SLOT_DRAINER_H
 
-#include "score/mw/log/detail/circular_allocator.h"
 #include "score/mw/log/detail/log_record.h"
+#include "score/mw/log/detail/mpsc_ring_buffer.h"
 #include "score/mw/log/detail/text_recorder/imessage_builder.h"
-#include "score/mw/log/detail/text_recorder/non_blocking_writer.h"
+#include "score/mw/log/detail/text_recorder/non_blocking_vectored_writer.h"
 #include "score/mw/log/slot_handle.h"
 
-#include <score/circular_buffer.hpp>
 #include <score/span.hpp>
 
 #include <memory>
@@ -34,6 +33,11 @@ namespace log
 namespace detail
 {
 
+/// \brief Consumer of the slots published into a MpscRingBuffer.
+///
+/// \details Slots are drained in the order they were acquired by the producers. The spans of up to
+/// limit_slots_in_one_cycle messages are gathered into a single writev() system call. Thus every slot is only returned
+/// to the producers once the whole batch it belongs to was written, since the spans point into the slot memory.
 class SlotDrainer
 {
   public:
@@ -44,9 +48,9 @@ class SlotDrainer
         kNumberOfProcessedSlotsExceeded,
     };
     SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
-                std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                std::shared_ptr<MpscRingBuffer<LogRecord>> allocator,
                 const std::int32_t file_descriptor,
-                score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
+                score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
                 const std::size_t limit_slots_in_one_cycle = 32UL);
 
     SlotDrainer(SlotDrainer&&) noexcept = delete;
@@ -54,28 +58,29 @@ class SlotDrainer
     SlotDrainer& operator=(SlotDrainer&&) noexcept = delete;
     SlotDrainer& operator=(const SlotDrainer&) noexcept = delete;
 
-    void PushBack(const SlotHandle& slot) noexcept;
-    void Flush() noexcept;
+    /// \brief Writes all published slots until the writer would block or the slot limit per cycle is reached.
+    /// \return kNumberOfProcessedSlotsExceeded if further slots could be written right away.
+    score::cpp::expected<FlushResult, score::mw::log::detail::Error> Flush() noexcept;
 
     ~SlotDrainer();
 
   private:
     score::cpp::expected<FlushResult, score::mw::log::detail::Error> TryFlushSlots() noexcept;
-    score::cpp::expected<FlushResult, score::mw::log::detail::Error> TryFlushSpans() noexcept;
-    bool MoreSlotsAvailableAndLoaded() noexcept;
-    bool MoreSpansAvailableAndLoaded() noexcept;
+    bool GatherSpans(const std::size_t limit_slots) noexcept;
+    bool GatherSpansOfCurrentMessage() noexcept;
+    std::size_t ReleaseWrittenSlots() noexcept;
 
-    std::shared_ptr<CircularAllocator<LogRecord>> allocator_;
+    std::shared_ptr<MpscRingBuffer<LogRecord>> allocator_;
     std::unique_ptr<IMessageBuilder> message_builder_;
+    //  Ensures that only a single consumer reads from allocator_ at a time:
     std::mutex context_mutex_;
-    // used in circular_buffer_ declaration
-    // coverity[autosar_cpp14_a0_1_1_violation : FALSE]
-    static constexpr std::size_t kMaxCircularBufferSize = 1024UL;
-    //  TODO: assert size of circular_buffer:
-    score::cpp::circular_buffer<SlotHandle, kMaxCircularBufferSize> circular_buffer_;
-    //  To manually release resource and to set and reset access:
-    score::cpp::optional<std::reference_wrapper<const SlotHandle>> current_slot_;
-    NonBlockingWriter non_blocking_writer_;
+    //  Number of slots whose spans were handed to the writer but which are not yet returned to the producers:
+    std::size_t number_of_gathered_slots_;
+    //  False while the message builder still has spans of the last gathered slot:
+    bool current_message_complete_;
+    //  Span that did not fit into the last batch anymore:
+    score::cpp::optional<score::cpp::span<const std::uint8_t>> pending_span_;
+    NonBlockingVectoredWriter non_blocking_writer_;
     const std::size_t limit_slots_in_one_cycle_;
 };
 
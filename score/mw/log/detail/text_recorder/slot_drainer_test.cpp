@@ -12,9 +12,9 @@
  ********************************************************************************/
 #include "score/mw/log/detail/text_recorder/slot_drainer.h"
 
-#include "score/os/mocklib/unistdmock.h"
 #include "score/mw/log/detail/error.h"
 #include "score/mw/log/detail/text_recorder/mock/message_builder_mock.h"
+#include "score/os/mocklib/sys_uio_mock.h"
 
 #include "gtest/gtest.h"
 
@@ -45,10 +45,10 @@ class SlotDrainerFixture : public ::testing::Test
   public:
     void SetUp() override
     {
-        unistd_ptr_ = score::cpp::pmr::make_unique<score::os::UnistdMock>(score::cpp::pmr::get_default_resource());
-        unistd_mock_ = unistd_ptr_.get();
+        sys_uio_ptr_ = score::cpp::pmr::make_unique<score::os::SysUioMock>(score::cpp::pmr::get_default_resource());
+        sys_uio_mock_ = sys_uio_ptr_.get();
 
-        allocator_ = std::make_unique<CircularAllocator<LogRecord>>(pool_size_);
+        allocator_ = std::make_unique<MpscRingBuffer<LogRecord>>(pool_size_);
 
         message_builder_mock_ = std::make_unique<mock::MessageBuilderMock>();
 
@@ -58,15 +58,25 @@ class SlotDrainerFixture : public ::testing::Test
     void TearDown() override {}
 
   private:
-    const std::uint8_t pool_size_ = 8;  //  arbitrary size of circular allocator
+    const std::uint8_t pool_size_ = 8;  //  arbitrary size of ring buffer
 
   protected:
+    void PublishSlots(const std::size_t number_of_slots) noexcept
+    {
+        for (std::size_t i = 0; i < number_of_slots; i++)
+        {
+            const auto slot = allocator_->AcquireSlotToWrite();
+            ASSERT_TRUE(slot.has_value());
+            allocator_->ReleaseSlot(slot.value());
+        }
+    }
+
     const std::uint8_t data_table_[64] = {};  //  some memory used in test
 
-    score::cpp::pmr::unique_ptr<::score::os::UnistdMock> unistd_ptr_{};
-    ::score::os::UnistdMock* unistd_mock_{};
+    score::cpp::pmr::unique_ptr<::score::os::SysUioMock> sys_uio_ptr_{};
+    ::score::os::SysUioMock* sys_uio_mock_{};
     std::unique_ptr<IMessageBuilder> message_builder_ = nullptr;
-    std::shared_ptr<CircularAllocator<LogRecord>> allocator_ = nullptr;
+    std::shared_ptr<MpscRingBuffer<LogRecord>> allocator_ = nullptr;
     std::int32_t file_descriptor_ = 23;  //  random number file descriptor
     std::unique_ptr<mock::MessageBuilderMock> message_builder_mock_ = nullptr;
     mock::MessageBuilderMock* raw_message_builder_mock_ = nullptr;
@@ -81,58 +91,73 @@ TEST_F(SlotDrainerFixture, TestOneWriteFileFailurePath)
 
     //  Given write file error
     SlotDrainer unit(
-        std::move(message_builder_), allocator_, file_descriptor_, std::move(unistd_ptr_), kLimitSlotsInOneCycle);
+        std::move(message_builder_), allocator_, file_descriptor_, std::move(sys_uio_ptr_), kLimitSlotsInOneCycle);
 
     EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))  //  first unitialized
-        .WillOnce(
-            Return(score::cpp::span<const std::uint8_t>(data_table_, sizeof(data_table_))));  //  actual data to be written
+        .WillOnce(Return(SpanData(data_table_, sizeof(data_table_))))  //  actual data to be written
+        .WillRepeatedly(Return(OptionalSpan{}));
 
     EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(Exactly(1));
 
-    EXPECT_CALL(*unistd_mock_, write(file_descriptor_, _, _))
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, _))
         .WillRepeatedly(Return(score::cpp::unexpected<score::os::Error>(score::os::Error::createFromErrno(EIO))));
 
-    const auto slot = allocator_->AcquireSlotToWrite();
-    EXPECT_TRUE(slot.has_value());
+    PublishSlots(1U);
+    const auto result = unit.Flush();
 
-    //  Cast is not harmful because CircullarAllocator object size is within range of uint8_t
-    unit.PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
-    unit.Flush();
+    //  Then the error is reported and the slot is kept for a retry
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(allocator_->GetUsedCount(), 1U);
 }
 
 TEST_F(SlotDrainerFixture, IncompleteWriteFileShouldMakeFlushSpansReturnWouldBlock)
 {
     RecordProperty("ASIL", "B");
-    RecordProperty("Description", "If write not completed, the Flush API would wait till flushing is complete.");
+    RecordProperty("Description",
+                   "If write not completed, Flush shall report partial processing and resume behind the last written "
+                   "byte on the next call.");
     RecordProperty("TestType", "interface-test");
     RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
 
-    //  Given write file error
+    //  Given a writer that accepts only a single byte per call
     SlotDrainer unit(
-        std::move(message_builder_), allocator_, file_descriptor_, std::move(unistd_ptr_), kLimitSlotsInOneCycle);
+        std::move(message_builder_), allocator_, file_descriptor_, std::move(sys_uio_ptr_), kLimitSlotsInOneCycle);
 
     EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))  //  first unitialized
-        .WillOnce(
-            Return(score::cpp::span<const std::uint8_t>(data_table_, sizeof(data_table_))));  //  actual data to be written
+        .WillOnce(Return(SpanData(data_table_, sizeof(data_table_))))  //  actual data to be written
+        .WillRepeatedly(Return(OptionalSpan{}));
 
     EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(Exactly(1));
 
-    EXPECT_CALL(*unistd_mock_, write(file_descriptor_, _, _))
-        .WillOnce([](int, const void*, size_t) {
-            return 1;
-        })
-        .WillOnce([](int, const void*, size_t) {
+    ::testing::InSequence sequence{};
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 1))
+        .WillOnce([this](std::int32_t, const struct iovec* iov, std::int32_t) {
+            EXPECT_EQ(iov->iov_base, &data_table_[0]);
+            EXPECT_EQ(iov->iov_len, sizeof(data_table_));
             return 1;
         });
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 1))
+        .WillOnce([this](std::int32_t, const struct iovec* iov, std::int32_t) {
+            EXPECT_EQ(iov->iov_base, &data_table_[1]);
+            EXPECT_EQ(iov->iov_len, sizeof(data_table_) - 1U);
+            return static_cast<std::int64_t>(sizeof(data_table_) - 1U);
+        });
 
-    const auto slot = allocator_->AcquireSlotToWrite();
-    EXPECT_TRUE(slot.has_value());
+    PublishSlots(1U);
 
-    //  Cast is not harmful because CircullarAllocator object size is within range of uint8_t
-    unit.PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
-    unit.Flush();
+    //  When flushing the first time
+    const auto first_result = unit.Flush();
+
+    //  Then the slot is partially processed and still in use
+    ASSERT_TRUE(first_result.has_value());
+    EXPECT_EQ(first_result.value(), SlotDrainer::FlushResult::kPartiallyProcessed);
+    EXPECT_EQ(allocator_->GetUsedCount(), 1U);
+
+    //  When flushing again, the rest is written and the slot is returned
+    const auto second_result = unit.Flush();
+    ASSERT_TRUE(second_result.has_value());
+    EXPECT_EQ(second_result.value(), SlotDrainer::FlushResult::kAllDataProcessed);
+    EXPECT_EQ(allocator_->GetUsedCount(), 0U);
 }
 
 TEST_F(SlotDrainerFixture, TestOneSlotOneSpan)
@@ -144,29 +169,111 @@ TEST_F(SlotDrainerFixture, TestOneSlotOneSpan)
 
     //  Given one slot flushed
     SlotDrainer unit(
-        std::move(message_builder_), allocator_, file_descriptor_, std::move(unistd_ptr_), kLimitSlotsInOneCycle);
+        std::move(message_builder_), allocator_, file_descriptor_, std::move(sys_uio_ptr_), kLimitSlotsInOneCycle);
 
-    //  Expect sequence of calls to check if any spans from possible previous slots are remaining:
     EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))  //  first unitialized
-        .WillOnce(
-            Return(score::cpp::span<const std::uint8_t>(data_table_, sizeof(data_table_))))  //  actual data to be written
-        .WillOnce(Return(OptionalSpan{}))                                             //  spans depleted in a slot
-        .WillOnce(Return(OptionalSpan{}));                                            //  spans depleted in a slot
+        .WillOnce(Return(SpanData(data_table_, sizeof(data_table_))))  //  actual data to be written
+        .WillRepeatedly(Return(OptionalSpan{}));                       //  spans depleted in a slot
 
     EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(Exactly(1));
 
-    EXPECT_CALL(*unistd_mock_, write(file_descriptor_, data_table_, sizeof(data_table_)))
-        .WillOnce([](int, const void*, size_t) {
-            return sizeof(data_table_);
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 1))
+        .WillOnce([this](std::int32_t, const struct iovec* iov, std::int32_t) {
+            EXPECT_EQ(iov->iov_base, &data_table_[0]);
+            EXPECT_EQ(iov->iov_len, sizeof(data_table_));
+            return static_cast<std::int64_t>(sizeof(data_table_));
+        });
+
+    PublishSlots(1U);
+    unit.Flush();
+}
+
+TEST_F(SlotDrainerFixture, SpansOfSeveralSlotsShallBeWrittenWithSingleSystemCall)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Header and payload spans of all published slots shall be gathered into one writev.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    constexpr std::size_t kNumberOfSlotsQueued = 4UL;
+    constexpr std::size_t kSpansPerSlot = 2UL;
+
+    //  Given four published slots with a header and a payload span each
+    SlotDrainer unit(
+        std::move(message_builder_), allocator_, file_descriptor_, std::move(sys_uio_ptr_), kLimitSlotsInOneCycle);
+
+    std::size_t number_of_spans_of_current_message{0U};
+    EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_))
+        .Times(Exactly(kNumberOfSlotsQueued))
+        .WillRepeatedly([&number_of_spans_of_current_message](LogRecord&) {
+            number_of_spans_of_current_message = 0U;
+        });
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
+        .WillRepeatedly([this, &number_of_spans_of_current_message]() -> OptionalSpan {
+            if (number_of_spans_of_current_message == kSpansPerSlot)
+            {
+                return {};
+            }
+            ++number_of_spans_of_current_message;
+            return SpanData(data_table_, sizeof(data_table_));
         });
 
-    const auto slot = allocator_->AcquireSlotToWrite();
-    EXPECT_TRUE(slot.has_value());
+    //  Expect a single system call for all spans
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, kNumberOfSlotsQueued * kSpansPerSlot))
+        .WillOnce(Return(static_cast<std::int64_t>(kNumberOfSlotsQueued * kSpansPerSlot * sizeof(data_table_))));
 
-    //  Cast is not harmful because CircullarAllocator object size is within range of uint8_t
-    unit.PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
+    PublishSlots(kNumberOfSlotsQueued);
+    const auto result = unit.Flush();
+
+    //  Then all slots are returned to the producers
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), SlotDrainer::FlushResult::kAllDataProcessed);
+    EXPECT_EQ(allocator_->GetUsedCount(), 0U);
+}
+
+TEST_F(SlotDrainerFixture, MessageExceedingBatchCapacityShallContinueInNextBatch)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "If the spans of a message do not fit into one system call, the remaining spans shall be written "
+                   "by the next one and the slot shall only be returned afterwards.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    constexpr std::size_t kNumberOfSpans = NonBlockingVectoredWriter::kMaxNumberOfSpans + 1UL;
+
+    //  Given one published slot with more spans than a batch can hold
+    SlotDrainer unit(
+        std::move(message_builder_), allocator_, file_descriptor_, std::move(sys_uio_ptr_), kLimitSlotsInOneCycle);
+
+    std::size_t number_of_returned_spans{0U};
+    EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(_)).Times(Exactly(1));
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
+        .WillRepeatedly([this, &number_of_returned_spans]() -> OptionalSpan {
+            if (number_of_returned_spans == kNumberOfSpans)
+            {
+                return {};
+            }
+            ++number_of_returned_spans;
+            return SpanData(data_table_, sizeof(data_table_));
+        });
+
+    //  Expect a full batch followed by the remaining span
+    ::testing::InSequence sequence{};
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, NonBlockingVectoredWriter::kMaxNumberOfSpans))
+        .WillOnce([this](std::int32_t, const struct iovec*, std::int32_t) {
+            //  The slot must not be returned while its message is incomplete
+            EXPECT_EQ(allocator_->GetUsedCount(), 1U);
+            return static_cast<std::int64_t>(NonBlockingVectoredWriter::kMaxNumberOfSpans * sizeof(data_table_));
+        });
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 1))
+        .WillOnce(Return(static_cast<std::int64_t>(sizeof(data_table_))));
+
+    PublishSlots(1U);
     unit.Flush();
+
+    //  Then the slot is returned once all spans were written
+    EXPECT_EQ(allocator_->GetUsedCount(), 0U);
 }
 
 TEST_F(SlotDrainerFixture, TestTooManySlotsForSingleCallShallNotBeAbleToFlushAllSlots)
@@ -178,34 +285,60 @@ TEST_F(SlotDrainerFixture, TestTooManySlotsForSingleCallShallNotBeAbleToFlushAll
     RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
 
     constexpr std::size_t kLimitNumberOfSlotsProcessedInOneCall = 2UL;
-    constexpr std::size_t kNumberOfSlotsQueued = 3UL;
-    constexpr std::size_t kNumberOfUnflushedSlots = 1UL;
+    constexpr std::size_t kNumberOfSlotsQueued = 4UL;
+    constexpr std::size_t kNumberOfUnflushedSlots = 2UL;
 
     //  Given SlotDrainer set to limit number of slots processed in one call to:
     SlotDrainer unit(std::move(message_builder_),
                      allocator_,
                      file_descriptor_,
-                     std::move(unistd_ptr_),
+                     std::move(sys_uio_ptr_),
                      kLimitNumberOfSlotsProcessedInOneCall);
 
-    //  Given 3 slots queued due to 'would block' returns:
-    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan)
-        .WillOnce(Return(OptionalSpan{}))  //  first unitialized
-        .WillRepeatedly(Return(OptionalSpan{}));
+    //  Given 4 slots queued due to 'would block' returns:
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
 
-    for (std::size_t i = 0; i < kNumberOfSlotsQueued; i++)
-    {
-        const auto slot = allocator_->AcquireSlotToWrite();
-        EXPECT_TRUE(slot.has_value());
-        unit.PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
-    }
+    PublishSlots(kNumberOfSlotsQueued);
+    const auto result = unit.Flush();
+
+    //  Expectation is that the slots beyond the limit are left unflushed:
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), SlotDrainer::FlushResult::kNumberOfProcessedSlotsExceeded);
+    EXPECT_EQ(allocator_->GetUsedCount(), kNumberOfUnflushedSlots);
+}
+
+TEST_F(SlotDrainerFixture, FlushShallDrainPublishedSlotsInOrderAndReturnThemToProducers)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Flush shall drain published slots in acquisition order and return every flushed slot to the "
+                   "producers.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    //  Given two published slots with distinguishable content
+    SlotDrainer unit(
+        std::move(message_builder_), allocator_, file_descriptor_, std::move(sys_uio_ptr_), kLimitSlotsInOneCycle);
+
+    const auto first_slot = allocator_->AcquireSlotToWrite();
+    const auto second_slot = allocator_->AcquireSlotToWrite();
+    ASSERT_TRUE(first_slot.has_value());
+    ASSERT_TRUE(second_slot.has_value());
+    auto& first_record = allocator_->GetUnderlyingBufferFor(first_slot.value());
+    auto& second_record = allocator_->GetUnderlyingBufferFor(second_slot.value());
+    allocator_->ReleaseSlot(second_slot.value());
+    allocator_->ReleaseSlot(first_slot.value());
+
+    //  Expect both messages in acquisition order
+    EXPECT_CALL(*raw_message_builder_mock_, GetNextSpan).WillRepeatedly(Return(OptionalSpan{}));
+    ::testing::InSequence sequence{};
+    EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(::testing::Ref(first_record)));
+    EXPECT_CALL(*raw_message_builder_mock_, SetNextMessage(::testing::Ref(second_record)));
 
-    const auto slot = allocator_->AcquireSlotToWrite();
-    unit.PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
     unit.Flush();
 
-    //  Expectation is that one slot is left unflushed:
-    EXPECT_EQ(allocator_->GetUsedCount(), kNumberOfUnflushedSlots);
+    //  Then all slots are available for producers again
+    EXPECT_EQ(allocator_->GetUsedCount(), 0U);
 }
 
 }  // namespace
@@ -13,7 +13,6 @@
 #include "score/mw/log/detail/text_recorder/text_format.h"
 
 #include <array>
-#include <iomanip>
 
 namespace score
 {
@@ -24,11 +23,67 @@ namespace log
 namespace detail
 {
 
+namespace
+{
+
+constexpr std::int64_t kTmYearOffset{1900};
+constexpr std::int32_t kTmMonthOffset{1};
+
+/// \brief Date and time part of the timestamp of one second in the format "%Y/%m/%d %H:%M:%S.".
+struct TimestampPrefix
+{
+    std::time_t second;
+    std::array<Byte, kMaxTimestampPrefixCharacters> characters;
+    std::size_t length;  // 0 as long as no prefix was formatted.
+};
+
+std::size_t FormatTimestampPrefix(const struct tm& time, const score::cpp::span<Byte> destination) noexcept
+{
+    constexpr std::size_t kTwoDigits{2U};
+    std::size_t length = FormatDecimal(static_cast<std::int64_t>(time.tm_year) + kTmYearOffset, destination);
+    const auto put_separator = [&length, destination](const Byte separator) noexcept {
+        destination[static_cast<score::cpp::span<Byte>::size_type>(length)] = separator;
+        ++length;
+    };
+    const auto put_two_digits = [&length, destination](const std::int32_t value) noexcept {
+        length += FormatZeroPaddedDecimal(static_cast<std::uint64_t>(value), kTwoDigits, destination.subspan(length));
+    };
+
+    put_separator('/');
+    put_two_digits(time.tm_mon + kTmMonthOffset);
+    put_separator('/');
+    put_two_digits(time.tm_mday);
+    put_separator(' ');
+    put_two_digits(time.tm_hour);
+    put_separator(':');
+    put_two_digits(time.tm_min);
+    put_separator(':');
+    put_two_digits(time.tm_sec);
+    put_separator('.');
+    return length;
+}
+
+}  // namespace
+
 std::size_t GetSpanSizeCasted(const score::cpp::span<Byte> buffer) noexcept
 {
     return GetBufferSizeCasted(buffer.size());
 }
 
+std::size_t PutFormattedCharacters(const score::cpp::span<const Byte> characters,
+                                   score::cpp::span<Byte> buffer) noexcept
+{
+    if (buffer.empty())
+    {
+        return 0UL;
+    }
+    //  Same cropping as of std::snprintf: the last byte of the buffer is always reserved for the separating space.
+    const auto length = std::min(GetBufferSizeCasted(characters.size()), GetSpanSizeCasted(buffer) - 1U);
+    std::ignore = std::copy_n(characters.begin(), length, buffer.begin());
+    buffer[static_cast<score::cpp::span<Byte>::size_type>(length)] = ' ';
+    return length + kReserveSpaceForSpace;
+}
+
 std::size_t FormattingFunctionReturnCast(const std::int32_t i) noexcept
 {
     if (i > 0)
@@ -76,51 +131,41 @@ std::size_t TextFormat::PutLogRawBufferData(const LogRawBuffer& data, score::cpp
     {
         return 0UL;
     }
-    const auto destination_begin_reference = buffer.begin();
-    const auto destination_end_reference = buffer.end();
-    auto destination_iterator = destination_begin_reference;
-    std::ignore = std::for_each(
-        data.begin(), data.end(), [&destination_iterator, destination_end_reference = buffer.end()](const auto input) {
-            if (destination_iterator != destination_end_reference)
-            {
-                std::array<char, 3> temporary_formatting_buffer{};
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) safe to use std::snprintf
-                std::ignore = std::snprintf(
-                    temporary_formatting_buffer.begin(), temporary_formatting_buffer.size(), "%02hhx", input);
-                //  Take first two characters from temporary formatting buffer:
-                destination_iterator = std::copy_n(temporary_formatting_buffer.begin(), 2, destination_iterator);
-            }
-        });
-    if (destination_iterator != destination_end_reference)
+    auto length = FormatHexBytes(data, buffer);
+    if (length < GetSpanSizeCasted(buffer))
     {
-        constexpr std::array<char, 1UL> kSpace({' '});
-        destination_iterator = std::copy(kSpace.begin(), kSpace.end(), destination_iterator);
+        buffer[static_cast<score::cpp::span<Byte>::size_type>(length)] = ' ';
+        length += kReserveSpaceForSpace;
     }
-    return static_cast<std::size_t>(std::distance(destination_begin_reference, destination_iterator));
+    return length;
 }
 
 std::size_t TextFormat::PutFormattedTimeData(const std::time_t& time_point, score::cpp::span<Byte> buffer) noexcept
 {
-    std::size_t total = 0U;
-    struct tm time_structure_buffer{};
-    const struct tm* const time_structure =
-        localtime_r(&time_point, &time_structure_buffer);  // LCOV_EXCL_BR_LINE: there are no branches to be covered.
-
-    if (nullptr != time_structure)  // LCOV_EXCL_BR_LINE: "nullptr" condition can't be controlled via test case.
+    //  Only the first record of every second pays for localtime_r() and the conversion, all others copy the prefix
+    //  that this thread formatted last. Being thread local the cache needs no synchronization.
+    thread_local TimestampPrefix cached_prefix{};
+    if ((cached_prefix.length == 0U) || (cached_prefix.second != time_point))
     {
-        const std::size_t buffer_space = GetSpanSizeCasted(buffer);
-
-        std::stringstream ss_time_str;
-        ss_time_str << std::put_time(&time_structure_buffer, "%Y/%m/%d %H:%M:%S.");
-        const std::string& time_str = ss_time_str.str();
+        struct tm time_structure_buffer{};
+        // LCOV_EXCL_BR_START: there are no branches to be covered.
+        const struct tm* const time_structure = localtime_r(&time_point, &time_structure_buffer);
+        // LCOV_EXCL_BR_STOP
 
-        if (buffer_space > time_str.length())
+        if (nullptr == time_structure)  // LCOV_EXCL_BR_LINE: "nullptr" condition can't be controlled via test case.
         {
-            std::ignore = std::copy(time_str.begin(), time_str.end(), buffer.begin());
-            total = time_str.length();
+            return 0U;
         }
+        cached_prefix.length = FormatTimestampPrefix(time_structure_buffer, cached_prefix.characters);
+        cached_prefix.second = time_point;
     }
 
+    std::size_t total = 0U;
+    if (GetSpanSizeCasted(buffer) > cached_prefix.length)
+    {
+        std::ignore = std::copy_n(cached_prefix.characters.begin(), cached_prefix.length, buffer.begin());
+        total = cached_prefix.length;
+    }
     return total;
 }
 
@@ -14,6 +14,7 @@
 #define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_TEXT_FORMAT_H
 
 #include "score/mw/log/detail/integer_representation.h"
+#include "score/mw/log/detail/text_recorder/number_formatting.h"
 #include "score/mw/log/log_types.h"
 
 #include "score/memory/string_literal.h"
@@ -21,12 +22,12 @@
 #include "score/span.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
-#include <sstream>
 #include <string_view>
 #include <type_traits>
 
@@ -44,9 +45,14 @@ using Byte = char;
 //  Visibility of this funcation is extended because of coverage requirement
 std::size_t FormattingFunctionReturnCast(const std::int32_t i) noexcept;
 std::size_t GetSpanSizeCasted(const score::cpp::span<Byte> buffer) noexcept;
+//  Copies the characters of a formatted value followed by a space, crops the characters if the buffer is too small
+std::size_t PutFormattedCharacters(const score::cpp::span<const Byte> characters,
+                                   score::cpp::span<Byte> buffer) noexcept;
 
 constexpr size_t kNumberOfBitsInByte = 8U;
 constexpr size_t kReserveSpaceForSpace = 1U;
+//  Enough for "YYYY/MM/DD HH:MM:SS." with any year that fits into struct tm.
+constexpr size_t kMaxTimestampPrefixCharacters = 32U;
 
 template <typename T>
 std::size_t GetBufferSizeCasted(T buffer_size) noexcept
@@ -63,7 +69,8 @@ struct GetFormatSpecifier
 {
 };
 
-//  to reuse the same mechanism and not to overcompilicate the code with additional template complexity,
+//  Format strings are only left for the floating point values the formatting kernel does not handle (see FormatNumber).
+//  To reuse the same mechanism and not to overcompilicate the code with additional template complexity,
 //  IntegerRepresentation is still used for float and double types:
 template <>
 struct GetFormatSpecifier<const float, IntegerRepresentation::kDecimal>
@@ -77,125 +84,70 @@ struct GetFormatSpecifier<const double, IntegerRepresentation::kDecimal>
     static constexpr score::StringLiteral kValue = "%f ";
 };
 
-template <>
-struct GetFormatSpecifier<const std::uint8_t, IntegerRepresentation::kHex>
-{
-    static constexpr score::StringLiteral kValue = "%hhx ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint8_t, IntegerRepresentation::kOctal>
-{
-    static constexpr score::StringLiteral kValue = "%hho ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint8_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%hhu ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint16_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%hu ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint16_t, IntegerRepresentation::kHex>
-{
-    static constexpr score::StringLiteral kValue = "%hx ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint16_t, IntegerRepresentation::kOctal>
+/// \brief Converts data with the formatting kernel, returns 0 if the value has to be formatted with std::snprintf.
+template <IntegerRepresentation i, typename T>
+std::size_t FormatNumber(const T data, const score::cpp::span<Byte> characters) noexcept
 {
-    static constexpr score::StringLiteral kValue = "%ho ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint32_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%u ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint32_t, IntegerRepresentation::kHex>
-{
-    static constexpr score::StringLiteral kValue = "%x ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint32_t, IntegerRepresentation::kOctal>
-{
-    static constexpr score::StringLiteral kValue = "%o ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint64_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%lu ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint64_t, IntegerRepresentation::kHex>
-{
-    static constexpr score::StringLiteral kValue = "%lx ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint64_t, IntegerRepresentation::kOctal>
-{
-    static constexpr score::StringLiteral kValue = "%lo ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int8_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%hhi ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int16_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%hi ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int32_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%i ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int64_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr score::StringLiteral kValue = "%li ";
-};
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return FormatFixedPoint(static_cast<double>(data), characters);
+    }
+    else if constexpr (i == IntegerRepresentation::kHex)
+    {
+        return FormatHex(static_cast<std::uint64_t>(data), characters);
+    }
+    else if constexpr (i == IntegerRepresentation::kOctal)
+    {
+        return FormatOctal(static_cast<std::uint64_t>(data), characters);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return FormatDecimal(static_cast<std::int64_t>(data), characters);
+    }
+    else
+    {
+        return FormatDecimal(static_cast<std::uint64_t>(data), characters);
+    }
+}
 
 template <IntegerRepresentation i, typename T, typename PT>
 void PutFormattedNumber(PT& payload, const T data) noexcept
 {
-    std::ignore = payload.Put([&data](score::cpp::span<Byte> buffer) noexcept {
-        if (!buffer.empty())  // LCOV_EXCL_BR_LINE: lcov complains about lots of uncovered branches here, it is not
-                              // convenient/related to this condition.
-        {
-            constexpr score::StringLiteral kFormat = GetFormatSpecifier<const T, i>::kValue;
-            using FormatType = std::conditional_t<std::is_same_v<std::remove_reference_t<T>, float>, double, T>;
-            const auto written =
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) safe to use std::snprintf
-                FormattingFunctionReturnCast(
-                    std::snprintf(buffer.data(), buffer.size(), kFormat, static_cast<FormatType>(data)));
-
-            const std::size_t num_written = std::min(written, buffer.size() - std::size_t{1});
-            buffer.first(num_written + 1U).back() = ' ';
-            return written;
-        }
-        else
-        {
-            return 0UL;
-        }
-    });
+    std::array<Byte, std::max(kMaxIntegerCharacters, kMaxFixedPointCharacters)> characters{};
+    const auto length = FormatNumber<i>(data, characters);
+    if (length > 0U)
+    {
+        //  Reserving only the formatted length avoids growing the payload by its whole remaining capacity:
+        std::ignore = payload.Put(
+            [&characters, length](score::cpp::span<Byte> buffer) noexcept {
+                return PutFormattedCharacters(score::cpp::span<const Byte>{characters.data(), length}, buffer);
+            },
+            length + kReserveSpaceForSpace);
+        return;
+    }
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        //  Only values that are not finite or too large for the formatting kernel end up here:
+        std::ignore = payload.Put([&data](score::cpp::span<Byte> buffer) noexcept {
+            if (!buffer.empty())  // LCOV_EXCL_BR_LINE: lcov complains about lots of uncovered branches here, it is not
+                                  // convenient/related to this condition.
+            {
+                constexpr score::StringLiteral kFormat = GetFormatSpecifier<const T, i>::kValue;
+                const auto written =
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) safe to use std::snprintf
+                    FormattingFunctionReturnCast(
+                        std::snprintf(buffer.data(), buffer.size(), kFormat, static_cast<double>(data)));
+
+                const std::size_t num_written = std::min(written, buffer.size() - std::size_t{1});
+                buffer.first(num_written + 1U).back() = ' ';
+                return written;
+            }
+            else
+            {
+                return 0UL;
+            }
+        });
+    }
 }
 
 template <typename T>
@@ -516,11 +468,19 @@ class TextFormat
     template <typename PT>
     static void PutFormattedTime(PT& payload) noexcept
     {
-        const auto time_point = std::chrono::system_clock::now();
+        PutFormattedTime(payload, std::chrono::system_clock::now());
+    }
+
+    /// \brief Puts time_point formatted like PutFormattedTime(payload), e.g. for records that were taken earlier.
+    template <typename PT>
+    static void PutFormattedTime(PT& payload, const std::chrono::system_clock::time_point time_point) noexcept
+    {
         const auto now = std::chrono::system_clock::to_time_t(time_point);
-        std::ignore = payload.Put([now](const score::cpp::span<Byte> buffer) noexcept {
-            return PutFormattedTimeData(now, buffer);
-        });
+        std::ignore = payload.Put(
+            [now](const score::cpp::span<Byte> buffer) noexcept {
+                return PutFormattedTimeData(now, buffer);
+            },
+            kMaxTimestampPrefixCharacters);
 
         const auto time_elapsed =
             std::chrono::duration_cast<std::chrono::milliseconds>(time_point.time_since_epoch()).count() % 10'000'000;
@@ -0,0 +1,94 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/text_format.h"
+#include "score/mw/log/detail/verbose_payload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kPayloadCapacity{256UL};
+
+/// Formats one argument into a payload that is reset after every iteration, so that only the formatting of the
+/// argument is measured and the payload never runs out of space.
+template <typename Argument>
+void FormatArgument(benchmark::State& state, const Argument argument)
+{
+    ByteVector buffer{};
+    VerbosePayload payload{kPayloadCapacity, buffer};
+    for (auto _ : state)
+    {
+        TextFormat::Log(payload, argument);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+        payload.Reset();
+    }
+}
+
+void FormatTimestamp(benchmark::State& state)
+{
+    ByteVector buffer{};
+    VerbosePayload payload{kPayloadCapacity, buffer};
+    for (auto _ : state)
+    {
+        TextFormat::PutFormattedTime(payload);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+        payload.Reset();
+    }
+}
+
+constexpr std::array<char, 64UL> kRawData{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ."};
+
+BENCHMARK_CAPTURE(FormatArgument, Bool, true);
+BENCHMARK_CAPTURE(FormatArgument, Uint8, std::numeric_limits<std::uint8_t>::max());
+BENCHMARK_CAPTURE(FormatArgument, Uint16, std::numeric_limits<std::uint16_t>::max());
+BENCHMARK_CAPTURE(FormatArgument, Uint32, std::numeric_limits<std::uint32_t>::max());
+BENCHMARK_CAPTURE(FormatArgument, Uint64, std::numeric_limits<std::uint64_t>::max());
+BENCHMARK_CAPTURE(FormatArgument, Int8, std::numeric_limits<std::int8_t>::min());
+BENCHMARK_CAPTURE(FormatArgument, Int16, std::numeric_limits<std::int16_t>::min());
+BENCHMARK_CAPTURE(FormatArgument, Int32, std::numeric_limits<std::int32_t>::min());
+BENCHMARK_CAPTURE(FormatArgument, Int64, std::numeric_limits<std::int64_t>::min());
+BENCHMARK_CAPTURE(FormatArgument, Hex8, LogHex8{0xABU});
+BENCHMARK_CAPTURE(FormatArgument, Hex16, LogHex16{0xABCDU});
+BENCHMARK_CAPTURE(FormatArgument, Hex32, LogHex32{0xABCDEF01U});
+BENCHMARK_CAPTURE(FormatArgument, Hex64, LogHex64{0xABCDEF0123456789U});
+BENCHMARK_CAPTURE(FormatArgument, Bin8, LogBin8{0xABU});
+BENCHMARK_CAPTURE(FormatArgument, Bin16, LogBin16{0xABCDU});
+BENCHMARK_CAPTURE(FormatArgument, Bin32, LogBin32{0xABCDEF01U});
+BENCHMARK_CAPTURE(FormatArgument, Bin64, LogBin64{0xABCDEF0123456789U});
+BENCHMARK_CAPTURE(FormatArgument, Float, -1234.5678F);
+BENCHMARK_CAPTURE(FormatArgument, Double, -12345678.87654321);
+BENCHMARK_CAPTURE(FormatArgument, StringView, std::string_view{"The quick brown fox jumps over the lazy dog"});
+BENCHMARK_CAPTURE(FormatArgument, RawBuffer, LogRawBuffer{kRawData.data(), kRawData.size()});
+BENCHMARK(FormatTimestamp);
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
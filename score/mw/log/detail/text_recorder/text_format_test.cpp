@@ -15,6 +15,9 @@
 
 #include "gtest/gtest.h"
 
+#include <limits>
+#include <string>
+
 namespace score
 {
 namespace mw
@@ -663,6 +666,45 @@ TEST_F(TextFormatFixture, LogDouble)
     EXPECT_EQ(buffer.size(), 9);
 }
 
+TEST_F(TextFormatFixture, LogDoubleBeyondRangeOfFormattingKernel)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that doubles of at least 2^64 are still logged in fixed point format.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    TextFormat::Log(payload, 1e20);
+
+    EXPECT_EQ(std::string(buffer.data(), buffer.size()), "100000000000000000000.000000 ");
+}
+
+TEST_F(TextFormatFixture, LogNegativeFloatInfinity)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that not finite floats are logged in the same way as by printf.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    TextFormat::Log(payload, -std::numeric_limits<float>::infinity());
+
+    EXPECT_EQ(std::string(buffer.data(), buffer.size()), "-inf ");
+}
+
+TEST_F(TextFormatFixture, LogInt64Minimum)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies the minimum value of int64 which has no positive counterpart.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    TextFormat::Log(payload, std::numeric_limits<std::int64_t>::min());
+
+    EXPECT_EQ(std::string(buffer.data(), buffer.size()), "-9223372036854775808 ");
+}
+
 TEST_F(TextFormatFixture, StringValueCorrectlyTransformed)
 {
     RecordProperty("ParentRequirement", "SCR-1633236");
@@ -797,6 +839,24 @@ TEST_F(TextFormatFixture, RawValueZeroLengthBuffer)
     ASSERT_EQ(buffer.size(), 0);
 }
 
+TEST_F(TextFormatFixture, RawValueShallBeCroppedWithinByteIfBufferSizeIsOdd)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies Type-Information for raw value is cropped to the buffer even if only one nibble of a byte "
+                   "fits.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    ByteVector size_three_buffer{};
+    VerbosePayload capacity_three_payload{3, size_three_buffer};
+    std::vector<char> data{{1, 2, 0x1F}};
+    TextFormat::Log(capacity_three_payload, LogRawBuffer{data.data(), 3});
+
+    EXPECT_EQ(std::string(size_three_buffer.data(), size_three_buffer.size()), "010");
+}
+
 TEST_F(TextFormatFixture, RawValueZeroMaxSizeBuffer)
 {
     RecordProperty("ParentRequirement", "SCR-1633236");
@@ -836,6 +896,38 @@ TEST(FormattingFunction, ShallReturnEmptyIfPayloadMaxSizeEqualToZero)
     ASSERT_TRUE(payload.GetSpan().empty());
 }
 
+TEST_F(TextFormatFixture, FormattedTimeShallStartWithDateAndTimeOfDay)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that the timestamp is put as \"YYYY/MM/DD HH:MM:SS.\" followed by the elapsed "
+                   "milliseconds, also if the date and time part is reused from the previous record.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    //  Given two timestamps which most likely share the same second
+    ByteVector second_buffer{};
+    VerbosePayload second_payload{100, second_buffer};
+    TextFormat::PutFormattedTime(payload);
+    TextFormat::PutFormattedTime(second_payload);
+
+    for (const auto* const timestamp : {&buffer, &second_buffer})
+    {
+        const std::string text{timestamp->data(), timestamp->size()};
+        ASSERT_GT(text.size(), 21U);
+        for (const std::size_t separator_index : {4U, 7U})
+        {
+            EXPECT_EQ(text.at(separator_index), '/');
+        }
+        EXPECT_EQ(text.at(10U), ' ');
+        EXPECT_EQ(text.at(13U), ':');
+        EXPECT_EQ(text.at(16U), ':');
+        EXPECT_EQ(text.at(19U), '.');
+        EXPECT_EQ(text.back(), ' ');
+    }
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace detail
@@ -31,7 +31,7 @@ namespace detail
 namespace
 {
 
-constexpr std::size_t kMaxHeaderSize = 512UL;
+constexpr std::size_t kMaxHeaderSize = TextMessageBuilder::kMaxHeaderSize;
 
 void LogLevelToString(VerbosePayload& payload, const LogLevel level) noexcept
 {
@@ -74,9 +74,7 @@ inline std::uint32_t TimeStamp() noexcept
 }  // namespace
 
 TextMessageBuilder::TextMessageBuilder(const std::string_view ecu_id) noexcept
-    : IMessageBuilder(),
-      header_payload_(kMaxHeaderSize, header_memory_),
-      parsing_phase_{ParsingPhase::kHeader},
+    : IMessageBuilder(), parsing_phase_{ParsingPhase::kHeader},
       ecu_id_{ecu_id}
 {
 }
@@ -85,17 +83,20 @@ void TextMessageBuilder::SetNextMessage(LogRecord& log_record) noexcept
 {
     log_record_ = log_record;
 
-    const auto& log_entry = log_record_.value().get().GetLogEntry();
-    detail::TextFormat::PutFormattedTime(header_payload_);
-    detail::TextFormat::Log(header_payload_, TimeStamp());
-    detail::TextFormat::Log(header_payload_, std::string_view{"000"});
-    detail::TextFormat::Log(header_payload_, ecu_id_.GetStringView());
-    detail::TextFormat::Log(header_payload_, log_entry.app_id.GetStringView());
-    detail::TextFormat::Log(header_payload_, log_entry.ctx_id.GetStringView());
-    detail::TextFormat::Log(header_payload_, std::string_view{"log"});
-    LogLevelToString(header_payload_, log_entry.log_level);
-    detail::TextFormat::Log(header_payload_, std::string_view{"verbose"});
-    detail::TextFormat::Log(header_payload_, log_entry.num_of_args);
+    //  The header is stored within the slot, so that its span stays valid until the slot is returned to the producers:
+    auto& log_entry = log_record_.value().get().GetLogEntry();
+    VerbosePayload header_payload{kMaxHeaderSize, log_entry.header_buffer};
+    header_payload.Reset();
+    detail::TextFormat::PutFormattedTime(header_payload);
+    detail::TextFormat::Log(header_payload, TimeStamp());
+    detail::TextFormat::Log(header_payload, std::string_view{"000"});
+    detail::TextFormat::Log(header_payload, ecu_id_.GetStringView());
+    detail::TextFormat::Log(header_payload, log_entry.app_id.GetStringView());
+    detail::TextFormat::Log(header_payload, log_entry.ctx_id.GetStringView());
+    detail::TextFormat::Log(header_payload, std::string_view{"log"});
+    LogLevelToString(header_payload, log_entry.log_level);
+    detail::TextFormat::Log(header_payload, std::string_view{"verbose"});
+    detail::TextFormat::Log(header_payload, log_entry.num_of_args);
     parsing_phase_ = ParsingPhase::kHeader;
 }
 
@@ -113,7 +114,8 @@ score::cpp::optional<score::cpp::span<const std::uint8_t>> TextMessageBuilder::G
     {
         case ParsingPhase::kHeader:
             parsing_phase_ = ParsingPhase::kPayload;
-            return_result = header_payload_.GetSpan();
+            return_result =
+                VerbosePayload{kMaxHeaderSize, log_record_.value().get().GetLogEntry().header_buffer}.GetSpan();
             break;
         case ParsingPhase::kPayload:
             parsing_phase_ = ParsingPhase::kReinitialize;
@@ -121,9 +123,10 @@ score::cpp::optional<score::cpp::span<const std::uint8_t>> TextMessageBuilder::G
             return_result = log_record_.value().get().GetVerbosePayload().GetSpan();
             break;
         case ParsingPhase::kReinitialize:
+            //  Header and payload are not reset here, since the returned spans may still be pending to be written.
+            //  The payload is reset by the producer on the next reservation of the slot, the header on the next
+            //  SetNextMessage().
             parsing_phase_ = ParsingPhase::kHeader;
-            header_payload_.Reset();
-            verbose_payload.Reset();
             log_record_.reset();
             break;
             // LCOV_EXCL_START
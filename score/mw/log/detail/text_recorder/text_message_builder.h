@@ -27,6 +27,9 @@ namespace detail
 class TextMessageBuilder : public IMessageBuilder
 {
   public:
+    /// \brief Capacity of the header buffer of a LogRecord that is needed to build the text header.
+    static constexpr std::size_t kMaxHeaderSize{512UL};
+
     explicit TextMessageBuilder(const std::string_view ecu_id) noexcept;
 
     score::cpp::optional<score::cpp::span<const std::uint8_t>> GetNextSpan() noexcept override;
@@ -41,8 +44,6 @@ class TextMessageBuilder : public IMessageBuilder
         kReinitialize,
     };
     score::cpp::optional<std::reference_wrapper<LogRecord>> log_record_;
-    ByteVector header_memory_;
-    detail::VerbosePayload header_payload_;
     ParsingPhase parsing_phase_;
     LoggingIdentifier ecu_id_;
 };
@@ -12,8 +12,6 @@
  ********************************************************************************/
 #include "score/mw/log/detail/text_recorder/text_recorder.h"
 
-#include "score/mw/log/detail/dlt_argument_counter.h"
-#include "score/mw/log/detail/log_record.h"
 #include "score/mw/log/detail/text_recorder/text_format.h"
 
 namespace score
@@ -25,181 +23,34 @@ namespace log
 namespace detail
 {
 
-namespace
+struct TextRecordFormat
 {
+    static void StartRecord(LogEntry&) noexcept {}
 
-template <typename T>
-inline void GenericLog(const SlotHandle& slot_handle, detail::Backend& backend, const T data) noexcept
-{
-    auto& log_record = backend.GetLogRecord(slot_handle);
-
-    detail::DltArgumentCounter counter{log_record.GetLogEntry().num_of_args};
-    std::ignore = counter.TryAddArgument([data, &log_record]() noexcept {
-        if (log_record.GetVerbosePayload()
-                .RemainingCapacity() >  // LCOV_EXCL_BR_LINE: lcov complains about lots of uncovered branches, it is
-                                        // not convenient/related to this condition.
+    template <typename T>
+    static AddArgumentResult Log(VerbosePayload& payload, const T data) noexcept
+    {
+        if (payload.RemainingCapacity() >  // LCOV_EXCL_BR_LINE: lcov complains about lots of uncovered branches, it
+                                           // is not convenient/related to this condition.
             0U)
         {
-            detail::TextFormat::Log(log_record.GetVerbosePayload(), data);
-            return detail::AddArgumentResult::kAdded;
+            TextFormat::Log(payload, data);
+            return AddArgumentResult::kAdded;
         }
         else
         {
-            return detail::AddArgumentResult::kNotAdded;
+            return AddArgumentResult::kNotAdded;
         }
-    });
-}
-
-inline void SlogGenericLog(const SlotHandle& slot_handle, detail::Backend& backend, const LogSlog2Message data) noexcept
-{
-// QNX-specific recorder
-// coverity[autosar_cpp14_a16_0_1_violation]
-#if defined __QNX__
-    auto& log_record = backend.GetLogRecord(slot_handle);
-    auto& log_entry = log_record.GetLogEntry();
-    log_entry.slog2_code = data.GetCode();
-// QNX-specific recorder
-// coverity[autosar_cpp14_a16_0_1_violation]
-#endif
-
-    GenericLog(slot_handle, backend, data.GetMessage());
-}
+    }
+};
 
-}  //  anonymous namespace
+template class SlotRecorder<TextRecordFormat>;
 
 TextRecorder::TextRecorder(const detail::Configuration& config,
                            std::unique_ptr<detail::Backend> backend,
                            const bool check_log_level_for_console) noexcept
-    : Recorder(),
-      backend_(std::move(backend)),
-      config_(config),
-      check_log_level_for_console_{check_log_level_for_console}
-{
-}
-
-score::cpp::optional<SlotHandle> TextRecorder::StartRecord(const std::string_view context_id,
-                                                    const LogLevel log_level) noexcept
-{
-    if (IsLogEnabled(log_level, context_id) == false)
-    {
-        return {};
-    }
-
-    auto slot_handle = backend_->ReserveSlot();
-    if (slot_handle.has_value())
-    {
-        auto& payload = backend_->GetLogRecord(slot_handle.value());
-        auto& log_entry = payload.GetLogEntry();
-
-        const auto app_id = config_.GetAppId();
-        log_entry.app_id = detail::LoggingIdentifier{app_id};
-        log_entry.ctx_id = detail::LoggingIdentifier{context_id};
-        log_entry.num_of_args = 0U;
-        log_entry.log_level = log_level;
-        payload.GetVerbosePayload().Reset();
-    }
-
-    return slot_handle;
-}
-
-void TextRecorder::StopRecord(const SlotHandle& slot) noexcept
-{
-    backend_->FlushSlot(slot);
-}
-
-bool TextRecorder::IsLogEnabled(const LogLevel& log_level, const std::string_view context) const noexcept
-{
-    return config_.IsLogLevelEnabled(log_level, context, check_log_level_for_console_);
-}
-
-void TextRecorder::Log(const SlotHandle& slot, const bool data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::uint8_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::int8_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::uint16_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::int16_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::uint32_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::int32_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::uint64_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::int64_t data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const float data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const double data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogRawBuffer data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const std::string_view data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogHex8 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogHex16 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogHex32 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogHex64 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogBin8 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogBin16 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogBin32 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-void TextRecorder::Log(const SlotHandle& slot, const LogBin64 data) noexcept
-{
-    GenericLog(slot, *backend_, data);
-}
-
-void TextRecorder::Log(const SlotHandle& slot, const LogSlog2Message data) noexcept
+    : SlotRecorder<TextRecordFormat>(config, std::move(backend), check_log_level_for_console)
 {
-    SlogGenericLog(slot, *backend_, data);
 }
 
 }  // namespace detail
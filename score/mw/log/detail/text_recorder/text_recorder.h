@@ -13,9 +13,7 @@
 #ifndef SCORE_MW_LOG_DETAIL_TEXT_RECORDER_TEXT_RECORDER_H
 #define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_TEXT_RECORDER_H
 
-#include "score/mw/log/configuration/configuration.h"
-#include "score/mw/log/detail/backend.h"
-#include "score/mw/log/recorder.h"
+#include "score/mw/log/detail/slot_recorder.h"
 
 namespace score
 {
@@ -26,7 +24,12 @@ namespace log
 namespace detail
 {
 
-class TextRecorder : public Recorder
+/// \brief Formats the arguments of a TextRecorder as text.
+struct TextRecordFormat;
+
+extern template class SlotRecorder<TextRecordFormat>;
+
+class TextRecorder : public SlotRecorder<TextRecordFormat>
 {
   public:
     TextRecorder(const detail::Configuration& config,
@@ -38,41 +41,6 @@ class TextRecorder : public Recorder
     TextRecorder& operator=(const TextRecorder&) noexcept = delete;
 
     ~TextRecorder() override = default;
-
-    score::cpp::optional<SlotHandle> StartRecord(const std::string_view context_id,
-                                          const LogLevel log_level) noexcept override;
-    void StopRecord(const SlotHandle& slot) noexcept override;
-
-    void Log(const SlotHandle& slot, const bool data) noexcept override;
-    void Log(const SlotHandle& slot, const std::uint8_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::int8_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::uint16_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::int16_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::uint32_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::int32_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::uint64_t data) noexcept override;
-    void Log(const SlotHandle& slot, const std::int64_t data) noexcept override;
-    void Log(const SlotHandle& slot, const float data) noexcept override;
-    void Log(const SlotHandle& slot, const double data) noexcept override;
-    void Log(const SlotHandle& slot, const LogRawBuffer data) noexcept override;
-    void Log(const SlotHandle& slot, const std::string_view data) noexcept override;
-    void Log(const SlotHandle& slot, const LogHex8 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogHex16 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogHex32 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogHex64 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogBin8 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogBin16 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogBin32 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogBin64 data) noexcept override;
-    void Log(const SlotHandle& slot, const LogSlog2Message data) noexcept override;
-
-    bool IsLogEnabled(const LogLevel&, const std::string_view) const noexcept override;
-
-  private:
-    std::unique_ptr<detail::Backend> backend_;
-
-    detail::Configuration config_;
-    bool check_log_level_for_console_;
 };
 
 }  // namespace detail
@@ -13,6 +13,7 @@
 #include "score/mw/log/detail/text_recorder/text_recorder.h"
 
 #include "score/mw/log/detail/backend_mock.h"
+#include "score/mw/log/drop_statistics.h"
 
 #include "gtest/gtest.h"
 
@@ -118,6 +119,26 @@ TEST_F(TextRecorderFixtureWithLogLevelCheck, WillObtainEmptySlotsWhenNoSlotsRese
     EXPECT_FALSE(slot.has_value());
 }
 
+TEST_F(TextRecorderFixtureWithLogLevelCheck, MissingSlotIsCountedAsDropped)
+{
+    RecordProperty("Description", "Records for which the backend has no free slot shall be counted as dropped.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "error-guessing");
+
+    auto backend_mock = std::make_unique<NiceMock<BackendMock>>();
+    ON_CALL(*backend_mock, ReserveSlot()).WillByDefault(Return(score::cpp::optional<SlotHandle>{}));
+    constexpr auto kCheckLogLevelForConsole = true;
+    const auto recorder = std::make_unique<TextRecorder>(config_, std::move(backend_mock), kCheckLogLevelForConsole);
+    const auto dropped_before = GetDropStatistics().no_slot;
+
+    EXPECT_FALSE(recorder->StartRecord(context_id_, kActiveLogLevel).has_value());
+    EXPECT_EQ(GetDropStatistics().no_slot, dropped_before + 1U);
+
+    // Disabled records are not counted
+    EXPECT_FALSE(recorder->StartRecord(context_id_, kInActiveLogLevel).has_value());
+    EXPECT_EQ(GetDropStatistics().no_slot, dropped_before + 1U);
+}
+
 class TextRecorderFixture : public ::testing::Test
 {
   public:
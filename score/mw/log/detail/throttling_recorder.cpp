@@ -0,0 +1,657 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/throttling_recorder.h"
+
+#include "score/mw/log/drop_statistics.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::size_t kMaxNumberOfContexts{128U};
+constexpr std::uint64_t kNanosecondsPerSecond{1'000'000'000U};
+//  Time after which the repetitions of a context are reported if no rate limit is configured:
+constexpr std::uint64_t kDefaultRepetitionTimeoutNsec{kNanosecondsPerSecond};
+
+template <typename... Ts>
+struct TypeList
+{
+};
+
+/// \brief Arguments that are stored as type tag and value. The tag of such an argument is its index in the list.
+using FixedSizeArguments = TypeList<bool,
+                                    std::uint8_t,
+                                    std::int8_t,
+                                    std::uint16_t,
+                                    std::int16_t,
+                                    std::uint32_t,
+                                    std::int32_t,
+                                    std::uint64_t,
+                                    std::int64_t,
+                                    float,
+                                    double,
+                                    LogHex8,
+                                    LogHex16,
+                                    LogHex32,
+                                    LogHex64,
+                                    LogBin8,
+                                    LogBin16,
+                                    LogBin32,
+                                    LogBin64>;
+
+template <typename T, typename... Ts>
+constexpr std::uint8_t TagOf(TypeList<Ts...>) noexcept
+{
+    constexpr std::array<bool, sizeof...(Ts)> kMatches{std::is_same<T, Ts>::value...};
+    std::uint8_t tag{0U};
+    while ((tag < kMatches.size()) && (!kMatches.at(tag)))
+    {
+        ++tag;
+    }
+    return tag;
+}
+
+template <typename... Ts>
+constexpr std::uint8_t NumberOfTypes(TypeList<Ts...>) noexcept
+{
+    return static_cast<std::uint8_t>(sizeof...(Ts));
+}
+
+//  Arguments of variable size are stored as type tag, 16 bit length and data:
+constexpr std::uint8_t kStringTag{NumberOfTypes(FixedSizeArguments{})};
+constexpr std::uint8_t kRawBufferTag{kStringTag + 1U};
+//  Stored as type tag, 16 bit code, 16 bit length and data:
+constexpr std::uint8_t kSlog2MessageTag{kStringTag + 2U};
+
+using LengthType = std::uint16_t;
+
+std::uint64_t NowNanoseconds() noexcept
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+/// \brief FNV-1a, cheap and good enough to tell different messages of one context apart.
+class MessageHash
+{
+  public:
+    void Add(const void* const data, const std::size_t size) noexcept
+    {
+        constexpr std::uint64_t kPrime{0x100000001B3U};
+        const auto* const bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t index{0U}; index < size; ++index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounded by size
+            value_ = (value_ ^ bytes[index]) * kPrime;
+        }
+    }
+
+    /// \brief Never zero, which stands for "no message".
+    std::uint64_t Get() const noexcept
+    {
+        return value_ | 1U;
+    }
+
+  private:
+    std::uint64_t value_{0xCBF29CE484222325U};
+};
+
+template <typename T>
+bool Read(score::cpp::span<const Byte>& data, T& value) noexcept
+{
+    if (static_cast<std::size_t>(data.size()) < sizeof(T))
+    {
+        return false;
+    }
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed for unaligned loads
+    std::ignore = std::memcpy(&value, data.data(), sizeof(T));
+    data = data.subspan(sizeof(T));
+    return true;
+}
+
+bool ReadData(score::cpp::span<const Byte>& data, score::cpp::span<const Byte>& value) noexcept
+{
+    LengthType length{};
+    if ((!Read(data, length)) || (static_cast<std::size_t>(data.size()) < length))
+    {
+        return false;
+    }
+    value = data.first(length);
+    data = data.subspan(length);
+    return true;
+}
+
+template <typename T>
+bool ReplayFixedSize(Recorder& recorder, const SlotHandle& slot, score::cpp::span<const Byte>& data) noexcept
+{
+    T value{};
+    if (!Read(data, value))
+    {
+        return false;
+    }
+    recorder.Log(slot, value);
+    return true;
+}
+
+template <typename... Ts>
+bool ReplayFixedSize(Recorder& recorder,
+                     const SlotHandle& slot,
+                     const std::uint8_t tag,
+                     score::cpp::span<const Byte>& data,
+                     TypeList<Ts...>) noexcept
+{
+    //  Dispatches to the type whose index is tag, the evaluation of || stops there:
+    std::uint8_t index{0U};
+    bool replayed{false};
+    std::ignore = ((tag == index++ ? (replayed = ReplayFixedSize<Ts>(recorder, slot, data), true) : false) || ...);
+    return replayed;
+}
+
+bool ReplayArgument(Recorder& recorder,
+                    const SlotHandle& slot,
+                    const std::uint8_t tag,
+                    score::cpp::span<const Byte>& data) noexcept
+{
+    if (tag < kStringTag)
+    {
+        return ReplayFixedSize(recorder, slot, tag, data, FixedSizeArguments{});
+    }
+
+    std::uint16_t slog_code{};
+    if ((tag == kSlog2MessageTag) && (!Read(data, slog_code)))
+    {
+        return false;
+    }
+    score::cpp::span<const Byte> value{};
+    if (!ReadData(data, value))
+    {
+        return false;
+    }
+    const std::string_view text{value.data(), static_cast<std::size_t>(value.size())};
+    switch (tag)
+    {
+        case kStringTag:
+            recorder.Log(slot, text);
+            return true;
+        case kRawBufferTag:
+            recorder.Log(slot, LogRawBuffer{value.data(), value.size()});
+            return true;
+        case kSlog2MessageTag:
+            recorder.Log(slot, LogSlog2Message{slog_code, text});
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// \brief Appends tag and value if both fit, nothing otherwise, like a VerbosePayload that is full.
+template <typename T>
+void Append(std::vector<Byte>& buffer, std::size_t& size, const T value) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Fixed size arguments are copied with memcpy()");
+    constexpr auto kTag = TagOf<T>(FixedSizeArguments{});
+    static_assert(kTag < kStringTag, "Unsupported argument type");
+    if ((buffer.size() - size) < (sizeof(kTag) + sizeof(T)))
+    {
+        return;
+    }
+    buffer[size] = static_cast<Byte>(kTag);
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed for unaligned stores
+    std::ignore = std::memcpy(&buffer[size + sizeof(kTag)], &value, sizeof(T));
+    size += sizeof(kTag) + sizeof(T);
+}
+
+/// \brief Appends tag, prefix, length and data, where data is cut to the remaining capacity.
+void AppendVariableSize(std::vector<Byte>& buffer,
+                        std::size_t& size,
+                        const std::uint8_t tag,
+                        const score::cpp::span<const Byte> prefix,
+                        const score::cpp::span<const Byte> data) noexcept
+{
+    const std::size_t fixed_size = sizeof(tag) + static_cast<std::size_t>(prefix.size()) + sizeof(LengthType);
+    if ((buffer.size() - size) < fixed_size)
+    {
+        return;
+    }
+    const auto length = static_cast<LengthType>(std::min({static_cast<std::size_t>(data.size()),
+                                                          buffer.size() - size - fixed_size,
+                                                          std::size_t{std::numeric_limits<LengthType>::max()}}));
+    buffer[size] = static_cast<Byte>(tag);
+    std::size_t offset = size + sizeof(tag);
+    // NOLINTBEGIN(score-banned-function) memcpy is needed for unaligned stores
+    std::ignore = std::copy(prefix.begin(), prefix.end(), &buffer[offset]);
+    offset += static_cast<std::size_t>(prefix.size());
+    std::ignore = std::memcpy(&buffer[offset], &length, sizeof(length));
+    offset += sizeof(length);
+    std::ignore = std::copy(data.begin(), data.begin() + length, &buffer[offset]);
+    // NOLINTEND(score-banned-function) memcpy is needed for unaligned stores
+    size = offset + length;
+}
+
+void Append(std::vector<Byte>& buffer, std::size_t& size, const std::string_view value) noexcept
+{
+    AppendVariableSize(buffer, size, kStringTag, {}, {value.data(), value.size()});
+}
+
+void Append(std::vector<Byte>& buffer, std::size_t& size, const LogRawBuffer value) noexcept
+{
+    AppendVariableSize(buffer, size, kRawBufferTag, {}, value);
+}
+
+void Append(std::vector<Byte>& buffer, std::size_t& size, const LogSlog2Message value) noexcept
+{
+    const auto code = value.GetCode();
+    std::array<Byte, sizeof(code)> prefix{};
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed
+    std::ignore = std::memcpy(prefix.data(), &code, sizeof(code));
+    const auto message = value.GetMessage();
+    AppendVariableSize(buffer, size, kSlog2MessageTag, prefix, {message.data(), message.size()});
+}
+
+}  // namespace
+
+ThrottlingRecorder::ThrottlingRecorder(const Configuration& config, std::unique_ptr<Recorder> recorder) noexcept
+    : Recorder{},
+      recorder_{std::move(recorder)},
+      emission_interval_nsec_{(config.GetContextRateLimit() > 0U)
+                                  ? (kNanosecondsPerSecond / static_cast<std::uint64_t>(config.GetContextRateLimit()))
+                                  : 0U},
+      burst_tolerance_nsec_{emission_interval_nsec_ *
+                            static_cast<std::uint64_t>(std::max(config.GetContextRateLimitBurst(), std::size_t{1U}) -
+                                                       1U)},
+      collapse_repeated_messages_{config.GetCollapseRepeatedMessages()},
+      repetition_timeout_nsec_{(emission_interval_nsec_ > 0U) ? emission_interval_nsec_
+                                                               : kDefaultRepetitionTimeoutNsec},
+      context_states_(kMaxNumberOfContexts + 1U),
+      number_of_context_states_{0U},
+      context_index_{kMaxNumberOfContexts},
+      //  Pending records are only used to collapse repetitions. Their index has to fit into a SlotIndex.
+      pending_records_{collapse_repeated_messages_
+                           ? std::min(config.GetNumberOfSlots(),
+                                      std::size_t{std::numeric_limits<SlotIndex>::max()} + 1U)
+                           : 0U,
+                       PendingRecord{std::vector<Byte>(config.GetSlotSizeInBytes())}},
+      contexts_with_repetitions_{0U},
+      next_idle_check_nsec_{0U}
+{
+}
+
+ThrottlingRecorder::~ThrottlingRecorder()
+{
+    const auto number_of_context_states =
+        std::min(number_of_context_states_.load(std::memory_order_acquire), kMaxNumberOfContexts);
+    for (std::size_t index{0U}; index < number_of_context_states; ++index)
+    {
+        PassOnRepetitions(context_states_[index]);
+    }
+}
+
+bool ThrottlingRecorder::IsRequiredBy(const Configuration& config) noexcept
+{
+    return (config.GetContextRateLimit() > 0U) || config.GetCollapseRepeatedMessages();
+}
+
+const Recorder& ThrottlingRecorder::GetRecorder() const noexcept
+{
+    return *recorder_;
+}
+
+ThrottlingRecorder::ContextState& ThrottlingRecorder::GetContextState(const std::string_view context_id) noexcept
+{
+    const LoggingIdentifier identifier{context_id};
+    auto found = context_index_.Find(identifier);
+    if (found.has_value())
+    {
+        return found.value().get();
+    }
+
+    auto& shared_state = context_states_.back();
+    const auto index = number_of_context_states_.fetch_add(1U, std::memory_order_acq_rel);
+    if (index >= kMaxNumberOfContexts)
+    {
+        return shared_state;
+    }
+    auto& state = context_states_[index];
+    state.context_id = identifier;
+    if (!context_index_.TryInsert(identifier, state))
+    {
+        //  Another thread inserted the context in the meantime, state stays unused:
+        found = context_index_.Find(identifier);
+        return found.has_value() ? found.value().get() : shared_state;
+    }
+    return state;
+}
+
+bool ThrottlingRecorder::TryConsumeRateLimit(ContextState& state) noexcept
+{
+    if (emission_interval_nsec_ == 0U)
+    {
+        return true;
+    }
+
+    //  Generic cell rate algorithm, the equivalent of a token bucket that needs a single atomic:
+    const auto now = NowNanoseconds();
+    auto next_arrival = state.next_arrival_nsec.load(std::memory_order_relaxed);
+    std::uint64_t updated_next_arrival{};
+    do
+    {
+        const auto arrival = std::max(next_arrival, now);
+        if ((arrival - now) > burst_tolerance_nsec_)
+        {
+            return false;
+        }
+        updated_next_arrival = arrival + emission_interval_nsec_;
+    } while (!state.next_arrival_nsec.compare_exchange_weak(
+        next_arrival, updated_next_arrival, std::memory_order_relaxed));
+    return true;
+}
+
+score::cpp::optional<SlotHandle> ThrottlingRecorder::StartRecord(const std::string_view context_id,
+                                                             const LogLevel log_level) noexcept
+{
+    //  Disabled records shall neither count against the rate limit nor as dropped:
+    if (!recorder_->IsLogEnabled(log_level, context_id))
+    {
+        return {};
+    }
+
+    auto& state = GetContextState(context_id);
+    if (&state == &context_states_.back())
+    {
+        //  Contexts that are not tracked fail open, so that they do not share a rate limit:
+        CountUnthrottledRecords();
+    }
+    else if (!TryConsumeRateLimit(state))
+    {
+        CountDroppedRecords(DropReason::kRateLimited);
+        return {};
+    }
+
+    if (!collapse_repeated_messages_)
+    {
+        //  A record without slot is counted by the concrete recorder which could not reserve one.
+        return recorder_->StartRecord(context_id, log_level);
+    }
+
+    PassOnIdleRepetitions();
+
+    const auto index = pending_records_.AcquireSlotToWrite();
+    if (!index.has_value())
+    {
+        CountDroppedRecords(DropReason::kNoSlot);
+        return {};
+    }
+    auto& record = pending_records_.GetUnderlyingBufferFor(index.value());
+    record.size = 0U;
+    record.context_id = LoggingIdentifier{context_id};
+    record.log_level = log_level;
+    record.context_state = &state;
+    // The number of pending records is limited to the range of SlotIndex in the constructor.
+    return SlotHandle{static_cast<SlotIndex>(index.value())};
+}
+
+void ThrottlingRecorder::StopRecord(const SlotHandle& slot) noexcept
+{
+    if (!collapse_repeated_messages_)
+    {
+        recorder_->StopRecord(slot);
+        return;
+    }
+
+    const auto index = static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder());
+    const auto& record = pending_records_.GetUnderlyingBufferFor(index);
+    auto& state = *record.context_state;
+    if (&state == &context_states_.back())
+    {
+        //  The shared state does not belong to a single context, so there is nothing to compare with:
+        PassOn(record);
+    }
+    else
+    {
+        MessageHash hash{};
+        hash.Add(&record.log_level, sizeof(record.log_level));
+        hash.Add(record.arguments.data(), record.size);
+        const auto record_hash = hash.Get();
+        if (state.last_record_hash.exchange(record_hash, std::memory_order_acq_rel) == record_hash)
+        {
+            state.last_repetition_nsec.store(NowNanoseconds(), std::memory_order_relaxed);
+            if (state.repetitions.fetch_add(1U, std::memory_order_relaxed) == 0U)
+            {
+                std::ignore = contexts_with_repetitions_.fetch_add(1U, std::memory_order_relaxed);
+            }
+            CountDroppedRecords(DropReason::kRepeated);
+        }
+        else
+        {
+            PassOnRepetitions(state);
+            state.last_log_level.store(record.log_level, std::memory_order_relaxed);
+            PassOn(record);
+        }
+    }
+    pending_records_.ReleaseSlot(index);
+}
+
+void ThrottlingRecorder::PassOn(const PendingRecord& record) noexcept
+{
+    const auto slot = recorder_->StartRecord(record.context_id.GetStringView(), record.log_level);
+    if (!slot.has_value())
+    {
+        return;
+    }
+
+    score::cpp::span<const Byte> arguments{record.arguments.data(),
+                                    static_cast<score::cpp::span<const Byte>::size_type>(record.size)};
+    std::uint8_t tag{};
+    while (Read(arguments, tag) && ReplayArgument(*recorder_, slot.value(), tag, arguments))
+    {
+    }
+    recorder_->StopRecord(slot.value());
+}
+
+void ThrottlingRecorder::PassOnRepetitions(ContextState& state) noexcept
+{
+    const auto repetitions = state.repetitions.exchange(0U, std::memory_order_relaxed);
+    if (repetitions == 0U)
+    {
+        return;
+    }
+    std::ignore = contexts_with_repetitions_.fetch_sub(1U, std::memory_order_relaxed);
+    const auto slot =
+        recorder_->StartRecord(state.context_id.GetStringView(), state.last_log_level.load(std::memory_order_relaxed));
+    if (!slot.has_value())
+    {
+        return;
+    }
+    recorder_->Log(slot.value(), std::string_view{"Last message repeated"});
+    recorder_->Log(slot.value(), std::uint64_t{repetitions});
+    recorder_->Log(slot.value(), std::string_view{"times"});
+    recorder_->StopRecord(slot.value());
+}
+
+void ThrottlingRecorder::PassOnIdleRepetitions() noexcept
+{
+    if (contexts_with_repetitions_.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+
+    //  Only the thread that advances the next check scans the contexts:
+    const auto now = NowNanoseconds();
+    auto next_check = next_idle_check_nsec_.load(std::memory_order_relaxed);
+    if ((now < next_check) ||
+        (!next_idle_check_nsec_.compare_exchange_strong(
+            next_check, now + repetition_timeout_nsec_, std::memory_order_relaxed)))
+    {
+        return;
+    }
+
+    const auto number_of_context_states =
+        std::min(number_of_context_states_.load(std::memory_order_acquire), kMaxNumberOfContexts);
+    for (std::size_t index{0U}; index < number_of_context_states; ++index)
+    {
+        auto& state = context_states_[index];
+        if ((state.repetitions.load(std::memory_order_relaxed) > 0U) &&
+            ((now - std::min(now, state.last_repetition_nsec.load(std::memory_order_relaxed))) >
+             repetition_timeout_nsec_))
+        {
+            PassOnRepetitions(state);
+        }
+    }
+}
+
+template <typename T>
+void ThrottlingRecorder::GenericLog(const SlotHandle& slot, const T data) noexcept
+{
+    if (!collapse_repeated_messages_)
+    {
+        recorder_->Log(slot, data);
+        return;
+    }
+    auto& record = pending_records_.GetUnderlyingBufferFor(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+    Append(record.arguments, record.size, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const bool data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::uint8_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::int8_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::uint16_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::int16_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::uint32_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::int32_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::uint64_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::int64_t data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const float data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const double data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const std::string_view data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogHex8 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogHex16 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogHex32 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogHex64 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogBin8 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogBin16 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogBin32 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogBin64 data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogRawBuffer data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+void ThrottlingRecorder::Log(const SlotHandle& slot, const LogSlog2Message data) noexcept
+{
+    GenericLog(slot, data);
+}
+
+bool ThrottlingRecorder::IsLogEnabled(const LogLevel& log_level, const std::string_view context) const noexcept
+{
+    return recorder_->IsLogEnabled(log_level, context);
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
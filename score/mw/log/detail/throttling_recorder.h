@@ -0,0 +1,154 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_THROTTLING_RECORDER_H
+#define SCORE_MW_LOG_DETAIL_THROTTLING_RECORDER_H
+
+#include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/log_entry.h"
+#include "score/mw/log/detail/logging_identifier.h"
+#include "score/mw/log/detail/logging_identifier_index.h"
+#include "score/mw/log/recorder.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Recorder stage in front of the concrete recorders that protects them against log storms of single contexts.
+///
+/// \details Two independent measures can be configured:
+/// - contextRateLimit: every context may log at most that many records per second, plus a burst of
+///   contextRateLimitBurst records after it was idle. The decision is taken in StartRecord(), so a dropped record
+///   costs neither a slot nor formatting.
+/// - collapseRepeatedMessages: identical consecutive records of a context are dropped and reported by a single
+///   "Last message repeated N times" record once the context logs something else, once the context did not repeat
+///   the record for longer than the emission interval of the rate limit (one second without rate limit), or when
+///   this recorder is destroyed. Idle contexts are checked on the next StartRecord() of any context. To compare a
+///   record before it reaches the concrete recorders, its arguments are collected in a pending record of this stage
+///   and replayed to the concrete recorders in StopRecord().
+///
+/// Both measures are tracked for a fixed number of contexts. Records of further contexts are passed on without either
+/// measure, so that a storm in one of them can not throttle the others, and are counted as unthrottled.
+///
+/// Dropped and unthrottled records are counted in GetDropStatistics(). All operations are lock-free.
+class ThrottlingRecorder final : public Recorder
+{
+  public:
+    ThrottlingRecorder(const Configuration& config, std::unique_ptr<Recorder> recorder) noexcept;
+    ThrottlingRecorder(ThrottlingRecorder&&) noexcept = delete;
+    ThrottlingRecorder(const ThrottlingRecorder&) noexcept = delete;
+    ThrottlingRecorder& operator=(ThrottlingRecorder&&) noexcept = delete;
+    ThrottlingRecorder& operator=(const ThrottlingRecorder&) noexcept = delete;
+    ~ThrottlingRecorder() override;
+
+    /// \brief Returns true if config requests any of the measures of this stage.
+    static bool IsRequiredBy(const Configuration& config) noexcept;
+
+    score::cpp::optional<SlotHandle> StartRecord(const std::string_view context_id,
+                                          const LogLevel log_level) noexcept override;
+    void StopRecord(const SlotHandle& slot) noexcept override;
+
+    void Log(const SlotHandle& slot, const bool data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint8_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int8_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint16_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int16_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint32_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int32_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint64_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int64_t data) noexcept override;
+    void Log(const SlotHandle& slot, const float data) noexcept override;
+    void Log(const SlotHandle& slot, const double data) noexcept override;
+    void Log(const SlotHandle& slot, const std::string_view data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex8 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex16 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex32 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex64 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin8 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin16 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin32 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin64 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogRawBuffer data) noexcept override;
+    void Log(const SlotHandle& slot, const LogSlog2Message data) noexcept override;
+
+    bool IsLogEnabled(const LogLevel& log_level, const std::string_view context) const noexcept override;
+
+    const Recorder& GetRecorder() const noexcept;
+
+  private:
+    struct ContextState
+    {
+        LoggingIdentifier context_id{};
+        /// \brief Theoretical arrival time of the next record of the generic cell rate algorithm.
+        std::atomic<std::uint64_t> next_arrival_nsec{0U};
+        /// \brief Hash of the last record that was passed on, zero if there is none.
+        std::atomic<std::uint64_t> last_record_hash{0U};
+        std::atomic<std::uint64_t> repetitions{0U};
+        /// \brief Time of the last collapsed repetition.
+        std::atomic<std::uint64_t> last_repetition_nsec{0U};
+        std::atomic<LogLevel> last_log_level{LogLevel::kOff};
+    };
+
+    struct PendingRecord
+    {
+        /// \brief Arguments encoded as type tag and value, sized once to the capacity.
+        std::vector<Byte> arguments{};
+        std::size_t size{0U};
+        LoggingIdentifier context_id{};
+        LogLevel log_level{LogLevel::kOff};
+        ContextState* context_state{nullptr};
+    };
+
+    ContextState& GetContextState(const std::string_view context_id) noexcept;
+    bool TryConsumeRateLimit(ContextState& state) noexcept;
+    void PassOn(const PendingRecord& record) noexcept;
+    void PassOnRepetitions(ContextState& state) noexcept;
+    void PassOnIdleRepetitions() noexcept;
+
+    template <typename T>
+    void GenericLog(const SlotHandle& slot, const T data) noexcept;
+
+    std::unique_ptr<Recorder> recorder_;
+    std::uint64_t emission_interval_nsec_;
+    std::uint64_t burst_tolerance_nsec_;
+    bool collapse_repeated_messages_;
+    std::uint64_t repetition_timeout_nsec_;
+
+    /// \brief One state per context, the last one is shared by all contexts that do not get an own one. The shared
+    /// state is neither rate limited nor compared for repetitions.
+    std::vector<ContextState> context_states_;
+    std::atomic<std::size_t> number_of_context_states_;
+    LoggingIdentifierIndex<ContextState> context_index_;
+    CircularAllocator<PendingRecord> pending_records_;
+    /// \brief Number of contexts with repetitions that were not reported yet.
+    std::atomic<std::size_t> contexts_with_repetitions_;
+    /// \brief Earliest time at which idle contexts are checked again, so that they are scanned once per timeout.
+    std::atomic<std::uint64_t> next_idle_check_nsec_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_THROTTLING_RECORDER_H
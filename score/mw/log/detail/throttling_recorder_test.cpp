@@ -0,0 +1,440 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/throttling_recorder.h"
+
+#include "score/mw/log/drop_statistics.h"
+#include "score/mw/log/recorder_mock.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using testing::_;
+using testing::InSequence;
+using testing::Return;
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+const std::string_view kContext{"aCtx"};
+const std::string_view kOtherContext{"bCtx"};
+const LogLevel kLogLevel{LogLevel::kInfo};
+
+class ThrottlingRecorderFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        auto recorder_mock = std::make_unique<testing::NiceMock<RecorderMock>>();
+        recorder_mock_ = recorder_mock.get();
+        recorder_ = std::move(recorder_mock);
+        ON_CALL(*recorder_mock_, IsLogEnabled(_, _)).WillByDefault(Return(true));
+        ON_CALL(*recorder_mock_, StartRecord(_, _)).WillByDefault(Return(SlotHandle{0U}));
+        config_.SetNumberOfSlots(4U);
+        config_.SetSlotSizeInBytes(64U);
+        statistics_before_ = GetDropStatistics();
+    }
+
+    ThrottlingRecorder& CreateUnit()
+    {
+        unit_ = std::make_unique<ThrottlingRecorder>(config_, std::move(recorder_));
+        return *unit_;
+    }
+
+    void LogText(const std::string_view context, const std::string_view text)
+    {
+        const auto slot = unit_->StartRecord(context, kLogLevel);
+        ASSERT_TRUE(slot.has_value());
+        unit_->Log(slot.value(), text);
+        unit_->StopRecord(slot.value());
+    }
+
+    DropStatistics GetDropStatisticsDelta() const
+    {
+        const auto statistics = GetDropStatistics();
+        return DropStatistics{statistics.rate_limited - statistics_before_.rate_limited,
+                              statistics.repeated - statistics_before_.repeated,
+                              statistics.no_slot - statistics_before_.no_slot,
+                              statistics.not_written - statistics_before_.not_written,
+                              statistics.unthrottled - statistics_before_.unthrottled};
+    }
+
+  protected:
+    Configuration config_{};
+    testing::NiceMock<RecorderMock>* recorder_mock_{nullptr};
+    std::unique_ptr<Recorder> recorder_{};
+    std::unique_ptr<ThrottlingRecorder> unit_{};
+    DropStatistics statistics_before_{};
+};
+
+TEST_F(ThrottlingRecorderFixture, IsOnlyRequiredIfConfigured)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that the stage is only required if configured.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a default configuration
+    // Then the stage is not required
+    EXPECT_FALSE(ThrottlingRecorder::IsRequiredBy(config_));
+
+    // When configuring a rate limit or collapsing of repeated messages
+    // Then the stage is required
+    config_.SetContextRateLimit(10U);
+    EXPECT_TRUE(ThrottlingRecorder::IsRequiredBy(config_));
+    config_.SetContextRateLimit(0U);
+    config_.SetCollapseRepeatedMessages(true);
+    EXPECT_TRUE(ThrottlingRecorder::IsRequiredBy(config_));
+}
+
+TEST_F(ThrottlingRecorderFixture, RecordsBeyondBurstAreDroppedPerContext)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that the rate limit drops records beyond the burst.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a rate limit of one record per second with a burst of three records
+    config_.SetContextRateLimit(1U);
+    config_.SetContextRateLimitBurst(3U);
+
+    // Then three records of each context are passed on
+    EXPECT_CALL(*recorder_mock_, StartRecord(kContext, kLogLevel)).Times(3);
+    EXPECT_CALL(*recorder_mock_, StartRecord(kOtherContext, kLogLevel)).Times(3);
+    auto& unit = CreateUnit();
+
+    // When logging ten records in each of two contexts
+    std::size_t started{0U};
+    for (std::size_t index{0U}; index < 10U; ++index)
+    {
+        for (const auto context : {kContext, kOtherContext})
+        {
+            const auto slot = unit.StartRecord(context, kLogLevel);
+            if (slot.has_value())
+            {
+                ++started;
+                unit.StopRecord(slot.value());
+            }
+        }
+    }
+
+    // And the other records are counted as rate limited
+    EXPECT_EQ(started, 6U);
+    EXPECT_EQ(GetDropStatisticsDelta().rate_limited, 14U);
+}
+
+TEST_F(ThrottlingRecorderFixture, ContextsBeyondTrackedOnesAreNotRateLimited)
+{
+    ::testing::Test::RecordProperty("Description",
+                                    "Verifies that contexts which can not be tracked do not share a rate limit.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "boundary-values");
+
+    // Given a rate limit of one record per second without burst
+    config_.SetContextRateLimit(1U);
+    config_.SetContextRateLimitBurst(1U);
+    constexpr std::size_t kTrackedContexts{128U};
+    constexpr std::size_t kUntrackedContexts{2U};
+    constexpr std::size_t kRecordsPerContext{3U};
+    std::vector<std::string> contexts{};
+    for (std::size_t index{0U}; index < (kTrackedContexts + kUntrackedContexts); ++index)
+    {
+        contexts.push_back("c" + std::to_string(index));
+    }
+
+    // Then one record of each tracked context and all records of the other contexts are passed on
+    EXPECT_CALL(*recorder_mock_, StartRecord(_, kLogLevel))
+        .Times(static_cast<int>(kTrackedContexts + (kUntrackedContexts * kRecordsPerContext)));
+    auto& unit = CreateUnit();
+
+    // When logging three records in each of 130 contexts
+    for (std::size_t record{0U}; record < kRecordsPerContext; ++record)
+    {
+        for (const auto& context : contexts)
+        {
+            const auto slot = unit.StartRecord(context, kLogLevel);
+            if (slot.has_value())
+            {
+                unit.StopRecord(slot.value());
+            }
+        }
+    }
+
+    // And the records of the untracked contexts are counted as unthrottled
+    const auto statistics = GetDropStatisticsDelta();
+    EXPECT_EQ(statistics.rate_limited, kTrackedContexts * (kRecordsPerContext - 1U));
+    EXPECT_EQ(statistics.unthrottled, kUntrackedContexts * kRecordsPerContext);
+}
+
+TEST_F(ThrottlingRecorderFixture, DisabledRecordsDoNotConsumeRateLimit)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that disabled records are neither limited nor counted.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a rate limit without burst and a recorder that disables debug records
+    config_.SetContextRateLimit(1U);
+    config_.SetContextRateLimitBurst(1U);
+    ON_CALL(*recorder_mock_, IsLogEnabled(LogLevel::kDebug, _)).WillByDefault(Return(false));
+    auto& unit = CreateUnit();
+
+    // When logging debug records
+    EXPECT_FALSE(unit.StartRecord(kContext, LogLevel::kDebug).has_value());
+    EXPECT_FALSE(unit.StartRecord(kContext, LogLevel::kDebug).has_value());
+
+    // Then the next enabled record is still passed on and nothing is counted as dropped
+    EXPECT_TRUE(unit.StartRecord(kContext, kLogLevel).has_value());
+    EXPECT_EQ(GetDropStatisticsDelta().rate_limited, 0U);
+}
+
+TEST_F(ThrottlingRecorderFixture, RepeatedMessagesAreCollapsed)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that identical consecutive records are collapsed.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given collapsing of repeated messages
+    config_.SetCollapseRepeatedMessages(true);
+
+    // Then the first record, a summary of the repetitions and the different record are passed on
+    {
+        InSequence sequence{};
+        EXPECT_CALL(*recorder_mock_, StartRecord(kContext, kLogLevel));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"storm"}));
+        EXPECT_CALL(*recorder_mock_, StopRecord(_));
+        EXPECT_CALL(*recorder_mock_, StartRecord(kContext, kLogLevel));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"Last message repeated"}));
+        EXPECT_CALL(*recorder_mock_, LogUint64(_, 3U));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"times"}));
+        EXPECT_CALL(*recorder_mock_, StopRecord(_));
+        EXPECT_CALL(*recorder_mock_, StartRecord(kContext, kLogLevel));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"calm"}));
+        EXPECT_CALL(*recorder_mock_, StopRecord(_));
+    }
+    CreateUnit();
+
+    // When logging the same record four times followed by a different one
+    for (std::size_t index{0U}; index < 4U; ++index)
+    {
+        LogText(kContext, "storm");
+    }
+    LogText(kContext, "calm");
+
+    // And the repetitions are counted
+    EXPECT_EQ(GetDropStatisticsDelta().repeated, 3U);
+}
+
+TEST_F(ThrottlingRecorderFixture, RepetitionsAreReportedOnDestruction)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that pending repetitions are reported at the end.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given collapsing of repeated messages and a repeated record in one context
+    config_.SetCollapseRepeatedMessages(true);
+    CreateUnit();
+    LogText(kContext, "storm");
+    LogText(kOtherContext, "storm");
+    LogText(kContext, "storm");
+
+    // Then the repetition is reported when the stage is destroyed
+    EXPECT_CALL(*recorder_mock_, LogUint64(_, 1U));
+    unit_.reset();
+}
+
+TEST_F(ThrottlingRecorderFixture, RepetitionsOfIdleContextAreReportedOnNextRecord)
+{
+    ::testing::Test::RecordProperty("Description",
+                                    "Verifies that repetitions are reported once their context was idle for a while.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given collapsing of repeated messages with a rate limit whose emission interval is one millisecond
+    config_.SetCollapseRepeatedMessages(true);
+    config_.SetContextRateLimit(1000U);
+
+    // Then the repetition is reported before the record of the other context
+    {
+        InSequence sequence{};
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"storm"}));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"Last message repeated"}));
+        EXPECT_CALL(*recorder_mock_, LogUint64(_, 1U));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"times"}));
+        EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"calm"}));
+    }
+    CreateUnit();
+
+    // When a context repeats a record and stays idle for longer than the emission interval
+    LogText(kContext, "storm");
+    LogText(kContext, "storm");
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+
+    // And another context logs a record
+    LogText(kOtherContext, "calm");
+
+    // And nothing is left to report on destruction
+    EXPECT_CALL(*recorder_mock_, LogUint64(_, _)).Times(0);
+    unit_.reset();
+}
+
+TEST_F(ThrottlingRecorderFixture, AllArgumentTypesArePassedOnWhenCollapsing)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that buffered arguments are replayed unchanged.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given collapsing of repeated messages with enough space for all arguments
+    config_.SetCollapseRepeatedMessages(true);
+    config_.SetSlotSizeInBytes(256U);
+    const std::array<char, 3U> raw{'r', 'a', 'w'};
+
+    // Then all arguments reach the recorder
+    EXPECT_CALL(*recorder_mock_, LogBool(_, true));
+    EXPECT_CALL(*recorder_mock_, LogUint8(_, std::uint8_t{1U}));
+    EXPECT_CALL(*recorder_mock_, LogInt8(_, std::int8_t{-1}));
+    EXPECT_CALL(*recorder_mock_, LogUint16(_, std::uint16_t{2U}));
+    EXPECT_CALL(*recorder_mock_, LogInt16(_, std::int16_t{-2}));
+    EXPECT_CALL(*recorder_mock_, LogUint32(_, std::uint32_t{3U}));
+    EXPECT_CALL(*recorder_mock_, LogInt32(_, std::int32_t{-3}));
+    EXPECT_CALL(*recorder_mock_, LogUint64(_, std::uint64_t{4U}));
+    EXPECT_CALL(*recorder_mock_, LogInt64(_, std::int64_t{-4}));
+    EXPECT_CALL(*recorder_mock_, LogFloat(_, 1.5F));
+    EXPECT_CALL(*recorder_mock_, LogDouble(_, 2.5));
+    EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"text"}));
+    EXPECT_CALL(*recorder_mock_, LogUint8(_, std::uint8_t{5U}));
+    EXPECT_CALL(*recorder_mock_, LogUint16(_, std::uint16_t{6U}));
+    EXPECT_CALL(*recorder_mock_, LogUint32(_, std::uint32_t{7U}));
+    EXPECT_CALL(*recorder_mock_, LogUint64(_, std::uint64_t{8U}));
+    EXPECT_CALL(*recorder_mock_, LogUint8(_, std::uint8_t{9U}));
+    EXPECT_CALL(*recorder_mock_, LogUint16(_, std::uint16_t{10U}));
+    EXPECT_CALL(*recorder_mock_, LogUint32(_, std::uint32_t{11U}));
+    EXPECT_CALL(*recorder_mock_, LogUint64(_, std::uint64_t{12U}));
+    EXPECT_CALL(*recorder_mock_, LogLogRawBuffer(_, _, 3U));
+    EXPECT_CALL(*recorder_mock_, LogLogSlog2Message(_, 13U, _));
+    auto& unit = CreateUnit();
+
+    // When logging one argument of each type
+    const auto slot = unit.StartRecord(kContext, kLogLevel);
+    ASSERT_TRUE(slot.has_value());
+    unit.Log(slot.value(), true);
+    unit.Log(slot.value(), std::uint8_t{1U});
+    unit.Log(slot.value(), std::int8_t{-1});
+    unit.Log(slot.value(), std::uint16_t{2U});
+    unit.Log(slot.value(), std::int16_t{-2});
+    unit.Log(slot.value(), std::uint32_t{3U});
+    unit.Log(slot.value(), std::int32_t{-3});
+    unit.Log(slot.value(), std::uint64_t{4U});
+    unit.Log(slot.value(), std::int64_t{-4});
+    unit.Log(slot.value(), 1.5F);
+    unit.Log(slot.value(), 2.5);
+    unit.Log(slot.value(), std::string_view{"text"});
+    unit.Log(slot.value(), LogHex8{5U});
+    unit.Log(slot.value(), LogHex16{6U});
+    unit.Log(slot.value(), LogHex32{7U});
+    unit.Log(slot.value(), LogHex64{8U});
+    unit.Log(slot.value(), LogBin8{9U});
+    unit.Log(slot.value(), LogBin16{10U});
+    unit.Log(slot.value(), LogBin32{11U});
+    unit.Log(slot.value(), LogBin64{12U});
+    unit.Log(slot.value(), LogRawBuffer{raw.data(), raw.size()});
+    unit.Log(slot.value(), LogSlog2Message{13U, "slog"});
+    unit.StopRecord(slot.value());
+}
+
+TEST_F(ThrottlingRecorderFixture, ArgumentsThatDoNotFitAreDropped)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that arguments beyond the slot size are dropped.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given collapsing of repeated messages with slots of eight bytes
+    config_.SetCollapseRepeatedMessages(true);
+    config_.SetSlotSizeInBytes(8U);
+
+    // Then the string is cut to the remaining space and the integer is dropped
+    EXPECT_CALL(*recorder_mock_, LogStringView(_, std::string_view{"abcde"}));
+    EXPECT_CALL(*recorder_mock_, LogUint32(_, _)).Times(0);
+    auto& unit = CreateUnit();
+
+    // When logging a string and an integer
+    const auto slot = unit.StartRecord(kContext, kLogLevel);
+    ASSERT_TRUE(slot.has_value());
+    unit.Log(slot.value(), std::string_view{"abcdefgh"});
+    unit.Log(slot.value(), std::uint32_t{1U});
+    unit.StopRecord(slot.value());
+}
+
+TEST_F(ThrottlingRecorderFixture, MissingSlotIsCounted)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that records without a slot are counted.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given collapsing of repeated messages with a single slot
+    config_.SetCollapseRepeatedMessages(true);
+    config_.SetNumberOfSlots(1U);
+    auto& unit = CreateUnit();
+
+    // When starting a second record while the first one is open
+    const auto slot = unit.StartRecord(kContext, kLogLevel);
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_FALSE(unit.StartRecord(kContext, kLogLevel).has_value());
+    unit.StopRecord(slot.value());
+
+    // Then it is counted as dropped for lack of a slot
+    EXPECT_EQ(GetDropStatisticsDelta().no_slot, 1U);
+}
+
+TEST_F(ThrottlingRecorderFixture, RecordsArePassedThroughWithoutCollapsing)
+{
+    ::testing::Test::RecordProperty("Description", "Verifies that records are forwarded directly without collapsing.");
+    ::testing::Test::RecordProperty("TestingTechnique", "Requirements-based test");
+    ::testing::Test::RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    // Given a rate limit only
+    config_.SetContextRateLimit(100U);
+    const SlotHandle slot_of_recorder{3U};
+
+    // Then the slot of the recorder is handed out and arguments are forwarded immediately
+    EXPECT_CALL(*recorder_mock_, StartRecord(kContext, kLogLevel)).WillOnce(Return(slot_of_recorder));
+    EXPECT_CALL(*recorder_mock_, LogInt32(_, 42));
+    EXPECT_CALL(*recorder_mock_, StopRecord(_));
+    auto& unit = CreateUnit();
+
+    // When logging a record
+    const auto slot = unit.StartRecord(kContext, kLogLevel);
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_EQ(slot.value().GetSlotOfSelectedRecorder(), 3U);
+    unit.Log(slot.value(), std::int32_t{42});
+    unit.StopRecord(slot.value());
+}
+
+}  // namespace
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -13,13 +13,14 @@
 #ifndef SCORE_MW_LOG_DETAIL_VERBOSE_PAYLOAD_H
 #define SCORE_MW_LOG_DETAIL_VERBOSE_PAYLOAD_H
 
+#include "score/mw/log/detail/log_entry.h"
+
 #include <score/callback.hpp>
 #include <score/span.hpp>
 
 #include <cstddef>
 #include <cstring>
 #include <type_traits>
-#include <vector>
 
 namespace score
 {
@@ -30,9 +31,6 @@ namespace log
 namespace detail
 {
 
-using Byte = char;
-using ByteVector = std::vector<Byte>;
-
 using ReserveCallback = score::cpp::callback<std::size_t(score::cpp::span<Byte>)>;
 
 /// \brief Abstracts the usage of our underlying buffer for memory safety reasons.
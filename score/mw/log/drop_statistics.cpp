@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/drop_statistics.h"
+
+#include <atomic>
+#include <tuple>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+
+namespace
+{
+
+struct DropCounters
+{
+    std::atomic<std::uint64_t> rate_limited{0U};
+    std::atomic<std::uint64_t> repeated{0U};
+    std::atomic<std::uint64_t> no_slot{0U};
+    std::atomic<std::uint64_t> not_written{0U};
+    std::atomic<std::uint64_t> unthrottled{0U};
+};
+
+DropCounters& GetDropCounters() noexcept
+{
+    // Function-local, so that the counters can also be used while other static objects are initialized.
+    static DropCounters counters{};
+    return counters;
+}
+
+}  // namespace
+
+DropStatistics GetDropStatistics() noexcept
+{
+    const auto& counters = GetDropCounters();
+    DropStatistics statistics{};
+    statistics.rate_limited = counters.rate_limited.load(std::memory_order_relaxed);
+    statistics.repeated = counters.repeated.load(std::memory_order_relaxed);
+    statistics.no_slot = counters.no_slot.load(std::memory_order_relaxed);
+    statistics.not_written = counters.not_written.load(std::memory_order_relaxed);
+    statistics.unthrottled = counters.unthrottled.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+namespace detail
+{
+
+void CountDroppedRecords(const DropReason reason, const std::uint64_t count) noexcept
+{
+    auto& counters = GetDropCounters();
+    switch (reason)
+    {
+        case DropReason::kRateLimited:
+            std::ignore = counters.rate_limited.fetch_add(count, std::memory_order_relaxed);
+            break;
+        case DropReason::kRepeated:
+            std::ignore = counters.repeated.fetch_add(count, std::memory_order_relaxed);
+            break;
+        case DropReason::kNotWritten:
+            std::ignore = counters.not_written.fetch_add(count, std::memory_order_relaxed);
+            break;
+        case DropReason::kNoSlot:
+        default:
+            std::ignore = counters.no_slot.fetch_add(count, std::memory_order_relaxed);
+            break;
+    }
+}
+
+void CountUnthrottledRecords(const std::uint64_t count) noexcept
+{
+    std::ignore = GetDropCounters().unthrottled.fetch_add(count, std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DROP_STATISTICS_H
+#define SCORE_MW_LOG_DROP_STATISTICS_H
+
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+
+/// \brief Number of log records that were not recorded since the start of the process, by reason.
+struct DropStatistics
+{
+    /// \brief Records dropped because their context exceeded the configured contextRateLimit.
+    std::uint64_t rate_limited{};
+    /// \brief Identical consecutive records that were collapsed into a "repeated N times" record.
+    std::uint64_t repeated{};
+    /// \brief Records dropped because a recorder had no free slot for them, counted once per recorder.
+    std::uint64_t no_slot{};
+    /// \brief Records dropped by the backend after they were recorded, e.g. while no log file segment could be opened.
+    std::uint64_t not_written{};
+    /// \brief Records that were not dropped, but passed on without contextRateLimit and collapseRepeatedMessages
+    /// because their context exceeded the number of contexts that can be tracked.
+    std::uint64_t unthrottled{};
+};
+
+/// \brief Returns the drop counters of the process.
+/// \public
+/// \thread-safe
+///
+/// \details The rate_limited, repeated and unthrottled counters are only maintained if throttling is configured
+/// (contextRateLimit or collapseRepeatedMessages), otherwise they stay zero.
+DropStatistics GetDropStatistics() noexcept;
+
+namespace detail
+{
+
+enum class DropReason : std::uint8_t
+{
+    kRateLimited,
+    kRepeated,
+    kNoSlot,
+    kNotWritten,
+};
+
+/// \brief Adds count to the drop counter of reason.
+void CountDroppedRecords(const DropReason reason, const std::uint64_t count = 1U) noexcept;
+
+/// \brief Adds count to the counter of records that were passed on without throttling.
+void CountUnthrottledRecords(const std::uint64_t count = 1U) noexcept;
+
+}  // namespace detail
+
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DROP_STATISTICS_H
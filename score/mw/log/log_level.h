@@ -53,6 +53,25 @@ constexpr LogLevel GetMaxLogLevelValue()
                      LogLevel::kOff});
 }
 
+//  Set by the build flag //score/mw/log/flags:KCompile_Time_Log_Level, all levels are compiled in by default.
+#ifndef SCORE_MW_LOG_COMPILE_TIME_LOG_LEVEL
+#define SCORE_MW_LOG_COMPILE_TIME_LOG_LEVEL 6
+#endif
+
+/// \brief Most verbose log level that is compiled into the application.
+/// \public
+///
+/// \details Log statements of a more verbose level are dropped without asking the recorder. See
+/// Logger::LogIfEnabled() for statements that are removed entirely, including the evaluation of their arguments.
+constexpr LogLevel kCompileTimeLogLevel{static_cast<LogLevel>(SCORE_MW_LOG_COMPILE_TIME_LOG_LEVEL)};
+
+/// \brief Checks if log statements of the given level are compiled into the application.
+/// \public
+constexpr bool IsLogLevelCompiledIn(const LogLevel log_level) noexcept
+{
+    return log_level <= kCompileTimeLogLevel;
+}
+
 mw::log::LogLevel GetLogLevelFromU8(std::uint8_t candidate_log_level);
 std::optional<mw::log::LogLevel> TryGetLogLevelFromU8(std::uint8_t candidate_log_level);
 
@@ -46,6 +46,16 @@ TEST(LogLevelTesting, EnsureMaxLevelCoversAllEnumCases)
     }
 }
 
+TEST(LogLevelTesting, EnsureThatExactlyTheLevelsUpToTheCompileTimeLogLevelAreCompiledIn)
+{
+    for (std::uint8_t level{0U}; level <= static_cast<std::uint8_t>(GetMaxLogLevelValue()); ++level)
+    {
+        const auto log_level = GetLogLevelFromU8(level);
+        EXPECT_EQ(IsLogLevelCompiledIn(log_level), log_level <= kCompileTimeLogLevel);
+    }
+    EXPECT_TRUE(IsLogLevelCompiledIn(LogLevel::kOff));
+}
+
 TEST(LogLevelTesting, EnsureThatGetLogLevelFromU8WillReturnTheCandidateLogLevelIfItIsWithinTheLogLevelEnumValues)
 {
     // Let's pick any value within the LogLevel Enum class.
@@ -34,8 +34,12 @@ LogStream::LogStream(Recorder& recorder,
       context_id_(context_id.data() == nullptr ? kDefaultContextInStream : context_id),
       log_level_{log_level}
 {
-    // Construction fallback handled in log_stream_factory (using here CallRecorder, would give a false impression)
-    slot_ = recorder_.StartRecord(context_id_.GetStringView(), log_level_);
+    //  Levels removed at compile time never reach the recorder, the stream stays without slot and drops all arguments.
+    if (IsLogLevelCompiledIn(log_level_))
+    {
+        // Construction fallback handled in log_stream_factory (using here CallRecorder, would give a false impression)
+        slot_ = recorder_.StartRecord(context_id_.GetStringView(), log_level_);
+    }
 }
 
 // Suppress "AUTOSAR C++14 A15-5-1": "All user-provided class destructors, deallocation functions,
@@ -88,7 +92,10 @@ void LogStream::Flush() noexcept
     {
         CallOnRecorder(&Recorder::StopRecord, slot_.value());
     }
-    slot_ = CallOnRecorder(&Recorder::StartRecord, context_id_.GetStringView(), log_level_);
+    if (IsLogLevelCompiledIn(log_level_))
+    {
+        slot_ = CallOnRecorder(&Recorder::StartRecord, context_id_.GetStringView(), log_level_);
+    }
 }
 
 /*
@@ -226,7 +226,7 @@ class LogStream final
         // False positive, single char is not supported by operator<<
         // coverity[autosar_cpp14_m5_0_3_violation]
         // coverity[autosar_cpp14_m5_0_11_violation]
-        return Log(value);
+        return slot_.has_value() ? Log(value) : *this;
     }
 
     /// \brief Deprecated stream operator which enables logging of C-style string via character pointer.
@@ -243,7 +243,7 @@ class LogStream final
         enable_if_t<IsCharPtrType<T>(), LogStream&>
         operator<<(T char_ptr) &
     {
-        if (char_ptr != nullptr)
+        if ((char_ptr != nullptr) && slot_.has_value())
         {
             const LogString value{char_ptr, LogString::TraitsType::length(char_ptr)};
             return Log(value);
@@ -267,6 +267,10 @@ class LogStream final
     LogStream& operator<<(const LogString::CharType (&array)[n]) noexcept
     // NOLINTEND(modernize-avoid-c-arrays): see above
     {
+        if (!slot_.has_value())
+        {
+            return *this;
+        }
         const LogString value{std::forward<decltype(array)>(array)};
         return Log(value);
     }
@@ -81,7 +81,23 @@ bool Logger::IsLogEnabled(const LogLevel log_level) const noexcept
 
 bool Logger::IsEnabled(const LogLevel log_level) const noexcept
 {
-    return score::mw::log::detail::Runtime::GetRecorder().IsLogEnabled(log_level, context_.GetStringView());
+    if (!IsLogLevelCompiledIn(log_level))
+    {
+        return false;
+    }
+
+    //  Reading the generation before asking the recorder ensures that an answer of a replaced recorder is never cached
+    //  under the generation of its successor.
+    const auto generation = score::mw::log::detail::Runtime::GetRecorderGeneration();
+    const auto cached = enabled_levels_.Find(log_level, generation);
+    if (cached.has_value())
+    {
+        return cached.value();
+    }
+    const auto is_enabled =
+        score::mw::log::detail::Runtime::GetRecorder().IsLogEnabled(log_level, context_.GetStringView());
+    enabled_levels_.Store(log_level, generation, is_enabled);
+    return is_enabled;
 }
 
 std::string_view Logger::GetContext() const noexcept
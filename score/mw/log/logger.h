@@ -17,8 +17,11 @@
 
 #include <string_view>
 
+#include "score/mw/log/detail/log_level_cache.h"
 #include "score/mw/log/detail/logging_identifier.h"
 
+#include <tuple>
+
 namespace score
 {
 namespace mw
@@ -112,10 +115,39 @@ class Logger final
     /// \details See also AUTOSAR_SWS_LogAndTrace R20-11, Section 8.3.2.7
     bool IsEnabled(const LogLevel) const noexcept;
 
+    /// \brief Invokes log_statement with a LogStream only if kLogLevel is enabled for the current context.
+    /// \public
+    /// \thread-safe
+    ///
+    /// \details In contrast to `LogDebug() << Expensive()` the arguments of a disabled statement are not evaluated.
+    /// Levels above kCompileTimeLogLevel are removed at compile time, for all others the check is served from a cache
+    /// of this logger that is only filled by the recorder once per level, see IsEnabled().
+    /// \code
+    /// logger.LogIfEnabled<LogLevel::kDebug>([&data](LogStream& stream) { stream << Expensive(data); });
+    /// \endcode
+    template <LogLevel kLogLevel, typename LogStatement>
+    void LogIfEnabled(LogStatement&& log_statement) const noexcept
+    {
+        if constexpr (IsLogLevelCompiledIn(kLogLevel))
+        {
+            if (IsEnabled(kLogLevel))
+            {
+                auto stream = WithLevel(kLogLevel);
+                log_statement(stream);
+            }
+        }
+        else
+        {
+            std::ignore = log_statement;
+        }
+    }
+
     std::string_view GetContext() const noexcept;
 
   private:
     detail::LoggingIdentifier context_;
+    //  Filled on demand by IsEnabled(), the recorder answers are constant until another recorder is set.
+    mutable detail::LogLevelCache enabled_levels_;
 };
 
 score::mw::log::Logger& CreateLogger(const std::string_view context) noexcept;
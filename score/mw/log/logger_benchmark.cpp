@@ -0,0 +1,90 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/logger.h"
+#include "score/mw/log/logging.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace
+{
+
+//  Cost of log statements that do not produce a message. The recorder disables every level at runtime. Levels above
+//  the compile time threshold can be measured by building with e.g.
+//  --//score/mw/log/flags:KCompile_Time_Log_Level=info, the kDebug cases then show the cost of a removed statement.
+
+/// Argument whose evaluation is visible in the measurement, as it is for most real log statements.
+std::string Expensive(const std::int32_t value)
+{
+    return std::to_string(value) + " is the answer";
+}
+
+class LoggerFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State&) override
+    {
+        SetLogRecorder(&recorder_);
+    }
+
+    void TearDown(const benchmark::State&) override
+    {
+        SetLogRecorder(nullptr);
+    }
+
+  protected:
+    detail::EmptyRecorder recorder_{};
+    Logger logger_{"BNCH"};
+    std::int32_t value_{42};
+};
+
+BENCHMARK_F(LoggerFixture, IsEnabled)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(logger_.IsEnabled(LogLevel::kDebug));
+    }
+}
+
+BENCHMARK_F(LoggerFixture, DisabledStream)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        logger_.LogDebug() << value_ << Expensive(value_);
+    }
+}
+
+BENCHMARK_F(LoggerFixture, DisabledLogIfEnabled)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        logger_.LogIfEnabled<LogLevel::kDebug>([this](LogStream& stream) noexcept {
+            stream << value_ << Expensive(value_);
+        });
+        benchmark::ClobberMemory();
+    }
+}
+
+}  // namespace
+}  // namespace log
+}  // namespace mw
+}  // namespace score
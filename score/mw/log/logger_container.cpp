@@ -12,6 +12,8 @@
  ********************************************************************************/
 #include "score/mw/log/logger_container.h"
 
+#include <tuple>
+
 namespace score
 {
 namespace mw
@@ -24,24 +26,38 @@ namespace
 constexpr std::size_t kMaxLoggersSize{32U};
 }
 
-LoggerContainer::LoggerContainer() : stack_{kMaxLoggersSize}, default_logger_{score::mw::log::GetDefaultContextId()} {}
+LoggerContainer::LoggerContainer() : LoggerContainer{kMaxLoggersSize} {}
+
+LoggerContainer::LoggerContainer(const std::size_t max_number_of_loggers)
+    : stack_{max_number_of_loggers},
+      index_{max_number_of_loggers},
+      capacity_{max_number_of_loggers},
+      default_logger_{score::mw::log::GetDefaultContextId()}
+{
+}
 
 Logger& LoggerContainer::GetLogger(const std::string_view context) noexcept
 {
-    auto logger = FindExistingLogger(context);
+    //  Contexts are identified by their first LoggingIdentifier::kMaxLength characters, as in all log messages.
+    const detail::LoggingIdentifier identifier{context};
+    const auto logger = index_.Find(identifier);
 
     if (logger.has_value())
     {
         return logger.value();
     }
-    return InsertNewLogger(context);
+    return InsertNewLogger(context, identifier);
 }
 
-Logger& LoggerContainer::InsertNewLogger(const std::string_view context) noexcept
+Logger& LoggerContainer::InsertNewLogger(const std::string_view context,
+                                         const detail::LoggingIdentifier& identifier) noexcept
 {
     const auto result = stack_.TryPush(Logger{context});
     if (result.has_value())
     {
+        //  Fails only if another thread inserted the same context concurrently. Both loggers log under the same
+        //  context, so returning either of them is fine.
+        std::ignore = index_.TryInsert(identifier, result.value());
         return result.value();
     }
     // Returning address of non-static private class member is justified by
@@ -51,17 +67,9 @@ Logger& LoggerContainer::InsertNewLogger(const std::string_view context) noexcep
     return default_logger_;
 }
 
-score::cpp::optional<std::reference_wrapper<Logger>> LoggerContainer::FindExistingLogger(
-    const std::string_view context) noexcept
-{
-    return stack_.Find([context](const Logger& logger) noexcept {
-        return logger.GetContext() == context;
-    });
-}
-
 size_t LoggerContainer::GetCapacity() const noexcept
 {
-    return kMaxLoggersSize;
+    return capacity_;
 }
 
 Logger& LoggerContainer::GetDefaultLogger() noexcept
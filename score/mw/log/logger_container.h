@@ -13,6 +13,7 @@
 #ifndef SCORE_MW_LOG_LOGGER_CONTAINER_H
 #define SCORE_MW_LOG_LOGGER_CONTAINER_H
 
+#include "score/mw/log/detail/logging_identifier_index.h"
 #include "score/mw/log/detail/wait_free_stack/wait_free_stack.h"
 #include "score/mw/log/logger.h"
 #include "score/mw/log/slot_handle.h"
@@ -29,6 +30,10 @@ class LoggerContainer final
   public:
     explicit LoggerContainer();
 
+    /// \brief Creates a container for up to max_number_of_loggers loggers besides the default logger.
+    /// \details All memory is allocated on construction.
+    explicit LoggerContainer(const std::size_t max_number_of_loggers);
+
     Logger& GetLogger(const std::string_view context) noexcept;
 
     size_t GetCapacity() const noexcept;
@@ -36,10 +41,12 @@ class LoggerContainer final
     Logger& GetDefaultLogger() noexcept;
 
   private:
-    Logger& InsertNewLogger(const std::string_view context) noexcept;
+    Logger& InsertNewLogger(const std::string_view context, const detail::LoggingIdentifier& identifier) noexcept;
 
-    score::cpp::optional<std::reference_wrapper<Logger>> FindExistingLogger(const std::string_view context) noexcept;
     detail::WaitFreeStack<Logger, memory::shared::AtomicIndirectorReal> stack_;
+    //  Resolves a context in constant time, the loggers themselves are owned by stack_.
+    detail::LoggingIdentifierIndex<Logger> index_;
+    std::size_t capacity_;
     Logger default_logger_;
 };
 
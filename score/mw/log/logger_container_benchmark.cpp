@@ -0,0 +1,89 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/wait_free_stack/wait_free_stack.h"
+#include "score/mw/log/logger_container.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace
+{
+
+/// Distinct four character contexts "C000", "C001", ...
+std::vector<std::string> MakeContexts(const std::size_t number_of_contexts)
+{
+    std::vector<std::string> contexts{};
+    for (std::size_t i{0U}; i < number_of_contexts; ++i)
+    {
+        auto number = std::to_string(i);
+        contexts.push_back("C" + std::string(3U - std::min(number.size(), std::size_t{3U}), '0') + number);
+    }
+    return contexts;
+}
+
+/// Looks up all existing contexts in turn.
+void GetExistingLogger(benchmark::State& state)
+{
+    const auto contexts = MakeContexts(static_cast<std::size_t>(state.range(0)));
+    LoggerContainer unit{contexts.size()};
+    for (const auto& context : contexts)
+    {
+        benchmark::DoNotOptimize(&unit.GetLogger(context));
+    }
+
+    std::size_t next{0U};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(&unit.GetLogger(contexts[next]));
+        next = (next + 1U == contexts.size()) ? 0U : next + 1U;
+    }
+}
+
+/// Reference: the linear search over the push-only storage that resolved contexts before the hashed index.
+void LinearFindExistingLogger(benchmark::State& state)
+{
+    const auto contexts = MakeContexts(static_cast<std::size_t>(state.range(0)));
+    detail::WaitFreeStack<Logger> stack{contexts.size()};
+    for (const auto& context : contexts)
+    {
+        benchmark::DoNotOptimize(stack.TryPush(Logger{context}));
+    }
+
+    std::size_t next{0U};
+    for (auto _ : state)
+    {
+        const std::string_view context{contexts[next]};
+        benchmark::DoNotOptimize(stack.Find([context](const Logger& logger) noexcept {
+            return logger.GetContext() == context;
+        }));
+        next = (next + 1U == contexts.size()) ? 0U : next + 1U;
+    }
+}
+
+BENCHMARK(GetExistingLogger)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(LinearFindExistingLogger)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace log
+}  // namespace mw
+}  // namespace score
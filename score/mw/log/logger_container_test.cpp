@@ -17,7 +17,9 @@
 #include "score/mw/log/logging.h"
 #include "score/mw/log/recorder_mock.h"
 
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include <thread>
@@ -102,6 +104,49 @@ TEST(LoggerContainerTests, WhenLoggerContainerIsFullShallGetDefaultContextWhenNe
     EXPECT_EQ(unit.GetLogger(inserted_context).GetContext(), inserted_context);
 }
 
+TEST(LoggerContainerTests, ContextsThatShareTheirIdentifierShallShareOneLogger)
+{
+    RecordProperty("ParentRequirement", "SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that contexts longer than four characters are resolved by their logging identifier.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+    LoggerContainer unit{2U};
+
+    // Given a logger was created for a context that is cropped to its first four characters
+    const Logger& logger = unit.GetLogger("MYCTX_LONG");
+
+    // Then a context with the same first four characters returns the same logger without taking more capacity
+    EXPECT_EQ(&unit.GetLogger("MYCT"), &logger);
+    EXPECT_EQ(&unit.GetLogger("MYCTX_LONG"), &logger);
+    EXPECT_EQ(unit.GetLogger("OTHR").GetContext(), std::string_view{"OTHR"});
+    EXPECT_EQ(unit.GetLogger("FULL").GetContext(), kDefaultContext);
+}
+
+TEST(LoggerContainerTests, ContainerShallHoldTheRequestedNumberOfLoggers)
+{
+    RecordProperty("ParentRequirement", "SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that every logger of a large container is found again.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+    constexpr std::size_t kCapacity{1000U};
+    LoggerContainer unit{kCapacity};
+    EXPECT_EQ(unit.GetCapacity(), kCapacity);
+
+    std::vector<const Logger*> loggers{};
+    for (std::size_t i = 0U; i < kCapacity; i++)
+    {
+        loggers.push_back(&unit.GetLogger(std::to_string(i)));
+    }
+    for (std::size_t i = 0U; i < kCapacity; i++)
+    {
+        EXPECT_EQ(&unit.GetLogger(std::to_string(i)), loggers[i]);
+    }
+    EXPECT_EQ(unit.GetLogger(kContext1).GetContext(), kDefaultContext);
+}
+
 void LoggerRequester1(LoggerContainer& logger_container)
 {
     EXPECT_EQ(logger_container.GetLogger(kContext1).GetContext(), kContext1);
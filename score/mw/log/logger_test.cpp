@@ -183,6 +183,93 @@ TEST_F(BasicLoggerFixture, CheckThatIsLogEnabledReturnsCorrectValue)
     EXPECT_TRUE(unit.IsLogEnabled(LogLevel::kWarn));
 }
 
+TEST_F(BasicLoggerFixture, IsEnabledShallAskTheRecorderOnlyOncePerLevel)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verify that the enabled log levels are cached until another recorder is set.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given the recorder is asked exactly once per level
+    EXPECT_CALL(recorder_mock, IsLogEnabled(LogLevel::kInfo, kContext)).WillOnce(Return(true));
+    EXPECT_CALL(recorder_mock, IsLogEnabled(LogLevel::kDebug, kContext)).WillOnce(Return(false));
+
+    // Expect that repeated checks return the answers of the recorder
+    EXPECT_TRUE(unit.IsEnabled(LogLevel::kInfo));
+    EXPECT_FALSE(unit.IsEnabled(LogLevel::kDebug));
+    EXPECT_TRUE(unit.IsEnabled(LogLevel::kInfo));
+    EXPECT_FALSE(unit.IsLogEnabled(LogLevel::kDebug));
+}
+
+TEST_F(BasicLoggerFixture, SettingRecorderShallInvalidateCachedLevels)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verify that a newly set recorder is asked again for the enabled log levels.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    RecorderMock other_recorder_mock{};
+    EXPECT_CALL(recorder_mock, IsLogEnabled(LogLevel::kInfo, kContext)).WillOnce(Return(true));
+    EXPECT_CALL(other_recorder_mock, IsLogEnabled(LogLevel::kInfo, kContext)).WillOnce(Return(false));
+
+    // Given the level was cached for the first recorder
+    EXPECT_TRUE(unit.IsEnabled(LogLevel::kInfo));
+
+    // When another recorder is set
+    score::mw::log::SetLogRecorder(&other_recorder_mock);
+
+    // Then the new recorder decides
+    EXPECT_FALSE(unit.IsEnabled(LogLevel::kInfo));
+
+    score::mw::log::SetLogRecorder(&recorder_mock);
+}
+
+TEST_F(BasicLoggerFixture, LogIfEnabledShallNotEvaluateDisabledStatement)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verify that the statement of a disabled log level is neither invoked nor recorded.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given the level is disabled
+    EXPECT_CALL(recorder_mock, IsLogEnabled(LogLevel::kDebug, kContext)).WillOnce(Return(false));
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kDebug)).Times(0);
+
+    // When logging a statement of this level
+    bool invoked{false};
+    unit.LogIfEnabled<LogLevel::kDebug>([&invoked](LogStream&) noexcept {
+        invoked = true;
+    });
+
+    // Then the statement is not invoked
+    EXPECT_FALSE(invoked);
+}
+
+TEST_F(BasicLoggerFixture, LogIfEnabledShallRecordEnabledStatement)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verify that the statement of an enabled log level is recorded.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given the level is enabled
+    EXPECT_CALL(recorder_mock, IsLogEnabled(LogLevel::kError, kContext)).WillOnce(Return(true));
+
+    // Expect the statement to be recorded
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kError)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogInt32(kHandle, 42)).Times(1);
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle)).Times(1);
+
+    // When logging a statement of this level
+    unit.LogIfEnabled<LogLevel::kError>([](LogStream& stream) noexcept {
+        stream << std::int32_t{42};
+    });
+}
+
 TEST(CreateLoggerGetContext, CreateLoggerWithNeededContext)
 {
     RecordProperty("ParentRequirement", "SCR-1016719");
@@ -18,6 +18,9 @@
 
 #include "score/utils/meyer_singleton/meyer_singleton.h"
 
+#include <atomic>
+#include <tuple>
+
 namespace score
 {
 namespace mw
@@ -27,6 +30,11 @@ namespace log
 namespace detail
 {
 
+namespace
+{
+std::atomic<std::uint32_t> recorder_generation{0U};
+}  // namespace
+
 Runtime& Runtime::Instance(Recorder* const recorder, score::cpp::pmr::memory_resource* memory_resource) noexcept
 {
     return singleton::MeyerSingleton<Runtime>::GetInstance(recorder, memory_resource);
@@ -81,6 +89,12 @@ score::mw::log::LoggerContainer& Runtime::GetLoggerContainer() noexcept
 void Runtime::SetRecorder(Recorder* const recorder, score::cpp::pmr::memory_resource* memory_resource) noexcept
 {
     Instance(recorder, memory_resource).recorder_instance_ = recorder;
+    std::ignore = recorder_generation.fetch_add(1U, std::memory_order_release);
+}
+
+std::uint32_t Runtime::GetRecorderGeneration() noexcept
+{
+    return recorder_generation.load(std::memory_order_acquire);
 }
 
 }  // namespace detail
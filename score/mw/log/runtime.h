@@ -19,6 +19,8 @@
 
 #include <score/memory.hpp>
 
+#include <cstdint>
+
 namespace score
 {
 namespace mw
@@ -77,6 +79,12 @@ class Runtime final
 
     static Recorder& GetFallbackRecorder() noexcept;
 
+    /// \brief Returns a number that changes whenever SetRecorder() was called.
+    ///
+    /// \details Allows to cache answers of the recorder, e.g. the enabled log levels of a Logger, as long as the
+    /// generation did not change.
+    static std::uint32_t GetRecorderGeneration() noexcept;
+
     static score::mw::log::LoggerContainer& GetLoggerContainer() noexcept;
 
   private:
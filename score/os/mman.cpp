@@ -16,8 +16,17 @@
 
 #include <sys/mman.h>
 #include <cerrno>
+#include <climits>
 #include <type_traits>
 
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#endif
+
 /* KW_SUPPRESS_START:AUTOSAR.BUILTIN_NUMERIC:Char is used in respect to the wrapped function's signature */
 /* KW_SUPPRESS_START:MISRA.VAR.HIDDEN:Wrapper function is identifiable through namespace usage */
 namespace score
@@ -84,6 +93,89 @@ score::cpp::expected_blank<Error> MmanImpl::shm_unlink(const char* const pathnam
     }
     return {};
 }
+score::cpp::expected_blank<Error> MmanImpl::madvise(void* const addr,
+                                                const std::size_t length,
+                                                const Advice advice) const noexcept
+{
+    std::int32_t native_advice{};
+    switch (advice)
+    {
+        case Advice::kNormal:
+            native_advice = POSIX_MADV_NORMAL;
+            break;
+        case Advice::kWillNeed:
+            native_advice = POSIX_MADV_WILLNEED;
+            break;
+        case Advice::kSequential:
+            native_advice = POSIX_MADV_SEQUENTIAL;
+            break;
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        case Advice::kHugePage:
+            native_advice = MADV_HUGEPAGE;
+            break;
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#endif
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#if defined(__linux__) && defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+        case Advice::kPopulateRead:
+            native_advice = MADV_POPULATE_READ;
+            break;
+        case Advice::kPopulateWrite:
+            native_advice = MADV_POPULATE_WRITE;
+            break;
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#endif
+        default:
+            return score::cpp::make_unexpected(Error::createFromErrno(ENOTSUP));
+    }
+    // posix_madvise() does not know the Linux specific advice and returns the error instead of setting errno.
+    if (::madvise(addr, length, native_advice) == -1)
+    {
+        return score::cpp::make_unexpected(Error::createFromErrno());
+    }
+    return {};
+}
+
+score::cpp::expected_blank<Error> MmanImpl::mlock(const void* const addr, const std::size_t length) const noexcept
+{
+    if (::mlock(addr, length) == -1)
+    {
+        return score::cpp::make_unexpected(Error::createFromErrno());
+    }
+    return {};
+}
+
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#if defined(__linux__)
+score::cpp::expected_blank<Error> MmanImpl::mbind(void* const addr,
+                                              const std::size_t length,
+                                              const std::uint32_t numa_node) const noexcept
+{
+    using NodeMask = unsigned long;
+    constexpr std::uint32_t kNumberOfNodesInMask{sizeof(NodeMask) * CHAR_BIT};
+    if (numa_node >= kNumberOfNodesInMask)
+    {
+        return score::cpp::make_unexpected(Error::createFromErrno(EINVAL));
+    }
+    const NodeMask node_mask{1UL << numa_node};
+    // glibc offers no wrapper for mbind, libnuma only wraps the system call. The kernel expects the number of bits in
+    // the mask plus one.
+    // NOLINTNEXTLINE(score-banned-function) system call without libc wrapper
+    if (::syscall(SYS_mbind, addr, length, MPOL_BIND, &node_mask, kNumberOfNodesInMask + 1U, 0U) == -1)
+    {
+        return score::cpp::make_unexpected(Error::createFromErrno());
+    }
+    return {};
+}
+#else
+score::cpp::expected_blank<Error> MmanImpl::mbind(void* const, const std::size_t, const std::uint32_t) const noexcept
+{
+    return score::cpp::make_unexpected(Error::createFromErrno(ENOTSUP));
+}
+// coverity[autosar_cpp14_a16_0_1_violation], see rationale below
+#endif
+
 // Suppress "AUTOSAR C++14 A16-0-1" rule findings. This rule stated: "The pre-processor shall only be used for
 // unconditional and conditional file inclusion and include guards, and using the following directives: (1) #ifndef,
 // #ifdef, (3) #if, (4) #if defined, (5) #elif, (6) #else, (7) #define, (8) #endif, (9) #include.".
@@ -216,6 +308,19 @@ std::int32_t MmanImpl::MapFlagsToInteger(const Map flags) const noexcept
         /* KW_SUPPRESS_END:MISRA.BITS.NOT_UNSIGNED:Macro does not affect the sign of the result */
     }
 // coverity[autosar_cpp14_a16_0_1_violation], see above rationale
+#if defined(__linux__)
+    if (static_cast<utype_map>(flags & Map::kPopulate) != 0)
+    {
+        /* KW_SUPPRESS_START:MISRA.USE.EXPANSION: Using library-defined macro to ensure correct operation */
+        // NOLINTBEGIN(hicpp-signed-bitwise): macro does not affect the sign of the result.
+        // coverity[autosar_cpp14_m5_0_21_violation] macro does not affect the sign of the result.
+        map |= MAP_POPULATE;
+        // NOLINTEND(hicpp-signed-bitwise): macro does not affect the sign of the result.
+        /* KW_SUPPRESS_END:MISRA.USE.EXPANSION: Using library-defined macro to ensure correct operation */
+    }
+// coverity[autosar_cpp14_a16_0_1_violation], see above rationale
+#endif
+// coverity[autosar_cpp14_a16_0_1_violation], see above rationale
 #if defined(__QNX__)
     if (flags & Map::kPhys)
     {
@@ -62,8 +62,24 @@ class Mman : public ObjectSeam<Mman>
         kShared = 1,
         kPrivate = 2,
         kFixed = 4,
+        /// \brief Prefaults the mapping (MAP_POPULATE). Only supported on Linux, ignored otherwise.
+        kPopulate = 8,
         kPhys = 65536,
     };
+
+    /// \brief Usage advice for a mapped range, see madvise().
+    enum class Advice : std::int32_t
+    {
+        kNormal = 0,
+        kWillNeed = 1,
+        /// \brief Back the range with transparent huge pages (Linux only).
+        kHugePage = 2,
+        /// \brief Prefault the range for reading respectively writing (Linux 5.14 and newer).
+        kPopulateRead = 3,
+        kPopulateWrite = 4,
+        /// \brief Expect sequential reads, so that the pages are read ahead aggressively.
+        kSequential = 5,
+    };
 // Suppress "AUTOSAR C++14 A16-0-1" rule findings. This rule stated: "The pre-processor shall only be used for
 // unconditional and conditional file inclusion and include guards, and using the following directives: (1) #ifndef,
 // #ifdef, (3) #if, (4) #if defined, (5) #elif, (6) #else, (7) #define, (8) #endif, (9) #include.".
@@ -95,6 +111,23 @@ class Mman : public ObjectSeam<Mman>
 
     virtual score::cpp::expected_blank<Error> shm_unlink(const char* const pathname) const noexcept = 0;
 
+    /// \brief Gives the kernel advice how the range will be used. Advice which the platform does not support fails
+    /// with kOperationNotSupported.
+    virtual score::cpp::expected_blank<Error> madvise(void* const addr,
+                                               const std::size_t length,
+                                               const Advice advice) const noexcept = 0;
+
+    /// \brief Locks the range into RAM, which faults in all of its pages.
+    virtual score::cpp::expected_blank<Error> mlock(const void* const addr,
+                                             const std::size_t length) const noexcept = 0;
+
+    /// \brief Binds the memory of the range strictly to the given NUMA node (mbind() with MPOL_BIND).
+    /// \details Only supported on Linux for nodes below 64. Fails with kOperationNotSupported on other platforms and
+    /// with kInvalidArgument for higher nodes.
+    virtual score::cpp::expected_blank<Error> mbind(void* const addr,
+                                             const std::size_t length,
+                                             const std::uint32_t numa_node) const noexcept = 0;
+
 // coverity[autosar_cpp14_a16_0_1_violation], see above rationale
 #if defined(__EXT_POSIX1_200112)
     virtual score::cpp::expected<std::int32_t, Error> posix_typed_mem_open(const char* name,
@@ -139,6 +172,16 @@ class MmanImpl final : public Mman
 
     score::cpp::expected_blank<Error> shm_unlink(const char* const pathname) const noexcept override;
 
+    score::cpp::expected_blank<Error> madvise(void* const addr,
+                                       const std::size_t length,
+                                       const Advice advice) const noexcept override;
+
+    score::cpp::expected_blank<Error> mlock(const void* const addr, const std::size_t length) const noexcept override;
+
+    score::cpp::expected_blank<Error> mbind(void* const addr,
+                                     const std::size_t length,
+                                     const std::uint32_t numa_node) const noexcept override;
+
 // coverity[autosar_cpp14_a16_0_1_violation], see above rationale
 #if defined(__EXT_POSIX1_200112)
     score::cpp::expected<std::int32_t, Error> posix_typed_mem_open(const char* name,
@@ -39,6 +39,18 @@ class MmanMock : public Mman
                 (const char*, const Fcntl::Open, const Stat::Mode),
                 (const, noexcept, override));
     MOCK_METHOD(score::cpp::expected_blank<Error>, shm_unlink, (const char*), (const, noexcept, override));
+    MOCK_METHOD(score::cpp::expected_blank<Error>,
+                madvise,
+                (void*, const std::size_t, const Mman::Advice),
+                (const, noexcept, override));
+    MOCK_METHOD(score::cpp::expected_blank<Error>,
+                mlock,
+                (const void*, const std::size_t),
+                (const, noexcept, override));
+    MOCK_METHOD(score::cpp::expected_blank<Error>,
+                mbind,
+                (void*, const std::size_t, const std::uint32_t),
+                (const, noexcept, override));
 #if defined(__EXT_POSIX1_200112)
     MOCK_METHOD((score::cpp::expected<std::int32_t, Error>),
                 posix_typed_mem_open,
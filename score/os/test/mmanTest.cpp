@@ -16,6 +16,7 @@
 
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace score
 {
@@ -227,6 +228,69 @@ TEST(mmap, InfoTypedMemory)
 }
 #endif
 
+TEST(mmap, PopulatedMappingCanBeAdvisedAndLocked)
+{
+    RecordProperty("Verifies", "SCR-46010294");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "mmap Populated Mapping Can Be Advised And Locked");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    const char* name = "/test_mmap_advise";
+    const auto size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    auto fd = score::os::Mman::instance().shm_open(
+        name, Fcntl::Open::kCreate | Fcntl::Open::kReadWrite, Stat::Mode::kReadWriteExecUser);
+    ASSERT_TRUE(fd.has_value());
+    ASSERT_EQ(::ftruncate(fd.value(), static_cast<off_t>(size)), 0);
+
+    const auto result = score::os::Mman::instance().mmap(nullptr,
+                                                       size,
+                                                       Mman::Protection::kRead | Mman::Protection::kWrite,
+                                                       Mman::Map::kShared | Mman::Map::kPopulate,
+                                                       fd.value(),
+                                                       0);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(score::os::Mman::instance().madvise(result.value(), size, Mman::Advice::kWillNeed).has_value());
+    EXPECT_TRUE(score::os::Mman::instance().madvise(result.value(), size, Mman::Advice::kSequential).has_value());
+    EXPECT_TRUE(score::os::Mman::instance().mlock(result.value(), size).has_value());
+
+    EXPECT_TRUE(score::os::Mman::instance().munmap(result.value(), size).has_value());
+    ASSERT_EQ(close(fd.value()), 0);
+    ASSERT_TRUE(score::os::Mman::instance().shm_unlink(name).has_value());
+}
+
+TEST(mmap, MadviseFailsOnUnalignedAddress)
+{
+    RecordProperty("Verifies", "SCR-46010294");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "mmap Madvise Fails On Unaligned Address");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    void* unaligned_address = reinterpret_cast<void*>(0x1001);
+    const auto result = score::os::Mman::instance().madvise(unaligned_address, 1U, Mman::Advice::kNormal);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::Code::kInvalidArgument);
+}
+
+TEST(mmap, MbindFailsForNodeOutsideOfNodeMask)
+{
+    RecordProperty("Verifies", "SCR-46010294");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "mmap Mbind Fails For Node Outside Of Node Mask");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    // The node is checked before the range, so no mapping is needed
+    const auto result = score::os::Mman::instance().mbind(nullptr, 4096U, 64U);
+    ASSERT_FALSE(result.has_value());
+#if defined(__linux__)
+    EXPECT_EQ(result.error(), Error::Code::kInvalidArgument);
+#else
+    EXPECT_EQ(result.error(), Error::Code::kOperationNotSupported);
+#endif
+}
+
 TEST(mmap, DefaultShallReturnImplInstance)
 {
     RecordProperty("Verifies", "SCR-46010294");